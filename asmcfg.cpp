@@ -0,0 +1,69 @@
+#include "asmcfg.h"
+#include <algorithm>
+
+using namespace std;
+
+AsmCfg::AsmCfg(const AsmCode& code) {
+	const vector<AsmInstr>& cmds = code.m_commands;
+	size_t begin = 0;
+	for (size_t i = 0; i < cmds.size(); i++) {
+		bool is_label = cmds[i].kind == AsmInstr::LABEL;
+		if (is_label && i > begin) {
+			blocks.push_back({begin, i, {}, {}});
+			begin = i;
+		}
+		if (is_label) {
+			m_labels[cmds[i].ops[0].name] = blocks.size();
+		}
+		if (cmds[i].kind == AsmInstr::CMD && is_jump(cmds[i].oc())) {
+			blocks.push_back({begin, i + 1, {}, {}});
+			begin = i + 1;
+		}
+	}
+	if (begin < cmds.size()) {
+		blocks.push_back({begin, cmds.size(), {}, {}});
+	}
+	for (size_t b = 0; b < blocks.size(); b++) {
+		/// the last command, comments skipped
+		size_t last = blocks[b].end;
+		while (last > blocks[b].begin && cmds[last - 1].kind == AsmInstr::COMMENT) {
+			last--;
+		}
+		Opcode oc = last > blocks[b].begin && cmds[last - 1].kind == AsmInstr::CMD ? cmds[last - 1].oc() : NONE;
+		if (is_jump(oc) && oc != RET && cmds[last - 1].count == 1 && cmds[last - 1].ops[0].is_label()) {
+			int target = block_of(cmds[last - 1].ops[0].name);
+			if (target != -1) {
+				m_edge(b, target);
+			}
+		}
+		if (oc != JMP && oc != RET && b + 1 < blocks.size()) {
+			m_edge(b, b + 1);
+		}
+	}
+}
+
+int AsmCfg::block_of(uint32_t label) const {
+	auto it = m_labels.find(label);
+	return it == m_labels.end() ? -1 : it->second;
+}
+
+bool AsmCfg::is_jump(Opcode oc) {
+	switch (oc) {
+	case JZ: case JNZ: case JMP:
+	case JE: case JGE: case JLE:
+	case JG: case JL: case JB:
+	case JBE: case JAE: case JNS:
+	case RET:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void AsmCfg::m_edge(int from, int to) {
+	vector<int>& succs = blocks[from].succs;
+	if (find(succs.begin(), succs.end(), to) == succs.end()) {
+		succs.push_back(to);
+		blocks[to].preds.push_back(from);
+	}
+}
@@ -0,0 +1,33 @@
+#ifndef ASMCFG_H
+#define ASMCFG_H
+
+#include <unordered_map>
+#include <vector>
+#include "asmcode.h"
+
+struct AsmBlock {
+	/// commands [begin, end) of the code
+	size_t begin;
+	size_t end;
+	std::vector<int> preds;
+	std::vector<int> succs;
+};
+
+/// Basic blocks of the commands of an AsmCode, numbered in the order of the code.
+/// A block starts at a label or after a jump or ret, a call falls through.
+/// A jump has the block of its label as a successor if the label is in the code,
+/// a conditional jump and a block ending without a jump have the next block too.
+class AsmCfg {
+public:
+	AsmCfg(const AsmCode&);
+	std::vector<AsmBlock> blocks;
+	/// block starting at the label, -1 if it is not in the code
+	int block_of(uint32_t label) const;
+	/// jumps and ret, the commands ending a block
+	static bool is_jump(Opcode);
+private:
+	std::unordered_map<uint32_t, int> m_labels;
+	void m_edge(int from, int to);
+};
+
+#endif // ASMCFG_H
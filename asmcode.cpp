@@ -1,4 +1,7 @@
 #include "asmcode.h"
+#include "asmwriter.h"
+#include <cstring>
+#include <sstream>
 
 using namespace std;
 
@@ -17,6 +20,7 @@ const std::map<Register, string> registers =
     {XMM1,	"xmm1"},
     {AL,	"al"},
     {CL,	"cl"},
+    {R8,	"r8"},
     {R9,	"r9"},
 	{R10,	"r10"},
 	{R11,	"r11"},
@@ -24,6 +28,38 @@ const std::map<Register, string> registers =
 	{R13,	"r13"},
 	{R14,	"r14"},
 	{R15,	"r15"},
+	{XMM2,	"xmm2"},
+	{XMM3,	"xmm3"},
+	{XMM4,	"xmm4"},
+	{XMM5,	"xmm5"},
+	{XMM6,	"xmm6"},
+	{XMM7,	"xmm7"},
+	{XMM8,	"xmm8"},
+	{XMM9,	"xmm9"},
+	{XMM10,	"xmm10"},
+	{XMM11,	"xmm11"},
+	{XMM12,	"xmm12"},
+	{XMM13,	"xmm13"},
+	{XMM14,	"xmm14"},
+	{XMM15,	"xmm15"},
+	{YMM0,	"ymm0"},
+	{YMM1,	"ymm1"},
+	{YMM2,	"ymm2"},
+	{YMM3,	"ymm3"},
+	{YMM4,	"ymm4"},
+	{YMM5,	"ymm5"},
+	{YMM6,	"ymm6"},
+	{YMM7,	"ymm7"},
+	{YMM8,	"ymm8"},
+	{YMM9,	"ymm9"},
+	{YMM10,	"ymm10"},
+	{YMM11,	"ymm11"},
+	{YMM12,	"ymm12"},
+	{YMM13,	"ymm13"},
+	{YMM14,	"ymm14"},
+	{YMM15,	"ymm15"},
+	{DIL,	"dil"},
+	{RIP,	"rip"},
 };
 const string reg_prefix = "%";
 const string imm_prefix = "$";
@@ -65,6 +101,19 @@ const std::map<Opcode, string> opcodes =
     {XORPD,	"xorpd"},
     {SHLQ,	"shlq"},
     {SHRQ,	"shrq"},
+    {SARQ,	"sarq"},
+    {ANDQ,	"andq"},
+    {ORQ,	"orq"},
+    {MULQ,	"mulq"},
+    {INCQ,	"incq"},
+    {DECQ,	"decq"},
+    {BTSQ,	"btsq"},
+    {SHRDQ,	"shrdq"},
+    {MOVABSQ,	"movabsq"},
+    {MOVB,	"movb"},
+    {ADDB,	"addb"},
+    {TESTB,	"testb"},
+    {SYSCALL,	"syscall"},
     {MOV,	"mov"},
     {JZ,	"jz"},
     {JNZ,	"jnz"},
@@ -74,59 +123,181 @@ const std::map<Opcode, string> opcodes =
     {JLE,	"jle"},
     {JG,	"jg"},
     {JL,	"jl"},
+    {JB,	"jb"},
+    {JBE,	"jbe"},
+    {JAE,	"jae"},
+    {JNS,	"jns"},
     {TESTQ,	"testq"},
+    {MOVUPD,	"movupd"},
+    {MOVDQU,	"movdqu"},
+    {MOVAPD,	"movapd"},
+    {MOVDQA,	"movdqa"},
+    {ADDPD,	"addpd"},
+    {SUBPD,	"subpd"},
+    {MULPD,	"mulpd"},
+    {DIVPD,	"divpd"},
+    {PADDQ,	"paddq"},
+    {PSUBQ,	"psubq"},
+    {PXOR,	"pxor"},
+    {UNPCKLPD,	"unpcklpd"},
+    {PUNPCKLQDQ,	"punpcklqdq"},
+    {VMOVUPD,	"vmovupd"},
+    {VMOVDQU,	"vmovdqu"},
+    {VMOVAPD,	"vmovapd"},
+    {VMOVDQA,	"vmovdqa"},
+    {VADDPD,	"vaddpd"},
+    {VSUBPD,	"vsubpd"},
+    {VMULPD,	"vmulpd"},
+    {VDIVPD,	"vdivpd"},
+    {VPADDQ,	"vpaddq"},
+    {VPSUBQ,	"vpsubq"},
+    {VXORPD,	"vxorpd"},
+    {VPXOR,	"vpxor"},
+    {VBROADCASTSD,	"vbroadcastsd"},
+    {VPBROADCASTQ,	"vpbroadcastq"},
+    {VZEROUPPER,	"vzeroupper"},
     {NONE,	""}
 };
 
 uint64_t AsmLabel::counter = 0;
+std::unordered_map<std::string, uint32_t> AsmNames::m_ids;
+std::deque<std::string> AsmNames::m_names;
 
-AsmLabel::AsmLabel() :
-    name(label_prefix + to_string(++counter))
+uint32_t AsmNames::id(const std::string& name) {
+	auto it = m_ids.find(name);
+	if (it != m_ids.end()) {
+		return it->second;
+	}
+	m_names.push_back(name);
+	return m_ids[name] = m_names.size() - 1;
+}
+
+const std::string& AsmNames::str(uint32_t id) {
+	return m_names[id];
+}
+
+AsmOp::AsmOp() :
+    kind(NONE), base(0), index(0), scale(0), name(no_name), value(0)
 {}
 
-AsmCmd::AsmCmd() :
-    m_opcode(NONE)
+AsmOp::AsmOp(Register a_register) :
+    kind(REG), base(a_register), index(0), scale(0), name(no_name), value(0)
 {}
 
-AsmCmd::AsmCmd(Opcode oc) :
-    m_opcode(oc)
+AsmOp::AsmOp(int64_t a_value) :
+    kind(IMM), base(0), index(0), scale(0), name(no_name), value(a_value)
 {}
 
-Opcode AsmCmd::oc() const {
-	return m_opcode;
+AsmOp::AsmOp(double a_value) :
+    kind(FLOAT), base(0), index(0), scale(0), name(no_name), value(0)
+{
+	memcpy(&value, &a_value, sizeof(value));
 }
 
-AsmComment::AsmComment(const std::string& str) :
-    AsmCmd(NONE), m_string(str)
+AsmOp::AsmOp(Syscall sc) :
+    AsmOp(AsmSyscall(syscalls.at(sc)))
 {}
 
-AsmImmInt::AsmImmInt(int64_t a_value) :
-    m_value(a_value)
+AsmOp::AsmOp(const AsmLabel& a_label) :
+    AsmOp(a_label.operand())
 {}
 
-AsmImmFloat::AsmImmFloat(double a_value) :
-    m_value(a_value)
-{}
+AsmOperandOffset::AsmOperandOffset(Register a_base) {
+	kind = MEM;
+	base = a_base;
+}
 
-AsmOperandOffset::AsmOperandOffset(Register reg) :
-    base(make_shared<AsmOperandReg>(reg))
-{}
+AsmOperandOffset::AsmOperandOffset(Register a_base, Register a_index, int64_t a_scale) {
+	kind = MEM;
+	base = a_base;
+	index = a_index;
+	scale = a_scale;
+}
+
+AsmOperandOffset::AsmOperandOffset(int64_t a_offset, Register a_base) {
+	kind = MEM;
+	base = a_base;
+	value = a_offset;
+}
+
+AsmOperandOffset::AsmOperandOffset(int64_t a_offset, Register a_base, Register a_index, int64_t a_scale) {
+	kind = MEM;
+	base = a_base;
+	index = a_index;
+	scale = a_scale;
+	value = a_offset;
+}
 
-AsmOperandOffset::AsmOperandOffset(Register a_base, Register a_index, int64_t a_scale) :
-    base(make_shared<AsmOperandReg>(a_base)), index(make_shared<AsmOperandReg>(a_index)), scale(make_shared<AsmRawInt>(a_scale))
+AsmOperandOffset::AsmOperandOffset(const AsmLabel& a_label, Register a_base) {
+	kind = MEM;
+	base = a_base;
+	name = AsmNames::id(a_label.name);
+}
+
+AsmLabel::AsmLabel() :
+    name(label_prefix + to_string(++counter))
 {}
 
-AsmRawInt::AsmRawInt(int64_t a_value) :
-    value(a_value)
+AsmInstr::AsmInstr() :
+    kind(CMD), count(0), opcode(NONE)
 {}
 
-void AsmCode::push_buf(PAsmCmd cmd) {
+Opcode AsmInstr::oc() const {
+	return opcode;
+}
+
+AsmCmd0::AsmCmd0(Opcode oc) {
+	opcode = oc;
+}
+
+AsmCmd1::AsmCmd1(Opcode oc, AsmOp a_operand) {
+	opcode = oc;
+	count = 1;
+	ops[0] = a_operand;
+}
+
+AsmCmd2::AsmCmd2(Opcode oc, AsmOp a_op1, AsmOp a_op2) {
+	opcode = oc;
+	count = 2;
+	ops[0] = a_op1;
+	ops[1] = a_op2;
+}
+
+AsmCmd3::AsmCmd3(Opcode oc, AsmOp a_op1, AsmOp a_op2, AsmOp a_op3) {
+	opcode = oc;
+	count = 3;
+	ops[0] = a_op1;
+	ops[1] = a_op2;
+	ops[2] = a_op3;
+}
+
+AsmComment::AsmComment(const std::string& str) {
+	kind = COMMENT;
+	ops[0].name = AsmNames::id(str);
+}
+
+void AsmCode::push_buf(const AsmInstr& cmd) {
 	m_commands.push_back(cmd);
 }
 
 void AsmCode::append(const AsmCode& other) {
 	m_commands.insert(m_commands.end(), other.m_commands.begin(), other.m_commands.end());
-	m_header_labels.insert(m_header_labels.end(), other.m_header_labels.begin(), other.m_header_labels.end());
+	append_data(other);
+}
+
+/// the same variable may be declared by a procedure and by its inlined copies
+void AsmCode::append_data(const AsmCode& other) {
+	for (PAsmLabel label: other.m_header_labels) {
+		add_data(label);
+	}
+}
+
+size_t AsmCode::size() const {
+	return m_commands.size();
+}
+
+void AsmCode::insert(size_t pos, const AsmInstr& cmd) {
+	m_commands.insert(m_commands.begin() + pos, cmd);
 }
 
 AsmCode& AsmCode::push_buf() {
@@ -163,123 +334,51 @@ PAsmLabel AsmCode::add_data(PAsmLabel a_label) {
 	return a_label;
 }
 
+/// the data is little beside the code, through a stream
 std::ostream& AsmCode::output(std::ostream& os) {
-	for (PAsmLabel label: m_header_labels) {
-		label->output(os);
-	}
-	for (PAsmCmd cmd: this->m_commands) {
-		cmd->output(os);
+	ostringstream header;
+	output_data(header);
+	AsmWriter writer(header.str().size() + 32 * m_commands.size());
+	writer.write(header.str());
+	writer.write(".text\n", 6);
+	for (const AsmInstr& cmd: this->m_commands) {
+		writer.write(cmd);
 	}
-	os << '\n';
+	writer.write("\n", 1);
+	writer.flush(os);
 	return os;
 }
 
-std::ostream& AsmCmd::output(std::ostream& os) {
-	return os << '\t' << opcodes.at(this->m_opcode) << '\n';
-}
-
-AsmOperandReg::AsmOperandReg(Register a_register) :
-    m_register(a_register)
-{}
-
-AsmCmd1::AsmCmd1(Opcode oc, PAsmOperand a_operand) :
-    AsmCmd(oc), operand(a_operand)
-{}
-
-AsmCmd1::AsmCmd1(Opcode oc, PAsmVar a_label) :
-    AsmCmd(oc), operand(a_label)
-{}
-
-AsmCmd1::AsmCmd1(Opcode oc, AsmVar a_label) :
-    AsmCmd(oc), operand(make_shared<AsmVar>(a_label))
-{}
-
-AsmCmd1::AsmCmd1(Opcode oc, Syscall sc) :
-    AsmCmd(oc), operand(make_shared<AsmSyscall>(syscalls.at(sc)))
-{}
-
-AsmCmd1::AsmCmd1(Opcode oc, Register a_register) :
-    AsmCmd(oc), operand(make_shared<AsmOperandReg>(a_register))
-{}
-
-AsmCmd1::AsmCmd1(Opcode oc, AsmLabel a_label) :
-    AsmCmd(oc), operand(make_shared<AsmLabel>(a_label))
-{}
-
-AsmCmd1::AsmCmd1(Opcode oc, AsmOperandOffset a_offs) :
-    AsmCmd(oc), operand(make_shared<AsmOperandOffset>(a_offs))
-{}
-
-AsmCmd1::AsmCmd1(Opcode oc, int64_t a_value) :
-    AsmCmd(oc), operand(make_shared<AsmImmInt>(a_value))
-{}
-
-AsmCmd1::AsmCmd1(Opcode oc, double a_value) :
-    AsmCmd(oc), operand(make_shared<AsmImmFloat>(a_value))
-{}
-
-AsmCmd2::AsmCmd2(Opcode oc, PAsmOperand a_op1, PAsmOperand a_op2) :
-	AsmCmd(oc), operand1(a_op1), operand2(a_op2)
-{}
-
-AsmCmd2::AsmCmd2(Opcode oc, Register a_register_1, Register a_register_2) :
-    AsmCmd(oc), operand1(make_shared<AsmOperandReg>(a_register_1)), operand2(make_shared<AsmOperandReg>(a_register_2))
-{}
-
-AsmCmd2::AsmCmd2(Opcode oc, PAsmVar a_var, Register a_register) :
-    AsmCmd(oc), operand1(a_var), operand2(make_shared<AsmOperandReg>(a_register))
-{}
-
-AsmCmd2::AsmCmd2(Opcode oc, AsmVar a_var, Register a_register) :
-    AsmCmd(oc), operand1(make_shared<AsmVar>(a_var)), operand2(make_shared<AsmOperandReg>(a_register))
-{}
-
-AsmCmd2::AsmCmd2(Opcode oc, Register a_register, AsmVar a_var) :
-    AsmCmd(oc), operand1(make_shared<AsmOperandReg>(a_register)), operand2(make_shared<AsmVar>(a_var))
-{}
-
-AsmCmd2::AsmCmd2(Opcode oc, AsmOffs a_offs, Register a_register) :
-    AsmCmd(oc), operand1(make_shared<AsmOffs>(a_offs)), operand2(make_shared<AsmOperandReg>(a_register))
-{}
-
-AsmCmd2::AsmCmd2(Opcode oc, int64_t a_value, AsmOffs a_offs) :
-    AsmCmd(oc), operand1(make_shared<AsmImmInt>(a_value)), operand2(make_shared<AsmOffs>(a_offs))
-{}
-
-AsmCmd2::AsmCmd2(Opcode oc, double a_var, Register a_register) :
-    AsmCmd(oc), operand1(make_shared<AsmImmFloat>(a_var)), operand2(make_shared<AsmOperandReg>(a_register))
-{}
-
-AsmCmd2::AsmCmd2(Opcode oc, int64_t a_var, Register a_register) :
-    AsmCmd(oc), operand1(make_shared<AsmImmInt>(a_var)), operand2(make_shared<AsmOperandReg>(a_register))
-{}
-
-AsmDirective::AsmDirective(Directive a_directive) :
-    AsmCmd(NONE), m_directive(a_directive)
-{}
-
-std::ostream& AsmCmd0::output(std::ostream& os) {
-	return os << '\t' << opcodes.at(this->m_opcode) << "\n";
+std::ostream& AsmCode::output_commands(std::ostream& os) {
+	AsmWriter writer(32 * m_commands.size());
+	for (const AsmInstr& cmd: this->m_commands) {
+		writer.write(cmd);
+	}
+	writer.flush(os);
+	return os;
 }
 
-std::ostream& AsmCmd1::output(std::ostream& os) {
-	return os << '\t' << opcodes.at(this->m_opcode) << "\t" << operand->str() << '\n';
+std::ostream& AsmCode::output_data(std::ostream& os) {
+	for (PAsmLabel label: m_header_labels) {
+		label->output(os);
+	}
+	return os;
 }
 
-std::ostream& AsmCmd2::output(std::ostream& os) {
-	return os << '\t' << opcodes.at(this->m_opcode) << "\t" << operand1->str() << ", " << operand2->str() << '\n';
+void AsmCode::clear() {
+	vector<AsmInstr>().swap(m_commands);
+	m_header_labels.clear();
 }
 
-std::ostream& AsmComment::output(std::ostream& os) {
-	return os << "// " + m_string + "\n";
+std::ostream& AsmInstr::output(std::ostream& os) const {
+	AsmWriter writer;
+	writer.write(*this);
+	writer.flush(os);
+	return os;
 }
 
-AsmCmd0::AsmCmd0(Opcode oc) :
-    AsmCmd(oc)
-{}
-
 AsmLabel::AsmLabel(const std::string& a_label) :
-    AsmCmd(NONE), name(a_label)
+    name(a_label)
 {}
 
 AsmVar::AsmVar(const std::string& a_name) :
@@ -314,6 +413,26 @@ AsmVarRecord::AsmVarRecord(const std::string& a_var, PSymTable a_st) :
     AsmVar(a_var), st(a_st), m_size(a_st->sizeb())
 {}
 
+AsmVarBss::AsmVarBss(const std::string& a_name, uint a_size) :
+    AsmVar(a_name), size(a_size)
+{}
+
+int64_t AsmVarInt::value() const {
+	return m_value;
+}
+
+double AsmVarFloat::value() const {
+	return m_value;
+}
+
+uint AsmVarArray::size() const {
+	return m_size*m_element_size;
+}
+
+uint AsmVarRecord::size() const {
+	return m_size;
+}
+
 uint AsmVarArray::_m_size() const {
 	uint result = 1;
 	for (const pair<int, int>& p: this->m_bounds) {
@@ -342,6 +461,10 @@ std::ostream& AsmVarRecord::output(std::ostream& os) {
 	return os << ".data\n\t" << name << ": .fill " << this->m_size << ",1,0\n";
 }
 
+std::ostream& AsmVarBss::output(std::ostream& os) {
+	return os << "\t.lcomm " << name << ", " << size << "\n";
+}
+
 std::ostream& AsmLabel::output(std::ostream& os) {
 	return os << name + ":\n";
 }
@@ -358,182 +481,116 @@ std::ostream& AsmGlobl::output(std::ostream& os) {
 	return os << "\t.globl " << name << '\n';
 }
 
-AsmCode& operator<<(AsmCode& ac, PAsmCmd cmd) {
-	ac.push_buf(cmd);
-	return ac;
-}
-
-std::string AsmOperandReg::str() const {
-	return reg_prefix + registers.at(m_register);
+AsmOp AsmLabel::operand() const {
+	AsmOp op;
+	op.kind = AsmOp::LABEL;
+	op.name = AsmNames::id(name);
+	return op;
 }
 
-std::string AsmOperandImm::str() const {
-	return "";
+AsmOp AsmVar::operand() const {
+	AsmOp op = AsmLabel::operand();
+	op.kind = AsmOp::VAR;
+	return op;
 }
 
-std::string AsmVar::str() const {
-	return name;
+AsmOp AsmSyscall::operand() const {
+	AsmOp op = AsmLabel::operand();
+	op.kind = AsmOp::SYSCALL;
+	return op;
 }
 
-std::string AsmSyscall::str() const {
-	return name;
+AsmInstr AsmLabel::line() const {
+	AsmInstr line;
+	line.kind = AsmInstr::LABEL;
+	line.ops[0] = AsmLabel::operand();
+	return line;
 }
 
-std::string AsmImmInt::str() const {
-	return imm_prefix + to_string(m_value);
-}
-
-std::string AsmImmFloat::str() const {
-	return imm_prefix + to_string(m_value);
-}
-
-std::string AsmRawInt::str() const {
-	return to_string(value);
-}
-
-std::string AsmLabel::str() const {
-	return name;
-}
-
-Register AsmOperandReg::reg() const {
-	return m_register;
-}
-
-int64_t AsmImmInt::value() const {
-	return m_value;
-}
-
-double AsmImmFloat::value() const {
-	return m_value;
-}
-
-std::string AsmOperandOffset::str() const {
-	return (offset ? offset->str() : "") +
-	        "(" + base->str() +
-	            (index ? ("," + index->str() +
-	                     (scale ? ("," + scale->str()) : ""))
-	                     : "")
-	        + ")";
-}
-
-
-bool AsmOperandReg      ::equals(PAsmOperand oprd) const {return oprd->equals(*this);}
-bool AsmOperandImm      ::equals(PAsmOperand oprd) const {return oprd->equals(*this);}
-bool AsmImmInt          ::equals(PAsmOperand oprd) const {return oprd->equals(*this);}
-bool AsmImmFloat        ::equals(PAsmOperand oprd) const {return oprd->equals(*this);}
-bool AsmOperandOffset   ::equals(PAsmOperand oprd) const {return oprd->equals(*this);}
-bool AsmRawInt          ::equals(PAsmOperand oprd) const {return oprd->equals(*this);}
-bool AsmOperandIndirect ::equals(PAsmOperand oprd) const {return oprd->equals(*this);}
-bool AsmLabel           ::equals(PAsmOperand oprd) const {return oprd->equals(*this);}
-
-bool AsmOperand::equals(const AsmOperandReg&)      const {return false;}
-bool AsmOperand::equals(const AsmOperandImm&)      const {return false;}
-bool AsmOperand::equals(const AsmImmInt&)          const {return false;}
-bool AsmOperand::equals(const AsmImmFloat&)        const {return false;}
-bool AsmOperand::equals(const AsmOperandOffset&)   const {return false;}
-bool AsmOperand::equals(const AsmRawInt&)          const {return false;}
-bool AsmOperand::equals(const AsmOperandIndirect&) const {return false;}
-bool AsmOperand::equals(const AsmLabel&)           const {return false;}
-bool AsmOperand::equals(PAsmOperand)               const {return false;}
-
-bool AsmOperandReg::equals(const AsmOperandReg& oprd) const {
-	return this->m_register == oprd.m_register;
-}
-
-bool AsmOperandImm::equals(const AsmOperandImm& oprd) const {
-	return false;
-}
-
-bool AsmImmInt::equals(const AsmImmInt& oprd) const {
-	return this->m_value == oprd.m_value;
-}
-
-bool AsmImmFloat::equals(const AsmImmFloat& oprd) const {
-	return this->m_value == oprd.m_value;
-}
-
-bool AsmOperandOffset::equals(const AsmOperandOffset& oprd) const {
-	return
-			this->base->equals(oprd.base) &&
-			((!this->index  && !oprd.index ) || (this->index  && oprd.index && this->index->equals(oprd.index))) &&
-			((!this->scale  && !oprd.scale ) || (this->scale  && oprd.scale && this->scale->equals(oprd.scale))) &&
-			((!this->offset && !oprd.offset) || (this->offset && oprd.offset && this->offset->equals(oprd.offset)));
+AsmCode& operator<<(AsmCode& ac, const AsmInstr& cmd) {
+	ac.push_buf(cmd);
+	return ac;
 }
 
-bool AsmRawInt::equals(const AsmRawInt& oprd) const {
-	return this->value == oprd.value;
+AsmCode& operator<<(AsmCode& ac, const AsmLabel& label) {
+	ac.push_buf(label.line());
+	return ac;
 }
 
-bool AsmOperandIndirect::equals(const AsmOperandIndirect& oprd) const {
-	return false;
+std::string AsmOp::str() const {
+	switch (kind) {
+	case REG:
+		return reg_prefix + registers.at(reg());
+	case IMM:
+		return imm_prefix + to_string(value);
+	case FLOAT:
+		return imm_prefix + to_string(float_value());
+	case MEM:
+		return (name != no_name ? name_str() : value ? to_string(value) : "") +
+		        "(" + reg_prefix + registers.at(reg()) +
+		            (scale ? "," + reg_prefix + registers.at(index_reg()) + "," + to_string(scale) : "")
+		        + ")";
+	case LABEL:
+	case VAR:
+	case SYSCALL:
+		return name_str();
+	default:
+		return "";
+	}
 }
 
-bool AsmLabel::equals(const AsmLabel& oprd) const {
-	return this->name == oprd.name;
+bool AsmOp::operator==(const AsmOp& op) const {
+	if (is_label() && op.is_label()) {
+		return name == op.name;
+	}
+	if (kind != op.kind) {
+		return false;
+	}
+	switch (kind) {
+	case REG:
+		return base == op.base;
+	case IMM:
+		return value == op.value;
+	case FLOAT:
+		return float_value() == op.float_value();
+	case MEM:
+		return base == op.base && scale == op.scale && (!scale || index == op.index) &&
+		       value == op.value && name == op.name;
+	default:
+		return true;
+	}
 }
 
-bool operator==(PAsmOperand opr1, PAsmOperand opr2) {
-	return opr1->equals(opr2);
+bool AsmOp::operator!=(const AsmOp& op) const {
+	return !(*this == op);
 }
 
-bool operator!=(PAsmOperand opr1, PAsmOperand opr2) {
-	return !(opr1->equals(opr2));
+bool AsmOp::operator==(Register reg) const {
+	return kind == REG && base == reg;
 }
 
-bool operator==(PAsmOperand opr, Register reg) {
-	PAsmOperandReg r = dynamic_pointer_cast<AsmOperandReg>(opr);
-	return r && r->reg() == reg;
+bool AsmOp::operator!=(Register reg) const {
+	return !(*this == reg);
 }
 
-bool operator!=(PAsmOperand opr, Register reg) {
-	return !(opr == reg);
+bool AsmOp::is_label() const {
+	return kind == LABEL || kind == VAR || kind == SYSCALL;
 }
 
-bool operator==(PAsmCmd cmd, Opcode opc) {
-	PAsmCmd1 acd1 = dynamic_pointer_cast<AsmCmd1>(cmd);
-	if (acd1) {
-		if (acd1 == opc) {
-			return true;
-		}
-		return false;
-	}
-	PAsmCmd2 acd2 = dynamic_pointer_cast<AsmCmd2>(cmd);
-	if (acd2) {
-		if (acd2 == opc) {
-			return true;
-		}
-		return false;
-	}
-	PAsmCmd0 acd0 = dynamic_pointer_cast<AsmCmd0>(cmd);
-	if (acd0) {
-		if (acd0 == opc) {
-			return true;
-		}
-		return false;
-	}
-	return false;
+Register AsmOp::reg() const {
+	return (Register)base;
 }
 
-bool operator==(PAsmCmd0 op, Opcode opc) {
-	return op->oc() == opc;
+Register AsmOp::index_reg() const {
+	return (Register)index;
 }
 
-bool operator==(PAsmCmd1 op, Opcode opc) {
-	return op->oc() == opc;
+double AsmOp::float_value() const {
+	double result;
+	memcpy(&result, &value, sizeof(result));
+	return result;
 }
 
-bool operator==(PAsmCmd2 op, Opcode opc) {
-	return op->oc() == opc;
+const std::string& AsmOp::name_str() const {
+	return AsmNames::str(name);
 }
-
-
-
-
-
-
-
-
-
-
-
-
@@ -10,6 +10,8 @@
 #include <memory>
 #include <algorithm>
 #include <map>
+#include <type_traits>
+#include <unordered_map>
 #include "symboltable.h"
 
 const std::string var_prefix = ".__";
@@ -27,13 +29,46 @@ enum Register {
 	XMM1,
 	AL,
 	CL,
+	R8,
 	R9,
 	R10,
 	R11,
 	R12,
 	R13,
 	R14,
-	R15
+	R15,
+	XMM2,
+	XMM3,
+	XMM4,
+	XMM5,
+	XMM6,
+	XMM7,
+	XMM8,
+	XMM9,
+	XMM10,
+	XMM11,
+	XMM12,
+	XMM13,
+	XMM14,
+	XMM15,
+	YMM0,
+	YMM1,
+	YMM2,
+	YMM3,
+	YMM4,
+	YMM5,
+	YMM6,
+	YMM7,
+	YMM8,
+	YMM9,
+	YMM10,
+	YMM11,
+	YMM12,
+	YMM13,
+	YMM14,
+	YMM15,
+	DIL,
+	RIP
 };
 
 enum Opcode {
@@ -70,6 +105,19 @@ enum Opcode {
 	XORPD,
 	SHLQ,
 	SHRQ,
+	SARQ,
+	ANDQ,
+	ORQ,
+	MULQ,
+	INCQ,
+	DECQ,
+	BTSQ,
+	SHRDQ,
+	MOVABSQ,
+	MOVB,
+	ADDB,
+	TESTB,
+	SYSCALL,
 	MOV,
 	CALL,
 	RET,
@@ -81,9 +129,47 @@ enum Opcode {
 	JLE,
 	JG,
 	JL,
+	JB,
+	JBE,
+	JAE,
+	JNS,
 	TESTQ,
+	/// packed SSE2
+	MOVUPD,
+	MOVDQU,
+	MOVAPD,
+	MOVDQA,
+	ADDPD,
+	SUBPD,
+	MULPD,
+	DIVPD,
+	PADDQ,
+	PSUBQ,
+	PXOR,
+	UNPCKLPD,
+	PUNPCKLQDQ,
+	/// AVX/AVX2
+	VMOVUPD,
+	VMOVDQU,
+	VMOVAPD,
+	VMOVDQA,
+	VADDPD,
+	VSUBPD,
+	VMULPD,
+	VDIVPD,
+	VPADDQ,
+	VPSUBQ,
+	VXORPD,
+	VPXOR,
+	VBROADCASTSD,
+	VPBROADCASTQ,
+	VZEROUPPER,
 	NONE,
 };
+/// mnemonics as written
+extern const std::map<Opcode, std::string> opcodes;
+/// names without the prefix
+extern const std::map<Register, std::string> registers;
 
 enum Directive {
 	DATA,
@@ -93,108 +179,126 @@ enum Syscall {
 	PRINTF,
 };
 
-class AsmOperand {
+/// Names of labels and variables and the text of comments, a number each
+class AsmNames {
 public:
-	virtual std::string str() const = 0;
-	virtual bool equals(const AsmOperandReg&) const;
-	virtual bool equals(const AsmOperandImm&) const;
-	virtual bool equals(const AsmImmInt&) const;
-	virtual bool equals(const AsmImmFloat&) const;
-	virtual bool equals(const AsmOperandOffset&) const;
-	virtual bool equals(const AsmRawInt&) const;
-	virtual bool equals(const AsmOperandIndirect&) const;
-	virtual bool equals(const AsmLabel&) const;
-	virtual bool equals(PAsmOperand) const;
+	static uint32_t id(const std::string&);
+	static const std::string& str(uint32_t);
+private:
+	static std::unordered_map<std::string, uint32_t> m_ids;
+	/// a deque, the names stay where they are
+	static std::deque<std::string> m_names;
 };
 
-class AsmOperandReg : public AsmOperand {
-public:
-	AsmOperandReg(Register);
-	std::string str() const override;
+/// An operand held by value: a register, an immediate, memory as disp(base,index,scale) where
+/// the displacement is a number or a label, or a label, variable or syscall by the number of its name.
+struct AsmOp {
+	enum Kind : uint8_t {
+		NONE,
+		REG,
+		IMM,
+		FLOAT,
+		MEM,
+		LABEL,
+		VAR,
+		SYSCALL,
+	};
+	static const uint32_t no_name = UINT32_MAX;
+	AsmOp();
+	AsmOp(Register);
+	AsmOp(int64_t);
+	AsmOp(double);
+	AsmOp(Syscall);
+	AsmOp(const AsmLabel&);
+	template <class TAsmLabel>
+	AsmOp(const std::shared_ptr<TAsmLabel>& label) : AsmOp(*label) {}
+	std::string str() const;
+	/// the same operand, labels of any kind the same by their names
+	bool operator==(const AsmOp&) const;
+	bool operator!=(const AsmOp&) const;
+	bool operator==(Register) const;
+	bool operator!=(Register) const;
+	/// LABEL, VAR or SYSCALL
+	bool is_label() const;
 	Register reg() const;
-	bool equals(PAsmOperand) const override;
-	bool equals(const AsmOperandReg&) const override;
-private:
-	Register m_register;
+	Register index_reg() const;
+	double float_value() const;
+	const std::string& name_str() const;
+	Kind kind;
+	/// the register of REG, the base of MEM
+	uint8_t base;
+	/// of MEM, the scale is 0 without an index
+	uint8_t index;
+	uint8_t scale;
+	/// of a label and of MEM displaced by a label
+	uint32_t name;
+	/// of IMM, the displacement of MEM, the bits of FLOAT
+	int64_t value;
 };
 
-class AsmOperandImm : public AsmOperand {
-public:
-	std::string str() const override;
-	bool equals(PAsmOperand) const override;
-	bool equals(const AsmOperandImm&) const override;
+struct AsmOperandOffset : public AsmOp {
+	AsmOperandOffset(Register);
+	AsmOperandOffset(Register, Register, int64_t);
+	AsmOperandOffset(int64_t, Register);
+	AsmOperandOffset(int64_t, Register, Register, int64_t);
+	/// label(%rip) and the like
+	AsmOperandOffset(const AsmLabel&, Register);
 };
+typedef AsmOperandOffset AsmOffs;
 
-class AsmImmInt : public AsmOperandImm {
-public:
-	AsmImmInt(int64_t);
-	std::string str() const override;
-	int64_t value() const;
-	bool equals(PAsmOperand) const override;
-	bool equals(const AsmImmInt&) const override;
-private:
-	int64_t m_value;
+/// A line of the code held by value: a command, a label or a comment.
+/// A label has itself as the first operand, a comment its text as the name of it.
+struct AsmInstr {
+	enum Kind : uint8_t {
+		CMD,
+		LABEL,
+		COMMENT,
+	};
+	AsmInstr();
+	Opcode oc() const;
+	std::ostream& output(std::ostream&) const;
+	Kind kind;
+	uint8_t count;
+	Opcode opcode;
+	AsmOp ops[3];
 };
+static_assert(std::is_trivially_copyable<AsmInstr>::value, "AsmInstr is copied as bytes");
 
-class AsmImmFloat : public AsmOperandImm {
+/// commands of 0 to 3 operands, as the code is written
+class AsmCmd0 : public AsmInstr {
 public:
-	AsmImmFloat(double);
-	std::string str() const override;
-	double value() const;
-	bool equals(PAsmOperand) const override;
-	bool equals(const AsmImmFloat&) const override;
-private:
-	double m_value;
+	AsmCmd0(Opcode);
 };
 
-class AsmOperandOffset : public AsmOperand {
+class AsmCmd1 : public AsmInstr {
 public:
-	AsmOperandOffset(Register);
-	AsmOperandOffset(Register, Register, int64_t);
-	std::string str() const override;
-	bool equals(PAsmOperand) const override;
-	bool equals(const AsmOperandOffset&) const override;
-	PAsmOperand offset = nullptr;
-	PAsmOperandReg base = nullptr;
-	PAsmOperandReg index = nullptr;
-	PAsmRawInt scale = nullptr;
+	AsmCmd1(Opcode, AsmOp);
 };
-typedef AsmOperandOffset AsmOffs;
 
-class AsmRawInt : public AsmOperand {
+class AsmCmd2 : public AsmInstr {
 public:
-	AsmRawInt(int64_t);
-	std::string str() const override;
-	bool equals(PAsmOperand) const override;
-	bool equals(const AsmRawInt&) const override;
-	int64_t value;
+	AsmCmd2(Opcode, AsmOp, AsmOp);
 };
 
-class AsmOperandIndirect : public AsmOperand {
+class AsmCmd3 : public AsmInstr {
 public:
-	std::string str() const override;
-	bool equals(PAsmOperand) const override;
-	bool equals(const AsmOperandIndirect&) const override;
+	AsmCmd3(Opcode, AsmOp, AsmOp, AsmOp);
 };
 
-class AsmCmd {
+class AsmComment : public AsmInstr {
 public:
-	AsmCmd();
-	AsmCmd(Opcode);
-	virtual std::ostream& output(std::ostream&);
-	Opcode oc() const;
-protected:
-	Opcode m_opcode;
+	AsmComment(const std::string&);
 };
 
-class AsmLabel : public AsmCmd, public AsmOperand {
+class AsmLabel {
 public:
 	AsmLabel();
 	AsmLabel(const std::string&);
-	std::ostream& output(std::ostream&) override;
-	std::string str() const override;
-	bool equals(PAsmOperand) const override;
-	bool equals(const AsmLabel&) const override;
+	/// a definition of data, in the header
+	virtual std::ostream& output(std::ostream&);
+	virtual AsmOp operand() const;
+	/// where it is in the code, of any kind a plain label
+	AsmInstr line() const;
 	std::string name;
 protected:
 	static uint64_t counter;
@@ -204,14 +308,14 @@ class AsmVar : public AsmLabel {
 public:
 	AsmVar(const std::string&);
 	std::ostream& output(std::ostream&) override;
-	std::string str() const override;
+	AsmOp operand() const override;
 };
 
 class AsmSyscall : public AsmLabel {
 public:
 	AsmSyscall(const std::string&);
 	std::ostream& output(std::ostream&) override;
-	std::string str() const override;
+	AsmOp operand() const override;
 };
 
 class AsmGlobl : public AsmLabel {
@@ -231,6 +335,7 @@ class AsmVarInt : public AsmVar {
 public:
 	AsmVarInt(const std::string&, int64_t value = 0);
 	std::ostream& output(std::ostream&) override;
+	int64_t value() const;
 private:
 	int64_t m_value;
 };
@@ -239,6 +344,7 @@ class AsmVarFloat : public AsmVar {
 public:
 	AsmVarFloat(const std::string&, double value = 0);
 	std::ostream& output(std::ostream&) override;
+	double value() const;
 private:
 	double m_value;
 };
@@ -247,6 +353,7 @@ class AsmVarArray : public AsmVar {
 public:
 	AsmVarArray(const std::string&, uint, const std::vector<std::pair<int, int>>&);
 	std::ostream& output(std::ostream&) override;
+	uint size() const;
 private:
 	uint _m_size() const;
 	const uint m_element_size;                       // Do not
@@ -258,17 +365,38 @@ class AsmVarRecord : public AsmVar {
 public:
 	AsmVarRecord(const std::string&, PSymTable);
 	std::ostream& output(std::ostream&) override;
+	uint size() const;
 private:
 	uint _m_size() const;
 	PSymTable st;
 	const uint m_size;
 };
 
+/// zero-filled
+class AsmVarBss : public AsmVar {
+public:
+	AsmVarBss(const std::string&, uint size);
+	std::ostream& output(std::ostream&) override;
+	const uint size;
+};
+
+class AsmStream;
+
 class AsmCode {
 public:
 	std::ostream& output(std::ostream&);
-	void push_buf(PAsmCmd);
+	/// the commands alone, the definitions of the data alone, as output writes them
+	std::ostream& output_commands(std::ostream&);
+	std::ostream& output_data(std::ostream&);
+	/// the commands and the data dropped, the names of the data stay known
+	void clear();
+	void push_buf(const AsmInstr&);
 	void append(const AsmCode&);
+	/// only the data of the other code
+	void append_data(const AsmCode&);
+	/// number of commands, a position for insert
+	size_t size() const;
+	void insert(size_t pos, const AsmInstr&);
 	AsmCode& push_buf();
 	void pop_buf();
 	AsmCode& buf();
@@ -277,108 +405,22 @@ public:
 	bool add_label(PAsmLabel);
 	PAsmLabel add_data(PAsmLabel);
 	std::stack<PAsmCode> buffers;
+	/// if set, where each procedure goes as soon as it is generated, see AsmStream
+	AsmStream* stream = nullptr;
 private:
 	friend class Optimizer;
+	friend class Encoder;
+	friend class AsmCfg;
+	friend class Liveness;
+	friend class LoadForwarding;
+	friend class Scheduler;
 	std::vector<PAsmLabel> m_header_labels;
 	std::map<std::string, PAsmLabel> m_labels;
-	std::deque<PAsmCmd> m_commands;
+	std::vector<AsmInstr> m_commands;
 	PAsmCode m_procedures = nullptr;
 };
 
-class AsmCmd0 : public AsmCmd {
-public:
-	AsmCmd0(Opcode);
-	std::ostream& output(std::ostream&) override;
-};
-
-class AsmCmd1 : public AsmCmd {
-public:
-	AsmCmd1(Opcode, PAsmOperand);
-	AsmCmd1(Opcode, PAsmVar);
-	AsmCmd1(Opcode, AsmVar);
-	AsmCmd1(Opcode, Syscall);
-	AsmCmd1(Opcode, Register);
-	AsmCmd1(Opcode, AsmLabel);
-	AsmCmd1(Opcode, AsmOperandOffset);
-	AsmCmd1(Opcode, int64_t);
-	AsmCmd1(Opcode, double);
-	std::ostream& output(std::ostream&) override;
-	PAsmOperand operand;
-};
-
-class AsmCmd2 : public AsmCmd {
-public:
-	AsmCmd2(Opcode, PAsmOperand, PAsmOperand);
-	AsmCmd2(Opcode, Register, Register);
-	AsmCmd2(Opcode, PAsmVar, Register);
-	AsmCmd2(Opcode, AsmVar, Register);
-	AsmCmd2(Opcode, double, Register);
-	AsmCmd2(Opcode, int64_t, Register);
-	AsmCmd2(Opcode, Register, AsmVar);
-	AsmCmd2(Opcode, AsmOffs, Register);
-	AsmCmd2(Opcode, int64_t, AsmOffs);
-	std::ostream& output(std::ostream&) override;
-	PAsmOperand operand1;
-	PAsmOperand operand2;
-};
-
-class AsmDirective : public AsmCmd {
-public:
-	AsmDirective(Directive);
-private:
-	Directive m_directive;
-};
-
-class AsmComment : public AsmCmd {
-public:
-	AsmComment(const std::string&);
-	std::ostream& output(std::ostream&) override;
-private:
-	std::string m_string;
-};
-
-AsmCode& operator<<(AsmCode& ac, PAsmCmd cmd);
-
-template <class TAsmCmd>
-AsmCode& operator<<(AsmCode& ac, TAsmCmd cmd) {
-	ac.push_buf(std::make_shared<TAsmCmd>(cmd));
-	return ac;
-}
-
-bool operator==(PAsmOperand, PAsmOperand);
-bool operator!=(PAsmOperand, PAsmOperand);
-bool operator==(PAsmOperand, Register);
-bool operator!=(PAsmOperand, Register);
-
-bool operator==(PAsmCmd, Opcode);
-bool operator==(PAsmCmd0, Opcode);
-bool operator==(PAsmCmd1, Opcode);
-bool operator==(PAsmCmd2, Opcode);
+AsmCode& operator<<(AsmCode&, const AsmInstr&);
+AsmCode& operator<<(AsmCode&, const AsmLabel&);
 
 #endif // ASMCODE_H
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
-
@@ -1,7 +1,19 @@
 #include "asmgenerator.h"
+#include "bytecode.h"
+#include "elf.h"
+#include "encoder.h"
+#include "interpreter.h"
+#include "irbuilder.h"
+#include "irlower.h"
+#include "irpass.h"
+#include "jit.h"
+#include "profile.h"
+#include "rangecheck.h"
 
 using namespace std;
 
+bool Generator::streaming = false;
+
 Generator::Generator(const std::string& filename) :
     m_parser(filename)
 {}
@@ -15,12 +27,86 @@ string Generator::get_line(int id) {
 }
 
 void Generator::generate(std::ostream& os, bool optimize, bool output_stats) {
+	if (streaming) {
+		AsmStream stream(os, optimize);
+		m_build(optimize, output_stats, &stream);
+		stream.finish(output_stats);
+		return;
+	}
+	m_build(optimize, output_stats);
+	m_asmcode.output(os);
+}
+
+void Generator::generate_object(std::ostream& os, bool optimize, bool output_stats) {
+	m_build(optimize, output_stats);
+	Encoder encoder(m_asmcode);
+	encoder.encode();
+	ElfWriter(encoder).output(os);
+}
+
+int Generator::run(bool optimize) {
+	m_build(optimize, false);
+	Encoder encoder(m_asmcode);
+	encoder.encode();
+	return Jit(encoder).run();
+}
+
+int Generator::interpret() {
 	m_parser.parse();
-	m_generate(m_parser.tree());
-	if (optimize) {
+	Bytecode bc;
+	BytecodeCompiler(bc).compile(dynamic_pointer_cast<NodeProgram>(m_parser.tree()));
+	return Interpreter(bc).run();
+}
+
+void Generator::generate_ir(std::ostream& os, bool optimize, bool output_stats) {
+	m_parser.parse();
+	if (RangeChecks::enabled) {
+		RangeChecks::analyze(dynamic_pointer_cast<NodeProgram>(m_parser.tree()));
+	}
+	IrModule module;
+	m_build_ir(module, optimize, output_stats);
+	module.print(os);
+}
+
+/// the runtime is not optimized, it is written after the rest
+void Generator::m_build(bool optimize, bool output_stats, AsmStream* stream) {
+	m_asmcode.stream = stream;
+	m_parser.parse();
+	if (RangeChecks::enabled) {
+		RangeChecks::analyze(dynamic_pointer_cast<NodeProgram>(m_parser.tree()));
+		if (optimize && output_stats) {
+			RangeChecks::print_stats(cout);
+		}
+	}
+	if (IrBuilder::enabled) {
+		IrModule module;
+		m_build_ir(module, optimize, output_stats);
+		IrLowering(m_asmcode).lower(module);
+	} else {
+		m_generate(m_parser.tree());
+	}
+	if (stream) {
+		stream->flush(m_asmcode);
+	} else if (optimize) {
 		Optimizer(m_asmcode).optimize(output_stats);
 	}
-	m_asmcode.output(os);
+	Profile::generate(m_asmcode);
+	Runtime::generate(m_asmcode);
+	if (stream) {
+		stream->flush(m_asmcode, false);
+	}
+	m_asmcode.stream = nullptr;
+}
+
+void Generator::m_build_ir(IrModule& module, bool optimize, bool output_stats) {
+	IrBuilder(module).build(dynamic_pointer_cast<NodeProgram>(m_parser.tree()));
+	if (optimize) {
+		PassManager pm = PassManager::standard();
+		pm.run(module);
+		if (output_stats) {
+			pm.print_stats(cout);
+		}
+	}
 }
 
 void Generator::m_generate(PNode node) {
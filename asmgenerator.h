@@ -7,15 +7,31 @@
 #include "asmcode.h"
 #include "types.h"
 #include "optimizer.h"
+#include "asmstream.h"
+#include "ir.h"
+#include "runtime.h"
 
 class Generator {
 public:
+	/// generate writes each procedure as soon as it is generated, see AsmStream
+	static bool streaming;
 	Generator(const std::string& filename);
 	void generate(std::ostream&, bool optimize = false, bool output_stats = false);
+	/// ELF relocatable object instead of assembly
+	void generate_object(std::ostream&, bool optimize = false, bool output_stats = false);
+	/// compiled in memory and run, the exit code of the program
+	int run(bool optimize = false);
+	/// lowered to bytecode and interpreted, the exit code of the program
+	int interpret();
+	/// the SSA IR as text, after the passes of -O
+	void generate_ir(std::ostream&, bool optimize = false, bool output_stats = false);
 	bool is_open() const;
 	std::string get_line(int);
 private:
 	void m_generate(PNode);
+	/// parsed, generated, optimized, with the runtime; with a stream the procedures are written to it
+	void m_build(bool optimize, bool output_stats, AsmStream* stream = nullptr);
+	void m_build_ir(IrModule&, bool optimize, bool output_stats);
 	Parser m_parser;
 	AsmCode m_asmcode;
 };
@@ -0,0 +1,32 @@
+#include "asmstream.h"
+
+using namespace std;
+
+AsmStream::AsmStream(std::ostream& os, bool optimize) :
+	m_os(os), m_optimize(optimize), m_total(m_data)
+{
+	if (m_optimize) {
+		m_workers.reset(new Optimizer::Workers);
+	}
+	m_os << ".text\n";
+}
+
+void AsmStream::flush(AsmCode& ac, bool optimize) {
+	if (m_optimize && optimize) {
+		Optimizer part(ac);
+		part.optimize_quiet(*m_workers);
+		m_total.add(part);
+		m_optimized = true;
+	}
+	ac.output_commands(m_os);
+	m_data.append_data(ac);
+	ac.clear();
+}
+
+void AsmStream::finish(bool output_stats) {
+	m_os << '\n';
+	m_data.output_data(m_os);
+	if (m_optimized) {
+		m_total.report(output_stats);
+	}
+}
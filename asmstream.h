@@ -0,0 +1,31 @@
+#ifndef ASMSTREAM_H
+#define ASMSTREAM_H
+
+#include <memory>
+#include <ostream>
+#include "asmcode.h"
+#include "optimizer.h"
+
+/// The assembly written a procedure at a time instead of the program at once: each procedure
+/// optimized and written out as soon as it is generated, its data kept to be defined after
+/// all the code, so the commands in memory are of one procedure and of the main program.
+/// The procedures come before the main program. The stats of the optimizer are of all the parts.
+class AsmStream {
+public:
+	AsmStream(std::ostream&, bool optimize);
+	/// the commands of the code optimized if asked and written, its data taken, the code left empty
+	void flush(AsmCode&, bool optimize = true);
+	/// the data after the code, the stats of the optimizer if it ran
+	void finish(bool output_stats);
+private:
+	std::ostream& m_os;
+	bool m_optimize;
+	bool m_optimized = false;
+	/// of the parts written, the optimizer adds them up
+	AsmCode m_data;
+	Optimizer m_total;
+	/// made once for all the parts if optimizing
+	std::unique_ptr<Optimizer::Workers> m_workers;
+};
+
+#endif // ASMSTREAM_H
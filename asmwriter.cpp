@@ -0,0 +1,156 @@
+#include "asmwriter.h"
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+using namespace std;
+
+AsmWriter::Tables::Tables() {
+	for (Name& name: registers) {
+		name.size = numeric_limits<uint8_t>::max();
+	}
+	for (Name& name: opcodes) {
+		name.size = numeric_limits<uint8_t>::max();
+	}
+	for (const pair<const Register, string>& reg: ::registers) {
+		m_set(registers[reg.first], "%" + reg.second);
+	}
+	for (const pair<const Opcode, string>& oc: ::opcodes) {
+		m_set(opcodes[oc.first], oc.second);
+	}
+}
+
+const AsmWriter::Tables& AsmWriter::m_tables() {
+	static const Tables tables;
+	return tables;
+}
+
+void AsmWriter::m_set(Name& name, const std::string& text) {
+	if (text.size() >= sizeof(name.text)) {
+		throw runtime_error("Internal error: name too long for the table");
+	}
+	memcpy(name.text, text.data(), text.size());
+	name.size = text.size();
+}
+
+AsmWriter::AsmWriter(size_t size) {
+	m_buf.resize(max<size_t>(size, 4096));
+}
+
+void AsmWriter::write(const AsmInstr& cmd) {
+	switch (cmd.kind) {
+	case AsmInstr::LABEL:
+		write(cmd.ops[0].name_str());
+		write(":\n", 2);
+		return;
+	case AsmInstr::COMMENT:
+		write("// ", 3);
+		write(cmd.ops[0].name_str());
+		write("\n", 1);
+		return;
+	default:
+		break;
+	}
+	if (cmd.opcode > NONE || m_tables().opcodes[cmd.opcode].size == numeric_limits<uint8_t>::max()) {
+		throw runtime_error("Internal error: opcode without a name");
+	}
+	const Name& oc = m_tables().opcodes[cmd.opcode];
+	char* p = m_reserve(oc.size + 2);
+	*p++ = '\t';
+	memcpy(p, oc.text, oc.size);
+	m_size += oc.size + 1;
+	for (int k = 0; k < cmd.count; k++) {
+		if (k) {
+			write(", ", 2);
+		} else {
+			write("\t", 1);
+		}
+		m_op(cmd.ops[k]);
+	}
+	write("\n", 1);
+}
+
+void AsmWriter::write(const std::string& text) {
+	write(text.data(), text.size());
+}
+
+void AsmWriter::write(const char* text, size_t size) {
+	memcpy(m_reserve(size), text, size);
+	m_size += size;
+}
+
+void AsmWriter::flush(std::ostream& os) {
+	os.write(m_buf.data(), m_size);
+	m_size = 0;
+}
+
+char* AsmWriter::m_reserve(size_t n) {
+	if (m_size + n > m_buf.size()) {
+		m_buf.resize(max(m_buf.size() * 2, m_size + n));
+	}
+	return m_buf.data() + m_size;
+}
+
+/// as AsmOp::str
+void AsmWriter::m_op(const AsmOp& op) {
+	switch (op.kind) {
+	case AsmOp::REG:
+		m_reg(op.reg());
+		break;
+	case AsmOp::IMM:
+		write("$", 1);
+		m_int(op.value);
+		break;
+	case AsmOp::FLOAT:
+		write("$", 1);
+		write(to_string(op.float_value()));
+		break;
+	case AsmOp::MEM:
+		if (op.name != AsmOp::no_name) {
+			write(op.name_str());
+		} else if (op.value) {
+			m_int(op.value);
+		}
+		write("(", 1);
+		m_reg(op.reg());
+		if (op.scale) {
+			write(",", 1);
+			m_reg(op.index_reg());
+			write(",", 1);
+			m_int(op.scale);
+		}
+		write(")", 1);
+		break;
+	case AsmOp::LABEL:
+	case AsmOp::VAR:
+	case AsmOp::SYSCALL:
+		write(op.name_str());
+		break;
+	default:
+		break;
+	}
+}
+
+void AsmWriter::m_reg(Register reg) {
+	if (reg > RIP || m_tables().registers[reg].size == numeric_limits<uint8_t>::max()) {
+		throw runtime_error("Internal error: register without a name");
+	}
+	const Name& name = m_tables().registers[reg];
+	write(name.text, name.size);
+}
+
+/// the digits from the end, the minimum through its magnitude as unsigned
+void AsmWriter::m_int(int64_t value) {
+	char digits[20];
+	char* end = digits + sizeof(digits);
+	char* p = end;
+	uint64_t magnitude = value < 0 ? 0 - uint64_t(value) : uint64_t(value);
+	do {
+		*--p = '0' + magnitude % 10;
+		magnitude /= 10;
+	} while (magnitude);
+	if (value < 0) {
+		write("-", 1);
+	}
+	write(p, end - p);
+}
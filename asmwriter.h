@@ -0,0 +1,47 @@
+#ifndef ASMWRITER_H
+#define ASMWRITER_H
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include "asmcode.h"
+
+/// The text of the code put together in one buffer and written at once, without a stream
+/// for each line: the names of the registers and the opcodes from tables by number,
+/// the numbers formatted by hand. Lines as AsmInstr::output writes them, it writes through this.
+class AsmWriter {
+public:
+	/// room for about the size in bytes
+	AsmWriter(size_t size = 0);
+	void write(const AsmInstr&);
+	void write(const std::string&);
+	void write(const char*, size_t);
+	/// the text so far, then empty
+	void flush(std::ostream&);
+private:
+	/// a name with its length
+	struct Name {
+		char text[15];
+		uint8_t size;
+	};
+	/// the names by the numbers of the registers and the opcodes, built once, the size of a number
+	/// the maps have no name for the maximum
+	struct Tables {
+		Tables();
+		Name registers[RIP + 1];
+		Name opcodes[NONE + 1];
+	};
+	static const Tables& m_tables();
+	static void m_set(Name&, const std::string&);
+
+	/// at least n bytes free at the end
+	char* m_reserve(size_t n);
+	void m_op(const AsmOp&);
+	void m_reg(Register);
+	void m_int(int64_t);
+
+	std::vector<char> m_buf;
+	size_t m_size = 0;
+};
+
+#endif // ASMWRITER_H
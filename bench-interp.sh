@@ -0,0 +1,42 @@
+#!/bin/bash
+# Time to output for every test-gen program: -S, assembling and running the native code
+# against --interpret. Both columns include the start of the compiler.
+script_dir=$(dirname $0)
+test_dir=$script_dir/test-gen
+cc=${CC:-clang}
+runs=${RUNS:-5}
+tmp=$(mktemp -d)
+trap "rm -rf $tmp" EXIT
+
+ms() {
+	echo $(( ($2 - $1) / 1000000 ))
+}
+
+printf "%-24s %10s %10s %10s\n" program native,ms exe,ms interp,ms
+total_native=0
+total_exe=0
+total_interp=0
+for filename in $test_dir/*.in; do
+	name=$(basename "$filename" .in)
+	native=0
+	exe=0
+	interp=0
+	for ((i = 0; i < runs; i++)); do
+		t0=$(date +%s%N)
+		$script_dir/compiler -S $filename -o $tmp/$name.s >/dev/null &&
+		$cc $tmp/$name.s -o $tmp/$name.exe 2>/dev/null || { echo "$name: native build failed"; continue 2; }
+		t1=$(date +%s%N)
+		$tmp/$name.exe >/dev/null
+		t2=$(date +%s%N)
+		$script_dir/compiler --interpret $filename >/dev/null
+		t3=$(date +%s%N)
+		native=$((native + t2 - t0))
+		exe=$((exe + t2 - t1))
+		interp=$((interp + t3 - t2))
+	done
+	printf "%-24s %10d %10d %10d\n" $name $(ms 0 $((native / runs))) $(ms 0 $((exe / runs))) $(ms 0 $((interp / runs)))
+	total_native=$((total_native + native / runs))
+	total_exe=$((total_exe + exe / runs))
+	total_interp=$((total_interp + interp / runs))
+done
+printf "%-24s %10d %10d %10d\n" total $(ms 0 $total_native) $(ms 0 $total_exe) $(ms 0 $total_interp)
@@ -0,0 +1,76 @@
+#!/bin/bash
+# Cost of --range-checks per kind of loop: each kernel is compiled with -O, with and without
+# the checks, and run. The checks left by the elimination are in the last column.
+script_dir=$(dirname $0)
+cc=${CC:-clang}
+runs=${RUNS:-5}
+tmp=$(mktemp -d)
+trap "rm -rf $tmp" EXIT
+
+header='var a, b: array [1..10000] of integer;
+	m: array [1..100, 1..100] of integer;
+	i, j, k, n, r, s: integer;
+begin
+	n := 10000;
+	s := 0;
+	for r := 1 to 2000 do begin'
+footer='	end;
+	writeln(s);
+end.'
+
+# constant bounds prove the indexes
+kernels[0]=const-bounds
+bodies[0]='		for i := 1 to 10000 do
+			a[i] := a[i] + i;'
+# a variable bound is tested once before the loop
+kernels[1]=var-bound
+bodies[1]='		for i := 1 to n do
+			a[i] := a[i] + i;'
+# offsets of the same variable share the test
+kernels[2]=offsets
+bodies[2]='		for i := 2 to n - 1 do
+			b[i] := a[i - 1] + a[i + 1];'
+# one check of the first index proves the second
+kernels[3]=merged
+bodies[3]='		for i := 1 to n do begin
+			k := (i * 7) mod n + 1;
+			s := s + a[k] - b[k];
+		end;'
+# the variable changes in the body: every access is checked
+kernels[4]=while
+bodies[4]='		i := 1;
+		while i <= n do begin
+			s := s + a[i];
+			i := i + 1;
+		end;'
+kernels[5]=nested
+bodies[5]='		for i := 1 to 100 do
+			for j := 1 to 100 do
+				m[i, j] := i + j;'
+
+ms() {
+	echo $(( $1 / 1000000 ))
+}
+
+printf "%-16s %10s %10s %10s  %s\n" loop plain,ms checked,ms overhead checks
+for ((k = 0; k < ${#kernels[@]}; k++)); do
+	name=${kernels[$k]}
+	printf "%s\n%s\n%s\n" "$header" "${bodies[$k]}" "$footer" > $tmp/$name.in
+	$script_dir/compiler -S -O $tmp/$name.in -o $tmp/$name.s >/dev/null &&
+	$cc $tmp/$name.s -o $tmp/$name.exe 2>/dev/null || { echo "$name: build failed"; continue; }
+	stats=$($script_dir/compiler -S -O --range-checks $tmp/$name.in -o $tmp/$name.rc.s | grep "range checks" | sed 's/^# range checks: //')
+	$cc $tmp/$name.rc.s -o $tmp/$name.rc.exe 2>/dev/null || { echo "$name: build failed"; continue; }
+	plain=0
+	checked=0
+	for ((i = 0; i < runs; i++)); do
+		t0=$(date +%s%N)
+		$tmp/$name.exe >/dev/null
+		t1=$(date +%s%N)
+		$tmp/$name.rc.exe >/dev/null
+		t2=$(date +%s%N)
+		plain=$((plain + t1 - t0))
+		checked=$((checked + t2 - t1))
+	done
+	printf "%-16s %10d %10d %9d%%  %s\n" $name $(ms $((plain / runs))) $(ms $((checked / runs))) \
+		$(( (checked - plain) * 100 / plain )) "$stats"
+done
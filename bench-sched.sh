@@ -0,0 +1,19 @@
+#!/bin/bash
+# Gain of the scheduler on the arithmetic test-gen programs: the cycles of the blocks on the model of
+# the scheduler before and after it and the commands it moved (from --opt-stats). The programs run
+# for too short a time for their run time to show the gain, so they are not timed.
+script_dir=$(dirname $0)
+test_dir=$script_dir/test-gen
+tmp=$(mktemp -d)
+trap "rm -rf $tmp" EXIT
+
+programs="int-expression-01 int-expression-03 shl-shr-xor strength write-int-expr writeln-int-expr schedule sorts vector"
+
+printf "%-24s %10s %10s %8s\n" program cycles scheduled moved
+for name in $programs; do
+	filename=$test_dir/$name.in
+	$script_dir/compiler -S -O --opt-stats=$tmp/$name.json $filename -o $tmp/$name.s >/dev/null || { echo "$name: build failed"; continue; }
+	cycles=$(grep -o '"cycles": {"before": [0-9]*, "after": [0-9]*' $tmp/$name.json | grep -o '[0-9]*' | tr '\n' ' ')
+	moved=$(grep -o '"scheduled": [0-9]*' $tmp/$name.json | grep -o '[0-9]*')
+	printf "%-24s %10d %10d %8d\n" $name $cycles $moved
+done
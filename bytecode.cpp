@@ -0,0 +1,558 @@
+#include "bytecode.h"
+#include <cstring>
+#include "node.h"
+#include "symboltable.h"
+
+using namespace std;
+
+BytecodeCompiler::BytecodeCompiler(Bytecode& bc) :
+    m_bc(bc)
+{}
+
+void BytecodeCompiler::compile(PNodeProgram program) {
+	m_bc.functions.push_back({});
+	m_bc.functions[0].name = "main";
+	m_defined.push_back(true);
+	m_current = 0;
+	m_parts(program->parts);
+	m_emit(Bytecode::HALT);
+	m_finish_function();
+	while (!m_pending.empty()) {
+		NodeStmtProcedure* proc = m_pending.back();
+		m_pending.pop_back();
+		m_compile_procedure(*proc);
+	}
+	for (size_t i = 0; i < m_defined.size(); i++) {
+		if (!m_defined[i]) {
+			throw InterpretError("procedure " + m_bc.functions[i].name + " has no body");
+		}
+	}
+}
+
+Bytecode::Function& BytecodeCompiler::m_fn() {
+	return m_bc.functions[m_current];
+}
+
+void BytecodeCompiler::m_parts(const std::vector<PNodeStmt>& parts) {
+	for (PNodeStmt part: parts) {
+		if (PNodeStmtProcedure proc = dynamic_pointer_cast<NodeStmtProcedure>(part)) {
+			/// forward declarations have no parts
+			if (!proc->parts.empty()) {
+				m_pending.push_back(proc.get());
+			}
+		} else if (PNodeStmtVar var = dynamic_pointer_cast<NodeStmtVar>(part)) {
+			m_stmt_var(*var);
+		} else if (dynamic_pointer_cast<NodeStmtBlock>(part)) {
+			m_stmt(part);
+		}
+	}
+}
+
+void BytecodeCompiler::m_compile_procedure(NodeStmtProcedure& proc) {
+	m_current = m_function_id(proc.symbol);
+	m_defined[m_current] = true;
+	m_is_function = (bool)dynamic_pointer_cast<SymbolFunction>(proc.symbol);
+	m_fn().frame_size = proc.symbol->frame_size;
+	for (PNodeFormalParameterSection section: proc.params) {
+		for (PNodeVariable var: section->identifiers) {
+			const SymbolVariable& formal = *var->symbol;
+			bool is_copied = !formal.is_var &&
+			                 (dynamic_pointer_cast<SymbolTypeArray>(formal.type) || dynamic_pointer_cast<SymbolTypeRecord>(formal.type));
+			m_fn().params.push_back({formal.offset, is_copied ? formal.type->size() / 8 * 8 : 0});
+		}
+	}
+	m_parts(proc.parts);
+	/// a function without exit returns whatever is at hand, here 0
+	m_emit(Bytecode::RET0);
+	m_finish_function();
+}
+
+void BytecodeCompiler::m_finish_function() {
+	vector<Bytecode::Instr>& code = m_fn().code;
+	for (const pair<size_t, int>& patch: m_patches) {
+		Bytecode::Instr& instr = code[patch.first];
+		(instr.op == Bytecode::JMP ? instr.a : instr.b) = m_labels[patch.second];
+	}
+	m_patches.clear();
+	m_labels.clear();
+	m_next_reg = 0;
+}
+
+int BytecodeCompiler::m_function_id(PSymbolProcedure proc) {
+	auto it = m_function_ids.find(proc->name);
+	if (it != m_function_ids.end()) {
+		return it->second;
+	}
+	int id = m_bc.functions.size();
+	m_function_ids[proc->name] = id;
+	m_bc.functions.push_back({});
+	m_bc.functions.back().name = proc->name;
+	m_defined.push_back(false);
+	return id;
+}
+
+void BytecodeCompiler::m_stmt(PNodeStmt stmt) {
+	int mark = m_next_reg;
+	if (PNodeStmtBlock block = dynamic_pointer_cast<NodeStmtBlock>(stmt)) {
+		for (PNodeStmt s: block->stmts) {
+			m_stmt(s);
+		}
+	} else if (PNodeStmtAssign assign = dynamic_pointer_cast<NodeStmtAssign>(stmt)) {
+		int value = m_expr(assign->right);
+		m_cast(value, assign->right->exprtype(), assign->left->exprtype());
+		int address = m_lvalue(assign->left);
+		m_emit(Bytecode::STORE, address, value);
+	} else if (PNodeExprStmtFunctionCall call = dynamic_pointer_cast<NodeExprStmtFunctionCall>(stmt)) {
+		m_call(*call, m_reg());
+	} else if (PNodeStmtIf stmt_if = dynamic_pointer_cast<NodeStmtIf>(stmt)) {
+		int _else = m_label(), _endif = m_label();
+		m_jump(Bytecode::JZ, m_expr(stmt_if->cond), _else);
+		m_stmt(stmt_if->then_stmt);
+		m_jump(Bytecode::JMP, 0, _endif);
+		m_bind(_else);
+		if (stmt_if->else_stmt) {
+			m_stmt(stmt_if->else_stmt);
+		}
+		m_bind(_endif);
+	} else if (PNodeStmtWhile stmt_while = dynamic_pointer_cast<NodeStmtWhile>(stmt)) {
+		int _body = m_label(), _end = m_label();
+		m_cycles.push_back({_body, _end});
+		m_bind(_body);
+		m_jump(Bytecode::JZ, m_expr(stmt_while->cond), _end);
+		m_stmt(stmt_while->stmt);
+		m_jump(Bytecode::JMP, 0, _body);
+		m_bind(_end);
+		m_cycles.pop_back();
+	} else if (PNodeStmtRepeat stmt_repeat = dynamic_pointer_cast<NodeStmtRepeat>(stmt)) {
+		/// continue goes to the body, not to the condition
+		int _body = m_label(), _end = m_label();
+		m_cycles.push_back({_body, _end});
+		m_bind(_body);
+		m_stmt(stmt_repeat->stmt);
+		m_jump(Bytecode::JZ, m_expr(stmt_repeat->cond), _body);
+		m_bind(_end);
+		m_cycles.pop_back();
+	} else if (PNodeStmtFor stmt_for = dynamic_pointer_cast<NodeStmtFor>(stmt)) {
+		m_stmt_for(*stmt_for);
+	} else if (dynamic_pointer_cast<NodeStmtBreak>(stmt)) {
+		m_jump(Bytecode::JMP, 0, m_cycles.back().second);
+	} else if (dynamic_pointer_cast<NodeStmtContinue>(stmt)) {
+		m_jump(Bytecode::JMP, 0, m_cycles.back().first);
+	}
+	m_next_reg = mark;
+}
+
+void BytecodeCompiler::m_stmt_var(NodeStmtVar& stmt) {
+	for (PNodeVarDeclarationUnit unit: stmt.units) {
+		for (PNodeVariable var: unit->vars) {
+			if (!var->symbol->is_local) {
+				m_declare_global(*var->symbol);
+			}
+			if (!unit->initializer) {
+				continue;
+			}
+			int mark = m_next_reg;
+			int value = m_expr(unit->initializer->expr);
+			m_cast(value, unit->initializer->expr->exprtype(), var->exprtype());
+			m_emit(Bytecode::STORE, m_lvalue(var), value);
+			m_next_reg = mark;
+		}
+	}
+}
+
+/// high is evaluated again before every step, the variable is read back from memory
+void BytecodeCompiler::m_stmt_for(NodeStmtFor& stmt) {
+	int _body = m_label(), _end = m_label(), _continue = m_label();
+	m_cycles.push_back({_continue, _end});
+	int low = m_expr(stmt.low);
+	int address = m_lvalue(stmt.iter_var);
+	int high = m_expr(stmt.high);
+	m_emit(Bytecode::STORE, address, low);
+	int cond = m_reg();
+	m_emit(Bytecode::LOAD, low, address);
+	m_emit(stmt.is_inc ? Bytecode::LT : Bytecode::GT, cond, high, low);
+	m_jump(Bytecode::JNZ, cond, _end);
+	m_next_reg = low;
+	m_bind(_body);
+	m_stmt(stmt.stmt);
+	m_bind(_continue);
+	high = m_expr(stmt.high);
+	int value = m_expr(stmt.iter_var);
+	m_emit(stmt.is_inc ? Bytecode::LE : Bytecode::GE, high, high, value);
+	m_jump(Bytecode::JNZ, high, _end);
+	address = m_lvalue(stmt.iter_var);
+	m_emit(Bytecode::LOAD, value, address);
+	m_emit(Bytecode::ADDI, value, value, stmt.is_inc ? 1 : -1);
+	m_emit(Bytecode::STORE, address, value);
+	m_jump(Bytecode::JMP, 0, _body);
+	m_bind(_end);
+	m_next_reg = low;
+	m_cycles.pop_back();
+}
+
+void BytecodeCompiler::m_call(NodeExprStmtFunctionCall& call, int dst) {
+	vector<PNodeExpression> no_args;
+	const vector<PNodeExpression>& args = call.args ? call.args->arglist : no_args;
+	if (call.is_write()) {
+		for (PNodeExpression arg: args) {
+			m_write(arg);
+		}
+		if (call.is_writeln()) {
+			m_emit(Bytecode::WRITEC, '\n');
+		}
+		return;
+	}
+	if (call.is_exit()) {
+		if (m_current == 0) {
+			m_emit(Bytecode::HALT);
+		} else if (m_is_function && !args.empty()) {
+			/// the result as is, without a typecast
+			m_emit(Bytecode::RET, m_expr(args[0]));
+		} else {
+			m_emit(Bytecode::RET0);
+		}
+		return;
+	}
+	const SymbolProcedure& proc = *call.proc;
+	int first = m_next_reg;
+	for (size_t i = 0; i < args.size(); i++) {
+		m_reg();
+	}
+	/// in the order of the native call: stack args, then register args, each from the last
+	Register reg;
+	int64_t slot;
+	for (bool in_register: {false, true}) {
+		for (int i = args.size() - 1; i >= 0; i--) {
+			if (proc.arg_location(i, reg, slot) != in_register) {
+				continue;
+			}
+			int mark = m_next_reg;
+			PSymbolVariable formal;
+			(*proc.params)[i] >> formal;
+			int value;
+			if (proc.is_nth_var.at(i) ||
+			    dynamic_pointer_cast<SymbolTypeArray>(formal->type) || dynamic_pointer_cast<SymbolTypeRecord>(formal->type))
+			{
+				value = m_lvalue(args[i]);
+			} else {
+				value = m_expr(args[i]);
+				m_cast(value, args[i]->exprtype(), formal->type);
+			}
+			m_emit(Bytecode::MOV, first + i, value);
+			m_next_reg = mark;
+		}
+	}
+	m_emit(Bytecode::CALL, dst, m_function_id(call.proc), first);
+	m_next_reg = first;
+}
+
+void BytecodeCompiler::m_write(PNodeExpression expr) {
+	if (PNodeString str = dynamic_pointer_cast<NodeString>(expr)) {
+		m_emit(Bytecode::WRITES, m_bc.strings.size());
+		m_bc.strings.push_back(str->value);
+		return;
+	}
+	int mark = m_next_reg;
+	int value = m_expr(expr);
+	PSymbolType type = expr->exprtype();
+	if (dynamic_pointer_cast<SymbolTypeInt>(type)) {
+		m_emit(Bytecode::WRITEI, value);
+	} else if (dynamic_pointer_cast<SymbolTypeFloat>(type)) {
+		m_emit(Bytecode::WRITEF, value);
+	}
+	m_next_reg = mark;
+}
+
+int BytecodeCompiler::m_expr(PNodeExpression expr) {
+	if (PNodeInteger integer = dynamic_pointer_cast<NodeInteger>(expr)) {
+		int reg = m_reg();
+		m_load_int(reg, integer->value);
+		return reg;
+	}
+	if (PNodeFloat real = dynamic_pointer_cast<NodeFloat>(expr)) {
+		int reg = m_reg();
+		int64_t bits;
+		memcpy(&bits, &real->value, sizeof(bits));
+		m_load_int(reg, bits);
+		return reg;
+	}
+	if (PNodeVariable var = dynamic_pointer_cast<NodeVariable>(expr)) {
+		if (PSymbolConstInt c = dynamic_pointer_cast<SymbolConstInt>(var->symbol)) {
+			int reg = m_reg();
+			m_load_int(reg, c->value);
+			return reg;
+		}
+		if (PSymbolConstFloat c = dynamic_pointer_cast<SymbolConstFloat>(var->symbol)) {
+			int reg = m_reg();
+			int64_t bits;
+			memcpy(&bits, &c->value, sizeof(bits));
+			m_load_int(reg, bits);
+			return reg;
+		}
+		int reg = m_lvalue(expr);
+		m_emit(Bytecode::LOAD, reg, reg);
+		return reg;
+	}
+	if (PNodeBinaryOperator binary = dynamic_pointer_cast<NodeBinaryOperator>(expr)) {
+		return m_binary(*binary);
+	}
+	if (PNodeUnaryOperator unary = dynamic_pointer_cast<NodeUnaryOperator>(expr)) {
+		return m_unary(*unary);
+	}
+	if (dynamic_pointer_cast<NodeArrayAccess>(expr) || dynamic_pointer_cast<NodeRecordAccess>(expr)) {
+		int reg = m_lvalue(expr);
+		m_emit(Bytecode::LOAD, reg, reg);
+		return reg;
+	}
+	if (PNodeExprStmtFunctionCall call = dynamic_pointer_cast<NodeExprStmtFunctionCall>(expr)) {
+		int reg = m_reg();
+		m_call(*call, reg);
+		return reg;
+	}
+	/// a string has no value
+	int reg = m_reg();
+	m_load_int(reg, 0);
+	return reg;
+}
+
+int BytecodeCompiler::m_lvalue(PNodeExpression expr) {
+	if (PNodeVariable var = dynamic_pointer_cast<NodeVariable>(expr)) {
+		int reg = m_variable_address(*var->symbol);
+		if (var->symbol->is_var) {
+			m_emit(Bytecode::LOAD, reg, reg);
+		}
+		return reg;
+	}
+	if (PNodeRecordAccess access = dynamic_pointer_cast<NodeRecordAccess>(expr)) {
+		int reg = m_lvalue(access->record);
+		m_emit_imm(Bytecode::ADDI, Bytecode::ADD, reg, reg, access->st->offsetb(access->field->name));
+		return reg;
+	}
+	if (PNodeArrayAccess access = dynamic_pointer_cast<NodeArrayAccess>(expr)) {
+		return m_array_address(*access);
+	}
+	PNodeUnaryOperator deref = dynamic_pointer_cast<NodeUnaryOperator>(expr);
+	if (deref && deref->operation == Token::OP_DEREFERENCE) {
+		return m_expr(deref->node);
+	}
+	int reg = m_reg();
+	m_load_int(reg, 0);
+	return reg;
+}
+
+int BytecodeCompiler::m_variable_address(const SymbolVariable& var) {
+	int reg = m_reg();
+	if (var.is_local) {
+		m_emit(Bytecode::LADDR, reg, var.offset);
+		return reg;
+	}
+	m_emit(Bytecode::GADDR, reg, m_declare_global(var));
+	return reg;
+}
+
+/// one after another in the order of declaration, like the .data of the native code
+int64_t BytecodeCompiler::m_declare_global(const SymbolVariable& var) {
+	auto it = m_globals.find(&var);
+	if (it == m_globals.end()) {
+		it = m_globals.insert({&var, m_bc.globals_size}).first;
+		m_bc.globals_size += var.is_var ? 8 : var.size();
+	}
+	return it->second;
+}
+
+/// same index arithmetic as NodeArrayAccess::m_gen_index
+int BytecodeCompiler::m_array_address(NodeArrayAccess& access) {
+	PSymbolTypeArray type = dynamic_pointer_cast<SymbolTypeArray>(access.array->exprtype());
+	const vector<pair<int, int>>& bounds = type->bounds;
+	vector<int64_t> dims, qr(bounds.size(), 0);
+	for (const pair<int, int>& p: bounds) {
+		dims.push_back(p.second - p.first + 1);
+	}
+	for (size_t i = 0; i < qr.size(); i++) {
+		for (size_t j = i + 1; j < qr.size(); j++) {
+			qr[i] += dims[j];
+		}
+	}
+	qr.back() = 1;
+	int address = m_lvalue(access.array);
+	int index = m_reg();
+	m_load_int(index, 0);
+	for (size_t i = 0; i < qr.size(); i++) {
+		int mark = m_next_reg;
+		int value = m_expr(access.index->arglist.at(i));
+		m_emit_imm(Bytecode::ADDI, Bytecode::ADD, value, value, -(int64_t)bounds[i].first);
+		m_emit_imm(Bytecode::MULI, Bytecode::MUL, value, value, qr[i]);
+		m_emit(Bytecode::ADD, index, index, value);
+		m_next_reg = mark;
+	}
+	m_emit_imm(Bytecode::MULI, Bytecode::MUL, index, index, type->type->size());
+	m_emit(Bytecode::ADD, address, address, index);
+	m_next_reg = index;
+	return address;
+}
+
+int BytecodeCompiler::m_binary(NodeBinaryOperator& node) {
+	PSymbolType type = node.exprtype();
+	PSymbolType int_type = NodeInteger::type_sym_ptr, float_type = NodeFloat::type_sym_ptr;
+	int left, right;
+	switch (node.operation) {
+	case Token::OP_PLUS:
+	case Token::OP_MINUS:
+	case Token::OP_MULT:
+	case Token::OP_DIV:
+	case Token::OP_DIV_SLASH: {
+		left = m_expr(node.left);
+		m_cast(left, node.left->exprtype(), type);
+		right = m_expr(node.right);
+		m_cast(right, node.right->exprtype(), type);
+		static const map<Token::Operator, Bytecode::Op> int_ops = {
+			{Token::OP_PLUS, Bytecode::ADD}, {Token::OP_MINUS, Bytecode::SUB},
+			{Token::OP_MULT, Bytecode::MUL}, {Token::OP_DIV, Bytecode::DIV},
+		};
+		static const map<Token::Operator, Bytecode::Op> float_ops = {
+			{Token::OP_PLUS, Bytecode::FADD}, {Token::OP_MINUS, Bytecode::FSUB},
+			{Token::OP_MULT, Bytecode::FMUL}, {Token::OP_DIV_SLASH, Bytecode::FDIV},
+		};
+		bool is_int = type == int_type || dynamic_pointer_cast<SymbolTypePointer>(type);
+		const map<Token::Operator, Bytecode::Op>& ops = is_int ? int_ops : float_ops;
+		auto op = ops.find(node.operation);
+		/// with no instruction for it the left operand is the result
+		if ((is_int || type == float_type) && op != ops.end()) {
+			m_emit(op->second, left, left, right);
+		}
+		break;
+	}
+	case Token::OP_EQUAL:
+	case Token::OP_GREATER:
+	case Token::OP_LESS:
+	case Token::OP_LEQ:
+	case Token::OP_GEQ:
+	case Token::OP_NEQ: {
+		bool is_float = node.left->exprtype() == float_type || node.right->exprtype() == float_type;
+		left = m_expr(node.left);
+		if (is_float) {
+			m_cast(left, node.left->exprtype(), float_type);
+		}
+		right = m_expr(node.right);
+		if (is_float) {
+			m_cast(right, node.right->exprtype(), float_type);
+		}
+		static const map<Token::Operator, pair<Bytecode::Op, Bytecode::Op>> ops = {
+			{Token::OP_EQUAL, {Bytecode::EQ, Bytecode::FEQ}}, {Token::OP_NEQ, {Bytecode::NE, Bytecode::FNE}},
+			{Token::OP_LESS, {Bytecode::LT, Bytecode::FLT}}, {Token::OP_LEQ, {Bytecode::LE, Bytecode::FLE}},
+			{Token::OP_GREATER, {Bytecode::GT, Bytecode::FGT}}, {Token::OP_GEQ, {Bytecode::GE, Bytecode::FGE}},
+		};
+		const pair<Bytecode::Op, Bytecode::Op>& op = ops.at(node.operation);
+		m_emit(is_float ? op.second : op.first, left, left, right);
+		break;
+	}
+	case Token::OP_AND:
+	case Token::OP_OR: {
+		/// 0 or 1, the right operand only if needed
+		bool is_and = node.operation == Token::OP_AND;
+		Bytecode::Op skip = is_and ? Bytecode::JZ : Bytecode::JNZ;
+		int _end = m_label();
+		int result = m_reg();
+		m_load_int(result, is_and ? 0 : 1);
+		m_jump(skip, m_expr(node.left), _end);
+		m_next_reg = result + 1;
+		m_jump(skip, m_expr(node.right), _end);
+		m_next_reg = result + 1;
+		m_load_int(result, is_and ? 1 : 0);
+		m_bind(_end);
+		return result;
+	}
+	case Token::OP_XOR:
+	case Token::OP_SHL:
+	case Token::OP_SHR:
+	case Token::OP_MOD: {
+		static const map<Token::Operator, Bytecode::Op> ops = {
+			{Token::OP_XOR, Bytecode::XOR}, {Token::OP_SHL, Bytecode::SHL},
+			{Token::OP_SHR, Bytecode::SHR}, {Token::OP_MOD, Bytecode::MOD},
+		};
+		left = m_expr(node.left);
+		right = m_expr(node.right);
+		m_emit(ops.at(node.operation), left, left, right);
+		break;
+	}
+	default:
+		left = m_expr(node.left);
+	}
+	m_next_reg = left + 1;
+	return left;
+}
+
+int BytecodeCompiler::m_unary(NodeUnaryOperator& node) {
+	int reg;
+	switch (node.operation) {
+	case Token::OP_MINUS:
+		reg = m_expr(node.node);
+		m_emit(node.exprtype() == NodeInteger::type_sym_ptr ? Bytecode::NEG : Bytecode::FNEG, reg, reg);
+		return reg;
+	case Token::OP_DEREFERENCE:
+		reg = m_expr(node.node);
+		m_emit(Bytecode::LOAD, reg, reg);
+		return reg;
+	case Token::OP_AT:
+		return m_lvalue(node.node);
+	case Token::OP_NOT:
+		reg = m_expr(node.node);
+		m_emit(Bytecode::NOT, reg, reg);
+		return reg;
+	default:
+		reg = m_reg();
+		m_load_int(reg, 0);
+		return reg;
+	}
+}
+
+void BytecodeCompiler::m_cast(int reg, PSymbolType from, PSymbolType to) {
+	if (dynamic_pointer_cast<SymbolTypeInt>(from) && dynamic_pointer_cast<SymbolTypeFloat>(to)) {
+		m_emit(Bytecode::I2F, reg, reg);
+	} else if (dynamic_pointer_cast<SymbolTypeFloat>(from) && dynamic_pointer_cast<SymbolTypeInt>(to)) {
+		m_emit(Bytecode::F2I, reg, reg);
+	}
+}
+
+int BytecodeCompiler::m_reg() {
+	int reg = m_next_reg++;
+	m_fn().regs = max(m_fn().regs, m_next_reg);
+	return reg;
+}
+
+int BytecodeCompiler::m_label() {
+	m_labels.push_back(-1);
+	return m_labels.size() - 1;
+}
+
+void BytecodeCompiler::m_bind(int label) {
+	m_labels[label] = m_fn().code.size();
+}
+
+void BytecodeCompiler::m_emit(Bytecode::Op op, int32_t a, int32_t b, int32_t c) {
+	m_fn().code.push_back({op, a, b, c});
+}
+
+void BytecodeCompiler::m_jump(Bytecode::Op op, int reg, int label) {
+	m_patches.push_back({m_fn().code.size(), label});
+	m_emit(op, reg);
+}
+
+void BytecodeCompiler::m_load_int(int reg, int64_t value) {
+	if (value == (int32_t)value) {
+		m_emit(Bytecode::LOADI, reg, value);
+		return;
+	}
+	m_emit(Bytecode::LOADK, reg, m_bc.constants.size());
+	m_bc.constants.push_back(value);
+}
+
+void BytecodeCompiler::m_emit_imm(Bytecode::Op op, Bytecode::Op regop, int dst, int src, int64_t imm) {
+	if (imm == (int32_t)imm) {
+		m_emit(op, dst, src, imm);
+		return;
+	}
+	int reg = m_reg();
+	m_load_int(reg, imm);
+	m_emit(regop, dst, src, reg);
+}
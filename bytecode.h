@@ -0,0 +1,153 @@
+#ifndef BYTECODE_H
+#define BYTECODE_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include "types.h"
+
+/// a dst, b and c registers or immediates, see Bytecode::Instr
+#define BYTECODE_OPS(X) \
+	X(LOADI)  /* a = b */ \
+	X(LOADK)  /* a = constants[b] */ \
+	X(MOV)    /* a = b */ \
+	X(GADDR)  /* a = globals + b */ \
+	X(LADDR)  /* a = frame + b, b < 0 like offsets from RBP */ \
+	X(LOAD)   /* a = *b */ \
+	X(STORE)  /* *a = b */ \
+	X(ADD)    /* a = b + c */ \
+	X(SUB) \
+	X(MUL) \
+	X(DIV) \
+	X(MOD) \
+	X(XOR) \
+	X(SHL) \
+	X(SHR) \
+	X(ADDI)   /* a = b + immediate c */ \
+	X(MULI)   /* a = b * immediate c */ \
+	X(NEG)    /* a = -b */ \
+	X(NOT)    /* a = b xor 1 */ \
+	X(FADD) \
+	X(FSUB) \
+	X(FMUL) \
+	X(FDIV) \
+	X(FNEG)   /* a = 0.0 - b */ \
+	X(I2F) \
+	X(F2I) \
+	X(EQ)     /* a = b = c */ \
+	X(NE) \
+	X(LT) \
+	X(LE) \
+	X(GT) \
+	X(GE) \
+	X(FEQ) \
+	X(FNE) \
+	X(FLT) \
+	X(FLE) \
+	X(FGT) \
+	X(FGE) \
+	X(JMP)    /* to a */ \
+	X(JZ)     /* to b if a = 0 */ \
+	X(JNZ)    /* to b if a <> 0 */ \
+	X(CALL)   /* a = functions[b](c, c + 1, ...) */ \
+	X(RET)    /* returns a */ \
+	X(RET0) \
+	X(HALT) \
+	X(WRITEI) /* a */ \
+	X(WRITEF) /* a */ \
+	X(WRITES) /* strings[a] */ \
+	X(WRITEC) /* character a */
+
+/// Register-based program lowered from the syntax tree.
+/// Every value is a quad, reals are kept as their bits; memory is addressed by
+/// host addresses so variables, pointers and @ work as in the native code.
+class Bytecode {
+public:
+	enum Op : uint8_t {
+#define BYTECODE_ENUM(op) op,
+		BYTECODE_OPS(BYTECODE_ENUM)
+#undef BYTECODE_ENUM
+	};
+	struct Instr {
+		Op op;
+		int32_t a, b, c;
+	};
+	/// where an argument is stored in the frame of the callee
+	struct Param {
+		int64_t offset;
+		/// bytes copied from the address passed, 0 to store the value itself
+		int64_t copied;
+	};
+	struct Function {
+		std::string name;
+		std::vector<Instr> code;
+		std::vector<Param> params;
+		int regs = 0;
+		int64_t frame_size = 0;
+	};
+	/// main program first
+	std::vector<Function> functions;
+	std::vector<int64_t> constants;
+	std::vector<std::string> strings;
+	int64_t globals_size = 0;
+};
+
+/// Lowers the tree of a parsed program the way Node::generate does for the native code,
+/// quirks included, so both give the same output.
+class BytecodeCompiler {
+public:
+	BytecodeCompiler(Bytecode&);
+	void compile(PNodeProgram);
+private:
+	Bytecode& m_bc;
+	/// index of the function being lowered
+	size_t m_current = 0;
+	bool m_is_function = false;
+	int m_next_reg = 0;
+	/// jump targets, label -> instruction
+	std::vector<int32_t> m_labels;
+	std::vector<std::pair<size_t, int>> m_patches;
+	/// continue and break of the enclosing loops
+	std::vector<std::pair<int, int>> m_cycles;
+	/// by name like the labels of the native code, a forward declaration has its own symbol
+	std::map<std::string, int> m_function_ids;
+	std::map<const SymbolVariable*, int64_t> m_globals;
+	std::vector<bool> m_defined;
+	/// bodies met while lowering another one
+	std::vector<NodeStmtProcedure*> m_pending;
+
+	Bytecode::Function& m_fn();
+	void m_compile_procedure(NodeStmtProcedure&);
+	void m_finish_function();
+	/// var, procedure and block parts of the program or a procedure
+	void m_parts(const std::vector<PNodeStmt>&);
+	int m_function_id(PSymbolProcedure);
+	void m_stmt(PNodeStmt);
+	void m_stmt_var(NodeStmtVar&);
+	void m_stmt_for(NodeStmtFor&);
+	void m_call(NodeExprStmtFunctionCall&, int dst);
+	void m_write(PNodeExpression);
+	/// value into a new register
+	int m_expr(PNodeExpression);
+	int m_lvalue(PNodeExpression);
+	int m_variable_address(const SymbolVariable&);
+	/// offset in the globals
+	int64_t m_declare_global(const SymbolVariable&);
+	int m_array_address(NodeArrayAccess&);
+	int m_binary(NodeBinaryOperator&);
+	int m_unary(NodeUnaryOperator&);
+	/// gen_typecast
+	void m_cast(int reg, PSymbolType from, PSymbolType to);
+
+	int m_reg();
+	int m_label();
+	void m_bind(int label);
+	void m_emit(Bytecode::Op, int32_t a = 0, int32_t b = 0, int32_t c = 0);
+	void m_jump(Bytecode::Op, int reg, int label);
+	void m_load_int(int reg, int64_t);
+	/// op with an immediate if it fits, regop with a register otherwise
+	void m_emit_imm(Bytecode::Op op, Bytecode::Op regop, int dst, int src, int64_t imm);
+};
+
+#endif // BYTECODE_H
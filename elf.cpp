@@ -0,0 +1,207 @@
+#include "elf.h"
+
+using namespace std;
+
+namespace {
+
+enum SectionIndex {
+	SH_NULL,
+	SH_TEXT,
+	SH_DATA,
+	SH_BSS,
+	SH_RODATA,
+	SH_SYMTAB,
+	SH_STRTAB,
+	SH_RELA_TEXT,
+	SH_SHSTRTAB,
+	SH_NOTE_STACK,
+	SH_COUNT,
+};
+
+const uint32_t SHT_PROGBITS = 1, SHT_SYMTAB = 2, SHT_STRTAB = 3, SHT_RELA = 4, SHT_NOBITS = 8;
+const uint64_t SHF_WRITE = 1, SHF_ALLOC = 2, SHF_EXECINSTR = 4, SHF_INFO_LINK = 0x40;
+const uint8_t STB_LOCAL = 0, STB_GLOBAL = 1, STT_NOTYPE = 0, STT_SECTION = 3;
+const int ehdr_size = 64, shdr_size = 64, sym_size = 24, rela_size = 24;
+
+struct SectionHeader {
+	uint32_t name = 0;
+	uint32_t type = 0;
+	uint64_t flags = 0;
+	uint64_t offset = 0;
+	uint64_t size = 0;
+	uint32_t link = 0;
+	uint32_t info = 0;
+	uint64_t alignment = 0;
+	uint64_t entry_size = 0;
+};
+
+}
+
+ElfWriter::ElfWriter(const Encoder& encoder) :
+    m_encoder(encoder)
+{}
+
+void ElfWriter::output(std::ostream& os) {
+	SectionHeader headers[SH_COUNT];
+	vector<uint8_t> shstrtab = {0}, strtab = {0}, symtab(sym_size, 0), rela;
+	const char* names[SH_COUNT] = {"", ".text", ".data", ".bss", ".rodata", ".symtab", ".strtab", ".rela.text",
+	                               ".shstrtab", ".note.GNU-stack"};
+	for (int i = 1; i < SH_COUNT; i++) {
+		headers[i].name = m_add_string(shstrtab, names[i]);
+	}
+
+	/// section symbols, then locals, then globals as the ELF requires
+	auto add_symbol = [&](uint32_t name, uint8_t info, uint16_t section, uint64_t value) {
+		vector<uint8_t> sym(sym_size, 0);
+		for (int k = 0; k < 4; k++) {
+			sym[k] = (name >> 8*k) & 0xff;
+		}
+		sym[4] = info;
+		sym[6] = section & 0xff;
+		sym[7] = section >> 8;
+		for (int k = 0; k < 8; k++) {
+			sym[8 + k] = (value >> 8*k) & 0xff;
+		}
+		symtab.insert(symtab.end(), sym.begin(), sym.end());
+	};
+	for (uint16_t section: {SH_TEXT, SH_DATA, SH_BSS, SH_RODATA}) {
+		add_symbol(0, STB_LOCAL << 4 | STT_SECTION, section, 0);
+	}
+	vector<uint32_t> ids(m_encoder.symbols.size());
+	uint32_t next_id = 5;
+	for (bool global: {false, true}) {
+		if (global) {
+			headers[SH_SYMTAB].info = next_id;
+		}
+		for (size_t i = 0; i < m_encoder.symbols.size(); i++) {
+			const Encoder::Symbol& symbol = m_encoder.symbols[i];
+			if (symbol.is_global != global) {
+				continue;
+			}
+			ids[i] = next_id++;
+			add_symbol(m_add_string(strtab, symbol.name), (global ? STB_GLOBAL : STB_LOCAL) << 4 | STT_NOTYPE,
+			           m_section_index(symbol.section), symbol.offset);
+		}
+	}
+	map<string, uint32_t> symbol_ids;
+	for (size_t i = 0; i < m_encoder.symbols.size(); i++) {
+		symbol_ids[m_encoder.symbols[i].name] = ids[i];
+	}
+	for (const Encoder::Reloc& reloc: m_encoder.relocs) {
+		uint64_t info = (uint64_t)symbol_ids.at(reloc.symbol) << 32 | reloc.type;
+		for (uint64_t value: {reloc.offset, info, (uint64_t)reloc.addend}) {
+			for (int k = 0; k < 8; k++) {
+				rela.push_back((value >> 8*k) & 0xff);
+			}
+		}
+	}
+
+	m_out.assign(ehdr_size, 0);
+	auto place = [&](SectionIndex i, const vector<uint8_t>& bytes, int alignment) {
+		m_align(alignment);
+		headers[i].offset = m_out.size();
+		headers[i].size = bytes.size();
+		headers[i].alignment = alignment;
+		m_put(bytes);
+	};
+	place(SH_TEXT, m_encoder.text, 16);
+	headers[SH_TEXT].type = SHT_PROGBITS;
+	headers[SH_TEXT].flags = SHF_ALLOC | SHF_EXECINSTR;
+	place(SH_DATA, m_encoder.data, 8);
+	headers[SH_DATA].type = SHT_PROGBITS;
+	headers[SH_DATA].flags = SHF_ALLOC | SHF_WRITE;
+	headers[SH_BSS].type = SHT_NOBITS;
+	headers[SH_BSS].flags = SHF_ALLOC | SHF_WRITE;
+	headers[SH_BSS].offset = m_out.size();
+	headers[SH_BSS].size = m_encoder.bss_size;
+	headers[SH_BSS].alignment = 16;
+	place(SH_RODATA, m_encoder.rodata, 1);
+	headers[SH_RODATA].type = SHT_PROGBITS;
+	headers[SH_RODATA].flags = SHF_ALLOC;
+	place(SH_SYMTAB, symtab, 8);
+	headers[SH_SYMTAB].type = SHT_SYMTAB;
+	headers[SH_SYMTAB].link = SH_STRTAB;
+	headers[SH_SYMTAB].entry_size = sym_size;
+	place(SH_STRTAB, strtab, 1);
+	headers[SH_STRTAB].type = SHT_STRTAB;
+	place(SH_RELA_TEXT, rela, 8);
+	headers[SH_RELA_TEXT].type = SHT_RELA;
+	headers[SH_RELA_TEXT].flags = SHF_INFO_LINK;
+	headers[SH_RELA_TEXT].link = SH_SYMTAB;
+	headers[SH_RELA_TEXT].info = SH_TEXT;
+	headers[SH_RELA_TEXT].entry_size = rela_size;
+	place(SH_SHSTRTAB, shstrtab, 1);
+	headers[SH_SHSTRTAB].type = SHT_STRTAB;
+	/// empty, marks the stack as not executable
+	place(SH_NOTE_STACK, {}, 1);
+	headers[SH_NOTE_STACK].type = SHT_PROGBITS;
+
+	m_align(8);
+	uint64_t shoff = m_out.size();
+	for (const SectionHeader& h: headers) {
+		m_put(h.name, 4);
+		m_put(h.type, 4);
+		m_put(h.flags, 8);
+		m_put(0, 8);    /// address
+		m_put(h.offset, 8);
+		m_put(h.size, 8);
+		m_put(h.link, 4);
+		m_put(h.info, 4);
+		m_put(h.alignment, 8);
+		m_put(h.entry_size, 8);
+	}
+
+	/// ELF header: 64-bit, little endian, System V, relocatable, x86-64
+	vector<uint8_t> ident = {0x7f, 'E', 'L', 'F', 2, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+	vector<uint8_t> body;
+	body.swap(m_out);
+	m_put(ident);
+	m_put(1, 2);            /// ET_REL
+	m_put(62, 2);           /// EM_X86_64
+	m_put(1, 4);            /// EV_CURRENT
+	m_put(0, 8);            /// entry
+	m_put(0, 8);            /// program headers
+	m_put(shoff, 8);
+	m_put(0, 4);            /// flags
+	m_put(ehdr_size, 2);
+	m_put(0, 2);
+	m_put(0, 2);
+	m_put(shdr_size, 2);
+	m_put(SH_COUNT, 2);
+	m_put(SH_SHSTRTAB, 2);
+	copy(m_out.begin(), m_out.end(), body.begin());
+	os.write((const char*)body.data(), body.size());
+}
+
+uint16_t ElfWriter::m_section_index(Encoder::Section section) {
+	switch (section) {
+	case Encoder::TEXT:   return SH_TEXT;
+	case Encoder::DATA:   return SH_DATA;
+	case Encoder::RODATA: return SH_RODATA;
+	case Encoder::BSS:    return SH_BSS;
+	default:              return 0;     /// SHN_UNDEF
+	}
+}
+
+uint32_t ElfWriter::m_add_string(std::vector<uint8_t>& table, const std::string& s) {
+	uint32_t offset = table.size();
+	table.insert(table.end(), s.begin(), s.end());
+	table.push_back(0);
+	return offset;
+}
+
+void ElfWriter::m_put(uint64_t value, int size) {
+	for (int k = 0; k < size; k++) {
+		m_out.push_back((value >> 8*k) & 0xff);
+	}
+}
+
+void ElfWriter::m_put(const std::vector<uint8_t>& bytes) {
+	m_out.insert(m_out.end(), bytes.begin(), bytes.end());
+}
+
+void ElfWriter::m_align(int alignment) {
+	while (m_out.size() % alignment) {
+		m_out.push_back(0);
+	}
+}
@@ -0,0 +1,27 @@
+#ifndef ELF_H
+#define ELF_H
+
+#include <ostream>
+#include <string>
+#include <vector>
+#include "encoder.h"
+
+/// ELF64 relocatable object (ET_REL) of an encoded program, for the system linker.
+/// Sections: .text .data .bss .rodata .symtab .strtab .rela.text .shstrtab .note.GNU-stack.
+class ElfWriter {
+public:
+	ElfWriter(const Encoder&);
+	void output(std::ostream&);
+private:
+	const Encoder& m_encoder;
+	std::vector<uint8_t> m_out;
+	/// section header index of an encoder section
+	static uint16_t m_section_index(Encoder::Section);
+	/// offset of the name in the table
+	static uint32_t m_add_string(std::vector<uint8_t>& table, const std::string&);
+	void m_put(uint64_t value, int size);
+	void m_put(const std::vector<uint8_t>&);
+	void m_align(int alignment);
+};
+
+#endif // ELF_H
@@ -0,0 +1,656 @@
+#include "encoder.h"
+#include <cstring>
+#include <set>
+#include <sstream>
+#include "exceptions.h"
+
+using namespace std;
+
+Encoder::Encoder(AsmCode& code) :
+    m_code(code)
+{}
+
+void Encoder::encode() {
+	m_encode_data();
+	for (const AsmInstr& cmd: m_code.m_commands) {
+		m_encode(cmd);
+	}
+	m_resolve_jumps();
+	/// whatever is referenced and not defined comes from libc
+	for (const Reloc& r: relocs) {
+		if (!m_symbol_ids.count(r.symbol)) {
+			m_symbol_ids[r.symbol] = symbols.size();
+			symbols.push_back({r.symbol, UNDEF, 0, true});
+		}
+	}
+}
+
+void Encoder::m_encode_data() {
+	set<string> globals;
+	for (PAsmLabel label: m_code.m_header_labels) {
+		if (dynamic_pointer_cast<AsmGlobl>(label)) {
+			globals.insert(label->name);
+		} else if (PAsmVarString str = dynamic_pointer_cast<AsmVarString>(label)) {
+			m_define(str->name, RODATA, rodata.size());
+			/// the escapes .string knows
+			for (size_t k = 0; k < str->value.size(); k++) {
+				char c = str->value[k];
+				if (c == '\\' && k + 1 < str->value.size()) {
+					c = str->value[++k];
+					c = c == 'n' ? '\n' : c == 't' ? '\t' : c;
+				}
+				rodata.push_back(c);
+			}
+			rodata.push_back(0);
+		} else if (dynamic_pointer_cast<AsmVarInt>(label) || dynamic_pointer_cast<AsmVarFloat>(label)) {
+			PAsmVarInt i = dynamic_pointer_cast<AsmVarInt>(label);
+			PAsmVarFloat f = dynamic_pointer_cast<AsmVarFloat>(label);
+			int64_t bits = i ? i->value() : 0;
+			if (f) {
+				double value = f->value();
+				memcpy(&bits, &value, sizeof(bits));
+			}
+			data.resize((data.size() + 7) / 8 * 8);
+			m_define(label->name, DATA, data.size());
+			for (int k = 0; k < 8; k++) {
+				data.push_back((bits >> 8*k) & 0xff);
+			}
+		} else {
+			/// zero-filled
+			uint64_t size;
+			if (PAsmVarArray a = dynamic_pointer_cast<AsmVarArray>(label)) {
+				size = a->size();
+			} else if (PAsmVarRecord r = dynamic_pointer_cast<AsmVarRecord>(label)) {
+				size = r->size();
+			} else if (PAsmVarBss b = dynamic_pointer_cast<AsmVarBss>(label)) {
+				size = b->size;
+			} else {
+				continue;
+			}
+			bss_size = (bss_size + 15) / 16 * 16;
+			m_define(label->name, BSS, bss_size);
+			bss_size += size;
+		}
+	}
+	for (const AsmInstr& cmd: m_code.m_commands) {
+		if (cmd.kind != AsmInstr::LABEL) {
+			continue;
+		}
+		const string& name = cmd.ops[0].name_str();
+		if (globals.count(name)) {
+			globals.erase(name);
+			m_symbol_ids[name] = symbols.size();
+			symbols.push_back({name, TEXT, 0, true});
+		}
+	}
+	for (const string& name: globals) {
+		throw EncodeError("global symbol " + name + " is not defined");
+	}
+}
+
+void Encoder::m_define(const std::string& name, Section section, uint64_t offset) {
+	auto it = m_symbol_ids.find(name);
+	if (it == m_symbol_ids.end()) {
+		m_symbol_ids[name] = symbols.size();
+		symbols.push_back({name, section, offset, false});
+		return;
+	}
+	/// a global is known before its definition in the code
+	Symbol& sym = symbols[it->second];
+	if (!sym.is_global || sym.section != TEXT || sym.offset != 0 || section != TEXT) {
+		throw EncodeError("symbol " + name + " is already defined");
+	}
+	sym.offset = offset;
+}
+
+void Encoder::m_encode(const AsmInstr& cmd) {
+	m_cmd = &cmd;
+	switch (cmd.kind) {
+	case AsmInstr::COMMENT:
+		return;
+	case AsmInstr::LABEL:
+		m_define(cmd.ops[0].name_str(), TEXT, text.size());
+		return;
+	default:
+		break;
+	}
+	switch (cmd.count) {
+	case 0: m_encode0(cmd.oc()); break;
+	case 1: m_encode1(cmd.oc(), cmd.ops[0]); break;
+	case 2: m_encode2(cmd.oc(), cmd.ops[0], cmd.ops[1]); break;
+	default: m_encode3(cmd.oc(), cmd.ops[0], cmd.ops[1], cmd.ops[2]);
+	}
+}
+
+void Encoder::m_encode0(Opcode oc) {
+	switch (oc) {
+	case CQO:        text.insert(text.end(), {0x48, 0x99}); break;
+	case RET:        text.push_back(0xc3); break;
+	case SYSCALL:    text.insert(text.end(), {0x0f, 0x05}); break;
+	case VZEROUPPER: text.insert(text.end(), {0xc5, 0xf8, 0x77}); break;
+	default: m_unsupported();
+	}
+}
+
+void Encoder::m_encode1(Opcode oc, const AsmOp& x) {
+	switch (oc) {
+	case CALL: m_jump({0xe8}, x); return;
+	case JMP:  m_jump({0xe9}, x); return;
+	case JZ: case JE: case JNZ: case JL: case JG: case JGE: case JLE: case JB: case JAE: case JBE: case JNS:
+		m_jump({0x0f, (uint8_t)(0x80 | m_condition(oc))}, x);
+		return;
+	case PUSHQ:
+	case POPQ: {
+		bool is_push = oc == PUSHQ;
+		if (m_is_reg(x)) {
+			int r = m_rm(x).reg;
+			if (r >= 8) {
+				text.push_back(0x41);
+			}
+			text.push_back((is_push ? 0x50 : 0x58) + (r & 7));
+		} else if (is_push && m_is_imm(x)) {
+			int64_t v = m_imm_value(x);
+			if (m_fits8(v)) {
+				text.push_back(0x6a);
+				m_imm(v, 1);
+			} else if (m_fits32(v)) {
+				text.push_back(0x68);
+				m_imm(v, 4);
+			} else {
+				m_unsupported();
+			}
+		} else if (!m_is_imm(x) && !m_is_vreg(x)) {
+			m_op({}, false, {(uint8_t)(is_push ? 0xff : 0x8f)}, is_push ? 6 : 0, m_rm(x));
+		} else {
+			m_unsupported();
+		}
+		return;
+	}
+	case IMULQ: m_op({}, true, {0xf7}, 5, m_rm(x)); return;
+	case IDIVQ: m_op({}, true, {0xf7}, 7, m_rm(x)); return;
+	case MULQ:  m_op({}, true, {0xf7}, 4, m_rm(x)); return;
+	case NEGQ:  m_op({}, true, {0xf7}, 3, m_rm(x)); return;
+	case INCQ:  m_op({}, true, {0xff}, 0, m_rm(x)); return;
+	case DECQ:  m_op({}, true, {0xff}, 1, m_rm(x)); return;
+	case SETE: case SETNE: case SETL: case SETG: case SETGE: case SETLE: case SETA: case SETB: case SETAE: case SETBE:
+		m_op({}, false, {0x0f, (uint8_t)(0x90 | m_condition(oc))}, 0, m_rm(x), 0, 0, m_is_byte_rex(x));
+		return;
+	default: m_unsupported();
+	}
+}
+
+void Encoder::m_encode2(Opcode oc, const AsmOp& src, const AsmOp& dst) {
+	if (m_is_imm(dst)) {
+		m_unsupported();
+	}
+	/// ALU group: 01 r -> r/m, 03 r/m -> r, 81/83 imm
+	static const map<Opcode, int> alu = {{ADDQ, 0}, {ORQ, 1}, {ANDQ, 4}, {SUBQ, 5}, {XORQ, 6}, {CMPQ, 7}};
+	static const map<Opcode, int> shifts = {{SHLQ, 4}, {SHRQ, 5}, {SARQ, 7}};
+	auto it = alu.find(oc);
+	if (it != alu.end()) {
+		uint8_t n = it->second;
+		if (m_is_imm(src)) {
+			int64_t v = m_imm_value(src);
+			if (m_fits8(v)) {
+				m_op({}, true, {0x83}, n, m_rm(dst), 1, v);
+			} else if (m_fits32(v)) {
+				m_op({}, true, {0x81}, n, m_rm(dst), 4, v);
+			} else {
+				m_unsupported();
+			}
+		} else if (m_is_reg(src)) {
+			m_op({}, true, {(uint8_t)(0x01 + 8*n)}, m_rm(src).reg, m_rm(dst));
+		} else if (m_is_reg(dst)) {
+			m_op({}, true, {(uint8_t)(0x03 + 8*n)}, m_rm(dst).reg, m_rm(src));
+		} else {
+			m_unsupported();
+		}
+		return;
+	}
+	it = shifts.find(oc);
+	if (it != shifts.end()) {
+		if (m_is_imm(src)) {
+			m_op({}, true, {0xc1}, it->second, m_rm(dst), 1, m_imm_value(src));
+		} else if (src == CL) {
+			m_op({}, true, {0xd3}, it->second, m_rm(dst));
+		} else {
+			m_unsupported();
+		}
+		return;
+	}
+	switch (oc) {
+	case MOVQ:
+		if (m_is_vreg(src) && m_is_vreg(dst)) {
+			m_op({0xf3}, false, {0x0f, 0x7e}, m_rm(dst).reg, m_rm(src));
+		} else if (m_is_vreg(src)) {
+			if (m_is_reg(dst)) {
+				m_op({0x66}, true, {0x0f, 0x7e}, m_rm(src).reg, m_rm(dst));
+			} else {
+				m_op({0x66}, false, {0x0f, 0xd6}, m_rm(src).reg, m_rm(dst));
+			}
+		} else if (m_is_vreg(dst)) {
+			if (m_is_reg(src)) {
+				m_op({0x66}, true, {0x0f, 0x6e}, m_rm(dst).reg, m_rm(src));
+			} else if (!m_is_imm(src)) {
+				m_op({0xf3}, false, {0x0f, 0x7e}, m_rm(dst).reg, m_rm(src));
+			} else {
+				m_unsupported();
+			}
+		} else if (m_is_imm(src)) {
+			int64_t v = m_imm_value(src);
+			if (m_fits32(v)) {
+				m_op({}, true, {0xc7}, 0, m_rm(dst), 4, v);
+			} else if (m_is_reg(dst)) {
+				m_encode2(MOVABSQ, src, dst);
+			} else {
+				m_unsupported();
+			}
+		} else if (m_is_reg(src)) {
+			m_op({}, true, {0x89}, m_rm(src).reg, m_rm(dst));
+		} else if (m_is_reg(dst)) {
+			m_op({}, true, {0x8b}, m_rm(dst).reg, m_rm(src));
+		} else {
+			m_unsupported();
+		}
+		return;
+	case MOVABSQ: {
+		if (!m_is_imm(src) || !m_is_reg(dst)) {
+			m_unsupported();
+		}
+		int r = m_rm(dst).reg;
+		text.push_back(0x48 | (r >> 3));
+		text.push_back(0xb8 + (r & 7));
+		m_imm(m_imm_value(src), 8);
+		return;
+	}
+	case TESTQ:
+		if (m_is_imm(src) && m_fits32(m_imm_value(src))) {
+			m_op({}, true, {0xf7}, 0, m_rm(dst), 4, m_imm_value(src));
+		} else if (m_is_reg(src)) {
+			m_op({}, true, {0x85}, m_rm(src).reg, m_rm(dst));
+		} else if (m_is_reg(dst) && !m_is_imm(src)) {
+			m_op({}, true, {0x85}, m_rm(dst).reg, m_rm(src));
+		} else {
+			m_unsupported();
+		}
+		return;
+	case LEAQ:
+		if (!m_is_reg(dst) || m_is_reg(src) || m_is_imm(src)) {
+			m_unsupported();
+		}
+		m_op({}, true, {0x8d}, m_rm(dst).reg, m_rm(src));
+		return;
+	case IMULQ:
+		if (!m_is_reg(dst)) {
+			m_unsupported();
+		}
+		if (m_is_imm(src)) {
+			int64_t v = m_imm_value(src);
+			if (m_fits8(v)) {
+				m_op({}, true, {0x6b}, m_rm(dst).reg, m_rm(dst), 1, v);
+			} else if (m_fits32(v)) {
+				m_op({}, true, {0x69}, m_rm(dst).reg, m_rm(dst), 4, v);
+			} else {
+				m_unsupported();
+			}
+		} else {
+			m_op({}, true, {0x0f, 0xaf}, m_rm(dst).reg, m_rm(src));
+		}
+		return;
+	case BTSQ:
+		if (!m_is_imm(src)) {
+			m_unsupported();
+		}
+		m_op({}, true, {0x0f, 0xba}, 5, m_rm(dst), 1, m_imm_value(src));
+		return;
+	case MOVB: {
+		bool rex = m_is_byte_rex(src) || m_is_byte_rex(dst);
+		if (m_is_imm(src)) {
+			m_op({}, false, {0xc6}, 0, m_rm(dst), 1, m_imm_value(src));
+		} else if (m_is_reg(src)) {
+			m_op({}, false, {0x88}, m_rm(src).reg, m_rm(dst), 0, 0, rex);
+		} else if (m_is_reg(dst)) {
+			m_op({}, false, {0x8a}, m_rm(dst).reg, m_rm(src), 0, 0, rex);
+		} else {
+			m_unsupported();
+		}
+		return;
+	}
+	case ADDB:
+		if (!m_is_imm(src)) {
+			m_unsupported();
+		}
+		m_op({}, false, {0x80}, 0, m_rm(dst), 1, m_imm_value(src), m_is_byte_rex(dst));
+		return;
+	case TESTB:
+		if (!m_is_reg(src)) {
+			m_unsupported();
+		}
+		m_op({}, false, {0x84}, m_rm(src).reg, m_rm(dst), 0, 0, m_is_byte_rex(src) || m_is_byte_rex(dst));
+		return;
+	case VMOVUPD: case VMOVDQU: case VMOVAPD: case VMOVDQA: case VBROADCASTSD: case VPBROADCASTQ:
+		m_encode_avx(oc, src, AsmOp(), dst);
+		return;
+	default:
+		m_encode_sse(oc, src, dst);
+	}
+}
+
+void Encoder::m_encode3(Opcode oc, const AsmOp& op1, const AsmOp& op2, const AsmOp& op3) {
+	if (oc == SHRDQ) {
+		/// shrdq %cl, src, dst
+		if (op1 != CL || !m_is_reg(op2)) {
+			m_unsupported();
+		}
+		m_op({}, true, {0x0f, 0xad}, m_rm(op2).reg, m_rm(op3));
+		return;
+	}
+	m_encode_avx(oc, op1, op2, op3);
+}
+
+void Encoder::m_encode_sse(Opcode oc, const AsmOp& src, const AsmOp& dst) {
+	struct Form {
+		uint8_t prefix;
+		uint8_t load;
+		uint8_t store;  /// 0 if the destination is always a register
+	};
+	static const map<Opcode, Form> forms = {
+		{ADDSD, {0xf2, 0x58, 0}},
+		{SUBSD, {0xf2, 0x5c, 0}},
+		{MULSD, {0xf2, 0x59, 0}},
+		{DIVSD, {0xf2, 0x5e, 0}},
+		{COMISD, {0x66, 0x2f, 0}},
+		{XORPD, {0x66, 0x57, 0}},
+		{ADDPD, {0x66, 0x58, 0}},
+		{SUBPD, {0x66, 0x5c, 0}},
+		{MULPD, {0x66, 0x59, 0}},
+		{DIVPD, {0x66, 0x5e, 0}},
+		{PADDQ, {0x66, 0xd4, 0}},
+		{PSUBQ, {0x66, 0xfb, 0}},
+		{PXOR, {0x66, 0xef, 0}},
+		{UNPCKLPD, {0x66, 0x14, 0}},
+		{PUNPCKLQDQ, {0x66, 0x6c, 0}},
+		{MOVSD, {0xf2, 0x10, 0x11}},
+		{MOVUPD, {0x66, 0x10, 0x11}},
+		{MOVDQU, {0xf3, 0x6f, 0x7f}},
+		{MOVAPD, {0x66, 0x28, 0x29}},
+		{MOVDQA, {0x66, 0x6f, 0x7f}},
+	};
+	if (oc == CVTSI2SD || oc == CVTSD2SI) {
+		/// general register and XMM, REX.W for 64 bits
+		if (m_is_imm(src)) {
+			m_unsupported();
+		}
+		m_op({0xf2}, true, {0x0f, (uint8_t)(oc == CVTSI2SD ? 0x2a : 0x2d)}, m_rm(dst).reg, m_rm(src));
+		return;
+	}
+	auto it = forms.find(oc);
+	if (it == forms.end() || m_is_imm(src)) {
+		m_unsupported();
+	}
+	const Form& form = it->second;
+	if (m_is_vreg(dst)) {
+		m_op({form.prefix}, false, {0x0f, form.load}, m_rm(dst).reg, m_rm(src));
+	} else if (form.store && m_is_vreg(src)) {
+		m_op({form.prefix}, false, {0x0f, form.store}, m_rm(src).reg, m_rm(dst));
+	} else {
+		m_unsupported();
+	}
+}
+
+void Encoder::m_encode_avx(Opcode oc, const AsmOp& src, const AsmOp& src1, const AsmOp& dst) {
+	/// pp: 1 is 66, 2 is F3
+	struct Form {
+		int pp;
+		int map;
+		uint8_t load;
+		uint8_t store;
+	};
+	static const map<Opcode, Form> forms = {
+		{VMOVUPD, {1, 1, 0x10, 0x11}},
+		{VMOVDQU, {2, 1, 0x6f, 0x7f}},
+		{VMOVAPD, {1, 1, 0x28, 0x29}},
+		{VMOVDQA, {1, 1, 0x6f, 0x7f}},
+		{VADDPD, {1, 1, 0x58, 0}},
+		{VSUBPD, {1, 1, 0x5c, 0}},
+		{VMULPD, {1, 1, 0x59, 0}},
+		{VDIVPD, {1, 1, 0x5e, 0}},
+		{VPADDQ, {1, 1, 0xd4, 0}},
+		{VPSUBQ, {1, 1, 0xfb, 0}},
+		{VXORPD, {1, 1, 0x57, 0}},
+		{VPXOR, {1, 1, 0xef, 0}},
+		{VBROADCASTSD, {1, 2, 0x19, 0}},
+		{VPBROADCASTQ, {1, 2, 0x59, 0}},
+	};
+	auto it = forms.find(oc);
+	if (it == forms.end() || m_is_imm(src)) {
+		m_unsupported();
+	}
+	const Form& form = it->second;
+	bool wide = m_is_ymm(dst) || m_is_ymm(src);
+	bool has_src1 = src1.kind != AsmOp::NONE;
+	int vvvv = has_src1 ? m_rm(src1).reg : 0;
+	if (has_src1 && !m_is_vreg(src1)) {
+		m_unsupported();
+	}
+	if (m_is_vreg(dst)) {
+		m_vex(form.pp, form.map, wide, m_rm(dst).reg, vvvv, {form.load}, m_rm(src));
+	} else if (form.store && m_is_vreg(src)) {
+		m_vex(form.pp, form.map, wide, m_rm(src).reg, vvvv, {form.store}, m_rm(dst));
+	} else {
+		m_unsupported();
+	}
+}
+
+void Encoder::m_jump(std::vector<uint8_t> opcode, const AsmOp& target) {
+	if (!target.is_label()) {
+		m_unsupported();
+	}
+	text.insert(text.end(), opcode.begin(), opcode.end());
+	m_jumps.push_back({text.size(), target.name_str()});
+	m_imm(0, 4);
+}
+
+void Encoder::m_resolve_jumps() {
+	for (const pair<uint64_t, string>& jump: m_jumps) {
+		auto it = m_symbol_ids.find(jump.second);
+		if (it == m_symbol_ids.end() || symbols[it->second].section != TEXT) {
+			relocs.push_back({jump.first, jump.second, R_X86_64_PLT32, -4});
+			continue;
+		}
+		int64_t rel = (int64_t)symbols[it->second].offset - (int64_t)(jump.first + 4);
+		for (int k = 0; k < 4; k++) {
+			text[jump.first + k] = (rel >> 8*k) & 0xff;
+		}
+	}
+}
+
+void Encoder::m_op(std::vector<uint8_t> prefix, bool rex_w, std::vector<uint8_t> opcode, int reg, const Rm& rm, int imm_size, int64_t imm, bool byte_regs) {
+	text.insert(text.end(), prefix.begin(), prefix.end());
+	int rex = rex_w << 3 | ((reg >> 3) & 1) << 2;
+	if (rm.is_reg) {
+		rex |= (rm.reg >> 3) & 1;
+	} else {
+		rex |= (rm.index >= 0 ? ((rm.index >> 3) & 1) << 1 : 0) | (rm.base >= 0 ? (rm.base >> 3) & 1 : 0);
+	}
+	if (rex || byte_regs) {
+		text.push_back(0x40 | rex);
+	}
+	text.insert(text.end(), opcode.begin(), opcode.end());
+	m_modrm(reg, rm, imm_size);
+	m_imm(imm, imm_size);
+}
+
+void Encoder::m_vex(int pp, int map, bool wide, int reg, int vvvv, std::vector<uint8_t> opcode, const Rm& rm) {
+	int r = !((reg >> 3) & 1);
+	int x = rm.is_reg || rm.index < 0 || !((rm.index >> 3) & 1);
+	int b = rm.is_reg ? !((rm.reg >> 3) & 1) : (rm.base < 0 || !((rm.base >> 3) & 1));
+	int tail = (~vvvv & 15) << 3 | wide << 2 | pp;
+	if (map == 1 && x && b) {
+		text.push_back(0xc5);
+		text.push_back(r << 7 | tail);
+	} else {
+		text.push_back(0xc4);
+		text.push_back(r << 7 | x << 6 | b << 5 | map);
+		text.push_back(tail);
+	}
+	text.insert(text.end(), opcode.begin(), opcode.end());
+	m_modrm(reg, rm, 0);
+}
+
+void Encoder::m_modrm(int reg, const Rm& rm, int imm_size) {
+	reg &= 7;
+	if (rm.is_reg) {
+		text.push_back(0xc0 | reg << 3 | (rm.reg & 7));
+		return;
+	}
+	if (rm.base < 0) {
+		/// disp32(%rip), the displacement counts from the end of the instruction
+		text.push_back(0x05 | reg << 3);
+		if (!rm.label.empty()) {
+			relocs.push_back({text.size(), rm.label, R_X86_64_PC32, rm.disp - 4 - imm_size});
+			m_imm(0, 4);
+		} else {
+			m_imm(rm.disp, 4);
+		}
+		return;
+	}
+	bool sib = rm.index >= 0 || (rm.base & 7) == 4;
+	int mod;
+	if (rm.disp == 0 && (rm.base & 7) != 5) {
+		mod = 0;
+	} else {
+		mod = m_fits8(rm.disp) ? 1 : 2;
+	}
+	text.push_back(mod << 6 | reg << 3 | (sib ? 4 : (rm.base & 7)));
+	if (sib) {
+		int ss = rm.scale == 8 ? 3 : rm.scale == 4 ? 2 : rm.scale == 2 ? 1 : 0;
+		text.push_back(ss << 6 | (rm.index >= 0 ? rm.index & 7 : 4) << 3 | (rm.base & 7));
+	}
+	if (mod == 1) {
+		m_imm(rm.disp, 1);
+	} else if (mod == 2) {
+		m_imm(rm.disp, 4);
+	}
+}
+
+void Encoder::m_imm(int64_t value, int size) {
+	for (int k = 0; k < size; k++) {
+		text.push_back((value >> 8*k) & 0xff);
+	}
+}
+
+Encoder::Rm Encoder::m_rm(const AsmOp& op) {
+	Rm rm;
+	if (op.kind == AsmOp::REG) {
+		rm.is_reg = true;
+		rm.reg = m_number(op.reg());
+	} else if (op.kind == AsmOp::MEM) {
+		rm.base = op.reg() == RIP ? -1 : m_number(op.reg());
+		if (op.scale) {
+			rm.index = m_number(op.index_reg());
+			rm.scale = op.scale;
+		}
+		if (op.name != AsmOp::no_name) {
+			/// only rip-relative, the code is position independent
+			if (rm.base >= 0) {
+				throw EncodeError("operand " + op.str() + " is a label with a base register");
+			}
+			rm.label = op.name_str();
+		} else {
+			rm.disp = op.value;
+		}
+	} else if (op.is_label()) {
+		rm.label = op.name_str();
+	} else {
+		throw EncodeError("operand " + op.str() + " is not a register or memory");
+	}
+	return rm;
+}
+
+Encoder::Rm Encoder::m_reg(int n) {
+	Rm rm;
+	rm.is_reg = true;
+	rm.reg = n;
+	return rm;
+}
+
+bool Encoder::m_is_reg(const AsmOp& op) {
+	return op.kind == AsmOp::REG && !m_is_vreg(op) && op.reg() != RIP;
+}
+
+bool Encoder::m_is_vreg(const AsmOp& op) {
+	return op.kind == AsmOp::REG && (op.reg() == XMM0 || op.reg() == XMM1 || (op.reg() >= XMM2 && op.reg() <= YMM15));
+}
+
+bool Encoder::m_is_ymm(const AsmOp& op) {
+	return op.kind == AsmOp::REG && op.reg() >= YMM0 && op.reg() <= YMM15;
+}
+
+bool Encoder::m_is_imm(const AsmOp& op) {
+	return op.kind == AsmOp::IMM || op.kind == AsmOp::FLOAT;
+}
+
+/// a float as its bits, as they are moved to a general register
+int64_t Encoder::m_imm_value(const AsmOp& op) {
+	return op.value;
+}
+
+int Encoder::m_number(Register reg) {
+	static const map<Register, int> numbers = {
+		{RAX, 0}, {RCX, 1}, {RDX, 2}, {RBX, 3}, {RSP, 4}, {RBP, 5}, {RSI, 6}, {RDI, 7},
+		{R8, 8}, {R9, 9}, {R10, 10}, {R11, 11}, {R12, 12}, {R13, 13}, {R14, 14}, {R15, 15},
+		{AL, 0}, {CL, 1}, {DIL, 7},
+		{XMM0, 0}, {XMM1, 1},
+	};
+	auto it = numbers.find(reg);
+	if (it != numbers.end()) {
+		return it->second;
+	}
+	if (reg >= XMM2 && reg <= XMM15) {
+		return reg - XMM2 + 2;
+	}
+	if (reg >= YMM0 && reg <= YMM15) {
+		return reg - YMM0;
+	}
+	throw EncodeError("register " + AsmOp(reg).str() + " has no encoding");
+}
+
+bool Encoder::m_is_byte_rex(const AsmOp& op) {
+	return op == DIL;
+}
+
+bool Encoder::m_fits8(int64_t v) {
+	return v >= -128 && v <= 127;
+}
+
+bool Encoder::m_fits32(int64_t v) {
+	return v >= INT32_MIN && v <= INT32_MAX;
+}
+
+int Encoder::m_condition(Opcode oc) {
+	switch (oc) {
+	case JB: case SETB:                return 0x2;
+	case JAE: case SETAE:              return 0x3;
+	case JZ: case JE: case SETE:       return 0x4;
+	case JNZ: case SETNE:              return 0x5;
+	case JBE: case SETBE:              return 0x6;
+	case SETA:                         return 0x7;
+	case JNS:                          return 0x9;
+	case JL: case SETL:                return 0xc;
+	case JGE: case SETGE:              return 0xd;
+	case JLE: case SETLE:              return 0xe;
+	case JG: case SETG:                return 0xf;
+	default: throw EncodeError("no condition code");
+	}
+}
+
+void Encoder::m_unsupported() const {
+	ostringstream os;
+	m_cmd->output(os);
+	string text = os.str();
+	while (!text.empty() && (text.back() == '\n' || text[0] == '\t')) {
+		text = text.back() == '\n' ? text.substr(0, text.size() - 1) : text.substr(1);
+	}
+	throw EncodeError("cannot encode \"" + text + "\"");
+}
@@ -0,0 +1,100 @@
+#ifndef ENCODER_H
+#define ENCODER_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include "asmcode.h"
+
+/// x86-64 machine code of an AsmCode.
+/// Labels referenced as memory are addressed relative to RIP, jumps and calls take rel32.
+/// Jumps to labels of the code are resolved here, everything else is left as relocations.
+class Encoder {
+public:
+	enum Section {
+		TEXT,
+		DATA,
+		RODATA,
+		BSS,
+		UNDEF,
+	};
+	/// ELF x86-64 relocation types
+	enum RelocType {
+		R_X86_64_PC32 = 2,
+		R_X86_64_PLT32 = 4,
+	};
+	struct Symbol {
+		std::string name;
+		Section section;
+		uint64_t offset;
+		bool is_global;
+	};
+	/// in .text
+	struct Reloc {
+		uint64_t offset;
+		std::string symbol;
+		RelocType type;
+		int64_t addend;
+	};
+	Encoder(AsmCode&);
+	void encode();
+	std::vector<uint8_t> text;
+	std::vector<uint8_t> data;
+	std::vector<uint8_t> rodata;
+	uint64_t bss_size = 0;
+	/// in order of definition, undefined ones last
+	std::vector<Symbol> symbols;
+	std::vector<Reloc> relocs;
+private:
+	/// operand of ModRM: a register or memory
+	struct Rm {
+		bool is_reg = false;
+		int reg = 0;
+		int base = -1;          /// -1 if RIP-relative
+		int index = -1;
+		int scale = 1;
+		int64_t disp = 0;
+		std::string label;
+	};
+	AsmCode& m_code;
+	std::map<std::string, size_t> m_symbol_ids;
+	/// rel32 fields and their labels
+	std::vector<std::pair<uint64_t, std::string>> m_jumps;
+	void m_encode_data();
+	void m_define(const std::string& name, Section, uint64_t offset);
+	void m_encode(const AsmInstr&);
+	void m_encode0(Opcode);
+	void m_encode1(Opcode, const AsmOp&);
+	void m_encode2(Opcode, const AsmOp&, const AsmOp&);
+	void m_encode3(Opcode, const AsmOp&, const AsmOp&, const AsmOp&);
+	void m_encode_sse(Opcode, const AsmOp&, const AsmOp&);
+	void m_encode_avx(Opcode, const AsmOp& src, const AsmOp& src1, const AsmOp& dst);
+	void m_jump(std::vector<uint8_t> opcode, const AsmOp& target);
+	void m_resolve_jumps();
+
+	/// [prefix] [REX] opcode ModRM [SIB] [disp] [imm]
+	void m_op(std::vector<uint8_t> prefix, bool rex_w, std::vector<uint8_t> opcode, int reg, const Rm&, int imm_size = 0, int64_t imm = 0, bool byte_regs = false);
+	/// VEX prefixed, map 1 is 0F, map 2 is 0F38
+	void m_vex(int pp, int map, bool wide, int reg, int vvvv, std::vector<uint8_t> opcode, const Rm&);
+	void m_modrm(int reg, const Rm&, int imm_size);
+	void m_imm(int64_t value, int size);
+
+	static Rm m_rm(const AsmOp&);
+	static Rm m_reg(int);
+	static bool m_is_reg(const AsmOp&);
+	static bool m_is_vreg(const AsmOp&);
+	static bool m_is_ymm(const AsmOp&);
+	static bool m_is_imm(const AsmOp&);
+	static int64_t m_imm_value(const AsmOp&);
+	static int m_number(Register);
+	static bool m_is_byte_rex(const AsmOp&);
+	static bool m_fits8(int64_t);
+	static bool m_fits32(int64_t);
+	static int m_condition(Opcode);
+	/// command being encoded, for errors
+	const AsmInstr* m_cmd = nullptr;
+	[[noreturn]] void m_unsupported() const;
+};
+
+#endif // ENCODER_H
@@ -27,5 +27,56 @@ public:
 	{}
 };
 
+/// instruction or operands the encoder has no form for
+class EncodeError {
+public:
+	EncodeError(const std::string& msg) :
+	    m_msg(msg) {
+	}
+	std::string msg() const {
+		return m_msg;
+	}
+protected:
+	std::string m_msg;
+};
+
+/// program that cannot be loaded for --run
+class JitError {
+public:
+	JitError(const std::string& msg) :
+	    m_msg(msg) {
+	}
+	std::string msg() const {
+		return m_msg;
+	}
+protected:
+	std::string m_msg;
+};
+
+/// program the bytecode interpreter cannot lower or run
+class InterpretError {
+public:
+	InterpretError(const std::string& msg) :
+	    m_msg(msg) {
+	}
+	std::string msg() const {
+		return m_msg;
+	}
+protected:
+	std::string m_msg;
+};
+
+/// malformed SSA, a bug of the builder or a pass
+class IrError {
+public:
+	IrError(const std::string& msg) :
+	    m_msg(msg) {
+	}
+	std::string msg() const {
+		return m_msg;
+	}
+protected:
+	std::string m_msg;
+};
 
 #endif // EXCEPTIONS_H
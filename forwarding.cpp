@@ -0,0 +1,161 @@
+#include "forwarding.h"
+#include <unordered_map>
+
+using namespace std;
+
+LoadForwarding::LoadForwarding(AsmCode& a_ac) :
+	ac(a_ac), cmds(a_ac.m_commands)
+{}
+
+int LoadForwarding::forward() {
+	AsmCfg cfg(ac);
+	m_entered();
+	vector<bool> keep(cmds.size(), true);
+	/// of the blocks the next blocks go on from
+	unordered_map<int, Held> outs;
+	for (size_t b = 0; b < cfg.blocks.size(); b++) {
+		const AsmBlock& block = cfg.blocks[b];
+		Held held;
+		held.fill(AsmOp());
+		const AsmInstr& first = cmds[block.begin];
+		bool is_entered = first.kind == AsmInstr::LABEL && m_entries.count(first.ops[0].name);
+		if (block.preds.size() == 1 && block.preds[0] < int(b) && !is_entered) {
+			auto it = outs.find(block.preds[0]);
+			if (it != outs.end()) {
+				held = it->second;
+			}
+		}
+		for (size_t i = block.begin; i < block.end; i++) {
+			keep[i] = m_step(cmds[i], held);
+		}
+		for (int succ: block.succs) {
+			if (succ > int(b) && cfg.blocks[succ].preds.size() == 1) {
+				outs[b] = held;
+			}
+		}
+	}
+	size_t n = 0;
+	for (size_t i = 0; i < cmds.size(); i++) {
+		if (keep[i]) {
+			cmds[n++] = cmds[i];
+		}
+	}
+	cmds.resize(n);
+	return m_count;
+}
+
+bool LoadForwarding::m_step(AsmInstr& cmd, Held& held) {
+	if (cmd.kind != AsmInstr::CMD) {
+		return true;
+	}
+	AsmEffects e(cmd);
+	Opcode oc = cmd.oc();
+	int src = oc == MOVQ ? m_gpr(cmd.ops[0]) : -1;
+	int dst = oc == MOVQ ? m_gpr(cmd.ops[1]) : -1;
+	if (e.read.kind != AsmOp::NONE) {
+		int reg = m_holder(held, e.read);
+		if (dst != -1 && held[dst].kind != AsmOp::NONE &&
+		    AsmEffects::slot_key(held[dst]) == AsmEffects::slot_key(e.read)) {
+			m_count++;
+			return false;
+		}
+		int k = m_source(cmd, e.read);
+		if (reg != -1 && k != -1) {
+			m_count++;
+			cmd.ops[k] = m_register(reg);
+			e = AsmEffects(cmd);
+			src = oc == MOVQ ? m_gpr(cmd.ops[0]) : -1;
+		}
+	}
+	if (src != -1 && e.write.kind != AsmOp::NONE && held[src].kind != AsmOp::NONE &&
+	    AsmEffects::slot_key(held[src]) == AsmEffects::slot_key(e.write)) {
+		m_count++;
+		return false;
+	}
+	AsmOp moved = src != -1 ? held[src] : AsmOp();
+	if (e.writes_any || e.defs & 1ull << RBP) {
+		held.fill(AsmOp());
+	}
+	for (size_t r = 0; r < held.size(); r++) {
+		if (e.defs >> r & 1 || (e.write.kind != AsmOp::NONE && held[r].kind != AsmOp::NONE &&
+		                        AsmEffects::slot_key(held[r]) == AsmEffects::slot_key(e.write))) {
+			held[r] = AsmOp();
+		}
+	}
+	if (dst != -1 && e.read.kind != AsmOp::NONE) {
+		held[dst] = e.read;
+	} else if (dst != -1) {
+		held[dst] = moved;
+	} else if (src != -1 && e.write.kind != AsmOp::NONE) {
+		held[src] = e.write;
+	}
+	return true;
+}
+
+int LoadForwarding::m_holder(const Held& held, const AsmOp& slot) {
+	for (size_t r = 0; r < held.size(); r++) {
+		if (held[r].kind != AsmOp::NONE && AsmEffects::slot_key(held[r]) == AsmEffects::slot_key(slot)) {
+			return r;
+		}
+	}
+	return -1;
+}
+
+/// sources of integer commands and either side of a comparison
+int LoadForwarding::m_source(const AsmInstr& cmd, const AsmOp& slot) {
+	int last;
+	switch (cmd.oc()) {
+	case MOVQ: case ADDQ: case SUBQ: case ANDQ: case ORQ: case XORQ:
+	case PUSHQ: case CVTSI2SD:
+		last = 0;
+		break;
+	case IMULQ:
+		last = cmd.count == 2 ? 0 : -1;
+		break;
+	case CMPQ: case TESTQ:
+		last = 1;
+		break;
+	default:
+		last = -1;
+		break;
+	}
+	for (int k = 0; k <= last; k++) {
+		if ((cmd.ops[k].kind == AsmOp::MEM || cmd.ops[k].kind == AsmOp::VAR) &&
+		    AsmEffects::slot_key(cmd.ops[k]) == AsmEffects::slot_key(slot)) {
+			return k;
+		}
+	}
+	return -1;
+}
+
+int LoadForwarding::m_gpr(const AsmOp& op) {
+	if (op.kind != AsmOp::REG) {
+		return -1;
+	}
+	Register reg = op.reg();
+	if (reg <= RBP && reg != RSP && reg != RBP) {
+		return reg;
+	}
+	if (reg >= R8 && reg <= R15) {
+		return 8 + reg - R8;
+	}
+	return -1;
+}
+
+Register LoadForwarding::m_register(int gpr) {
+	static const Register regs[] = {RAX, RBX, RCX, RDX, RDI, RSI, RSP, RBP, R8, R9, R10, R11, R12, R13, R14, R15};
+	return regs[gpr];
+}
+
+void LoadForwarding::m_entered() {
+	for (const AsmInstr& cmd: cmds) {
+		if (cmd.kind != AsmInstr::CMD || (AsmCfg::is_jump(cmd.oc()) && cmd.oc() != RET)) {
+			continue;
+		}
+		for (int k = 0; k < cmd.count; k++) {
+			if (cmd.ops[k].is_label()) {
+				m_entries.insert(cmd.ops[k].name);
+			}
+		}
+	}
+}
@@ -0,0 +1,41 @@
+#ifndef FORWARDING_H
+#define FORWARDING_H
+
+#include <array>
+#include <unordered_set>
+#include "asmcode.h"
+#include "asmcfg.h"
+#include "liveness.h"
+
+/// Loads of slots (see AsmEffects) a general register already holds the value of, taken from
+/// the register: a load into the register itself removed, into another one a move, the slot
+/// as the source of an integer command the register. A store of the value the slot holds removed.
+/// A register holds a slot after a load of it, a store of it or a move of a register holding it,
+/// until either is written; a write through a pointer, a call or a change of %rbp forgets all.
+/// A block goes on from its only predecessor if that comes before it and nothing else enters it.
+class LoadForwarding {
+public:
+	LoadForwarding(AsmCode&);
+	/// the number of loads and stores removed or replaced
+	int forward();
+private:
+	typedef std::array<AsmOp, 16> Held;
+	/// false if the command is removed
+	bool m_step(AsmInstr&, Held&);
+	/// the first register holding the slot, -1 if none
+	int m_holder(const Held&, const AsmOp& slot);
+	/// the operand of the slot a register may stand for, -1 if none
+	int m_source(const AsmInstr&, const AsmOp& slot);
+	/// the index of a whole general register, -1 for anything else
+	static int m_gpr(const AsmOp&);
+	static Register m_register(int gpr);
+	/// labels used other than as targets of jumps
+	void m_entered();
+
+	AsmCode& ac;
+	std::vector<AsmInstr>& cmds;
+	std::unordered_set<uint32_t> m_entries;
+	int m_count = 0;
+};
+
+#endif // FORWARDING_H
@@ -0,0 +1,98 @@
+#include "inliner.h"
+#include "profile.h"
+
+using namespace std;
+
+bool Inliner::enabled = false;
+int Inliner::max_size = 24;
+int Inliner::hot_size = 96;
+std::map<SymbolVariable*, PNodeExpression> Inliner::bindings;
+std::set<SymbolProcedure*> Inliner::active;
+std::map<SymbolProcedure*, std::pair<NodeStmtProcedure*, int>> Inliner::m_bodies;
+
+void Inliner::add(NodeStmtProcedure& proc) {
+	int size = 0;
+	for (PNodeStmt part: proc.parts) {
+		size += m_size(part);
+	}
+	m_bodies[proc.symbol.get()] = {&proc, size};
+}
+
+NodeStmtProcedure* Inliner::candidate(const NodeExprStmtFunctionCall& call) {
+	auto body = m_bodies.find(call.proc.get());
+	if (body == m_bodies.end() || active.count(call.proc.get())) {
+		return nullptr;
+	}
+	if (call.proc->is_inline) {
+		return body->second.first;
+	}
+	int64_t count = Profile::count(call.pos, "call " + call.proc->name);
+	int size = count == 0 ? -1 : Profile::is_hot(count) ? hot_size : max_size;
+	if (enabled && body->second.second <= size) {
+		return body->second.first;
+	}
+	return nullptr;
+}
+
+int Inliner::m_size(PNode node) {
+	if (!node) {
+		return 0;
+	}
+	if (PNodeStmtBlock block = dynamic_pointer_cast<NodeStmtBlock>(node)) {
+		int size = 0;
+		for (PNodeStmt stmt: block->stmts) {
+			size += m_size(stmt);
+		}
+		return size;
+	}
+	if (PNodeStmtVar var = dynamic_pointer_cast<NodeStmtVar>(node)) {
+		int size = 0;
+		for (PNodeVarDeclarationUnit unit: var->units) {
+			if (unit->initializer) {
+				size += unit->vars.size()*(1 + m_size(unit->initializer->expr));
+			}
+		}
+		return size;
+	}
+	if (dynamic_pointer_cast<NodeStmtConst>(node) || dynamic_pointer_cast<NodeStmtType>(node)) {
+		return 0;
+	}
+	if (PNodeStmtIf st = dynamic_pointer_cast<NodeStmtIf>(node)) {
+		return 1 + m_size(st->cond) + m_size(st->then_stmt) + m_size(st->else_stmt);
+	}
+	if (PNodeStmtWhile st = dynamic_pointer_cast<NodeStmtWhile>(node)) {
+		return 1 + m_size(st->cond) + m_size(st->stmt);
+	}
+	if (PNodeStmtRepeat st = dynamic_pointer_cast<NodeStmtRepeat>(node)) {
+		return 1 + m_size(st->cond) + m_size(st->stmt);
+	}
+	if (PNodeStmtFor st = dynamic_pointer_cast<NodeStmtFor>(node)) {
+		return 1 + m_size(st->low) + m_size(st->high) + m_size(st->stmt);
+	}
+	if (PNodeExprStmtFunctionCall call = dynamic_pointer_cast<NodeExprStmtFunctionCall>(node)) {
+		int size = 1;
+		if (call->args) {
+			for (PNodeExpression arg: call->args->arglist) {
+				size += m_size(arg);
+			}
+		}
+		return size;
+	}
+	if (PNodeBinaryOperator op = dynamic_pointer_cast<NodeBinaryOperator>(node)) {
+		return 1 + m_size(op->left) + m_size(op->right);
+	}
+	if (PNodeUnaryOperator op = dynamic_pointer_cast<NodeUnaryOperator>(node)) {
+		return 1 + m_size(op->node);
+	}
+	if (PNodeArrayAccess acc = dynamic_pointer_cast<NodeArrayAccess>(node)) {
+		int size = 1 + m_size(acc->array);
+		for (PNodeExpression idx: acc->index->arglist) {
+			size += m_size(idx);
+		}
+		return size;
+	}
+	if (PNodeRecordAccess acc = dynamic_pointer_cast<NodeRecordAccess>(node)) {
+		return 1 + m_size(acc->record);
+	}
+	return 1;
+}
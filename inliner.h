@@ -0,0 +1,31 @@
+#ifndef INLINER_H
+#define INLINER_H
+
+#include <map>
+#include <set>
+#include "node.h"
+
+/// Expands calls of small procedures and functions in place of CALL.
+/// Procedures marked INLINE are expanded whatever their size.
+/// Recursive calls are never expanded.
+/// With a profile, a call never made is left as it is and a hot one is expanded up to hot_size.
+class Inliner {
+public:
+	static bool enabled;
+	/// body size limit in syntax tree nodes
+	static int max_size;
+	static int hot_size;
+	/// remembers a definition for the calls generated after it
+	static void add(NodeStmtProcedure&);
+	/// definition of the called procedure if the call should be expanded
+	static NodeStmtProcedure* candidate(const NodeExprStmtFunctionCall&);
+	/// VAR parameters of expanded procedures substituted by argument variables
+	static std::map<SymbolVariable*, PNodeExpression> bindings;
+	/// procedures being generated or expanded
+	static std::set<SymbolProcedure*> active;
+private:
+	static int m_size(PNode);
+	static std::map<SymbolProcedure*, std::pair<NodeStmtProcedure*, int>> m_bodies;
+};
+
+#endif // INLINER_H
@@ -0,0 +1,250 @@
+#include "interpreter.h"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include "exceptions.h"
+
+using namespace std;
+
+namespace {
+
+/// the native runtime flushes its buffer at this size too
+const size_t out_limit = 1 << 16;
+
+double to_float(int64_t bits) {
+	double value;
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+int64_t to_bits(double value) {
+	int64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+/// cvtsd2si: to nearest, the integer indefinite for nan and out of range
+int64_t float_to_int(double value) {
+	if (std::isnan(value) || value >= 9223372036854775808.0 || value < -9223372036854775808.0) {
+		return INT64_MIN;
+	}
+	return llrint(value);
+}
+
+/// two's complement wrap around like the machine instructions
+int64_t wrap(uint64_t value) {
+	return (int64_t)value;
+}
+
+struct Call {
+	const Bytecode::Function* fn;
+	const Bytecode::Instr* ip;
+	int64_t* base;
+	int32_t dst;
+};
+
+}
+
+Interpreter::Interpreter(const Bytecode& bc) :
+    m_bc(bc),
+    m_globals(new int64_t[(bc.globals_size + 7) / 8 + 1]()),
+    m_stack(new int64_t[stack_quads])
+{}
+
+void Interpreter::m_write(const char* s, size_t n) {
+	m_out.append(s, n);
+	if (m_out.size() >= out_limit) {
+		m_flush();
+	}
+}
+
+void Interpreter::m_flush() {
+	fwrite(m_out.data(), 1, m_out.size(), stdout);
+	fflush(stdout);
+	m_out.clear();
+}
+
+/// The frame of a procedure is [variables][registers], RBP points right after the variables.
+/// Registers of the callee follow the registers of the caller.
+int Interpreter::run() {
+	int64_t* const stack_end = m_stack.get() + stack_quads;
+	char* const globals = (char*)m_globals.get();
+	vector<Call> calls;
+	char buf[32];
+
+	const Bytecode::Function* fn = &m_bc.functions.at(0);
+	int64_t* base = m_stack.get();
+	if (base + fn->regs > stack_end) {
+		throw InterpretError("stack overflow");
+	}
+	int64_t* r = base;
+	char* rbp = (char*)base;
+	const Bytecode::Instr* ip = fn->code.data();
+	const Bytecode::Instr* i;
+
+#ifdef __GNUC__
+	/// labels as values, one indirect jump per instruction
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+	static void* const labels[] = {
+#define INTERPRETER_LABEL(op) &&L_##op,
+		BYTECODE_OPS(INTERPRETER_LABEL)
+#undef INTERPRETER_LABEL
+	};
+#define OP(op) L_##op:
+#define NEXT() i = ip++; goto *labels[i->op]
+	NEXT();
+#else
+#define OP(op) case Bytecode::op:
+#define NEXT() break
+	for (;;) {
+	i = ip++;
+	switch (i->op) {
+#endif
+
+	OP(LOADI) r[i->a] = i->b; NEXT();
+	OP(LOADK) r[i->a] = m_bc.constants[i->b]; NEXT();
+	OP(MOV) r[i->a] = r[i->b]; NEXT();
+	OP(GADDR) r[i->a] = (int64_t)(globals + i->b); NEXT();
+	OP(LADDR) r[i->a] = (int64_t)(rbp + i->b); NEXT();
+	OP(LOAD) memcpy(&r[i->a], (const void*)r[i->b], 8); NEXT();
+	OP(STORE) memcpy((void*)r[i->a], &r[i->b], 8); NEXT();
+
+	OP(ADD) r[i->a] = wrap((uint64_t)r[i->b] + (uint64_t)r[i->c]); NEXT();
+	OP(SUB) r[i->a] = wrap((uint64_t)r[i->b] - (uint64_t)r[i->c]); NEXT();
+	OP(MUL) r[i->a] = wrap((uint64_t)r[i->b] * (uint64_t)r[i->c]); NEXT();
+	OP(DIV)
+		if (r[i->c] == 0 || (r[i->b] == INT64_MIN && r[i->c] == -1)) {
+			m_flush();
+			throw InterpretError("division overflow in " + fn->name);
+		}
+		r[i->a] = r[i->b] / r[i->c];
+		NEXT();
+	OP(MOD)
+		if (r[i->c] == 0 || (r[i->b] == INT64_MIN && r[i->c] == -1)) {
+			m_flush();
+			throw InterpretError("division overflow in " + fn->name);
+		}
+		r[i->a] = r[i->b] % r[i->c];
+		NEXT();
+	OP(XOR) r[i->a] = r[i->b] ^ r[i->c]; NEXT();
+	OP(SHL) r[i->a] = wrap((uint64_t)r[i->b] << (r[i->c] & 63)); NEXT();
+	OP(SHR) r[i->a] = wrap((uint64_t)r[i->b] >> (r[i->c] & 63)); NEXT();
+	OP(ADDI) r[i->a] = wrap((uint64_t)r[i->b] + (uint64_t)(int64_t)i->c); NEXT();
+	OP(MULI) r[i->a] = wrap((uint64_t)r[i->b] * (uint64_t)(int64_t)i->c); NEXT();
+	OP(NEG) r[i->a] = wrap(0 - (uint64_t)r[i->b]); NEXT();
+	OP(NOT) r[i->a] = r[i->b] ^ 1; NEXT();
+
+	OP(FADD) r[i->a] = to_bits(to_float(r[i->b]) + to_float(r[i->c])); NEXT();
+	OP(FSUB) r[i->a] = to_bits(to_float(r[i->b]) - to_float(r[i->c])); NEXT();
+	OP(FMUL) r[i->a] = to_bits(to_float(r[i->b]) * to_float(r[i->c])); NEXT();
+	OP(FDIV) r[i->a] = to_bits(to_float(r[i->b]) / to_float(r[i->c])); NEXT();
+	OP(FNEG) r[i->a] = to_bits(0.0 - to_float(r[i->b])); NEXT();
+	OP(I2F) r[i->a] = to_bits((double)r[i->b]); NEXT();
+	OP(F2I) r[i->a] = float_to_int(to_float(r[i->b])); NEXT();
+
+	OP(EQ) r[i->a] = r[i->b] == r[i->c]; NEXT();
+	OP(NE) r[i->a] = r[i->b] != r[i->c]; NEXT();
+	OP(LT) r[i->a] = r[i->b] < r[i->c]; NEXT();
+	OP(LE) r[i->a] = r[i->b] <= r[i->c]; NEXT();
+	OP(GT) r[i->a] = r[i->b] > r[i->c]; NEXT();
+	OP(GE) r[i->a] = r[i->b] >= r[i->c]; NEXT();
+	/// ucomisd sets ZF, PF and CF when unordered, so =, < and <= hold for nan
+	OP(FEQ) r[i->a] = !(to_float(r[i->b]) < to_float(r[i->c]) || to_float(r[i->b]) > to_float(r[i->c])); NEXT();
+	OP(FNE) r[i->a] = to_float(r[i->b]) < to_float(r[i->c]) || to_float(r[i->b]) > to_float(r[i->c]); NEXT();
+	OP(FLT) r[i->a] = !(to_float(r[i->b]) >= to_float(r[i->c])); NEXT();
+	OP(FLE) r[i->a] = !(to_float(r[i->b]) > to_float(r[i->c])); NEXT();
+	OP(FGT) r[i->a] = to_float(r[i->b]) > to_float(r[i->c]); NEXT();
+	OP(FGE) r[i->a] = to_float(r[i->b]) >= to_float(r[i->c]); NEXT();
+
+	OP(JMP) ip = fn->code.data() + i->a; NEXT();
+	OP(JZ)
+		if (!r[i->a]) {
+			ip = fn->code.data() + i->b;
+		}
+		NEXT();
+	OP(JNZ)
+		if (r[i->a]) {
+			ip = fn->code.data() + i->b;
+		}
+		NEXT();
+
+	OP(CALL) {
+		const Bytecode::Function* callee = &m_bc.functions[i->b];
+		const int64_t* args = r + i->c;
+		int64_t* callee_base = r + fn->regs;
+		int64_t variables = callee->frame_size / 8;
+		if (callee_base + variables + callee->regs > stack_end) {
+			m_flush();
+			throw InterpretError("stack overflow in " + callee->name);
+		}
+		calls.push_back({fn, ip, base, i->a});
+		memset(callee_base, 0, callee->frame_size);
+		fn = callee;
+		base = callee_base;
+		rbp = (char*)(base + variables);
+		r = base + variables;
+		for (size_t n = 0; n < fn->params.size(); n++) {
+			const Bytecode::Param& param = fn->params[n];
+			if (param.copied) {
+				memcpy(rbp + param.offset, (const void*)args[n], param.copied);
+			} else {
+				memcpy(rbp + param.offset, &args[n], 8);
+			}
+		}
+		ip = fn->code.data();
+		NEXT();
+	}
+	OP(RET) {
+		int64_t value = r[i->a];
+		const Call& call = calls.back();
+		fn = call.fn;
+		ip = call.ip;
+		base = call.base;
+		rbp = (char*)(base + fn->frame_size / 8);
+		r = base + fn->frame_size / 8;
+		r[call.dst] = value;
+		calls.pop_back();
+		NEXT();
+	}
+	OP(RET0) {
+		const Call& call = calls.back();
+		fn = call.fn;
+		ip = call.ip;
+		base = call.base;
+		rbp = (char*)(base + fn->frame_size / 8);
+		r = base + fn->frame_size / 8;
+		r[call.dst] = 0;
+		calls.pop_back();
+		NEXT();
+	}
+	OP(HALT)
+		m_flush();
+		return 0;
+
+	OP(WRITEI) m_write(buf, snprintf(buf, sizeof(buf), "%lld", (long long)r[i->a])); NEXT();
+	OP(WRITEF) {
+		double value = to_float(r[i->a]);
+		int n = snprintf(buf, sizeof(buf), "%lf", value);
+		if (n < (int)sizeof(buf)) {
+			m_write(buf, n);
+		} else {
+			/// large reals have up to 309 integer digits
+			string s(n + 1, '\0');
+			snprintf(&s[0], s.size(), "%lf", value);
+			m_write(s.data(), n);
+		}
+		NEXT();
+	}
+	OP(WRITES) m_write(m_bc.strings[i->a].data(), m_bc.strings[i->a].size()); NEXT();
+	OP(WRITEC) buf[0] = i->a; m_write(buf, 1); NEXT();
+
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#else
+	}
+	}
+#endif
+#undef OP
+#undef NEXT
+}
@@ -0,0 +1,28 @@
+#ifndef INTERPRETER_H
+#define INTERPRETER_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "bytecode.h"
+
+/// Runs Bytecode with threaded dispatch (computed goto where the compiler has it).
+/// Frames live on a stack of quads: the variables of the procedure as laid out
+/// below RBP by SymbolProcedure::layout_frame, then its registers.
+class Interpreter {
+public:
+	Interpreter(const Bytecode&);
+	/// exit code of the program
+	int run();
+	static const size_t stack_quads = 1 << 22;
+private:
+	const Bytecode& m_bc;
+	std::unique_ptr<int64_t[]> m_globals;
+	std::unique_ptr<int64_t[]> m_stack;
+	/// written like the native runtime does, in large blocks
+	std::string m_out;
+	void m_write(const char*, size_t);
+	void m_flush();
+};
+
+#endif // INTERPRETER_H
@@ -0,0 +1,310 @@
+#include "ir.h"
+#include <algorithm>
+#include "exceptions.h"
+#include "iranalysis.h"
+#include "symbol.h"
+
+using namespace std;
+
+const char* ir_op_name(IrOp op) {
+	static const char* names[] = {
+#define IR_NAME(op) #op,
+		IR_OPS(IR_NAME)
+#undef IR_NAME
+	};
+	return names[op];
+}
+
+const char* ir_type_name(IrType type) {
+	static const char* names[] = {"void", "int", "float", "ptr"};
+	return names[type];
+}
+
+const char* ir_alias_name(IrAlias alias) {
+	static const char* names[] = {"any", "variable", "array", "record"};
+	return names[alias];
+}
+
+bool ir_may_alias(IrAlias alias, int address, IrAlias other, int other_address) {
+	if (alias == IR_ALIAS_ANY || other == IR_ALIAS_ANY) {
+		return true;
+	}
+	if (alias != other) {
+		return false;
+	}
+	return alias != IR_ALIAS_VARIABLE || address == other_address;
+}
+
+bool IrInstr::is_terminator() const {
+	return op == IR_JMP || op == IR_BR || op == IR_RET;
+}
+
+bool IrInstr::is_pure() const {
+	switch (op) {
+	case IR_STORE:
+	case IR_COPY:
+	case IR_CALL:
+	case IR_WRITE:
+	case IR_CHECK:
+	case IR_COUNT:
+	case IR_JMP:
+	case IR_BR:
+	case IR_RET:
+	/// may fault
+	case IR_LOAD:
+	case IR_DIV:
+	case IR_MOD:
+		return false;
+	default:
+		return true;
+	}
+}
+
+bool IrInstr::is_memory() const {
+	return op == IR_LOAD || op == IR_STORE || op == IR_COPY || op == IR_CALL || op == IR_WRITE;
+}
+
+int IrFunction::new_value(IrType type) {
+	values.push_back(type);
+	return values.size() - 1;
+}
+
+int IrFunction::new_block() {
+	blocks.push_back({});
+	return blocks.size() - 1;
+}
+
+void IrFunction::update_cfg() {
+	for (IrBlock& block: blocks) {
+		block.preds.clear();
+		block.succs.clear();
+	}
+	for (size_t b = 0; b < blocks.size(); b++) {
+		if (blocks[b].instrs.empty() || !blocks[b].instrs.back().is_terminator()) {
+			continue;
+		}
+		for (int succ: blocks[b].instrs.back().blocks) {
+			vector<int>& succs = blocks[b].succs;
+			if (find(succs.begin(), succs.end(), succ) == succs.end()) {
+				succs.push_back(succ);
+				blocks[succ].preds.push_back(b);
+			}
+		}
+	}
+}
+
+bool IrFunction::remove_unreachable() {
+	update_cfg();
+	vector<bool> reachable(blocks.size(), false);
+	vector<int> stack = {0};
+	reachable[0] = true;
+	while (!stack.empty()) {
+		int b = stack.back();
+		stack.pop_back();
+		for (int succ: blocks[b].succs) {
+			if (!reachable[succ]) {
+				reachable[succ] = true;
+				stack.push_back(succ);
+			}
+		}
+	}
+	if (find(reachable.begin(), reachable.end(), false) == reachable.end()) {
+		return false;
+	}
+	vector<int> number(blocks.size(), -1);
+	vector<IrBlock> kept;
+	for (size_t b = 0; b < blocks.size(); b++) {
+		if (reachable[b]) {
+			number[b] = kept.size();
+			kept.push_back(move(blocks[b]));
+		}
+	}
+	blocks.swap(kept);
+	for (IrBlock& block: blocks) {
+		for (IrInstr& instr: block.instrs) {
+			if (instr.op != IR_PHI) {
+				for (int& target: instr.blocks) {
+					target = number[target];
+				}
+				continue;
+			}
+			/// arguments coming from dropped blocks go with them
+			size_t n = 0;
+			for (size_t i = 0; i < instr.blocks.size(); i++) {
+				if (number[instr.blocks[i]] != -1) {
+					instr.args[n] = instr.args[i];
+					instr.blocks[n++] = number[instr.blocks[i]];
+				}
+			}
+			instr.args.resize(n);
+			instr.blocks.resize(n);
+		}
+	}
+	update_cfg();
+	return true;
+}
+
+void IrFunction::replace_values(const vector<int>& map) {
+	for (IrBlock& block: blocks) {
+		for (IrInstr& instr: block.instrs) {
+			for (int& arg: instr.args) {
+				/// replacements may be chained
+				while (arg < (int)map.size() && map[arg] != -1 && map[arg] != arg) {
+					arg = map[arg];
+				}
+			}
+		}
+	}
+}
+
+vector<pair<int, int>> IrFunction::definitions() const {
+	vector<pair<int, int>> result(values.size(), {-1, -1});
+	for (size_t b = 0; b < blocks.size(); b++) {
+		for (size_t i = 0; i < blocks[b].instrs.size(); i++) {
+			int dst = blocks[b].instrs[i].dst;
+			if (dst != -1) {
+				result[dst] = {b, i};
+			}
+		}
+	}
+	return result;
+}
+
+vector<int> IrFunction::use_counts() const {
+	vector<int> result(values.size(), 0);
+	for (const IrBlock& block: blocks) {
+		for (const IrInstr& instr: block.instrs) {
+			for (int arg: instr.args) {
+				result[arg]++;
+			}
+		}
+	}
+	return result;
+}
+
+void IrFunction::verify() const {
+	auto fail = [this](const string& msg) {
+		throw IrError("ir of " + name + ": " + msg);
+	};
+	vector<pair<int, int>> defs(values.size(), {-1, -1});
+	for (size_t b = 0; b < blocks.size(); b++) {
+		const vector<IrInstr>& instrs = blocks[b].instrs;
+		if (instrs.empty() || !instrs.back().is_terminator()) {
+			fail("block " + to_string(b) + " has no terminator");
+		}
+		for (size_t i = 0; i < instrs.size(); i++) {
+			const IrInstr& instr = instrs[i];
+			if (instr.is_terminator() && i + 1 != instrs.size()) {
+				fail("terminator inside block " + to_string(b));
+			}
+			if (instr.op == IR_PHI && i > 0 && instrs[i - 1].op != IR_PHI) {
+				fail("phi after other instructions in block " + to_string(b));
+			}
+			if (instr.dst == -1) {
+				continue;
+			}
+			if (instr.dst >= (int)values.size() || defs[instr.dst].first != -1) {
+				fail("value " + to_string(instr.dst) + " is defined twice");
+			}
+			defs[instr.dst] = {b, i};
+		}
+	}
+	DominatorTree dt(*this);
+	for (size_t b = 0; b < blocks.size(); b++) {
+		for (size_t i = 0; i < blocks[b].instrs.size(); i++) {
+			const IrInstr& instr = blocks[b].instrs[i];
+			if (instr.op == IR_PHI && instr.blocks.size() != blocks[b].preds.size()) {
+				fail("phi of value " + to_string(instr.dst) + " does not match the predecessors");
+			}
+			for (size_t k = 0; k < instr.args.size(); k++) {
+				int arg = instr.args[k];
+				if (arg < 0 || arg >= (int)values.size() || defs[arg].first == -1) {
+					fail("value " + to_string(arg) + " is not defined");
+				}
+				/// the argument of a phi has to be available at the end of its predecessor
+				int use_block = instr.op == IR_PHI ? instr.blocks[k] : b;
+				int def_block = defs[arg].first;
+				bool is_available = def_block == use_block ?
+				                    instr.op == IR_PHI || defs[arg].second < (int)i :
+				                    dt.dominates(def_block, use_block);
+				if (dt.is_reachable(use_block) && !is_available) {
+					fail("value " + to_string(arg) + " does not dominate its use in block " + to_string(b));
+				}
+			}
+		}
+	}
+}
+
+namespace {
+
+string value_str(int v) {
+	return "%" + to_string(v);
+}
+
+string block_str(int b) {
+	return "b" + to_string(b);
+}
+
+}
+
+ostream& IrFunction::print(ostream& os) const {
+	os << "function " << name << " frame " << frame_size << " -> " << ir_type_name(result) << "\n";
+	for (size_t b = 0; b < blocks.size(); b++) {
+		os << block_str(b) << ":";
+		if (!blocks[b].preds.empty()) {
+			os << " ; preds";
+			for (int pred: blocks[b].preds) {
+				os << " " << block_str(pred);
+			}
+		}
+		if (blocks[b].count != -1) {
+			os << " ; count " << blocks[b].count;
+		}
+		os << "\n";
+		for (const IrInstr& instr: blocks[b].instrs) {
+			os << "\t";
+			if (instr.dst != -1) {
+				os << value_str(instr.dst) << ":" << ir_type_name(instr.type) << " = ";
+			}
+			os << ir_op_name(instr.op);
+			vector<string> operands;
+			if (!instr.name.empty()) {
+				operands.push_back(instr.name);
+			}
+			if (instr.op == IR_CONST || instr.op == IR_LOCAL || instr.op == IR_STRING || instr.op == IR_PARAM || instr.op == IR_COPY ||
+			    instr.op == IR_CHECK || instr.op == IR_COUNT) {
+				operands.push_back(to_string(instr.imm));
+			}
+			for (size_t i = 0; i < instr.args.size(); i++) {
+				operands.push_back(value_str(instr.args[i]) + (instr.op == IR_PHI ? " " + block_str(instr.blocks[i]) : ""));
+			}
+			if (instr.op == IR_LOAD || instr.op == IR_STORE) {
+				operands.push_back(ir_alias_name(instr.alias));
+			}
+			if (instr.op != IR_PHI) {
+				for (int target: instr.blocks) {
+					operands.push_back(block_str(target));
+				}
+			}
+			for (size_t i = 0; i < operands.size(); i++) {
+				os << (i ? ", " : " ") << operands[i];
+			}
+			os << "\n";
+		}
+	}
+	return os;
+}
+
+ostream& IrModule::print(ostream& os) const {
+	for (const PSymbolVariable& var: globals) {
+		os << "global " << var->label << " " << var->size() << "\n";
+	}
+	for (size_t i = 0; i < strings.size(); i++) {
+		os << "string " << i << " \"" << strings[i] << "\"\n";
+	}
+	for (const IrFunction& fn: functions) {
+		os << "\n";
+		fn.print(os);
+	}
+	return os;
+}
@@ -0,0 +1,154 @@
+#ifndef IR_H
+#define IR_H
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "types.h"
+
+/// args are values, blocks are jump targets or the predecessors of a phi
+#define IR_OPS(X) \
+	X(CONST)  /* bits in imm */ \
+	X(GLOBAL) /* address of the global name */ \
+	X(LOCAL)  /* RBP + imm */ \
+	X(STRING) /* address of strings[imm] */ \
+	X(PARAM)  /* argument imm as passed by the caller */ \
+	X(LOAD)   /* *args[0] */ \
+	X(STORE)  /* *args[0] = args[1] */ \
+	X(COPY)   /* imm bytes from args[1] to args[0] */ \
+	X(ADD) \
+	X(SUB) \
+	X(MUL) \
+	X(DIV) \
+	X(MOD) \
+	X(XOR) \
+	X(SHL) \
+	X(SHR) \
+	X(NEG) \
+	X(NOT)    /* args[0] xor 1 */ \
+	X(FADD) \
+	X(FSUB) \
+	X(FMUL) \
+	X(FDIV) \
+	X(FNEG)   /* 0.0 - args[0] */ \
+	X(I2F) \
+	X(F2I) \
+	X(EQ) \
+	X(NE) \
+	X(LT) \
+	X(LE) \
+	X(GT) \
+	X(GE) \
+	X(FEQ) \
+	X(FNE) \
+	X(FLT) \
+	X(FLE) \
+	X(FGT) \
+	X(FGE) \
+	X(PHI) \
+	X(CALL)   /* procedure name with args */ \
+	X(WRITE)  /* runtime routine name with args[0] */ \
+	X(CHECK)  /* range error unless args[0] < imm unsigned */ \
+	X(COUNT)  /* adds one to the profile counter imm of the key name */ \
+	X(JMP)    /* to blocks[0] */ \
+	X(BR)     /* to blocks[0] if args[0] <> 0, to blocks[1] otherwise */ \
+	X(RET)    /* args[0] if any */
+
+enum IrOp {
+#define IR_ENUM(op) IR_##op,
+	IR_OPS(IR_ENUM)
+#undef IR_ENUM
+};
+
+/// every value is a quad, the type tells which registers suit it
+enum IrType {
+	IR_VOID,
+	IR_INT,
+	IR_FLOAT,
+	IR_PTR,
+};
+
+/// what a LOAD or STORE reaches by the path of its address: a scalar variable itself,
+/// an element of an array, a field of a record, or anything when through a pointer
+enum IrAlias {
+	IR_ALIAS_ANY,
+	IR_ALIAS_VARIABLE,
+	IR_ALIAS_ARRAY,
+	IR_ALIAS_RECORD,
+};
+
+struct IrInstr {
+	IrOp op;
+	IrType type = IR_VOID;
+	/// value defined, -1 if none
+	int dst = -1;
+	std::vector<int> args;
+	std::vector<int> blocks;
+	int64_t imm = 0;
+	IrAlias alias = IR_ALIAS_ANY;
+	std::string name;
+	/// callee, for the places of the arguments
+	PSymbolProcedure proc;
+	bool is_terminator() const;
+	/// can be removed if dst is not used
+	bool is_pure() const;
+	/// reads or writes memory, calls included
+	bool is_memory() const;
+};
+
+struct IrBlock {
+	std::vector<IrInstr> instrs;
+	/// times run by the loaded profile, -1 if unknown
+	int64_t count = -1;
+	/// filled by IrFunction::update_cfg
+	std::vector<int> preds;
+	std::vector<int> succs;
+};
+
+/// Blocks are numbered by their index, the entry is 0.
+/// Each value is defined once, its number indexes values.
+class IrFunction {
+public:
+	std::string name;
+	/// nullptr for the main program
+	PSymbolProcedure symbol;
+	/// bytes of variables below RBP, as laid out by SymbolProcedure::layout_frame
+	int64_t frame_size = 0;
+	IrType result = IR_VOID;
+	std::vector<IrBlock> blocks;
+	std::vector<IrType> values;
+	int new_value(IrType);
+	int new_block();
+	void update_cfg();
+	/// unreachable blocks are dropped and the rest renumbered, true if any was
+	bool remove_unreachable();
+	/// uses of value v are replaced with map[v] where it is not -1
+	void replace_values(const std::vector<int>& map);
+	/// block and index of the instruction defining each value, -1 for none
+	std::vector<std::pair<int, int>> definitions() const;
+	/// number of uses of each value
+	std::vector<int> use_counts() const;
+	/// throws IrError on a malformed function
+	void verify() const;
+	std::ostream& print(std::ostream&) const;
+};
+
+class IrModule {
+public:
+	/// main program first
+	std::vector<IrFunction> functions;
+	/// in the order of declaration
+	std::vector<PSymbolVariable> globals;
+	std::vector<std::string> strings;
+	std::ostream& print(std::ostream&) const;
+};
+
+const char* ir_op_name(IrOp);
+const char* ir_type_name(IrType);
+const char* ir_alias_name(IrAlias);
+/// accesses of different kinds never overlap, variables only at the same address;
+/// the addresses are values numbered alike
+bool ir_may_alias(IrAlias, int address, IrAlias other, int other_address);
+
+#endif // IR_H
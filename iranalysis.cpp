@@ -0,0 +1,450 @@
+#include "iranalysis.h"
+#include <algorithm>
+#include "symbol.h"
+
+using namespace std;
+
+DominatorTree::DominatorTree(const IrFunction& fn) :
+    m_idom(fn.blocks.size(), -1),
+    m_rpo_index(fn.blocks.size(), -1),
+    m_children(fn.blocks.size()),
+    m_frontier(fn.blocks.size()),
+    m_enter(fn.blocks.size(), -1),
+    m_leave(fn.blocks.size(), -1)
+{
+	if (fn.blocks.empty()) {
+		return;
+	}
+	/// postorder without recursion, a block is done when all its successors are
+	vector<int> postorder;
+	vector<bool> visited(fn.blocks.size(), false);
+	vector<pair<int, size_t>> stack = {{0, 0}};
+	visited[0] = true;
+	while (!stack.empty()) {
+		pair<int, size_t>& top = stack.back();
+		const vector<int>& succs = fn.blocks[top.first].succs;
+		if (top.second < succs.size()) {
+			int next = succs[top.second++];
+			if (!visited[next]) {
+				visited[next] = true;
+				stack.push_back({next, 0});
+			}
+			continue;
+		}
+		postorder.push_back(top.first);
+		stack.pop_back();
+	}
+	m_order.assign(postorder.rbegin(), postorder.rend());
+	for (size_t i = 0; i < m_order.size(); i++) {
+		m_rpo_index[m_order[i]] = i;
+	}
+
+	m_idom[0] = 0;
+	bool is_changed = true;
+	while (is_changed) {
+		is_changed = false;
+		for (size_t i = 1; i < m_order.size(); i++) {
+			int block = m_order[i];
+			int idom = -1;
+			for (int pred: fn.blocks[block].preds) {
+				if (m_idom[pred] == -1) {
+					continue;
+				}
+				idom = idom == -1 ? pred : m_intersect(pred, idom);
+			}
+			if (m_idom[block] != idom) {
+				m_idom[block] = idom;
+				is_changed = true;
+			}
+		}
+	}
+	m_idom[0] = -1;
+
+	for (int block: m_order) {
+		if (m_idom[block] != -1) {
+			m_children[m_idom[block]].push_back(block);
+		}
+	}
+	int counter = 0;
+	vector<pair<int, size_t>> walk = {{0, 0}};
+	m_enter[0] = counter++;
+	while (!walk.empty()) {
+		pair<int, size_t>& top = walk.back();
+		if (top.second < m_children[top.first].size()) {
+			int child = m_children[top.first][top.second++];
+			m_enter[child] = counter++;
+			walk.push_back({child, 0});
+			continue;
+		}
+		m_leave[top.first] = counter++;
+		walk.pop_back();
+	}
+
+	/// a join point is in the frontier of the blocks from its predecessors up to its idom
+	for (int block: m_order) {
+		const vector<int>& preds = fn.blocks[block].preds;
+		if (preds.size() < 2) {
+			continue;
+		}
+		for (int pred: preds) {
+			if (!is_reachable(pred)) {
+				continue;
+			}
+			for (int runner = pred; runner != m_idom[block] && runner != -1; runner = m_idom[runner]) {
+				vector<int>& frontier = m_frontier[runner];
+				if (find(frontier.begin(), frontier.end(), block) == frontier.end()) {
+					frontier.push_back(block);
+				}
+			}
+		}
+	}
+}
+
+int DominatorTree::m_intersect(int a, int b) const {
+	while (a != b) {
+		while (m_rpo_index[a] > m_rpo_index[b]) {
+			a = m_idom[a];
+		}
+		while (m_rpo_index[b] > m_rpo_index[a]) {
+			b = m_idom[b];
+		}
+	}
+	return a;
+}
+
+int DominatorTree::idom(int block) const {
+	return m_idom[block];
+}
+
+bool DominatorTree::dominates(int a, int b) const {
+	if (!is_reachable(a) || !is_reachable(b)) {
+		return false;
+	}
+	return m_enter[a] <= m_enter[b] && m_leave[b] <= m_leave[a];
+}
+
+bool DominatorTree::is_reachable(int block) const {
+	return m_rpo_index[block] != -1;
+}
+
+const vector<int>& DominatorTree::children(int block) const {
+	return m_children[block];
+}
+
+const vector<int>& DominatorTree::frontier(int block) const {
+	return m_frontier[block];
+}
+
+const vector<int>& DominatorTree::order() const {
+	return m_order;
+}
+
+Liveness::Liveness(const IrFunction& fn) :
+    m_in(fn.blocks.size()),
+    m_out(fn.blocks.size())
+{
+	/// uses before any definition in the block and the definitions, phis apart
+	vector<set<int>> uses(fn.blocks.size()), defs(fn.blocks.size());
+	for (size_t b = 0; b < fn.blocks.size(); b++) {
+		for (const IrInstr& instr: fn.blocks[b].instrs) {
+			if (instr.op != IR_PHI) {
+				for (int arg: instr.args) {
+					if (!defs[b].count(arg)) {
+						uses[b].insert(arg);
+					}
+				}
+			}
+			if (instr.dst != -1) {
+				defs[b].insert(instr.dst);
+			}
+		}
+	}
+	bool is_changed = true;
+	while (is_changed) {
+		is_changed = false;
+		for (int b = fn.blocks.size() - 1; b >= 0; b--) {
+			set<int> out;
+			for (int succ: fn.blocks[b].succs) {
+				/// phi results are defined on the edge, their arguments used on it
+				set<int> edge = m_in[succ];
+				for (const IrInstr& instr: fn.blocks[succ].instrs) {
+					if (instr.op != IR_PHI) {
+						break;
+					}
+					edge.erase(instr.dst);
+				}
+				for (const IrInstr& instr: fn.blocks[succ].instrs) {
+					if (instr.op != IR_PHI) {
+						break;
+					}
+					for (size_t i = 0; i < instr.blocks.size(); i++) {
+						if (instr.blocks[i] == b) {
+							edge.insert(instr.args[i]);
+						}
+					}
+				}
+				out.insert(edge.begin(), edge.end());
+			}
+			set<int> in = uses[b];
+			for (int v: out) {
+				if (!defs[b].count(v)) {
+					in.insert(v);
+				}
+			}
+			for (const IrInstr& instr: fn.blocks[b].instrs) {
+				if (instr.op == IR_PHI) {
+					in.insert(instr.dst);
+				}
+			}
+			if (in != m_in[b] || out != m_out[b]) {
+				m_in[b].swap(in);
+				m_out[b].swap(out);
+				is_changed = true;
+			}
+		}
+	}
+}
+
+const set<int>& Liveness::live_in(int block) const {
+	return m_in[block];
+}
+
+const set<int>& Liveness::live_out(int block) const {
+	return m_out[block];
+}
+
+LoopInfo::LoopInfo(const IrFunction& fn, const DominatorTree& dt) {
+	map<int, size_t> by_header;
+	for (int b: dt.order()) {
+		for (int succ: fn.blocks[b].succs) {
+			if (!dt.dominates(succ, b)) {
+				continue;
+			}
+			if (!by_header.count(succ)) {
+				by_header[succ] = m_loops.size();
+				m_loops.push_back({});
+				m_loops.back().header = succ;
+				m_loops.back().blocks.insert(succ);
+			}
+			/// the blocks reaching the back edge without passing the header
+			Loop& loop = m_loops[by_header[succ]];
+			vector<int> stack;
+			if (loop.blocks.insert(b).second) {
+				stack.push_back(b);
+			}
+			while (!stack.empty()) {
+				int block = stack.back();
+				stack.pop_back();
+				for (int pred: fn.blocks[block].preds) {
+					if (dt.is_reachable(pred) && loop.blocks.insert(pred).second) {
+						stack.push_back(pred);
+					}
+				}
+			}
+		}
+	}
+	for (Loop& loop: m_loops) {
+		for (int pred: fn.blocks[loop.header].preds) {
+			if (loop.blocks.count(pred) || !dt.is_reachable(pred)) {
+				continue;
+			}
+			if (loop.preheader != -1 || fn.blocks[pred].succs.size() != 1) {
+				loop.preheader = -1;
+				break;
+			}
+			loop.preheader = pred;
+		}
+	}
+	stable_sort(m_loops.begin(), m_loops.end(), [](const Loop& a, const Loop& b) {
+		return a.blocks.size() < b.blocks.size();
+	});
+}
+
+const vector<LoopInfo::Loop>& LoopInfo::loops() const {
+	return m_loops;
+}
+
+bool AliasAnalysis::Effects::any() const {
+	return !globals.empty() || classes[IR_ALIAS_ANY] || classes[IR_ALIAS_ARRAY] || classes[IR_ALIAS_RECORD];
+}
+
+AliasAnalysis::AliasAnalysis(const IrModule& module) {
+	map<string, set<string>> callees;
+	for (const IrFunction& fn: module.functions) {
+		FunctionInfo& info = m_functions[fn.name];
+		info.roots.resize(fn.values.size());
+		/// the addresses of variables and those computed from them, defined before used
+		DominatorTree dt(fn);
+		for (int b: dt.order()) {
+			for (const IrInstr& instr: fn.blocks[b].instrs) {
+				if (instr.op == IR_GLOBAL) {
+					info.roots[instr.dst] = {ROOT_GLOBAL, true, instr.name};
+				} else if (instr.op == IR_LOCAL) {
+					info.roots[instr.dst].kind = ROOT_FRAME;
+					info.roots[instr.dst].is_direct = true;
+					info.roots[instr.dst].offset = instr.imm;
+				} else if ((instr.op == IR_ADD || instr.op == IR_SUB) && instr.type == IR_PTR) {
+					for (int arg: instr.args) {
+						if (info.roots[arg].kind != ROOT_NONE) {
+							info.roots[instr.dst] = info.roots[arg];
+							info.roots[instr.dst].is_direct = false;
+						}
+					}
+				}
+			}
+		}
+		for (const IrBlock& block: fn.blocks) {
+			for (const IrInstr& instr: block.instrs) {
+				/// the uses that do not let the address out
+				for (size_t i = 0; i < instr.args.size(); i++) {
+					const Root& root = info.roots[instr.args[i]];
+					if (root.kind == ROOT_NONE) {
+						continue;
+					}
+					bool is_kept =
+						((instr.op == IR_LOAD || instr.op == IR_STORE) && i == 0 && instr.alias != IR_ALIAS_ANY) ||
+						instr.op == IR_COPY || instr.op == IR_WRITE ||
+						((instr.op == IR_ADD || instr.op == IR_SUB) && instr.type == IR_PTR) ||
+						(instr.op == IR_CALL && instr.proc && !instr.proc->is_nth_var.at(i));
+					if (is_kept) {
+						continue;
+					}
+					if (root.kind == ROOT_GLOBAL) {
+						m_is_globals_escaped = true;
+					} else {
+						info.is_frame_escaped = true;
+					}
+				}
+				if (instr.op == IR_CALL) {
+					callees[fn.name].insert(instr.name);
+				}
+				if (instr.op != IR_STORE && instr.op != IR_COPY) {
+					continue;
+				}
+				const Root& root = info.roots[instr.args[0]];
+				if (root.kind == ROOT_FRAME) {
+					continue;
+				}
+				if (root.kind == ROOT_GLOBAL && root.is_direct && instr.op == IR_STORE) {
+					info.effects.globals.insert(root.global);
+				} else if (instr.op == IR_COPY) {
+					/// a whole array or record
+					info.effects.classes[root.kind == ROOT_GLOBAL ? IR_ALIAS_ARRAY : IR_ALIAS_ANY] = true;
+					info.effects.classes[IR_ALIAS_RECORD] = true;
+				} else {
+					info.effects.classes[instr.alias] = true;
+				}
+			}
+		}
+	}
+	/// what the callees change, to the fixed point over the calls
+	bool is_changed = true;
+	while (is_changed) {
+		is_changed = false;
+		for (auto& caller: callees) {
+			Effects& effects = m_functions[caller.first].effects;
+			for (const string& callee: caller.second) {
+				auto it = m_functions.find(callee);
+				if (it == m_functions.end()) {
+					for (bool& c: effects.classes) {
+						is_changed |= !c;
+						c = true;
+					}
+					continue;
+				}
+				const Effects& other = it->second.effects;
+				for (const string& global: other.globals) {
+					is_changed |= effects.globals.insert(global).second;
+				}
+				for (int c = 0; c < 4; c++) {
+					is_changed |= other.classes[c] && !effects.classes[c];
+					effects.classes[c] |= other.classes[c];
+				}
+			}
+		}
+	}
+}
+
+bool AliasAnalysis::Root::is_same_variable(const Root& other) const {
+	if (!is_direct || !other.is_direct || kind != other.kind) {
+		return false;
+	}
+	return kind == ROOT_GLOBAL ? global == other.global : offset == other.offset;
+}
+
+const AliasAnalysis::FunctionInfo& AliasAnalysis::m_info(const IrFunction& fn) const {
+	return m_functions.at(fn.name);
+}
+
+bool AliasAnalysis::m_is_escaped(const FunctionInfo& info, const Root& root) const {
+	switch (root.kind) {
+	case ROOT_GLOBAL:
+		return m_is_globals_escaped;
+	case ROOT_FRAME:
+		return info.is_frame_escaped;
+	default:
+		return true;
+	}
+}
+
+bool AliasAnalysis::is_variable_load(const IrFunction& fn, const IrInstr& load) const {
+	const FunctionInfo& info = m_info(fn);
+	return load.args[0] < (int)info.roots.size() && info.roots[load.args[0]].is_direct;
+}
+
+bool AliasAnalysis::may_clobber(const IrFunction& fn, const IrInstr& instr, const IrInstr& load) const {
+	const FunctionInfo& info = m_info(fn);
+	if (load.args[0] >= (int)info.roots.size()) {
+		return true;
+	}
+	switch (instr.op) {
+	case IR_STORE:
+	case IR_COPY:
+		return m_store_clobbers(info, instr, load);
+	case IR_CALL:
+		return m_call_clobbers(info, instr, load);
+	default:
+		return false;
+	}
+}
+
+bool AliasAnalysis::m_store_clobbers(const FunctionInfo& info, const IrInstr& store, const IrInstr& load) const {
+	const Root& root = info.roots[load.args[0]];
+	const Root& store_root = info.roots[store.args[0]];
+	if (store.op == IR_COPY && store_root.kind != ROOT_NONE) {
+		/// into an array or record variable
+		return load.alias != IR_ALIAS_VARIABLE;
+	}
+	IrAlias alias = store.op == IR_COPY ? IR_ALIAS_ANY : store.alias;
+	if (alias == IR_ALIAS_VARIABLE && load.alias == IR_ALIAS_VARIABLE) {
+		return !store_root.is_direct || !root.is_direct || store_root.is_same_variable(root);
+	}
+	if (alias == IR_ALIAS_ANY && load.alias == IR_ALIAS_VARIABLE) {
+		return store_root.is_same_variable(root) || m_is_escaped(info, root);
+	}
+	if (alias == IR_ALIAS_VARIABLE && load.alias == IR_ALIAS_ANY) {
+		return store_root.is_same_variable(root) || m_is_escaped(info, store_root);
+	}
+	return ir_may_alias(alias, store.args[0], load.alias, load.args[0]);
+}
+
+bool AliasAnalysis::m_call_clobbers(const FunctionInfo& info, const IrInstr& call, const IrInstr& load) const {
+	auto it = m_functions.find(call.name);
+	if (it == m_functions.end()) {
+		return true;
+	}
+	const Effects& effects = it->second.effects;
+	const Root& root = info.roots[load.args[0]];
+	switch (load.alias) {
+	case IR_ALIAS_VARIABLE:
+		if (root.kind == ROOT_GLOBAL && effects.globals.count(root.global)) {
+			return true;
+		}
+		return effects.classes[IR_ALIAS_ANY] && m_is_escaped(info, root);
+	case IR_ALIAS_ARRAY:
+	case IR_ALIAS_RECORD:
+		return effects.classes[load.alias] || effects.classes[IR_ALIAS_ANY];
+	default:
+		return effects.any();
+	}
+}
@@ -0,0 +1,106 @@
+#ifndef IRANALYSIS_H
+#define IRANALYSIS_H
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include "ir.h"
+
+/// Immediate dominators by the iterative algorithm of Cooper, Harvey and Kennedy,
+/// with the dominance frontiers. Needs the preds and succs of IrFunction::update_cfg.
+class DominatorTree {
+public:
+	DominatorTree(const IrFunction&);
+	/// -1 for the entry and unreachable blocks
+	int idom(int block) const;
+	bool dominates(int a, int b) const;
+	bool is_reachable(int block) const;
+	const std::vector<int>& children(int block) const;
+	const std::vector<int>& frontier(int block) const;
+	/// reachable blocks in reverse postorder
+	const std::vector<int>& order() const;
+private:
+	std::vector<int> m_idom;
+	std::vector<int> m_rpo_index;
+	std::vector<int> m_order;
+	std::vector<std::vector<int>> m_children;
+	std::vector<std::vector<int>> m_frontier;
+	/// preorder numbers of the tree for dominates()
+	std::vector<int> m_enter, m_leave;
+	int m_intersect(int a, int b) const;
+};
+
+/// Values live at the start and the end of each block.
+/// A phi uses its argument at the end of the matching predecessor.
+class Liveness {
+public:
+	Liveness(const IrFunction&);
+	const std::set<int>& live_in(int block) const;
+	const std::set<int>& live_out(int block) const;
+private:
+	std::vector<std::set<int>> m_in, m_out;
+};
+
+/// Natural loops of the back edges, one per header, inner loops first.
+class LoopInfo {
+public:
+	struct Loop {
+		int header;
+		/// header included
+		std::set<int> blocks;
+		/// the only block outside the loop jumping to the header and nowhere else, -1 if none
+		int preheader = -1;
+	};
+	LoopInfo(const IrFunction&, const DominatorTree&);
+	const std::vector<Loop>& loops() const;
+private:
+	std::vector<Loop> m_loops;
+};
+
+/// What stores, copies and calls may change, for the loads of a module.
+/// Variables are told apart unless their address escapes: passed as var, stored,
+/// or reached by ^ with @ and pointer arithmetic, after which all globals or all
+/// of the frame are taken as reachable by pointers. A call changes what the callee
+/// and the procedures it calls store outside of their own frames.
+class AliasAnalysis {
+public:
+	AliasAnalysis(const IrModule&);
+	/// instr is a STORE, COPY or CALL of fn
+	bool may_clobber(const IrFunction& fn, const IrInstr& instr, const IrInstr& load) const;
+	/// a LOAD of a variable itself, cannot fault
+	bool is_variable_load(const IrFunction& fn, const IrInstr& load) const;
+private:
+	enum RootKind {
+		ROOT_NONE,
+		ROOT_GLOBAL,
+		ROOT_FRAME,
+	};
+	struct Root {
+		RootKind kind = ROOT_NONE;
+		/// the address is the variable itself, not an address in it
+		bool is_direct = false;
+		std::string global;
+		int64_t offset = 0;
+		bool is_same_variable(const Root&) const;
+	};
+	struct Effects {
+		std::set<std::string> globals;
+		/// stores of each IrAlias outside of the frame, variables aside
+		bool classes[4] = {false, false, false, false};
+		bool any() const;
+	};
+	struct FunctionInfo {
+		std::vector<Root> roots;
+		bool is_frame_escaped = false;
+		Effects effects;
+	};
+	std::map<std::string, FunctionInfo> m_functions;
+	bool m_is_globals_escaped = false;
+	const FunctionInfo& m_info(const IrFunction&) const;
+	bool m_is_escaped(const FunctionInfo&, const Root&) const;
+	bool m_store_clobbers(const FunctionInfo&, const IrInstr& store, const IrInstr& load) const;
+	bool m_call_clobbers(const FunctionInfo&, const IrInstr& call, const IrInstr& load) const;
+};
+
+#endif // IRANALYSIS_H
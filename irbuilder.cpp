@@ -0,0 +1,627 @@
+#include "irbuilder.h"
+#include <cstring>
+#include "node.h"
+#include "profile.h"
+#include "rangecheck.h"
+#include "runtime.h"
+#include "symboltable.h"
+
+using namespace std;
+
+bool IrBuilder::enabled = false;
+
+IrBuilder::IrBuilder(IrModule& module) :
+    m_module(module)
+{}
+
+void IrBuilder::build(PNodeProgram program) {
+	m_module.functions.push_back({});
+	m_module.functions[0].name = "main";
+	m_defined.push_back(true);
+	m_current = 0;
+	m_block = m_fn().new_block();
+	Pos begin = program->parts.back()->pos;
+	Profile::push_scope("main", begin);
+	m_fn().blocks[m_block].count = Profile::count(begin, "entry");
+	m_count(begin, "entry");
+	m_parts(program->parts);
+	m_finish_function();
+	Profile::pop_scope();
+	while (!m_pending.empty()) {
+		NodeStmtProcedure* proc = m_pending.back();
+		m_pending.pop_back();
+		m_build_procedure(*proc);
+	}
+	for (size_t i = 0; i < m_defined.size(); i++) {
+		if (!m_defined[i]) {
+			throw IrError("procedure " + m_module.functions[i].name + " has no body");
+		}
+	}
+}
+
+IrFunction& IrBuilder::m_fn() {
+	return m_module.functions[m_current];
+}
+
+void IrBuilder::m_parts(const std::vector<PNodeStmt>& parts) {
+	for (PNodeStmt part: parts) {
+		if (PNodeStmtProcedure proc = dynamic_pointer_cast<NodeStmtProcedure>(part)) {
+			/// forward declarations have no parts
+			if (!proc->parts.empty()) {
+				m_pending.push_back(proc.get());
+			}
+		} else if (PNodeStmtVar var = dynamic_pointer_cast<NodeStmtVar>(part)) {
+			m_stmt_var(*var);
+		} else if (dynamic_pointer_cast<NodeStmtBlock>(part)) {
+			m_stmt(part);
+		}
+	}
+}
+
+/// the arguments are stored into the frame first, like m_gen_bind_params does
+void IrBuilder::m_build_procedure(NodeStmtProcedure& proc) {
+	m_current = m_function_id(proc.symbol);
+	m_defined[m_current] = true;
+	PSymbolFunction function = dynamic_pointer_cast<SymbolFunction>(proc.symbol);
+	m_is_function = (bool)function;
+	m_fn().symbol = proc.symbol;
+	m_fn().frame_size = proc.symbol->frame_size;
+	m_fn().result = function ? m_type(function->type) : IR_VOID;
+	m_block = m_new_block(-1);
+	Profile::push_scope(proc.name->name, proc.pos);
+	m_fn().blocks[m_block].count = Profile::count(proc.pos, "entry");
+	m_count(proc.pos, "entry");
+	int n = 0;
+	for (PNodeFormalParameterSection section: proc.params) {
+		for (PNodeVariable var: section->identifiers) {
+			const SymbolVariable& formal = *var->symbol;
+			bool is_copied = !formal.is_var &&
+			                 (dynamic_pointer_cast<SymbolTypeArray>(formal.type) || dynamic_pointer_cast<SymbolTypeRecord>(formal.type));
+			int arg = m_emit(IR_PARAM, formal.is_var || is_copied ? IR_PTR : m_type(formal.type), {}, n++);
+			int address = m_emit(IR_LOCAL, IR_PTR, {}, formal.offset);
+			if (is_copied) {
+				m_emit_void(IR_COPY, {address, arg}, formal.type->size() / 8 * 8);
+			} else {
+				m_store(address, arg, IR_ALIAS_VARIABLE);
+			}
+		}
+	}
+	m_parts(proc.parts);
+	m_finish_function();
+	Profile::pop_scope();
+}
+
+void IrBuilder::m_finish_function() {
+	if (!m_is_terminated()) {
+		m_emit_void(IR_RET);
+	}
+	m_fn().remove_unreachable();
+	m_fn().update_cfg();
+	m_fn().verify();
+}
+
+int IrBuilder::m_function_id(PSymbolProcedure proc) {
+	auto it = m_function_ids.find(proc->name);
+	if (it != m_function_ids.end()) {
+		return it->second;
+	}
+	int id = m_module.functions.size();
+	m_function_ids[proc->name] = id;
+	m_module.functions.push_back({});
+	m_module.functions.back().name = proc->name;
+	m_defined.push_back(false);
+	return id;
+}
+
+void IrBuilder::m_stmt(PNodeStmt stmt) {
+	if (PNodeStmtBlock block = dynamic_pointer_cast<NodeStmtBlock>(stmt)) {
+		for (PNodeStmt s: block->stmts) {
+			m_stmt(s);
+		}
+	} else if (PNodeStmtAssign assign = dynamic_pointer_cast<NodeStmtAssign>(stmt)) {
+		int value = m_expr(assign->right);
+		value = m_cast(value, assign->right->exprtype(), assign->left->exprtype());
+		int address = m_lvalue(assign->left);
+		m_store(address, value, m_alias(assign->left));
+	} else if (PNodeExprStmtFunctionCall call = dynamic_pointer_cast<NodeExprStmtFunctionCall>(stmt)) {
+		m_call(*call);
+	} else if (PNodeStmtIf stmt_if = dynamic_pointer_cast<NodeStmtIf>(stmt)) {
+		int _then = m_new_block(Profile::count(stmt_if->pos, "then")), _else = m_new_block(Profile::count(stmt_if->pos, "else"));
+		int _endif = m_new_block(m_current_count());
+		m_branch(m_expr(stmt_if->cond), _then, _else);
+		m_start(_then);
+		m_count(stmt_if->pos, "then");
+		m_stmt(stmt_if->then_stmt);
+		m_jump(_endif);
+		m_start(_else);
+		m_count(stmt_if->pos, "else");
+		if (stmt_if->else_stmt) {
+			m_stmt(stmt_if->else_stmt);
+		}
+		m_start(_endif);
+	} else if (PNodeStmtWhile stmt_while = dynamic_pointer_cast<NodeStmtWhile>(stmt)) {
+		int64_t entries = Profile::count(stmt_while->pos, "loop"), iterations = Profile::count(stmt_while->pos, "body");
+		int _cond = m_new_block(entries == -1 || iterations == -1 ? -1 : entries + iterations);
+		int _body = m_new_block(iterations), _end = m_new_block(entries);
+		m_cycles.push_back({_cond, _end});
+		m_count(stmt_while->pos, "loop");
+		m_start(_cond);
+		m_branch(m_expr(stmt_while->cond), _body, _end);
+		m_start(_body);
+		m_count(stmt_while->pos, "body");
+		m_stmt(stmt_while->stmt);
+		m_jump(_cond);
+		m_start(_end);
+		m_cycles.pop_back();
+	} else if (PNodeStmtRepeat stmt_repeat = dynamic_pointer_cast<NodeStmtRepeat>(stmt)) {
+		/// continue goes to the body, not to the condition
+		int _body = m_new_block(Profile::count(stmt_repeat->pos, "body")), _end = m_new_block(Profile::count(stmt_repeat->pos, "loop"));
+		m_cycles.push_back({_body, _end});
+		m_count(stmt_repeat->pos, "loop");
+		m_start(_body);
+		m_count(stmt_repeat->pos, "body");
+		m_stmt(stmt_repeat->stmt);
+		m_branch(m_expr(stmt_repeat->cond), _end, _body);
+		m_start(_end);
+		m_cycles.pop_back();
+	} else if (PNodeStmtFor stmt_for = dynamic_pointer_cast<NodeStmtFor>(stmt)) {
+		m_stmt_for(*stmt_for);
+	} else if (dynamic_pointer_cast<NodeStmtBreak>(stmt)) {
+		m_jump(m_cycles.back().second);
+	} else if (dynamic_pointer_cast<NodeStmtContinue>(stmt)) {
+		m_jump(m_cycles.back().first);
+	}
+}
+
+void IrBuilder::m_stmt_var(NodeStmtVar& stmt) {
+	for (PNodeVarDeclarationUnit unit: stmt.units) {
+		for (PNodeVariable var: unit->vars) {
+			if (!var->symbol->is_local) {
+				m_module.globals.push_back(var->symbol);
+			}
+			if (!unit->initializer) {
+				continue;
+			}
+			int value = m_expr(unit->initializer->expr);
+			value = m_cast(value, unit->initializer->expr->exprtype(), var->exprtype());
+			m_store(m_lvalue(var), value, m_alias(var));
+		}
+	}
+}
+
+/// high is evaluated again before every step, the variable is read back from memory
+void IrBuilder::m_stmt_for(NodeStmtFor& stmt) {
+	int64_t entries = Profile::count(stmt.pos, "loop"), iterations = Profile::count(stmt.pos, "body");
+	int _body = m_new_block(iterations), _continue = m_new_block(iterations);
+	int _step = m_new_block(entries == -1 || iterations == -1 ? -1 : max(iterations - entries, (int64_t)0));
+	int _end = m_new_block(entries);
+	m_cycles.push_back({_continue, _end});
+	m_count(stmt.pos, "loop");
+	int low = m_expr(stmt.low);
+	int address = m_lvalue(stmt.iter_var);
+	int high = m_expr(stmt.high);
+	IrAlias alias = m_alias(stmt.iter_var);
+	m_store(address, low, alias);
+	int value = m_load(address, IR_INT, alias);
+	/// the range of the variable is tested once the loop is known to run
+	int64_t test_low, test_high;
+	if (RangeChecks::enabled && RangeChecks::loop_test(stmt, test_low, test_high)) {
+		int _test = m_new_block(entries);
+		m_branch(m_emit(stmt.is_inc ? IR_LT : IR_GT, IR_INT, {high, value}), _end, _test);
+		m_start(_test);
+		for (int bound: {value, high}) {
+			m_emit_void(IR_CHECK, {m_emit(IR_SUB, IR_INT, {bound, m_const(test_low)})}, test_high - test_low + 1);
+		}
+		m_jump(_body);
+	} else {
+		m_branch(m_emit(stmt.is_inc ? IR_LT : IR_GT, IR_INT, {high, value}), _end, _body);
+	}
+	m_start(_body);
+	m_count(stmt.pos, "body");
+	m_stmt(stmt.stmt);
+	m_start(_continue);
+	high = m_expr(stmt.high);
+	value = m_expr(stmt.iter_var);
+	m_branch(m_emit(stmt.is_inc ? IR_LE : IR_GE, IR_INT, {high, value}), _end, _step);
+	m_start(_step);
+	address = m_lvalue(stmt.iter_var);
+	value = m_load(address, IR_INT, alias);
+	value = m_emit(IR_ADD, IR_INT, {value, m_const(stmt.is_inc ? 1 : -1)});
+	m_store(address, value, alias);
+	m_jump(_body);
+	m_start(_end);
+	m_cycles.pop_back();
+}
+
+int IrBuilder::m_call(NodeExprStmtFunctionCall& call) {
+	vector<PNodeExpression> no_args;
+	const vector<PNodeExpression>& args = call.args ? call.args->arglist : no_args;
+	if (call.is_write()) {
+		for (PNodeExpression arg: args) {
+			m_write(arg);
+		}
+		if (call.is_writeln()) {
+			m_emit_void(IR_WRITE, {m_const('\n')});
+			m_fn().blocks[m_block].instrs.back().name = Runtime::write_char;
+		}
+		return -1;
+	}
+	if (call.is_exit()) {
+		if (m_is_function && !args.empty()) {
+			/// the result as is, without a typecast
+			m_emit_void(IR_RET, {m_expr(args[0])});
+		} else {
+			m_emit_void(IR_RET);
+		}
+		return -1;
+	}
+	const SymbolProcedure& proc = *call.proc;
+	m_count(call.pos, "call " + proc.name);
+	vector<int> values(args.size(), -1);
+	/// in the order of the native call: stack args, then register args, each from the last
+	Register reg;
+	int64_t slot;
+	for (bool in_register: {false, true}) {
+		for (int i = args.size() - 1; i >= 0; i--) {
+			if (proc.arg_location(i, reg, slot) != in_register) {
+				continue;
+			}
+			PSymbolVariable formal;
+			(*proc.params)[i] >> formal;
+			if (proc.is_nth_var.at(i) ||
+			    dynamic_pointer_cast<SymbolTypeArray>(formal->type) || dynamic_pointer_cast<SymbolTypeRecord>(formal->type))
+			{
+				values[i] = m_lvalue(args[i]);
+			} else {
+				values[i] = m_expr(args[i]);
+				values[i] = m_cast(values[i], args[i]->exprtype(), formal->type);
+			}
+		}
+	}
+	PSymbolFunction function = dynamic_pointer_cast<SymbolFunction>(call.proc);
+	IrType type = function ? m_type(function->type) : IR_VOID;
+	int result = m_emit(IR_CALL, type, values);
+	IrInstr& instr = m_fn().blocks[m_block].instrs.back();
+	instr.name = proc.name;
+	instr.proc = call.proc;
+	return result;
+}
+
+void IrBuilder::m_write(PNodeExpression expr) {
+	if (PNodeString str = dynamic_pointer_cast<NodeString>(expr)) {
+		int address = m_emit(IR_STRING, IR_PTR, {}, m_module.strings.size());
+		m_module.strings.push_back(str->value);
+		m_emit_void(IR_WRITE, {address});
+		m_fn().blocks[m_block].instrs.back().name = Runtime::write_str;
+		return;
+	}
+	int value = m_expr(expr);
+	PSymbolType type = expr->exprtype();
+	string routine;
+	if (dynamic_pointer_cast<SymbolTypeInt>(type)) {
+		routine = Runtime::write_int;
+	} else if (dynamic_pointer_cast<SymbolTypeFloat>(type)) {
+		routine = Runtime::write_float;
+	} else {
+		return;
+	}
+	m_emit_void(IR_WRITE, {value});
+	m_fn().blocks[m_block].instrs.back().name = routine;
+}
+
+int IrBuilder::m_expr(PNodeExpression expr) {
+	if (PNodeInteger integer = dynamic_pointer_cast<NodeInteger>(expr)) {
+		return m_const(integer->value);
+	}
+	if (PNodeFloat real = dynamic_pointer_cast<NodeFloat>(expr)) {
+		int64_t bits;
+		memcpy(&bits, &real->value, sizeof(bits));
+		return m_const(bits, IR_FLOAT);
+	}
+	if (PNodeVariable var = dynamic_pointer_cast<NodeVariable>(expr)) {
+		if (PSymbolConstInt c = dynamic_pointer_cast<SymbolConstInt>(var->symbol)) {
+			return m_const(c->value);
+		}
+		if (PSymbolConstFloat c = dynamic_pointer_cast<SymbolConstFloat>(var->symbol)) {
+			int64_t bits;
+			memcpy(&bits, &c->value, sizeof(bits));
+			return m_const(bits, IR_FLOAT);
+		}
+		return m_load(m_lvalue(expr), m_type(expr->exprtype()), m_alias(expr));
+	}
+	if (PNodeBinaryOperator binary = dynamic_pointer_cast<NodeBinaryOperator>(expr)) {
+		return m_binary(*binary);
+	}
+	if (PNodeUnaryOperator unary = dynamic_pointer_cast<NodeUnaryOperator>(expr)) {
+		return m_unary(*unary);
+	}
+	if (dynamic_pointer_cast<NodeArrayAccess>(expr) || dynamic_pointer_cast<NodeRecordAccess>(expr)) {
+		return m_load(m_lvalue(expr), m_type(expr->exprtype()), m_alias(expr));
+	}
+	if (PNodeExprStmtFunctionCall call = dynamic_pointer_cast<NodeExprStmtFunctionCall>(expr)) {
+		int result = m_call(*call);
+		return result == -1 ? m_const(0) : result;
+	}
+	/// a string has no value
+	return m_const(0);
+}
+
+int IrBuilder::m_lvalue(PNodeExpression expr) {
+	if (PNodeVariable var = dynamic_pointer_cast<NodeVariable>(expr)) {
+		int address = m_variable_address(*var->symbol);
+		if (var->symbol->is_var) {
+			address = m_load(address, IR_PTR, IR_ALIAS_VARIABLE);
+		}
+		return address;
+	}
+	if (PNodeRecordAccess access = dynamic_pointer_cast<NodeRecordAccess>(expr)) {
+		int address = m_lvalue(access->record);
+		return m_emit(IR_ADD, IR_PTR, {address, m_const(access->st->offsetb(access->field->name))});
+	}
+	if (PNodeArrayAccess access = dynamic_pointer_cast<NodeArrayAccess>(expr)) {
+		return m_array_address(*access);
+	}
+	PNodeUnaryOperator deref = dynamic_pointer_cast<NodeUnaryOperator>(expr);
+	if (deref && deref->operation == Token::OP_DEREFERENCE) {
+		return m_expr(deref->node);
+	}
+	return m_const(0, IR_PTR);
+}
+
+IrAlias IrBuilder::m_alias(PNodeExpression lvalue) {
+	if (PNodeVariable var = dynamic_pointer_cast<NodeVariable>(lvalue)) {
+		return var->symbol->is_var ? IR_ALIAS_ANY : IR_ALIAS_VARIABLE;
+	}
+	if (dynamic_pointer_cast<NodeArrayAccess>(lvalue)) {
+		return IR_ALIAS_ARRAY;
+	}
+	if (dynamic_pointer_cast<NodeRecordAccess>(lvalue)) {
+		return IR_ALIAS_RECORD;
+	}
+	return IR_ALIAS_ANY;
+}
+
+int IrBuilder::m_variable_address(const SymbolVariable& var) {
+	if (var.is_local) {
+		return m_emit(IR_LOCAL, IR_PTR, {}, var.offset);
+	}
+	int address = m_emit(IR_GLOBAL, IR_PTR);
+	m_fn().blocks[m_block].instrs.back().name = var.label;
+	return address;
+}
+
+/// same index arithmetic as NodeArrayAccess::m_gen_index
+int IrBuilder::m_array_address(NodeArrayAccess& access) {
+	PSymbolTypeArray type = dynamic_pointer_cast<SymbolTypeArray>(access.array->exprtype());
+	const vector<pair<int, int>>& bounds = type->bounds;
+	vector<int64_t> dims, qr(bounds.size(), 0);
+	for (const pair<int, int>& p: bounds) {
+		dims.push_back(p.second - p.first + 1);
+	}
+	for (size_t i = 0; i < qr.size(); i++) {
+		for (size_t j = i + 1; j < qr.size(); j++) {
+			qr[i] += dims[j];
+		}
+	}
+	qr.back() = 1;
+	int address = m_lvalue(access.array);
+	int index = -1;
+	for (size_t i = 0; i < qr.size(); i++) {
+		int value = m_expr(access.index->arglist.at(i));
+		value = m_emit(IR_SUB, IR_INT, {value, m_const(bounds[i].first)});
+		if (RangeChecks::enabled && RangeChecks::is_checked(access, i)) {
+			m_emit_void(IR_CHECK, {value}, dims[i]);
+		}
+		value = m_emit(IR_MUL, IR_INT, {value, m_const(qr[i])});
+		index = index == -1 ? value : m_emit(IR_ADD, IR_INT, {index, value});
+	}
+	index = m_emit(IR_MUL, IR_INT, {index, m_const(type->type->size())});
+	return m_emit(IR_ADD, IR_PTR, {address, index});
+}
+
+int IrBuilder::m_binary(NodeBinaryOperator& node) {
+	PSymbolType type = node.exprtype();
+	PSymbolType int_type = NodeInteger::type_sym_ptr, float_type = NodeFloat::type_sym_ptr;
+	switch (node.operation) {
+	case Token::OP_PLUS:
+	case Token::OP_MINUS:
+	case Token::OP_MULT:
+	case Token::OP_DIV:
+	case Token::OP_DIV_SLASH: {
+		int left = m_cast(m_expr(node.left), node.left->exprtype(), type);
+		int right = m_cast(m_expr(node.right), node.right->exprtype(), type);
+		static const map<Token::Operator, IrOp> int_ops = {
+			{Token::OP_PLUS, IR_ADD}, {Token::OP_MINUS, IR_SUB},
+			{Token::OP_MULT, IR_MUL}, {Token::OP_DIV, IR_DIV},
+		};
+		static const map<Token::Operator, IrOp> float_ops = {
+			{Token::OP_PLUS, IR_FADD}, {Token::OP_MINUS, IR_FSUB},
+			{Token::OP_MULT, IR_FMUL}, {Token::OP_DIV_SLASH, IR_FDIV},
+		};
+		bool is_int = type == int_type || dynamic_pointer_cast<SymbolTypePointer>(type);
+		const map<Token::Operator, IrOp>& ops = is_int ? int_ops : float_ops;
+		auto op = ops.find(node.operation);
+		/// with no instruction for it the left operand is the result
+		if ((is_int || type == float_type) && op != ops.end()) {
+			return m_emit(op->second, m_type(type), {left, right});
+		}
+		return left;
+	}
+	case Token::OP_EQUAL:
+	case Token::OP_GREATER:
+	case Token::OP_LESS:
+	case Token::OP_LEQ:
+	case Token::OP_GEQ:
+	case Token::OP_NEQ: {
+		bool is_float = node.left->exprtype() == float_type || node.right->exprtype() == float_type;
+		int left = m_expr(node.left);
+		if (is_float) {
+			left = m_cast(left, node.left->exprtype(), float_type);
+		}
+		int right = m_expr(node.right);
+		if (is_float) {
+			right = m_cast(right, node.right->exprtype(), float_type);
+		}
+		static const map<Token::Operator, pair<IrOp, IrOp>> ops = {
+			{Token::OP_EQUAL, {IR_EQ, IR_FEQ}}, {Token::OP_NEQ, {IR_NE, IR_FNE}},
+			{Token::OP_LESS, {IR_LT, IR_FLT}}, {Token::OP_LEQ, {IR_LE, IR_FLE}},
+			{Token::OP_GREATER, {IR_GT, IR_FGT}}, {Token::OP_GEQ, {IR_GE, IR_FGE}},
+		};
+		const pair<IrOp, IrOp>& op = ops.at(node.operation);
+		return m_emit(is_float ? op.second : op.first, IR_INT, {left, right});
+	}
+	case Token::OP_AND:
+	case Token::OP_OR: {
+		/// 0 or 1, the right operand only if needed
+		bool is_and = node.operation == Token::OP_AND;
+		int _right = m_new_block(m_current_count()), _end = m_new_block(m_current_count());
+		int left = m_expr(node.left);
+		int skipped = m_const(is_and ? 0 : 1);
+		int left_block = m_block;
+		if (is_and) {
+			m_branch(left, _right, _end);
+		} else {
+			m_branch(left, _end, _right);
+		}
+		m_start(_right);
+		int right = m_emit(IR_NE, IR_INT, {m_expr(node.right), m_const(0)});
+		int right_block = m_block;
+		m_jump(_end);
+		m_start(_end);
+		IrInstr phi;
+		phi.op = IR_PHI;
+		phi.type = IR_INT;
+		phi.dst = m_fn().new_value(IR_INT);
+		phi.args = {skipped, right};
+		phi.blocks = {left_block, right_block};
+		m_fn().blocks[m_block].instrs.push_back(phi);
+		return phi.dst;
+	}
+	case Token::OP_XOR:
+	case Token::OP_SHL:
+	case Token::OP_SHR:
+	case Token::OP_MOD: {
+		static const map<Token::Operator, IrOp> ops = {
+			{Token::OP_XOR, IR_XOR}, {Token::OP_SHL, IR_SHL},
+			{Token::OP_SHR, IR_SHR}, {Token::OP_MOD, IR_MOD},
+		};
+		int left = m_expr(node.left);
+		int right = m_expr(node.right);
+		return m_emit(ops.at(node.operation), IR_INT, {left, right});
+	}
+	default:
+		return m_expr(node.left);
+	}
+}
+
+int IrBuilder::m_unary(NodeUnaryOperator& node) {
+	switch (node.operation) {
+	case Token::OP_MINUS:
+		if (node.exprtype() == NodeInteger::type_sym_ptr) {
+			return m_emit(IR_NEG, IR_INT, {m_expr(node.node)});
+		}
+		return m_emit(IR_FNEG, IR_FLOAT, {m_expr(node.node)});
+	case Token::OP_DEREFERENCE:
+		return m_load(m_expr(node.node), m_type(node.exprtype()), IR_ALIAS_ANY);
+	case Token::OP_AT:
+		return m_lvalue(node.node);
+	case Token::OP_NOT:
+		return m_emit(IR_NOT, IR_INT, {m_expr(node.node)});
+	default:
+		return m_const(0);
+	}
+}
+
+int IrBuilder::m_cast(int value, PSymbolType from, PSymbolType to) {
+	if (dynamic_pointer_cast<SymbolTypeInt>(from) && dynamic_pointer_cast<SymbolTypeFloat>(to)) {
+		return m_emit(IR_I2F, IR_FLOAT, {value});
+	}
+	if (dynamic_pointer_cast<SymbolTypeFloat>(from) && dynamic_pointer_cast<SymbolTypeInt>(to)) {
+		return m_emit(IR_F2I, IR_INT, {value});
+	}
+	return value;
+}
+
+IrType IrBuilder::m_type(PSymbolType type) {
+	if (dynamic_pointer_cast<SymbolTypeFloat>(type)) {
+		return IR_FLOAT;
+	}
+	if (dynamic_pointer_cast<SymbolTypePointer>(type)) {
+		return IR_PTR;
+	}
+	return IR_INT;
+}
+
+int IrBuilder::m_emit(IrOp op, IrType type, std::vector<int> args, int64_t imm) {
+	if (m_is_terminated()) {
+		/// code after exit, break or continue
+		m_block = m_fn().new_block();
+	}
+	IrInstr instr;
+	instr.op = op;
+	instr.type = type;
+	instr.dst = type == IR_VOID ? -1 : m_fn().new_value(type);
+	instr.args = move(args);
+	instr.imm = imm;
+	m_fn().blocks[m_block].instrs.push_back(instr);
+	return instr.dst;
+}
+
+int IrBuilder::m_load(int address, IrType type, IrAlias alias) {
+	int value = m_emit(IR_LOAD, type, {address});
+	m_fn().blocks[m_block].instrs.back().alias = alias;
+	return value;
+}
+
+void IrBuilder::m_store(int address, int value, IrAlias alias) {
+	m_emit_void(IR_STORE, {address, value});
+	m_fn().blocks[m_block].instrs.back().alias = alias;
+}
+
+void IrBuilder::m_emit_void(IrOp op, std::vector<int> args, int64_t imm) {
+	m_emit(op, IR_VOID, move(args), imm);
+}
+
+int IrBuilder::m_const(int64_t value, IrType type) {
+	return m_emit(IR_CONST, type, {}, value);
+}
+
+void IrBuilder::m_count(Pos pos, const std::string& what) {
+	if (Profile::is_generating()) {
+		string key = Profile::key(pos, what);
+		m_emit_void(IR_COUNT, {}, Profile::counter(key));
+		m_fn().blocks[m_block].instrs.back().name = key;
+	}
+}
+
+int IrBuilder::m_new_block(int64_t count) {
+	int block = m_fn().new_block();
+	m_fn().blocks[block].count = count;
+	return block;
+}
+
+int64_t IrBuilder::m_current_count() const {
+	return m_module.functions[m_current].blocks[m_block].count;
+}
+
+void IrBuilder::m_jump(int block) {
+	m_emit_void(IR_JMP);
+	m_fn().blocks[m_block].instrs.back().blocks = {block};
+}
+
+void IrBuilder::m_branch(int cond, int then_block, int else_block) {
+	m_emit_void(IR_BR, {cond});
+	m_fn().blocks[m_block].instrs.back().blocks = {then_block, else_block};
+}
+
+void IrBuilder::m_start(int block) {
+	if (!m_is_terminated()) {
+		m_jump(block);
+	}
+	m_block = block;
+}
+
+bool IrBuilder::m_is_terminated() const {
+	const vector<IrInstr>& instrs = m_module.functions[m_current].blocks[m_block].instrs;
+	return !instrs.empty() && instrs.back().is_terminator();
+}
@@ -0,0 +1,71 @@
+#ifndef IRBUILDER_H
+#define IRBUILDER_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include "ir.h"
+#include "types.h"
+
+/// Lowers the tree of a parsed program to SSA the way Node::generate does to code.
+/// Variables stay in memory as in the native code, values of expressions are SSA.
+/// Blocks get the counts of a loaded profile, the ones with no key of their own
+/// are estimated from the counts of the statement they are made for.
+class IrBuilder {
+public:
+	IrBuilder(IrModule&);
+	void build(PNodeProgram);
+	/// -S, -c and --run go through the IR instead of Node::generate
+	static bool enabled;
+private:
+	IrModule& m_module;
+	size_t m_current = 0;
+	bool m_is_function = false;
+	int m_block = 0;
+	/// continue and break of the enclosing loops
+	std::vector<std::pair<int, int>> m_cycles;
+	/// by name like the labels of the native code, a forward declaration has its own symbol
+	std::map<std::string, int> m_function_ids;
+	std::vector<bool> m_defined;
+	std::vector<NodeStmtProcedure*> m_pending;
+
+	IrFunction& m_fn();
+	void m_build_procedure(NodeStmtProcedure&);
+	void m_finish_function();
+	void m_parts(const std::vector<PNodeStmt>&);
+	int m_function_id(PSymbolProcedure);
+	void m_stmt(PNodeStmt);
+	void m_stmt_var(NodeStmtVar&);
+	void m_stmt_for(NodeStmtFor&);
+	/// result value, -1 for a procedure
+	int m_call(NodeExprStmtFunctionCall&);
+	void m_write(PNodeExpression);
+	int m_expr(PNodeExpression);
+	int m_lvalue(PNodeExpression);
+	/// what the address of m_lvalue reaches
+	static IrAlias m_alias(PNodeExpression);
+	int m_variable_address(const SymbolVariable&);
+	int m_array_address(NodeArrayAccess&);
+	int m_binary(NodeBinaryOperator&);
+	int m_unary(NodeUnaryOperator&);
+	/// gen_typecast
+	int m_cast(int value, PSymbolType from, PSymbolType to);
+
+	static IrType m_type(PSymbolType);
+	int m_emit(IrOp, IrType, std::vector<int> args = {}, int64_t imm = 0);
+	void m_emit_void(IrOp, std::vector<int> args = {}, int64_t imm = 0);
+	int m_load(int address, IrType, IrAlias);
+	void m_store(int address, int value, IrAlias);
+	int m_const(int64_t, IrType = IR_INT);
+	/// COUNT of the key, with --profile-generate
+	void m_count(Pos, const std::string& what);
+	int m_new_block(int64_t count);
+	int64_t m_current_count() const;
+	void m_jump(int block);
+	void m_branch(int cond, int then_block, int else_block);
+	/// continues in block, a new one if the current has ended
+	void m_start(int block);
+	bool m_is_terminated() const;
+};
+
+#endif // IRBUILDER_H
@@ -0,0 +1,470 @@
+#include "irlower.h"
+#include "asmstream.h"
+#include "node.h"
+#include "profile.h"
+#include "rangecheck.h"
+#include "runtime.h"
+#include "symbol.h"
+
+using namespace std;
+
+bool IrLowering::tail_calls = false;
+
+IrLowering::IrLowering(AsmCode& ac) :
+    m_ac(ac)
+{}
+
+void IrLowering::lower(const IrModule& module) {
+	for (const PSymbolVariable& var: module.globals) {
+		(var->is_var ? NodeInteger::type_sym_ptr : var->type)->gen_declare(m_ac, var->label);
+	}
+	for (size_t i = 0; i < module.strings.size(); i++) {
+		m_strings.push_back(make_shared<AsmVarString>(NodeString::str_prefix + to_string(i), module.strings[i]));
+		m_ac.add_data(m_strings.back());
+	}
+	for (const IrFunction& fn: module.functions) {
+		for (const IrBlock& block: fn.blocks) {
+			for (const IrInstr& instr: block.instrs) {
+				m_writes |= instr.op == IR_WRITE;
+			}
+		}
+	}
+	for (const IrFunction& fn: module.functions) {
+		m_function(fn);
+		if (m_ac.stream) {
+			m_ac.stream->flush(m_ac);
+		}
+	}
+}
+
+void IrLowering::m_function(const IrFunction& fn) {
+	m_fn = &fn;
+	if (!fn.symbol) {
+		m_ac << *m_ac.add_data(make_shared<AsmGlobl>("main"));
+	} else {
+		m_ac << AsmLabel{var_prefix + fn.name};
+	}
+	m_ac << AsmCmd1{PUSHQ, RBP}
+	     << AsmCmd2{MOVQ, RSP, RBP};
+	int64_t frame = (fn.frame_size + 8*fn.values.size() + 15) / 16 * 16;
+	if (frame > 0) {
+		m_ac << AsmCmd2{SUBQ, frame, RSP};
+	}
+	m_labels.clear();
+	for (size_t b = 0; b < fn.blocks.size(); b++) {
+		m_labels.push_back(AsmLabel());
+	}
+	vector<int> order = m_layout(fn);
+	m_next.assign(fn.blocks.size(), -1);
+	for (size_t i = 0; i + 1 < order.size(); i++) {
+		m_next[order[i]] = order[i + 1];
+	}
+	for (int b: order) {
+		if (b > 0) {
+			m_ac << m_labels[b];
+		}
+		const vector<IrInstr>& instrs = fn.blocks[b].instrs;
+		for (size_t i = 0; i < instrs.size(); i++) {
+			if (i + 1 < instrs.size() && m_can_tail_call(instrs[i], instrs[i + 1])) {
+				m_tail_call(instrs[i]);
+				break;
+			}
+			m_instr(instrs[i], b);
+		}
+	}
+}
+
+/// chains of the hottest successors, the entry first
+vector<int> IrLowering::m_layout(const IrFunction& fn) const {
+	vector<int> order;
+	bool has_counts = false;
+	for (const IrBlock& block: fn.blocks) {
+		has_counts |= block.count != -1;
+	}
+	if (!has_counts) {
+		for (size_t b = 0; b < fn.blocks.size(); b++) {
+			order.push_back(b);
+		}
+		return order;
+	}
+	vector<bool> is_placed(fn.blocks.size(), false);
+	auto is_cold = [&](int b) {
+		return b > 0 && fn.blocks[b].count == 0;
+	};
+	int b = 0;
+	while (b != -1) {
+		order.push_back(b);
+		is_placed[b] = true;
+		int next = -1;
+		for (int succ: fn.blocks[b].succs) {
+			if (!is_placed[succ] && !is_cold(succ) && (next == -1 || fn.blocks[succ].count > fn.blocks[next].count)) {
+				next = succ;
+			}
+		}
+		for (size_t other = 0; next == -1 && other < fn.blocks.size(); other++) {
+			if (!is_placed[other] && !is_cold(other)) {
+				next = other;
+			}
+		}
+		b = next;
+	}
+	for (size_t cold = 0; cold < fn.blocks.size(); cold++) {
+		if (!is_placed[cold]) {
+			order.push_back(cold);
+		}
+	}
+	return order;
+}
+
+/// as NodeExprStmtFunctionCall::can_tail_call, a pointer made in the frame may point into it
+bool IrLowering::m_can_tail_call(const IrInstr& call, const IrInstr& ret) const {
+	if (!tail_calls || !m_fn->symbol || call.op != IR_CALL || ret.op != IR_RET) {
+		return false;
+	}
+	if (call.type != m_fn->result || (ret.args.empty() ? call.type != IR_VOID : ret.args[0] != call.dst)) {
+		return false;
+	}
+	if (call.proc->stack_args() > m_fn->symbol->stack_args()) {
+		return false;
+	}
+	vector<const IrInstr*> defs(m_fn->values.size(), nullptr);
+	for (const IrBlock& block: m_fn->blocks) {
+		for (const IrInstr& instr: block.instrs) {
+			if (instr.dst != -1) {
+				defs[instr.dst] = &instr;
+			}
+		}
+	}
+	for (int arg: call.args) {
+		if (m_fn->values[arg] == IR_PTR && defs[arg]->op != IR_LOAD && defs[arg]->op != IR_GLOBAL) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/// arguments in place of the own ones, the frame left before the jump
+void IrLowering::m_tail_call(const IrInstr& call) {
+	const SymbolProcedure& proc = *call.proc;
+	Register reg;
+	int64_t slot;
+	for (size_t i = 0; i < call.args.size(); i++) {
+		if (!proc.arg_location(i, reg, slot)) {
+			m_load(call.args[i], RAX);
+			m_ac << AsmCmd2{MOVQ, RAX, AsmOffs{16 + 8*slot, RBP}};
+		}
+	}
+	for (size_t i = 0; i < call.args.size(); i++) {
+		if (!proc.arg_location(i, reg, slot)) {
+			continue;
+		}
+		if (proc.is_float_arg(i)) {
+			m_load(call.args[i], RAX);
+			m_ac << AsmCmd2{MOVQ, RAX, reg};
+		} else {
+			m_load(call.args[i], reg);
+		}
+	}
+	m_ac << AsmCmd2{MOVQ, RBP, RSP}
+	     << AsmCmd1{POPQ, RBP}
+	     << AsmCmd1{JMP, AsmVar{call.name}};
+}
+
+AsmOffs IrLowering::m_slot(int value) const {
+	return AsmOffs{-(m_fn->frame_size + 8*(value + 1)), RBP};
+}
+
+void IrLowering::m_load(int value, Register reg) {
+	m_ac << AsmCmd2{MOVQ, m_slot(value), reg};
+}
+
+void IrLowering::m_store(Register reg, int value) {
+	m_ac << AsmCmd2{MOVQ, reg, m_slot(value)};
+}
+
+bool IrLowering::m_has_phis(int block) const {
+	const vector<IrInstr>& instrs = m_fn->blocks[block].instrs;
+	return !instrs.empty() && instrs[0].op == IR_PHI;
+}
+
+void IrLowering::m_edge(int from, int to) {
+	vector<int> dsts;
+	for (const IrInstr& phi: m_fn->blocks[to].instrs) {
+		if (phi.op != IR_PHI) {
+			break;
+		}
+		for (size_t i = 0; i < phi.blocks.size(); i++) {
+			if (phi.blocks[i] == from) {
+				m_ac << AsmCmd1{PUSHQ, m_slot(phi.args[i])};
+				dsts.push_back(phi.dst);
+			}
+		}
+	}
+	for (int i = dsts.size() - 1; i >= 0; i--) {
+		m_ac << AsmCmd1{POPQ, m_slot(dsts[i])};
+	}
+}
+
+void IrLowering::m_jump(int from, int to) {
+	m_edge(from, to);
+	if (m_next[from] != to) {
+		m_ac << AsmCmd1{JMP, m_labels[to]};
+	}
+}
+
+void IrLowering::m_instr(const IrInstr& instr, int block) {
+	static const map<IrOp, Opcode> int_ops = {
+		{IR_ADD, ADDQ}, {IR_SUB, SUBQ}, {IR_MUL, IMULQ}, {IR_XOR, XORQ},
+	};
+	static const map<IrOp, Opcode> float_ops = {
+		{IR_FADD, ADDSD}, {IR_FSUB, SUBSD}, {IR_FMUL, MULSD}, {IR_FDIV, DIVSD},
+	};
+	static const map<IrOp, Opcode> int_cmps = {
+		{IR_EQ, SETE}, {IR_NE, SETNE}, {IR_LT, SETL}, {IR_LE, SETLE}, {IR_GT, SETG}, {IR_GE, SETGE},
+	};
+	static const map<IrOp, Opcode> float_cmps = {
+		{IR_FEQ, SETE}, {IR_FNE, SETNE}, {IR_FLT, SETB}, {IR_FLE, SETBE}, {IR_FGT, SETA}, {IR_FGE, SETAE},
+	};
+	switch (instr.op) {
+	case IR_CONST:
+		if (instr.imm == (int32_t)instr.imm) {
+			m_ac << AsmCmd2{MOVQ, instr.imm, RAX};
+		} else {
+			m_ac << AsmCmd2{MOVABSQ, instr.imm, RAX};
+		}
+		m_store(RAX, instr.dst);
+		return;
+	case IR_GLOBAL:
+		m_ac << AsmCmd2{LEAQ, AsmVar{instr.name}, RAX};
+		m_store(RAX, instr.dst);
+		return;
+	case IR_LOCAL:
+		m_ac << AsmCmd2{LEAQ, AsmOffs{instr.imm, RBP}, RAX};
+		m_store(RAX, instr.dst);
+		return;
+	case IR_STRING:
+		m_ac << AsmCmd2{LEAQ, m_strings.at(instr.imm), RAX};
+		m_store(RAX, instr.dst);
+		return;
+	case IR_PARAM: {
+		Register reg;
+		int64_t slot;
+		if (!m_fn->symbol->arg_location(instr.imm, reg, slot)) {
+			m_ac << AsmCmd2{MOVQ, AsmOffs{16 + 8*slot, RBP}, RAX};
+			m_store(RAX, instr.dst);
+		} else if (m_fn->symbol->is_float_arg(instr.imm)) {
+			m_ac << AsmCmd2{MOVQ, reg, RAX};
+			m_store(RAX, instr.dst);
+		} else {
+			m_store(reg, instr.dst);
+		}
+		return;
+	}
+	case IR_LOAD:
+		m_load(instr.args[0], RAX);
+		m_ac << AsmCmd2{MOVQ, AsmOffs{RAX}, RAX};
+		m_store(RAX, instr.dst);
+		return;
+	case IR_STORE:
+		m_load(instr.args[0], RAX);
+		m_load(instr.args[1], R10);
+		m_ac << AsmCmd2{MOVQ, R10, AsmOffs{RAX}};
+		return;
+	case IR_COPY:
+		/// not through RSI and RDI, the arguments still to be bound may be there
+		m_load(instr.args[0], R11);
+		m_load(instr.args[1], R10);
+		for (int64_t offs = 0; offs < instr.imm; offs += 8) {
+			m_ac << AsmCmd2{MOVQ, AsmOffs{offs, R10}, RAX}
+			     << AsmCmd2{MOVQ, RAX, AsmOffs{offs, R11}};
+		}
+		return;
+	case IR_ADD:
+	case IR_SUB:
+	case IR_MUL:
+	case IR_XOR:
+		m_load(instr.args[0], RAX);
+		m_load(instr.args[1], R10);
+		m_ac << AsmCmd2{int_ops.at(instr.op), R10, RAX};
+		m_store(RAX, instr.dst);
+		return;
+	case IR_DIV:
+	case IR_MOD:
+		m_load(instr.args[0], RAX);
+		m_load(instr.args[1], R10);
+		m_ac << AsmCmd0{CQO}
+		     << AsmCmd1{IDIVQ, R10};
+		m_store(instr.op == IR_DIV ? RAX : RDX, instr.dst);
+		return;
+	case IR_SHL:
+	case IR_SHR:
+		m_load(instr.args[0], RAX);
+		m_load(instr.args[1], RCX);
+		m_ac << AsmCmd2{instr.op == IR_SHL ? SHLQ : SHRQ, CL, RAX};
+		m_store(RAX, instr.dst);
+		return;
+	case IR_NEG:
+		m_load(instr.args[0], RAX);
+		m_ac << AsmCmd1{NEGQ, RAX};
+		m_store(RAX, instr.dst);
+		return;
+	case IR_NOT:
+		m_load(instr.args[0], RAX);
+		m_ac << AsmCmd2{XORQ, (int64_t)1, RAX};
+		m_store(RAX, instr.dst);
+		return;
+	case IR_FADD:
+	case IR_FSUB:
+	case IR_FMUL:
+	case IR_FDIV:
+		m_load(instr.args[0], RAX);
+		m_load(instr.args[1], R10);
+		m_ac << AsmCmd2{MOVQ, RAX, XMM0}
+		     << AsmCmd2{MOVQ, R10, XMM1}
+		     << AsmCmd2{float_ops.at(instr.op), XMM1, XMM0}
+		     << AsmCmd2{MOVQ, XMM0, RAX};
+		m_store(RAX, instr.dst);
+		return;
+	case IR_FNEG:
+		m_load(instr.args[0], RAX);
+		m_ac << AsmCmd2{MOVQ, RAX, XMM1}
+		     << AsmCmd2{XORPD, XMM0, XMM0}
+		     << AsmCmd2{SUBSD, XMM1, XMM0}
+		     << AsmCmd2{MOVQ, XMM0, RAX};
+		m_store(RAX, instr.dst);
+		return;
+	case IR_I2F:
+		m_load(instr.args[0], RAX);
+		m_ac << AsmCmd2{CVTSI2SD, RAX, XMM0}
+		     << AsmCmd2{MOVQ, XMM0, RAX};
+		m_store(RAX, instr.dst);
+		return;
+	case IR_F2I:
+		m_load(instr.args[0], RAX);
+		m_ac << AsmCmd2{MOVQ, RAX, XMM0}
+		     << AsmCmd2{CVTSD2SI, XMM0, RAX};
+		m_store(RAX, instr.dst);
+		return;
+	case IR_EQ:
+	case IR_NE:
+	case IR_LT:
+	case IR_LE:
+	case IR_GT:
+	case IR_GE:
+		m_load(instr.args[0], RDX);
+		m_load(instr.args[1], R11);
+		m_ac << AsmCmd2{XORQ, RAX, RAX}
+		     << AsmCmd2{CMPQ, R11, RDX}
+		     << AsmCmd1{int_cmps.at(instr.op), AL};
+		m_store(RAX, instr.dst);
+		return;
+	case IR_FEQ:
+	case IR_FNE:
+	case IR_FLT:
+	case IR_FLE:
+	case IR_FGT:
+	case IR_FGE:
+		m_load(instr.args[0], RAX);
+		m_load(instr.args[1], R11);
+		m_ac << AsmCmd2{MOVQ, RAX, XMM0}
+		     << AsmCmd2{MOVQ, R11, XMM1}
+		     << AsmCmd2{XORQ, RAX, RAX}
+		     << AsmCmd2{COMISD, XMM1, XMM0}
+		     << AsmCmd1{float_cmps.at(instr.op), AL};
+		m_store(RAX, instr.dst);
+		return;
+	case IR_PHI:
+		/// copied on the edges
+		return;
+	case IR_CALL: {
+		const SymbolProcedure& proc = *instr.proc;
+		Register reg;
+		int64_t slot;
+		for (int i = instr.args.size() - 1; i >= 0; i--) {
+			if (!proc.arg_location(i, reg, slot)) {
+				m_ac << AsmCmd1{PUSHQ, m_slot(instr.args[i])};
+			}
+		}
+		for (size_t i = 0; i < instr.args.size(); i++) {
+			if (!proc.arg_location(i, reg, slot)) {
+				continue;
+			}
+			if (proc.is_float_arg(i)) {
+				m_load(instr.args[i], RAX);
+				m_ac << AsmCmd2{MOVQ, RAX, reg};
+			} else {
+				m_load(instr.args[i], reg);
+			}
+		}
+		m_ac << AsmCmd1{CALL, AsmVar{instr.name}};
+		int64_t args_size = 8*proc.stack_args();
+		if (args_size) {
+			m_ac << AsmCmd2{ADDQ, args_size, RSP};
+		}
+		if (instr.dst != -1) {
+			if (instr.type == IR_FLOAT) {
+				m_ac << AsmCmd2{MOVQ, XMM0, RAX};
+			}
+			m_store(RAX, instr.dst);
+		}
+		return;
+	}
+	case IR_WRITE:
+		m_load(instr.args[0], RDI);
+		Runtime::gen_call(m_ac, instr.name);
+		return;
+	case IR_CHECK:
+		m_load(instr.args[0], RAX);
+		RangeChecks::gen_check(m_ac, instr.imm);
+		return;
+	case IR_COUNT:
+		Profile::gen_increment(m_ac, instr.imm);
+		return;
+	case IR_JMP:
+		m_jump(block, instr.blocks[0]);
+		return;
+	case IR_BR: {
+		int then_block = instr.blocks[0], else_block = instr.blocks[1];
+		m_load(instr.args[0], RAX);
+		m_ac << AsmCmd2{TESTQ, RAX, RAX};
+		/// the layout may have put the then block next
+		if (m_next[block] == then_block && !m_has_phis(then_block) && !m_has_phis(else_block)) {
+			m_ac << AsmCmd1{JZ, m_labels[else_block]};
+			return;
+		}
+		if (!m_has_phis(then_block)) {
+			m_ac << AsmCmd1{JNZ, m_labels[then_block]};
+		} else {
+			AsmLabel _else;
+			m_ac << AsmCmd1{JZ, _else};
+			m_edge(block, then_block);
+			m_ac << AsmCmd1{JMP, m_labels[then_block]}
+			     << _else;
+		}
+		m_jump(block, else_block);
+		return;
+	}
+	case IR_RET:
+		if (!m_fn->symbol) {
+			Profile::gen_dump(m_ac);
+			if (m_writes) {
+				Runtime::gen_call(m_ac, Runtime::flush);
+			}
+			m_ac << AsmCmd2{MOVQ, RBP, RSP}
+			     << AsmCmd1{POPQ, RBP}
+			     << AsmCmd2{XORQ, RAX, RAX}
+			     << AsmCmd0{RET};
+			return;
+		}
+		if (!instr.args.empty()) {
+			m_load(instr.args[0], RAX);
+		}
+		if (m_fn->result == IR_FLOAT) {
+			m_ac << AsmCmd2{MOVQ, RAX, XMM0};
+		}
+		m_ac << AsmCmd2{MOVQ, RBP, RSP}
+		     << AsmCmd1{POPQ, RBP}
+		     << AsmCmd0{RET};
+		return;
+	}
+}
@@ -0,0 +1,41 @@
+#ifndef IRLOWER_H
+#define IRLOWER_H
+
+#include <vector>
+#include "asmcode.h"
+#include "ir.h"
+
+/// Code of an IrModule with the conventions of Node::generate: System V arguments,
+/// variables at offset(%rbp), the runtime for output.
+/// Every value has a quad of its own below the variables of the frame.
+/// Blocks go in their order unless they have profile counts: then each is followed by its
+/// most run successor not placed yet, and the blocks never run go to the end of the function.
+class IrLowering {
+public:
+	IrLowering(AsmCode&);
+	void lower(const IrModule&);
+	/// a call returned as is jumps to the callee, -O
+	static bool tail_calls;
+private:
+	AsmCode& m_ac;
+	const IrFunction* m_fn = nullptr;
+	std::vector<AsmLabel> m_labels;
+	/// the block placed after each, -1 for the last
+	std::vector<int> m_next;
+	std::vector<PAsmVar> m_strings;
+	bool m_writes = false;
+	void m_function(const IrFunction&);
+	std::vector<int> m_layout(const IrFunction&) const;
+	void m_instr(const IrInstr&, int block);
+	/// phi copies of the edge, all read before any is written
+	void m_edge(int from, int to);
+	bool m_has_phis(int block) const;
+	void m_jump(int from, int to);
+	bool m_can_tail_call(const IrInstr& call, const IrInstr& ret) const;
+	void m_tail_call(const IrInstr&);
+	AsmOffs m_slot(int value) const;
+	void m_load(int value, Register);
+	void m_store(Register, int value);
+};
+
+#endif // IRLOWER_H
@@ -0,0 +1,709 @@
+#include "irpass.h"
+#include <algorithm>
+#include <map>
+#include <tuple>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include "iranalysis.h"
+#include "profile.h"
+
+using namespace std;
+
+void PassManager::add(PIrPass pass) {
+	m_passes.push_back(pass);
+	m_stats.push_back({});
+	m_stats.back().name = pass->name();
+}
+
+void PassManager::run(IrModule& module) {
+	for (size_t i = 0; i < m_passes.size(); i++) {
+		auto start = chrono::steady_clock::now();
+		m_passes[i]->prepare(module);
+		for (IrFunction& fn: module.functions) {
+			m_stats[i].changes += m_passes[i]->run(fn);
+			fn.update_cfg();
+		}
+		m_stats[i].microseconds += chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+		for (const IrFunction& fn: module.functions) {
+			fn.verify();
+		}
+	}
+}
+
+const vector<PassManager::Stat>& PassManager::stats() const {
+	return m_stats;
+}
+
+void PassManager::print_stats(ostream& os) const {
+	for (const Stat& stat: m_stats) {
+		if (stat.changes) {
+			os << "# " << stat.name << ": " << stat.changes << '\n';
+		}
+	}
+}
+
+PassManager PassManager::standard() {
+	PassManager pm;
+	pm.add(make_shared<ConstantFolding>());
+	pm.add(make_shared<ValueNumbering>());
+	pm.add(make_shared<LoopInvariantCodeMotion>());
+	pm.add(make_shared<LoopUnrolling>());
+	pm.add(make_shared<DeadCodeElimination>());
+	return pm;
+}
+
+namespace {
+
+double to_float(int64_t bits) {
+	double value;
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+int64_t to_bits(double value) {
+	int64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+}
+
+string ConstantFolding::name() const {
+	return "constant-folding";
+}
+
+int ConstantFolding::run(IrFunction& fn) {
+	int changes = 0;
+	bool is_changed = true;
+	while (is_changed) {
+		is_changed = false;
+		vector<const IrInstr*> defs(fn.values.size(), nullptr);
+		for (const IrBlock& block: fn.blocks) {
+			for (const IrInstr& instr: block.instrs) {
+				if (instr.dst != -1) {
+					defs[instr.dst] = &instr;
+				}
+			}
+		}
+		vector<int> map(fn.values.size(), -1);
+		for (size_t b = 0; b < fn.blocks.size(); b++) {
+			for (IrInstr& instr: fn.blocks[b].instrs) {
+				int64_t result;
+				if (instr.op == IR_PHI) {
+					/// all arguments the same value, the phi itself aside
+					int same = -1;
+					bool is_same = true;
+					for (int arg: instr.args) {
+						if (arg == instr.dst || arg == same) {
+							continue;
+						}
+						if (same != -1) {
+							is_same = false;
+							break;
+						}
+						same = arg;
+					}
+					if (is_same && same != -1) {
+						map[instr.dst] = same;
+						is_changed = true;
+					}
+				} else if (instr.op == IR_BR && defs[instr.args[0]]->op == IR_CONST) {
+					int taken = instr.blocks[defs[instr.args[0]]->imm ? 0 : 1];
+					int dropped = instr.blocks[defs[instr.args[0]]->imm ? 1 : 0];
+					if (dropped != taken) {
+						for (IrInstr& phi: fn.blocks[dropped].instrs) {
+							if (phi.op != IR_PHI) {
+								break;
+							}
+							for (size_t i = 0; i < phi.blocks.size(); i++) {
+								if (phi.blocks[i] == (int)b) {
+									phi.blocks.erase(phi.blocks.begin() + i);
+									phi.args.erase(phi.args.begin() + i);
+									break;
+								}
+							}
+						}
+					}
+					instr.op = IR_JMP;
+					instr.args.clear();
+					instr.blocks = {taken};
+					is_changed = true;
+				} else if (instr.dst != -1 && instr.op != IR_CONST && m_fold(instr, defs, result)) {
+					instr.op = IR_CONST;
+					instr.imm = result;
+					instr.args.clear();
+					is_changed = true;
+				}
+			}
+		}
+		if (!is_changed) {
+			break;
+		}
+		changes++;
+		fn.replace_values(map);
+		/// phis replaced by their value are dropped
+		for (IrBlock& block: fn.blocks) {
+			block.instrs.erase(remove_if(block.instrs.begin(), block.instrs.end(), [&map](const IrInstr& instr) {
+				return instr.op == IR_PHI && map[instr.dst] != -1;
+			}), block.instrs.end());
+		}
+		fn.remove_unreachable();
+	}
+	return changes + m_remove_checks(fn);
+}
+
+/// range checks of constants in bounds
+int ConstantFolding::m_remove_checks(IrFunction& fn) const {
+	vector<bool> is_const(fn.values.size(), false);
+	vector<int64_t> consts(fn.values.size(), 0);
+	for (const IrBlock& block: fn.blocks) {
+		for (const IrInstr& instr: block.instrs) {
+			if (instr.op == IR_CONST) {
+				is_const[instr.dst] = true;
+				consts[instr.dst] = instr.imm;
+			}
+		}
+	}
+	int removed = 0;
+	for (IrBlock& block: fn.blocks) {
+		block.instrs.erase(remove_if(block.instrs.begin(), block.instrs.end(), [&](const IrInstr& instr) {
+			bool is_passed = instr.op == IR_CHECK && is_const[instr.args[0]] &&
+			                 (uint64_t)consts[instr.args[0]] < (uint64_t)instr.imm;
+			removed += is_passed;
+			return is_passed;
+		}), block.instrs.end());
+	}
+	return removed;
+}
+
+/// as the instructions of Node::generate compute them
+bool ConstantFolding::m_fold(const IrInstr& instr, const vector<const IrInstr*>& defs, int64_t& result) const {
+	if (instr.args.empty() || instr.op == IR_PHI || instr.op == IR_LOAD || instr.op == IR_CALL) {
+		return false;
+	}
+	vector<int64_t> c;
+	for (int arg: instr.args) {
+		if (!defs[arg] || defs[arg]->op != IR_CONST) {
+			return false;
+		}
+		c.push_back(defs[arg]->imm);
+	}
+	uint64_t a = c[0], b = c.size() > 1 ? c[1] : 0;
+	double x = to_float(c[0]), y = c.size() > 1 ? to_float(c[1]) : 0;
+	switch (instr.op) {
+	case IR_ADD: result = a + b; return true;
+	case IR_SUB: result = a - b; return true;
+	case IR_MUL: result = a * b; return true;
+	case IR_DIV:
+	case IR_MOD:
+		/// the fault is left to the program
+		if (c[1] == 0 || (c[0] == INT64_MIN && c[1] == -1)) {
+			return false;
+		}
+		result = instr.op == IR_DIV ? c[0] / c[1] : c[0] % c[1];
+		return true;
+	case IR_XOR: result = a ^ b; return true;
+	case IR_SHL: result = a << (b & 63); return true;
+	case IR_SHR: result = a >> (b & 63); return true;
+	case IR_NEG: result = 0 - a; return true;
+	case IR_NOT: result = a ^ 1; return true;
+	case IR_FADD: result = to_bits(x + y); return true;
+	case IR_FSUB: result = to_bits(x - y); return true;
+	case IR_FMUL: result = to_bits(x * y); return true;
+	case IR_FDIV: result = to_bits(x / y); return true;
+	case IR_FNEG: result = to_bits(0.0 - x); return true;
+	case IR_I2F: result = to_bits((double)c[0]); return true;
+	case IR_F2I:
+		/// cvtsd2si: to nearest, the integer indefinite for nan and out of range
+		if (std::isnan(x) || x >= 9223372036854775808.0 || x < -9223372036854775808.0) {
+			result = INT64_MIN;
+		} else {
+			result = llrint(x);
+		}
+		return true;
+	case IR_EQ: result = c[0] == c[1]; return true;
+	case IR_NE: result = c[0] != c[1]; return true;
+	case IR_LT: result = c[0] < c[1]; return true;
+	case IR_LE: result = c[0] <= c[1]; return true;
+	case IR_GT: result = c[0] > c[1]; return true;
+	case IR_GE: result = c[0] >= c[1]; return true;
+	/// comisd sets ZF, PF and CF when unordered, so =, < and <= hold for nan
+	case IR_FEQ: result = !(x < y || x > y); return true;
+	case IR_FNE: result = x < y || x > y; return true;
+	case IR_FLT: result = !(x >= y); return true;
+	case IR_FLE: result = !(x > y); return true;
+	case IR_FGT: result = x > y; return true;
+	case IR_FGE: result = x >= y; return true;
+	default:
+		return false;
+	}
+}
+
+string DeadCodeElimination::name() const {
+	return "dead-code";
+}
+
+int DeadCodeElimination::run(IrFunction& fn) {
+	int changes = fn.remove_unreachable() ? 1 : 0;
+	vector<int> uses = fn.use_counts();
+	bool is_changed = true;
+	while (is_changed) {
+		is_changed = false;
+		for (IrBlock& block: fn.blocks) {
+			for (int i = block.instrs.size() - 1; i >= 0; i--) {
+				const IrInstr& instr = block.instrs[i];
+				if (instr.dst == -1 || uses[instr.dst] || !instr.is_pure()) {
+					continue;
+				}
+				for (int arg: instr.args) {
+					uses[arg]--;
+				}
+				block.instrs.erase(block.instrs.begin() + i);
+				changes++;
+				is_changed = true;
+			}
+		}
+	}
+	return changes;
+}
+
+string ValueNumbering::name() const {
+	return "value-numbering";
+}
+
+namespace {
+
+struct Expression {
+	IrOp op;
+	IrType type;
+	int64_t imm;
+	std::string name;
+	std::vector<int> args;
+	bool operator<(const Expression& other) const {
+		return tie(op, type, imm, name, args) < tie(other.op, other.type, other.imm, other.name, other.args);
+	}
+};
+
+struct AvailableLoad {
+	int value;
+	IrAlias alias;
+};
+
+/// by address and type
+typedef map<pair<int, IrType>, AvailableLoad> Loads;
+
+bool is_commutative(IrOp op) {
+	return op == IR_ADD || op == IR_MUL || op == IR_XOR || op == IR_EQ || op == IR_NE;
+}
+
+void kill_loads(Loads& loads, IrAlias alias, int address) {
+	for (auto it = loads.begin(); it != loads.end();) {
+		if (ir_may_alias(alias, address, it->second.alias, it->first.first)) {
+			it = loads.erase(it);
+		} else {
+			++it;
+		}
+	}
+}
+
+}
+
+int ValueNumbering::run(IrFunction& fn) {
+	DominatorTree dt(fn);
+	vector<int> map(fn.values.size(), -1);
+	auto leader = [&map](int value) {
+		while (map[value] != -1) {
+			value = map[value];
+		}
+		return value;
+	};
+	std::map<Expression, int> table;
+	/// expressions of the blocks being walked, removed when leaving them
+	vector<vector<Expression>> scopes(fn.blocks.size());
+	vector<Loads> entry_loads(fn.blocks.size());
+	int changes = 0;
+	vector<pair<int, bool>> stack = {{0, false}};
+	while (!stack.empty()) {
+		int b = stack.back().first;
+		bool is_leaving = stack.back().second;
+		stack.pop_back();
+		if (is_leaving) {
+			for (const Expression& e: scopes[b]) {
+				table.erase(e);
+			}
+			scopes[b].clear();
+			continue;
+		}
+		stack.push_back({b, true});
+		Loads loads;
+		swap(loads, entry_loads[b]);
+		vector<IrInstr>& instrs = fn.blocks[b].instrs;
+		for (size_t i = 0; i < instrs.size(); i++) {
+			IrInstr& instr = instrs[i];
+			if (instr.op != IR_PHI) {
+				for (int& arg: instr.args) {
+					arg = leader(arg);
+				}
+			}
+			if (instr.op == IR_LOAD) {
+				pair<int, IrType> key = {instr.args[0], instr.type};
+				auto it = loads.find(key);
+				if (it != loads.end()) {
+					map[instr.dst] = it->second.value;
+					instrs.erase(instrs.begin() + i--);
+					changes++;
+				} else {
+					loads[key] = {instr.dst, instr.alias};
+				}
+				continue;
+			}
+			if (instr.op == IR_STORE) {
+				kill_loads(loads, instr.alias, instr.args[0]);
+				/// the value stored is what a load of it gives back
+				loads[{instr.args[0], fn.values[instr.args[1]]}] = {instr.args[1], instr.alias};
+				continue;
+			}
+			if (instr.op == IR_COPY || instr.op == IR_CALL) {
+				loads.clear();
+				continue;
+			}
+			/// a division that did not fault will not the second time
+			bool is_numbered = instr.is_pure() || instr.op == IR_DIV || instr.op == IR_MOD;
+			if (instr.dst == -1 || instr.op == IR_PHI || !is_numbered) {
+				continue;
+			}
+			Expression e{instr.op, instr.type, instr.imm, instr.name, instr.args};
+			if (is_commutative(instr.op)) {
+				sort(e.args.begin(), e.args.end());
+			}
+			auto it = table.find(e);
+			if (it != table.end()) {
+				map[instr.dst] = it->second;
+				instrs.erase(instrs.begin() + i--);
+				changes++;
+			} else {
+				table[e] = instr.dst;
+				scopes[b].push_back(e);
+			}
+		}
+		for (int child: dt.children(b)) {
+			if (fn.blocks[child].preds.size() == 1) {
+				entry_loads[child] = loads;
+			}
+			stack.push_back({child, false});
+		}
+	}
+	fn.replace_values(map);
+	return changes;
+}
+
+string LoopInvariantCodeMotion::name() const {
+	return "loop-invariant-code-motion";
+}
+
+void LoopInvariantCodeMotion::prepare(const IrModule& module) {
+	m_aliases = make_shared<AliasAnalysis>(module);
+}
+
+int LoopInvariantCodeMotion::run(IrFunction& fn) {
+	if (m_make_preheaders(fn)) {
+		fn.update_cfg();
+	}
+	DominatorTree dt(fn);
+	LoopInfo li(fn, dt);
+	int changes = 0;
+	/// inner loops first, what leaves one may leave the next too
+	for (const LoopInfo::Loop& loop: li.loops()) {
+		if (loop.preheader != -1) {
+			changes += m_hoist(fn, loop);
+		}
+	}
+	return changes;
+}
+
+bool LoopInvariantCodeMotion::m_make_preheaders(IrFunction& fn) {
+	DominatorTree dt(fn);
+	LoopInfo li(fn, dt);
+	bool is_changed = false;
+	for (const LoopInfo::Loop& loop: li.loops()) {
+		if (loop.preheader != -1) {
+			continue;
+		}
+		vector<int> outside;
+		for (int pred: fn.blocks[loop.header].preds) {
+			if (!loop.blocks.count(pred) && dt.is_reachable(pred)) {
+				outside.push_back(pred);
+			}
+		}
+		const vector<IrInstr>& header = fn.blocks[loop.header].instrs;
+		/// the phis would need their own in the preheader
+		if (outside.empty() || (outside.size() > 1 && !header.empty() && header[0].op == IR_PHI)) {
+			continue;
+		}
+		int preheader = fn.new_block();
+		/// entered as often as the blocks before it
+		for (int pred: outside) {
+			int64_t count = fn.blocks[pred].count, sum = fn.blocks[preheader].count;
+			fn.blocks[preheader].count = count == -1 || (sum == -1 && pred != outside[0]) ? -1 : max(sum, (int64_t)0) + count;
+		}
+		IrInstr jump;
+		jump.op = IR_JMP;
+		jump.blocks = {loop.header};
+		fn.blocks[preheader].instrs.push_back(jump);
+		for (int pred: outside) {
+			for (int& target: fn.blocks[pred].instrs.back().blocks) {
+				if (target == loop.header) {
+					target = preheader;
+				}
+			}
+		}
+		for (IrInstr& phi: fn.blocks[loop.header].instrs) {
+			if (phi.op != IR_PHI) {
+				break;
+			}
+			for (int& from: phi.blocks) {
+				if (from == outside[0]) {
+					from = preheader;
+				}
+			}
+		}
+		is_changed = true;
+	}
+	return is_changed;
+}
+
+int LoopInvariantCodeMotion::m_hoist(IrFunction& fn, const LoopInfo::Loop& loop) {
+	vector<bool> is_inside(fn.values.size(), false);
+	vector<IrInstr> clobbers;
+	for (int b: loop.blocks) {
+		for (const IrInstr& instr: fn.blocks[b].instrs) {
+			if (instr.dst != -1) {
+				is_inside[instr.dst] = true;
+			}
+			if (instr.op == IR_STORE || instr.op == IR_COPY || instr.op == IR_CALL) {
+				clobbers.push_back(instr);
+			}
+		}
+	}
+	vector<IrInstr> hoisted;
+	bool is_changed = true;
+	while (is_changed) {
+		is_changed = false;
+		for (int b: loop.blocks) {
+			vector<IrInstr>& instrs = fn.blocks[b].instrs;
+			bool is_after_check = false;
+			for (size_t i = 0; i < instrs.size(); i++) {
+				const IrInstr& instr = instrs[i];
+				is_after_check |= instr.op == IR_CHECK;
+				if (instr.dst == -1 || instr.op == IR_PHI || instr.op == IR_PARAM) {
+					continue;
+				}
+				bool is_invariant = true;
+				for (int arg: instr.args) {
+					is_invariant &= !is_inside[arg];
+				}
+				if (!is_invariant) {
+					continue;
+				}
+				/// executed whenever the preheader is, a failed range check stops the program before
+				bool is_always = b == loop.header && !is_after_check;
+				if (instr.op == IR_LOAD) {
+					if (!is_always && !m_aliases->is_variable_load(fn, instr)) {
+						continue;
+					}
+					bool is_clobbered = false;
+					for (const IrInstr& clobber: clobbers) {
+						if (m_aliases->may_clobber(fn, clobber, instr)) {
+							is_clobbered = true;
+							break;
+						}
+					}
+					if (is_clobbered) {
+						continue;
+					}
+				} else if (instr.op == IR_DIV || instr.op == IR_MOD) {
+					if (!is_always) {
+						continue;
+					}
+				} else if (!instr.is_pure()) {
+					continue;
+				}
+				is_inside[instr.dst] = false;
+				hoisted.push_back(instr);
+				instrs.erase(instrs.begin() + i--);
+				is_changed = true;
+			}
+		}
+	}
+	vector<IrInstr>& preheader = fn.blocks[loop.preheader].instrs;
+	preheader.insert(preheader.end() - 1, hoisted.begin(), hoisted.end());
+	return hoisted.size();
+}
+
+int LoopUnrolling::min_trips = 4;
+int LoopUnrolling::max_size = 160;
+
+string LoopUnrolling::name() const {
+	return "loop-unrolling";
+}
+
+/// one loop at a time, the loops are found again after each
+int LoopUnrolling::run(IrFunction& fn) {
+	if (!Profile::is_loaded()) {
+		return 0;
+	}
+	set<int> done;
+	int changes = 0;
+	bool is_changed = true;
+	while (is_changed) {
+		is_changed = false;
+		DominatorTree dt(fn);
+		LoopInfo li(fn, dt);
+		for (const LoopInfo::Loop& loop: li.loops()) {
+			bool is_innermost = true;
+			for (const LoopInfo::Loop& other: li.loops()) {
+				is_innermost &= other.header == loop.header || !loop.blocks.count(other.header);
+			}
+			if (!is_innermost || !done.insert(loop.header).second) {
+				continue;
+			}
+			int factor = m_factor(fn, loop);
+			if (factor > 1) {
+				m_unroll(fn, loop, factor);
+				fn.update_cfg();
+				changes++;
+				is_changed = true;
+				break;
+			}
+		}
+	}
+	return changes;
+}
+
+int LoopUnrolling::m_factor(const IrFunction& fn, const LoopInfo::Loop& loop) const {
+	const IrBlock& header = fn.blocks[loop.header];
+	if (!Profile::is_hot(header.count) || (!header.instrs.empty() && header.instrs[0].op == IR_PHI)) {
+		return 1;
+	}
+	int64_t entries = 0;
+	for (int pred: header.preds) {
+		if (!loop.blocks.count(pred)) {
+			if (fn.blocks[pred].count == -1) {
+				return 1;
+			}
+			entries += fn.blocks[pred].count;
+		}
+	}
+	int64_t trips = entries > 0 ? header.count / entries : 0;
+	if (trips < min_trips) {
+		return 1;
+	}
+	vector<bool> is_inside(fn.values.size(), false);
+	int size = 0;
+	for (int b: loop.blocks) {
+		for (const IrInstr& instr: fn.blocks[b].instrs) {
+			if (instr.dst != -1) {
+				is_inside[instr.dst] = true;
+			}
+		}
+		size += fn.blocks[b].instrs.size();
+	}
+	/// a value of the loop used after it would need a phi of the copies
+	for (size_t b = 0; b < fn.blocks.size(); b++) {
+		if (loop.blocks.count(b)) {
+			continue;
+		}
+		for (const IrInstr& instr: fn.blocks[b].instrs) {
+			for (int arg: instr.args) {
+				if (is_inside[arg]) {
+					return 1;
+				}
+			}
+		}
+	}
+	int factor = trips >= 2 * min_trips ? 4 : 2;
+	while (factor > 1 && size * factor > max_size) {
+		factor /= 2;
+	}
+	return factor;
+}
+
+/// the back edges of each copy go to the header of the next, of the last to the loop header
+void LoopUnrolling::m_unroll(IrFunction& fn, const LoopInfo::Loop& loop, int factor) {
+	vector<map<int, int>> block_maps(factor);
+	vector<vector<int>> value_maps(factor);
+	for (int c = 0; c < factor; c++) {
+		for (int b: loop.blocks) {
+			block_maps[c][b] = c == 0 ? b : fn.new_block();
+		}
+	}
+	size_t values = fn.values.size();
+	for (int c = 1; c < factor; c++) {
+		value_maps[c].assign(values, -1);
+		for (int b: loop.blocks) {
+			for (const IrInstr& instr: fn.blocks[b].instrs) {
+				if (instr.dst != -1) {
+					value_maps[c][instr.dst] = fn.new_value(instr.type);
+				}
+			}
+		}
+	}
+	/// copies first, the loop itself is retargeted last
+	for (int c = factor - 1; c >= 0; c--) {
+		const map<int, int>& blocks = block_maps[c];
+		int next_header = block_maps[(c + 1) % factor].at(loop.header);
+		for (int b: loop.blocks) {
+			vector<IrInstr> instrs = fn.blocks[b].instrs;
+			for (IrInstr& instr: instrs) {
+				if (c > 0) {
+					if (instr.dst != -1) {
+						instr.dst = value_maps[c][instr.dst];
+					}
+					for (int& arg: instr.args) {
+						if (arg < (int)values && value_maps[c][arg] != -1) {
+							arg = value_maps[c][arg];
+						}
+					}
+				}
+				for (int& target: instr.blocks) {
+					if (instr.op != IR_PHI && target == loop.header) {
+						target = next_header;
+					} else if (blocks.count(target)) {
+						target = blocks.at(target);
+					}
+				}
+			}
+			IrBlock& copy = fn.blocks[blocks.at(b)];
+			copy.instrs = move(instrs);
+			copy.count = fn.blocks[b].count == -1 ? -1 : fn.blocks[b].count / factor;
+		}
+	}
+	/// phis after the loop get the same value from each copy of their predecessor
+	for (size_t b = 0; b < fn.blocks.size(); b++) {
+		bool is_copy = false;
+		for (int c = 1; c < factor && !is_copy; c++) {
+			for (const pair<const int, int>& copied: block_maps[c]) {
+				is_copy |= copied.second == (int)b;
+			}
+		}
+		if (loop.blocks.count(b) || is_copy) {
+			continue;
+		}
+		for (IrInstr& phi: fn.blocks[b].instrs) {
+			if (phi.op != IR_PHI) {
+				break;
+			}
+			size_t n = phi.blocks.size();
+			for (size_t i = 0; i < n; i++) {
+				if (!loop.blocks.count(phi.blocks[i])) {
+					continue;
+				}
+				for (int c = 1; c < factor; c++) {
+					phi.args.push_back(phi.args[i]);
+					phi.blocks.push_back(block_maps[c].at(phi.blocks[i]));
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,104 @@
+#ifndef IRPASS_H
+#define IRPASS_H
+
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "ir.h"
+#include "iranalysis.h"
+
+/// Transformation of one function, run by a PassManager.
+class IrPass {
+public:
+	virtual ~IrPass() = default;
+	virtual std::string name() const = 0;
+	/// facts of the whole module, before the functions are run
+	virtual void prepare(const IrModule&) {}
+	/// number of changes made
+	virtual int run(IrFunction&) = 0;
+};
+typedef std::shared_ptr<IrPass> PIrPass;
+
+/// Runs the passes in order over every function and verifies the result of each.
+/// Changes and time are counted per pass.
+class PassManager {
+public:
+	struct Stat {
+		std::string name;
+		int changes = 0;
+		int64_t microseconds = 0;
+	};
+	void add(PIrPass);
+	void run(IrModule&);
+	const std::vector<Stat>& stats() const;
+	/// changes as comments of the assembly, times would make it differ between runs
+	void print_stats(std::ostream&) const;
+	/// the passes of -O
+	static PassManager standard();
+private:
+	std::vector<PIrPass> m_passes;
+	std::vector<Stat> m_stats;
+};
+
+/// Folds instructions of constants with the semantics of the machine code,
+/// phis of one value and branches on constants. Range checks of constants that pass are removed.
+class ConstantFolding : public IrPass {
+public:
+	std::string name() const override;
+	int run(IrFunction&) override;
+private:
+	bool m_fold(const IrInstr&, const std::vector<const IrInstr*>& defs, int64_t& result) const;
+	int m_remove_checks(IrFunction&) const;
+};
+
+/// Removes unused pure instructions and unreachable blocks.
+class DeadCodeElimination : public IrPass {
+public:
+	std::string name() const override;
+	int run(IrFunction&) override;
+};
+
+/// Value numbering over the dominator tree: an instruction computing what a dominating
+/// one does is replaced by it. Loads are numbered along single-predecessor chains of blocks
+/// and forgotten on the stores that may alias them (ir_may_alias), on copies and calls.
+class ValueNumbering : public IrPass {
+public:
+	std::string name() const override;
+	int run(IrFunction&) override;
+};
+
+/// Moves loop invariant computations and loads to a preheader made for each loop.
+/// Loads stay unless no store, copy or call of the loop may change them by AliasAnalysis.
+/// Only what cannot fault is moved from blocks after the header: a load of a variable
+/// itself, no division.
+class LoopInvariantCodeMotion : public IrPass {
+public:
+	std::string name() const override;
+	void prepare(const IrModule&) override;
+	int run(IrFunction&) override;
+private:
+	std::shared_ptr<AliasAnalysis> m_aliases;
+	/// the blocks jumping to the header from outside go to a new block first
+	bool m_make_preheaders(IrFunction&);
+	int m_hoist(IrFunction&, const LoopInfo::Loop&);
+};
+
+/// Unrolls the hot innermost loops of a loaded profile that run at least min_trips
+/// iterations per entry: the body is copied factor - 1 times, each copy ending where the
+/// next one starts, with the exits of the loop kept in every copy. Loops with phis in the
+/// header or values used after them are left alone.
+class LoopUnrolling : public IrPass {
+public:
+	static int min_trips;
+	/// instructions of the unrolled loop
+	static int max_size;
+	std::string name() const override;
+	int run(IrFunction&) override;
+private:
+	/// copies in the loop, 1 if it is not unrolled
+	int m_factor(const IrFunction&, const LoopInfo::Loop&) const;
+	void m_unroll(IrFunction&, const LoopInfo::Loop&, int factor);
+};
+
+#endif // IRPASS_H
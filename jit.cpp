@@ -0,0 +1,123 @@
+#include "jit.h"
+#include <cstring>
+#include <dlfcn.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "exceptions.h"
+
+using namespace std;
+
+namespace {
+
+/// jmp *0(%rip) followed by the target
+const uint8_t stub_code[] = {0xff, 0x25, 0, 0, 0, 0};
+const size_t stub_size = 16;
+/// the generated code keeps no callee-saved register: call *%rdi with rbx, rbp and r12-r15 saved
+/// around it and the stack aligned to 16 at the call
+const uint8_t entry_code[] = {
+	0x53, 0x55, 0x41, 0x54, 0x41, 0x55, 0x41, 0x56, 0x41, 0x57,  // push rbx, rbp, r12-r15
+	0x48, 0x83, 0xec, 0x08,                                      // subq $8, %rsp
+	0xff, 0xd7,                                                  // call *%rdi
+	0x48, 0x83, 0xc4, 0x08,                                      // addq $8, %rsp
+	0x41, 0x5f, 0x41, 0x5e, 0x41, 0x5d, 0x41, 0x5c, 0x5d, 0x5b,  // pop r15-r12, rbp, rbx
+	0xc3,                                                        // ret
+};
+
+}
+
+Jit::Jit(const Encoder& encoder) :
+    m_encoder(encoder)
+{}
+
+Jit::~Jit() {
+	if (m_memory) {
+		munmap(m_memory, m_size);
+	}
+}
+
+int Jit::run() {
+	m_load();
+	auto it = find_if(m_encoder.symbols.begin(), m_encoder.symbols.end(), [](const Encoder::Symbol& s) {
+		return s.name == "main" && s.section == Encoder::TEXT;
+	});
+	if (it == m_encoder.symbols.end()) {
+		throw JitError("main is not defined");
+	}
+	int (*entry)(uint64_t) = (int (*)(uint64_t))m_entry;
+	return entry(m_address(*it));
+}
+
+/// [.text stubs entry] [.rodata .data .bss], the code part is made executable
+void Jit::m_load() {
+	size_t page = sysconf(_SC_PAGESIZE);
+	size_t stubs = m_align(m_encoder.text.size(), 16);
+	size_t n_stubs = 0;
+	for (const Encoder::Symbol& symbol: m_encoder.symbols) {
+		n_stubs += symbol.section == Encoder::UNDEF;
+	}
+	size_t entry = stubs + n_stubs * stub_size;
+	size_t code_size = m_align(entry + sizeof(entry_code), page);
+	m_base[Encoder::RODATA] = code_size;
+	m_base[Encoder::DATA] = m_align(m_base[Encoder::RODATA] + m_encoder.rodata.size(), 16);
+	m_base[Encoder::BSS] = m_align(m_base[Encoder::DATA] + m_encoder.data.size(), 16);
+	m_size = m_align(m_base[Encoder::BSS] + m_encoder.bss_size, page);
+
+	void* memory = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (memory == MAP_FAILED) {
+		throw JitError("cannot map " + to_string(m_size) + " bytes");
+	}
+	m_memory = (uint8_t*)memory;
+	for (int section: {Encoder::TEXT, Encoder::RODATA, Encoder::DATA, Encoder::BSS}) {
+		m_base[section] += (uint64_t)m_memory;
+	}
+	copy(m_encoder.text.begin(), m_encoder.text.end(), m_memory);
+	copy(m_encoder.rodata.begin(), m_encoder.rodata.end(), (uint8_t*)m_base[Encoder::RODATA]);
+	copy(m_encoder.data.begin(), m_encoder.data.end(), (uint8_t*)m_base[Encoder::DATA]);
+
+	memcpy(m_memory + entry, entry_code, sizeof(entry_code));
+	m_entry = (uint64_t)m_memory + entry;
+
+	uint8_t* stub = m_memory + stubs;
+	for (const Encoder::Symbol& symbol: m_encoder.symbols) {
+		if (symbol.section != Encoder::UNDEF) {
+			continue;
+		}
+		void* target = dlsym(RTLD_DEFAULT, symbol.name.c_str());
+		if (!target) {
+			throw JitError("undefined symbol " + symbol.name);
+		}
+		memcpy(stub, stub_code, sizeof(stub_code));
+		memcpy(stub + sizeof(stub_code), &target, sizeof(target));
+		m_stubs[symbol.name] = (uint64_t)stub;
+		stub += stub_size;
+	}
+
+	map<string, const Encoder::Symbol*> symbols;
+	for (const Encoder::Symbol& symbol: m_encoder.symbols) {
+		symbols[symbol.name] = &symbol;
+	}
+	for (const Encoder::Reloc& reloc: m_encoder.relocs) {
+		/// all relative to the field, the code and the data are in the same mapping
+		int64_t value = m_address(*symbols.at(reloc.symbol)) + reloc.addend - ((int64_t)m_memory + reloc.offset);
+		if (value != (int32_t)value) {
+			throw JitError("relocation against " + reloc.symbol + " is out of range");
+		}
+		int32_t field = value;
+		memcpy(m_memory + reloc.offset, &field, sizeof(field));
+	}
+
+	if (mprotect(m_memory, code_size, PROT_READ | PROT_EXEC)) {
+		throw JitError("cannot make the code executable");
+	}
+}
+
+uint64_t Jit::m_address(const Encoder::Symbol& symbol) const {
+	if (symbol.section == Encoder::UNDEF) {
+		return m_stubs.at(symbol.name);
+	}
+	return m_base[symbol.section] + symbol.offset;
+}
+
+size_t Jit::m_align(size_t value, size_t alignment) {
+	return (value + alignment - 1) / alignment * alignment;
+}
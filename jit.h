@@ -0,0 +1,34 @@
+#ifndef JIT_H
+#define JIT_H
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include "encoder.h"
+
+/// Runs an encoded program in this process.
+/// Code and data are copied to one mapping anywhere in memory, every relocation relative to its place
+/// in it; calls to libc go through stubs with absolute addresses found by dlsym. main is entered
+/// through a trampoline saving the registers the caller expects kept, the generated code does not.
+class Jit {
+public:
+	Jit(const Encoder&);
+	~Jit();
+	/// exit code of the program's main
+	int run();
+private:
+	const Encoder& m_encoder;
+	uint8_t* m_memory = nullptr;
+	size_t m_size = 0;
+	/// start of each Encoder::Section in m_memory
+	uint64_t m_base[Encoder::UNDEF] = {};
+	/// jmp *libc_function for each undefined symbol
+	std::map<std::string, uint64_t> m_stubs;
+	/// the trampoline calling main
+	uint64_t m_entry = 0;
+	void m_load();
+	uint64_t m_address(const Encoder::Symbol&) const;
+	static size_t m_align(size_t, size_t);
+};
+
+#endif // JIT_H
@@ -0,0 +1,499 @@
+#include "liveness.h"
+
+using namespace std;
+
+uint64_t AsmEffects::units(Register reg, bool& partial) {
+	partial = reg == AL || reg == CL || reg == DIL;
+	switch (reg) {
+	case AL:
+		return 1ull << RAX;
+	case CL:
+		return 1ull << RCX;
+	case DIL:
+		return 1ull << RDI;
+	case RIP:
+		return 0;
+	default:
+		break;
+	}
+	if (reg <= RBP) {
+		return 1ull << reg;
+	}
+	if (reg >= R8 && reg <= R15) {
+		return 1ull << (8 + reg - R8);
+	}
+	if (reg == XMM0 || reg == XMM1) {
+		return 1ull << (16 + reg - XMM0);
+	}
+	if (reg >= XMM2 && reg <= XMM15) {
+		return 1ull << (18 + reg - XMM2);
+	}
+	if (reg >= YMM0 && reg <= YMM15) {
+		return (1ull << (16 + reg - YMM0)) | (1ull << (32 + reg - YMM0));
+	}
+	throw runtime_error("Internal error: register without units");
+}
+
+std::pair<uint32_t, int64_t> AsmEffects::slot_key(const AsmOp& slot) {
+	if (slot.kind == AsmOp::VAR || slot.reg() == RIP) {
+		return {slot.name, 0};
+	}
+	return {uint32_t(AsmOp::no_name), slot.value};
+}
+
+bool AsmEffects::is_slot(const AsmOp& op) {
+	if (op.kind == AsmOp::VAR) {
+		return true;
+	}
+	if (op.kind != AsmOp::MEM || op.scale) {
+		return false;
+	}
+	return (op.reg() == RBP && op.name == AsmOp::no_name && op.value % 8 == 0) ||
+	       (op.reg() == RIP && op.name != AsmOp::no_name);
+}
+
+AsmEffects::AsmEffects(const AsmInstr& cmd) {
+	if (cmd.kind != AsmInstr::CMD) {
+		pure = false;
+		return;
+	}
+	const AsmOp* ops = cmd.ops;
+	const uint64_t flags_unit = 1ull << flags;
+	Opcode oc = cmd.oc();
+	switch (oc) {
+	case MOVQ: case MOVABSQ: case CVTSD2SI:
+		m_wide = true;
+		m_use(ops[0]);
+		m_def(ops[1]);
+		break;
+	case LEAQ:
+		m_addr(ops[0]);
+		m_def(ops[1]);
+		break;
+	/// from a register only the low half of the destination
+	case MOVSD:
+		m_wide = true;
+		m_use(ops[0]);
+		m_def(ops[1], ops[0].kind != AsmOp::REG);
+		break;
+	case CVTSI2SD:
+		m_wide = true;
+		m_use(ops[0]);
+		m_def(ops[1], false);
+		break;
+	case MOVUPD: case MOVDQU: case MOVAPD: case MOVDQA: case MOVB:
+		m_use(ops[0]);
+		m_def(ops[1]);
+		break;
+	case VMOVUPD: case VMOVDQU: case VMOVAPD: case VMOVDQA:
+	case VBROADCASTSD: case VPBROADCASTQ:
+		m_wide = oc == VBROADCASTSD || oc == VPBROADCASTQ;
+		m_use(ops[0]);
+		m_vex_def(ops[1]);
+		break;
+	case ADDQ: case SUBQ: case ANDQ: case ORQ: case XORQ:
+	case SHLQ: case SHRQ: case SARQ:
+	case ADDSD: case SUBSD: case MULSD: case DIVSD:
+		m_wide = true;
+		m_rmw(ops[0], ops[1], oc == XORQ);
+		if (oc == SHLQ || oc == SHRQ || oc == SARQ) {
+			/// a shift by 0 leaves the flags
+			defs |= flags_unit;
+			if (ops[0].kind == AsmOp::IMM && ops[0].value & 63) {
+				kills |= flags_unit;
+			}
+		} else if (oc != ADDSD && oc != SUBSD && oc != MULSD && oc != DIVSD) {
+			defs |= kills |= flags_unit;
+		}
+		break;
+	case XORPD: case ADDPD: case SUBPD: case MULPD: case DIVPD:
+	case PADDQ: case PSUBQ: case PXOR: case UNPCKLPD: case PUNPCKLQDQ:
+		m_rmw(ops[0], ops[1], oc == XORPD || oc == PXOR);
+		break;
+	case BTSQ: case ADDB:
+		m_rmw(ops[0], ops[1], false);
+		defs |= kills |= flags_unit;
+		break;
+	case NEGQ: case INCQ: case DECQ:
+		m_wide = true;
+		m_use(ops[0]);
+		m_def(ops[0]);
+		/// inc and dec leave the carry
+		defs |= flags_unit;
+		if (oc == NEGQ) {
+			kills |= flags_unit;
+		}
+		break;
+	case IMULQ:
+		m_wide = true;
+		if (cmd.count == 1) {
+			m_use(ops[0]);
+			uses |= 1ull << RAX;
+			defs |= kills |= 1ull << RAX | 1ull << RDX;
+		} else if (cmd.count == 2) {
+			m_use(ops[0]);
+			m_use(ops[1]);
+			m_def(ops[1]);
+		} else {
+			m_use(ops[0]);
+			m_use(ops[1]);
+			m_def(ops[2]);
+		}
+		defs |= kills |= flags_unit;
+		break;
+	case MULQ: case IDIVQ:
+		m_wide = true;
+		m_use(ops[0]);
+		uses |= 1ull << RAX;
+		if (oc == IDIVQ) {
+			/// division by zero traps
+			uses |= 1ull << RDX;
+			pure = false;
+		}
+		defs |= kills |= 1ull << RAX | 1ull << RDX | flags_unit;
+		break;
+	case CQO:
+		uses |= 1ull << RAX;
+		defs |= kills |= 1ull << RDX;
+		break;
+	case SHRDQ:
+		m_wide = true;
+		m_use(ops[0]);
+		m_use(ops[1]);
+		m_use(ops[2]);
+		m_def(ops[2]);
+		defs |= flags_unit;
+		if (ops[0].kind == AsmOp::IMM && ops[0].value & 63) {
+			kills |= flags_unit;
+		}
+		break;
+	case SETE: case SETNE: case SETL: case SETG: case SETGE:
+	case SETLE: case SETA: case SETB: case SETAE: case SETBE:
+		uses |= flags_unit;
+		m_def(ops[0]);
+		break;
+	case CMPQ: case TESTQ: case COMISD: case TESTB:
+		m_wide = oc != TESTB;
+		m_use(ops[0]);
+		m_use(ops[1]);
+		defs |= kills |= flags_unit;
+		break;
+	case JZ: case JNZ: case JE: case JGE: case JLE:
+	case JG: case JL: case JB: case JBE: case JAE: case JNS:
+		uses |= flags_unit;
+		pure = false;
+		break;
+	case JMP:
+		pure = false;
+		break;
+	/// the pushed values are below the slots of the frame
+	case PUSHQ:
+		m_wide = true;
+		m_use(ops[0]);
+		uses |= 1ull << RSP;
+		defs |= 1ull << RSP;
+		break;
+	case POPQ:
+		m_wide = true;
+		uses |= 1ull << RSP;
+		defs |= 1ull << RSP;
+		m_def(ops[0]);
+		break;
+	case VADDPD: case VSUBPD: case VMULPD: case VDIVPD:
+	case VPADDQ: case VPSUBQ: case VXORPD: case VPXOR:
+		if (!m_zeroes(ops[0], ops[1], oc == VXORPD || oc == VPXOR)) {
+			m_use(ops[0]);
+			m_use(ops[1]);
+		}
+		m_vex_def(ops[2]);
+		break;
+	/// the arguments in, the registers not kept by the callee out
+	case CALL: {
+		bool partial;
+		if (!ops[0].is_label()) {
+			m_use(ops[0]);
+		}
+		uses |= 1ull << RSP | 1ull << RBP;
+		for (Register reg: {RDI, RSI, RDX, RCX, R8, R9, XMM0, XMM1, XMM2, XMM3, XMM4, XMM5, XMM6, XMM7}) {
+			uses |= units(reg, partial);
+		}
+		defs |= kills |= 1ull << RAX | 1ull << RCX | 1ull << RDX | 1ull << RSI | 1ull << RDI |
+		                 0xfull << 8 | 0xffffffffull << 16 | flags_unit;
+		reads_any = writes_any = true;
+		pure = false;
+		break;
+	}
+	/// the result and the registers kept for the caller
+	case RET:
+		uses |= 1ull << RAX | 1ull << RBX | 1ull << RSP | 1ull << RBP | 0xfull << 12 | 1ull << 16;
+		reads_any = true;
+		pure = false;
+		break;
+	case VZEROUPPER:
+		defs |= kills |= 0xffffull << 32;
+		pure = false;
+		break;
+	default:
+		m_all();
+		break;
+	}
+	if (reads_any || writes_any || defs & (1ull << RSP | 1ull << RBP)) {
+		pure = false;
+	}
+}
+
+void AsmEffects::m_use(const AsmOp& op) {
+	bool partial;
+	switch (op.kind) {
+	case AsmOp::REG:
+		uses |= units(op.reg(), partial);
+		break;
+	case AsmOp::MEM:
+	case AsmOp::VAR:
+		m_addr(op);
+		if (m_wide && is_slot(op)) {
+			read = op;
+		} else {
+			reads_any = true;
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+void AsmEffects::m_def(const AsmOp& op, bool whole) {
+	bool partial;
+	switch (op.kind) {
+	case AsmOp::REG: {
+		uint64_t u = units(op.reg(), partial);
+		defs |= u;
+		if (whole && !partial) {
+			kills |= u;
+		}
+		break;
+	}
+	case AsmOp::MEM:
+	case AsmOp::VAR:
+		m_addr(op);
+		if (m_wide && is_slot(op)) {
+			write = op;
+		} else {
+			writes_any = true;
+		}
+		break;
+	default:
+		break;
+	}
+}
+
+/// src op dst, dst read unless it is cleared
+void AsmEffects::m_rmw(const AsmOp& src, const AsmOp& dst, bool is_xor) {
+	if (!m_zeroes(src, dst, is_xor)) {
+		m_use(src);
+		m_use(dst);
+	}
+	m_def(dst);
+}
+
+/// xor of a register with itself does not read it
+bool AsmEffects::m_zeroes(const AsmOp& a, const AsmOp& b, bool is_xor) {
+	return is_xor && a.kind == AsmOp::REG && a == b;
+}
+
+void AsmEffects::m_addr(const AsmOp& op) {
+	bool partial;
+	if (op.kind == AsmOp::MEM) {
+		uses |= units(op.reg(), partial);
+		if (op.scale) {
+			uses |= units(op.index_reg(), partial);
+		}
+	}
+}
+
+/// VEX commands clear the high half of a register they write
+void AsmEffects::m_vex_def(const AsmOp& op) {
+	bool partial;
+	if (op.kind == AsmOp::REG) {
+		uint64_t u = units(op.reg(), partial);
+		u |= (u & 0xffffull << 16) << 16;
+		defs |= kills |= u;
+	} else {
+		m_def(op);
+	}
+}
+
+void AsmEffects::m_all() {
+	uses = all_units;
+	reads_any = writes_any = true;
+	pure = false;
+}
+
+Liveness::Liveness(AsmCode& a_ac) :
+	ac(a_ac), cmds(a_ac.m_commands)
+{}
+
+int Liveness::eliminate() {
+	m_number_slots();
+	size_t size = cmds.size();
+	m_rounds = 1;
+	while (m_round()) {
+		m_rounds++;
+	}
+	return size - cmds.size();
+}
+
+int Liveness::rounds() const {
+	return m_rounds;
+}
+
+bool Liveness::m_round() {
+	AsmCfg cfg(ac);
+	m_blocks.resize(cfg.blocks.size());
+	for (size_t b = 0; b < cfg.blocks.size(); b++) {
+		m_summary(cfg, b);
+	}
+	m_solve(cfg);
+	vector<bool> dead(cmds.size());
+	bool removed = false;
+	uint64_t live;
+	Slots slots;
+	for (size_t b = 0; b < cfg.blocks.size(); b++) {
+		m_live_out(cfg, b, live, slots);
+		for (size_t i = cfg.blocks[b].end; i-- > cfg.blocks[b].begin;) {
+			AsmEffects e = m_effects(cfg, cmds[i]);
+			if (e.pure && !(e.defs & live) && (e.write.kind == AsmOp::NONE || !m_is_live(slots, m_slot(e.write)))) {
+				dead[i] = removed = true;
+			} else {
+				m_transfer(e, live, slots);
+			}
+		}
+	}
+	if (removed) {
+		size_t n = 0;
+		for (size_t i = 0; i < cmds.size(); i++) {
+			if (!dead[i]) {
+				cmds[n++] = cmds[i];
+			}
+		}
+		cmds.resize(n);
+	}
+	return removed;
+}
+
+/// a jump out of the code goes where anything may be read
+AsmEffects Liveness::m_effects(const AsmCfg& cfg, const AsmInstr& cmd) {
+	AsmEffects e(cmd);
+	if (cmd.kind == AsmInstr::CMD && AsmCfg::is_jump(cmd.oc()) && cmd.oc() != RET &&
+	    (!cmd.ops[0].is_label() || cfg.block_of(cmd.ops[0].name) == -1)) {
+		e.uses = AsmEffects::all_units;
+		e.reads_any = true;
+	}
+	return e;
+}
+
+void Liveness::m_summary(const AsmCfg& cfg, int b) {
+	Block& block = m_blocks[b];
+	block.gen = block.kill = 0;
+	block.slot_gen.assign(m_words, 0);
+	block.slot_kill.assign(m_words, 0);
+	for (size_t i = cfg.blocks[b].end; i-- > cfg.blocks[b].begin;) {
+		AsmEffects e = m_effects(cfg, cmds[i]);
+		m_transfer(e, block.gen, block.slot_gen);
+		block.kill |= e.kills;
+		if (e.write.kind != AsmOp::NONE) {
+			int slot = m_slot(e.write);
+			block.slot_kill[slot / 64] |= 1ull << slot % 64;
+		}
+	}
+}
+
+void Liveness::m_solve(const AsmCfg& cfg) {
+	vector<int> work;
+	vector<bool> queued(m_blocks.size(), true);
+	for (size_t b = 0; b < m_blocks.size(); b++) {
+		m_blocks[b].live_in = m_blocks[b].gen;
+		m_blocks[b].slots_in = m_blocks[b].slot_gen;
+		work.push_back(b);
+	}
+	uint64_t live;
+	Slots slots;
+	while (!work.empty()) {
+		int b = work.back();
+		work.pop_back();
+		queued[b] = false;
+		Block& block = m_blocks[b];
+		m_live_out(cfg, b, live, slots);
+		live = block.gen | (live & ~block.kill);
+		for (size_t w = 0; w < m_words; w++) {
+			slots[w] = block.slot_gen[w] | (slots[w] & ~block.slot_kill[w]);
+		}
+		if (live == block.live_in && slots == block.slots_in) {
+			continue;
+		}
+		block.live_in = live;
+		block.slots_in = slots;
+		for (int pred: cfg.blocks[b].preds) {
+			if (!queued[pred]) {
+				queued[pred] = true;
+				work.push_back(pred);
+			}
+		}
+	}
+}
+
+/// everything after a block without successors
+void Liveness::m_live_out(const AsmCfg& cfg, int b, uint64_t& live, Slots& slots) {
+	const vector<int>& succs = cfg.blocks[b].succs;
+	if (succs.empty()) {
+		live = AsmEffects::all_units;
+		slots.assign(m_words, ~0ull);
+		return;
+	}
+	live = 0;
+	slots.assign(m_words, 0);
+	for (int succ: succs) {
+		live |= m_blocks[succ].live_in;
+		for (size_t w = 0; w < m_words; w++) {
+			slots[w] |= m_blocks[succ].slots_in[w];
+		}
+	}
+}
+
+void Liveness::m_transfer(const AsmEffects& e, uint64_t& live, Slots& slots) {
+	live = e.uses | (live & ~e.kills);
+	if (e.write.kind != AsmOp::NONE) {
+		int slot = m_slot(e.write);
+		slots[slot / 64] &= ~(1ull << slot % 64);
+	}
+	if (e.reads_any) {
+		slots.assign(m_words, ~0ull);
+	} else if (e.read.kind != AsmOp::NONE) {
+		int slot = m_slot(e.read);
+		slots[slot / 64] |= 1ull << slot % 64;
+	}
+}
+
+bool Liveness::m_is_live(const Slots& slots, int slot) {
+	return slots[slot / 64] >> slot % 64 & 1;
+}
+
+int Liveness::m_slot(const AsmOp& op) {
+	auto it = m_slots.find(AsmEffects::slot_key(op));
+	if (it == m_slots.end()) {
+		throw runtime_error("Internal error: slot not numbered");
+	}
+	return it->second;
+}
+
+void Liveness::m_number_slots() {
+	for (const AsmInstr& cmd: cmds) {
+		AsmEffects e(cmd);
+		for (const AsmOp* op: {&e.read, &e.write}) {
+			if (op->kind != AsmOp::NONE) {
+				m_slots.insert({AsmEffects::slot_key(*op), m_slots.size()});
+			}
+		}
+	}
+	m_words = (m_slots.size() + 63) / 64;
+}
@@ -0,0 +1,91 @@
+#ifndef LIVENESS_H
+#define LIVENESS_H
+
+#include <map>
+#include <utility>
+#include <vector>
+#include "asmcode.h"
+#include "asmcfg.h"
+
+/// What a command reads and writes: the registers as bits of units, a general register,
+/// the low 128 bits or the high 128 bits of a vector register, the flags.
+/// Memory is tracked by slots of 8 bytes, the displacements of %rbp and the variables;
+/// any other access may touch any slot.
+struct AsmEffects {
+	static const int flags = 48;
+	static const uint64_t all_units = (1ull << (flags + 1)) - 1;
+	/// the units of the register, partial if only its low byte
+	static uint64_t units(Register, bool& partial);
+	/// the operand is a slot, for a command accessing 8 bytes
+	static bool is_slot(const AsmOp&);
+	/// the same for the operands of the same slot: the name of a variable or no_name and the displacement of %rbp
+	static std::pair<uint32_t, int64_t> slot_key(const AsmOp& slot);
+
+	AsmEffects(const AsmInstr&);
+	uint64_t uses = 0;
+	uint64_t defs = 0;
+	/// of defs, the units written whole
+	uint64_t kills = 0;
+	/// the slots read and written, NONE if none
+	AsmOp read;
+	AsmOp write;
+	bool reads_any = false;
+	bool writes_any = false;
+	/// nothing but defs and write, may be removed if they are not used
+	bool pure = true;
+private:
+	bool m_wide = false;
+	void m_use(const AsmOp&);
+	void m_def(const AsmOp&, bool whole = true);
+	void m_rmw(const AsmOp& src, const AsmOp& dst, bool is_xor);
+	static bool m_zeroes(const AsmOp&, const AsmOp&, bool is_xor);
+	void m_addr(const AsmOp&);
+	void m_vex_def(const AsmOp&);
+	void m_all();
+};
+
+/// Commands whose results are never used removed: writes of registers and flags
+/// not read before the next write, stores to slots written again before they are read.
+/// Backward liveness over the blocks of AsmCfg. A call reads the argument registers and the memory,
+/// a ret the result, the registers kept for the caller and the memory, a syscall and a jump out of
+/// the code read everything. A load from an address not of a slot stays, for it may fault.
+class Liveness {
+public:
+	Liveness(AsmCode&);
+	/// the number of commands removed
+	int eliminate();
+	/// of the analysis and the removal, the last one removing nothing
+	int rounds() const;
+private:
+	typedef std::vector<uint64_t> Slots;
+	struct Block {
+		/// read before written, written in the block
+		uint64_t gen;
+		uint64_t kill;
+		Slots slot_gen;
+		Slots slot_kill;
+		uint64_t live_in;
+		Slots slots_in;
+	};
+	/// the dead commands of the code as it is removed, false if none
+	bool m_round();
+	AsmEffects m_effects(const AsmCfg&, const AsmInstr&);
+	void m_summary(const AsmCfg&, int b);
+	void m_solve(const AsmCfg&);
+	void m_live_out(const AsmCfg&, int b, uint64_t& live, Slots& slots);
+	/// live before the command given live after it
+	void m_transfer(const AsmEffects&, uint64_t& live, Slots& slots);
+	bool m_is_live(const Slots&, int slot);
+	int m_slot(const AsmOp&);
+	void m_number_slots();
+
+	AsmCode& ac;
+	std::vector<AsmInstr>& cmds;
+	std::vector<Block> m_blocks;
+	/// by slot_key
+	std::map<std::pair<uint32_t, int64_t>, int> m_slots;
+	size_t m_words = 0;
+	int m_rounds = 0;
+};
+
+#endif // LIVENESS_H
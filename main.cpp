@@ -5,6 +5,14 @@
 #include "scanner.h"
 #include "parser.h"
 #include "asmgenerator.h"
+#include "vectorizer.h"
+#include "inliner.h"
+#include "strength.h"
+#include "scheduler.h"
+#include "irbuilder.h"
+#include "irlower.h"
+#include "profile.h"
+#include "rangecheck.h"
 #include <fstream>
 
 using namespace std;
@@ -51,26 +59,103 @@ void parse(const string& filename, const bool strict) {
 	parser.output_syntax_tree(cout);
 }
 
-void generate(const string& filename, bool optimize, string output_filename, bool output_opt_stats) {
+void generate(const string& filename, bool optimize, string output_filename, bool output_opt_stats, bool object) {
 	Generator generator(filename);
 	if (!generator.is_open()) {
 		std::cerr << "Could not open " << filename << endl;
 		return;
 	}
-	if (output_filename.size() == 0) {
+	if (output_filename.size() == 0 && object) {
+		output_filename = filename.substr(0, filename.rfind('.')) + ".o";
+	} else if (output_filename.size() == 0) {
 		output_filename = "/dev/stdout";
 	}
-	ofstream output(output_filename);
+	ofstream output(output_filename, object ? ios::binary : ios::out);
 	if (!output.is_open()) {
 		std::cerr << "Could not open " << output_filename << endl;
 		return;
 	}
 	try {
-		generator.generate(output, optimize, output_opt_stats);
+		if (object) {
+			generator.generate_object(output, optimize, output_opt_stats);
+		} else {
+			generator.generate(output, optimize, output_opt_stats);
+		}
+	} catch (ParseError pe) {
+		cerr << pe.msg() << ":\n";
+		cerr << generator.get_line(pe.pos().line) << endl;
+		compile_result = 1;
+	} catch (EncodeError e) {
+		cerr << e.msg() << endl;
+		compile_result = 1;
+	} catch (IrError e) {
+		cerr << e.msg() << endl;
+		compile_result = 1;
+	}
+}
+
+void run(const string& filename, bool optimize) {
+	Generator generator(filename);
+	if (!generator.is_open()) {
+		std::cerr << "Could not open " << filename << endl;
+		compile_result = 1;
+		return;
+	}
+	try {
+		cout.flush();
+		compile_result = generator.run(optimize);
+	} catch (ParseError pe) {
+		cerr << pe.msg() << ":\n";
+		cerr << generator.get_line(pe.pos().line) << endl;
+		compile_result = 1;
+	} catch (EncodeError e) {
+		cerr << e.msg() << endl;
+		compile_result = 1;
+	} catch (JitError e) {
+		cerr << e.msg() << endl;
+		compile_result = 1;
+	} catch (IrError e) {
+		cerr << e.msg() << endl;
+		compile_result = 1;
+	}
+}
+
+void emit_ir(const string& filename, bool optimize) {
+	Generator generator(filename);
+	if (!generator.is_open()) {
+		std::cerr << "Could not open " << filename << endl;
+		compile_result = 1;
+		return;
+	}
+	try {
+		generator.generate_ir(cout, optimize, true);
+	} catch (ParseError pe) {
+		cerr << pe.msg() << ":\n";
+		cerr << generator.get_line(pe.pos().line) << endl;
+		compile_result = 1;
+	} catch (IrError e) {
+		cerr << e.msg() << endl;
+		compile_result = 1;
+	}
+}
+
+void interpret(const string& filename) {
+	Generator generator(filename);
+	if (!generator.is_open()) {
+		std::cerr << "Could not open " << filename << endl;
+		compile_result = 1;
+		return;
+	}
+	try {
+		cout.flush();
+		compile_result = generator.interpret();
 	} catch (ParseError pe) {
 		cerr << pe.msg() << ":\n";
 		cerr << generator.get_line(pe.pos().line) << endl;
 		compile_result = 1;
+	} catch (InterpretError e) {
+		cerr << e.msg() << endl;
+		compile_result = 1;
 	}
 }
 
@@ -79,15 +164,29 @@ int main(int argc, char *argv[]) {
 //	parse("./test-parse/not.in", true);
 //	return 0;
 	cxxopts::Options options(argv[0]);
-	bool mode_lexical = false, mode_parse_simple = false, mode_parse = false, mode_generate = false, optimize = false;
-	string asm_output_filename;
+	bool mode_lexical = false, mode_parse_simple = false, mode_parse = false, mode_generate = false, optimize = false,
+	     avx2 = false, mode_object = false, mode_run = false, mode_interpret = false,
+	     ssa = false, mode_emit_ir = false, range_checks = false, no_schedule = false;
+	string asm_output_filename, profile_use;
 	options.add_options()
 			("l,lexical", "lexical analysis", cxxopts::value<bool>(mode_lexical))
 	        ("s,parse-simple", "parse simple", cxxopts::value<bool>(mode_parse_simple))
 			("p,parse", "parse", cxxopts::value<bool>(mode_parse))
 	        ("S,generate", "generate", cxxopts::value<bool>(mode_generate))
-	        ("o,output", "asm output filename", cxxopts::value<string>(asm_output_filename))
+	        ("c,object", "generate an ELF object file", cxxopts::value<bool>(mode_object))
+	        ("run", "compile in memory and run", cxxopts::value<bool>(mode_run))
+	        ("interpret", "run in the bytecode interpreter", cxxopts::value<bool>(mode_interpret))
+	        ("ssa", "compile through the SSA IR", cxxopts::value<bool>(ssa))
+	        ("emit-ir", "print the SSA IR", cxxopts::value<bool>(mode_emit_ir))
+	        ("range-checks", "check array indexes against their bounds", cxxopts::value<bool>(range_checks))
+	        ("profile-generate", "count blocks and calls, write the counts to the file at exit", cxxopts::value<string>(Profile::generate_path))
+	        ("profile-use", "lay out, expand calls and unroll loops by the counts of the file", cxxopts::value<string>(profile_use))
+	        ("o,output", "asm or object output filename", cxxopts::value<string>(asm_output_filename))
+	        ("stream", "write the asm of each procedure as soon as it is generated (with -S)", cxxopts::value<bool>(Generator::streaming))
 	        ("O,optimize", "optimize", cxxopts::value<bool>(optimize))
+	        ("opt-stats", "write what the optimizer did to the file as JSON (with -O)", cxxopts::value<string>(Optimizer::stats_path))
+	        ("avx2", "use AVX2 in vectorized loops (with -O)", cxxopts::value<bool>(avx2))
+	        ("no-schedule", "keep the order of the commands in the blocks (with -O)", cxxopts::value<bool>(no_schedule))
 			("positional", "", cxxopts::value<vector<string>>());
 	options.parse_positional({"", "", "positional"});
 	options.parse(argc, argv);
@@ -108,8 +207,28 @@ int main(int argc, char *argv[]) {
 	if (mode_parse) {
 		parse(files[0], true);
 	}
-	if (mode_generate) {
-		generate(files[0], optimize, asm_output_filename, true);
+	if (mode_generate || mode_object || mode_run) {
+		Inliner::enabled = optimize;
+		NodeStmtProcedure::tail_calls = optimize;
+		StrengthReducer::enabled = optimize;
+		Scheduler::enabled = optimize && !no_schedule;
+		IrBuilder::enabled = ssa;
+		IrLowering::tail_calls = optimize;
+		Vectorizer::mode = !optimize ? Vectorizer::OFF : (avx2 ? Vectorizer::AVX2 : Vectorizer::SSE2);
+	}
+	RangeChecks::enabled = range_checks;
+	if (!profile_use.empty() && !Profile::load(profile_use)) {
+		cerr << "Could not read profile " << profile_use << endl;
+		return 1;
+	}
+	if (mode_generate || mode_object) {
+		generate(files[0], optimize, asm_output_filename, true, mode_object);
+	} else if (mode_run) {
+		run(files[0], optimize);
+	} else if (mode_interpret) {
+		interpret(files[0]);
+	} else if (mode_emit_ir) {
+		emit_ir(files[0], optimize);
 	}
 	return compile_result;
 }
@@ -1,6 +1,13 @@
 #include "node.h"
+#include "asmstream.h"
 #include "symboltable.h"
 #include "scanner.h"
+#include "vectorizer.h"
+#include "inliner.h"
+#include "runtime.h"
+#include "strength.h"
+#include "profile.h"
+#include "rangecheck.h"
 #include <sstream>
 
 using namespace std;
@@ -12,10 +19,44 @@ PSymbolTypeString NodeString::str_type_sym_ptr = nullptr;
 
 uint NodeString::strcounter = 0;
 string NodeString::str_prefix = ".str";
-string fmt_newline = "._fmt_newline_";
 
 std::stack<std::pair<AsmLabel, AsmLabel>> cycle_continue_break;
-std::stack<PSymbolProcedure> proc_func_exit;
+/// procedure or function being generated or expanded
+struct ProcContext {
+	PSymbolProcedure proc;
+	AsmLabel exit;   /// epilogue
+	AsmLabel entry;  /// after the prologue, self tail calls jump here
+	bool has_frame;  /// false for an expanded body
+};
+std::stack<ProcContext> proc_func_exit;
+/// stack frame of the procedure or main program being generated
+struct Frame {
+	int64_t used;  /// bytes taken by the variables in scope
+	int64_t size;  /// bytes to reserve, inlined bodies included
+};
+std::stack<Frame> frames;
+
+/// variables of an expanded body go below the ones in scope
+static void push_inline_frame(SymbolProcedure& proc) {
+	Frame& frame = frames.top();
+	proc.rebase_frame(-frame.used);
+	frame.used += proc.frame_size;
+	frame.size = max(frame.size, frame.used);
+}
+
+static void pop_inline_frame(SymbolProcedure& proc) {
+	frames.top().used -= proc.frame_size;
+	proc.rebase_frame(frames.top().used);
+}
+
+/// reserves the frame right after the prologue at pos
+static void reserve_frame(AsmCode& ac, size_t pos) {
+	if (frames.top().size > 0) {
+		ac.insert(pos, AsmCmd2{SUBQ, frames.top().size, RSP});
+	}
+}
+
+bool NodeStmtProcedure::tail_calls = false;
 
 std::map<Token::Operator, std::string> operator_lst =
 {
@@ -74,6 +115,34 @@ bool is_integer_type(PSymbolType symt) {
 	return symt == NodeInteger::type_sym_ptr || dynamic_pointer_cast<SymbolTypePointer>(symt);
 }
 
+/// integer literal, possibly negated
+bool is_int_constant(PNodeExpression expr, int64_t& value) {
+	PNodeUnaryOperator neg = dynamic_pointer_cast<NodeUnaryOperator>(expr);
+	if (neg && neg->operation == Token::OP_MINUS && is_int_constant(neg->node, value)) {
+		value = -value;
+		return true;
+	}
+	PNodeInteger integer = dynamic_pointer_cast<NodeInteger>(expr);
+	if (integer) {
+		value = integer->value;
+	}
+	return (bool)integer;
+}
+
+/// variable whose storage holds the lvalue, nullptr if reached through a pointer
+PSymbolVariable root_variable(PNodeExpression expr) {
+	if (PNodeVariable var = dynamic_pointer_cast<NodeVariable>(expr)) {
+		return var->symbol;
+	}
+	if (PNodeArrayAccess access = dynamic_pointer_cast<NodeArrayAccess>(expr)) {
+		return root_variable(access->array);
+	}
+	if (PNodeRecordAccess access = dynamic_pointer_cast<NodeRecordAccess>(expr)) {
+		return root_variable(access->record);
+	}
+	return nullptr;
+}
+
 NodeEof::NodeEof(const Token&) {
 }
 
@@ -362,6 +431,9 @@ PSymbolType NodeUnaryOperator::exprtype() {
 		    ))
 		{
 			m_exprtype = make_shared<SymbolTypePointer>(node->exprtype());
+			if (PSymbolVariable var = root_variable(node)) {
+				var->is_addressed = true;
+			}
 		} else if (dynamic_pointer_cast<NodeExprStmtFunctionCall>(node)) {
 			m_exprtype = make_shared<SymbolTypePointer>(dynamic_pointer_cast<NodeExprStmtFunctionCall>(node)->proctype());
 		} else {
@@ -491,6 +563,57 @@ bool NodeExprStmtFunctionCall::check_parameters(Pos pos) {
 	return true;
 }
 
+bool NodeExprStmtFunctionCall::is_exit() const {
+	return m_predefined == EXIT;
+}
+
+bool NodeExprStmtFunctionCall::is_write() const {
+	return m_predefined == WRITE || m_predefined == WRITELN;
+}
+
+bool NodeExprStmtFunctionCall::is_writeln() const {
+	return m_predefined == WRITELN;
+}
+
+bool NodeExprStmtFunctionCall::can_tail_call(const SymbolProcedure& caller) const {
+	if (m_predefined || this->proc->name.empty()) {
+		return false;
+	}
+	/// the callee returns in the same register and the caller's caller removes the stack args
+	const SymbolFunction* caller_f = dynamic_cast<const SymbolFunction*>(&caller);
+	PSymbolFunction f = dynamic_pointer_cast<SymbolFunction>(this->proc);
+	if ((bool)caller_f != (bool)f || (f && f->type != caller_f->type)) {
+		return false;
+	}
+	size_t n = this->args ? this->args->arglist.size() : 0;
+	if (this->proc->stack_args() > caller.stack_args()) {
+		return false;
+	}
+	/// arrays and records passed by value are copied from the argument address when bound
+	SymTable& st = *this->proc->params;
+	for (size_t i = 0; i < n; i++) {
+		PSymbolVariable formal;
+		st[i] >> formal;
+		if (!this->proc->is_nth_var.at(i) &&
+		    (dynamic_pointer_cast<SymbolTypeArray>(formal->type) || dynamic_pointer_cast<SymbolTypeRecord>(formal->type)))
+		{
+			return false;
+		}
+		/// the caller's frame is reused, nothing may point into it
+		PSymbolVariable root = this->proc->is_nth_var.at(i) ? root_variable(this->args->arglist[i]) : nullptr;
+		if (root && root->is_local && !root->is_var) {
+			return false;
+		}
+	}
+	for (PSymbol sym: *caller.locals) {
+		PSymbolVariable var = dynamic_pointer_cast<SymbolVariable>(sym);
+		if (var && var->is_addressed) {
+			return false;
+		}
+	}
+	return true;
+}
+
 void Node::generate(AsmCode& ac) {
 }
 
@@ -510,11 +633,30 @@ void NodeString::generate(AsmCode& ac) {
 }
 
 void NodeVariable::generate(AsmCode& ac) {
-	ac << AsmCmd1{PUSHQ, AsmVar{this->identifier->name}};
+	auto binding = Inliner::bindings.find(this->symbol.get());
+	if (binding != Inliner::bindings.end()) {
+		binding->second->generate(ac);
+		return;
+	}
+	if (this->symbol->is_var) {
+		ac << AsmCmd2{MOVQ, this->symbol->storage(), RAX}
+		   << AsmCmd1{PUSHQ, AsmOffs{RAX}};
+		return;
+	}
+	ac << AsmCmd1{PUSHQ, this->symbol->storage()};
 }
 
 void NodeVariable::generate_lvalue(AsmCode& ac) {
-	ac << AsmCmd2{LEAQ, AsmVar{this->identifier->name}, RAX}
+	auto binding = Inliner::bindings.find(this->symbol.get());
+	if (binding != Inliner::bindings.end()) {
+		binding->second->generate_lvalue(ac);
+		return;
+	}
+	if (this->symbol->is_var) {
+		ac << AsmCmd1{PUSHQ, this->symbol->storage()};
+		return;
+	}
+	ac << AsmCmd2{LEAQ, this->symbol->storage(), RAX}
 	   << AsmCmd1{PUSHQ, RAX};
 }
 
@@ -584,9 +726,12 @@ void NodeArrayAccess::m_gen_index(AsmCode& ac) {
 		/// args[i] - s
 		ac << AsmCmd2{MOVQ, s, R9}
 		   << AsmCmd1{POPQ, RAX}
-		   << AsmCmd2{SUBQ, R9, RAX}
+		   << AsmCmd2{SUBQ, R9, RAX};
+		if (RangeChecks::enabled && RangeChecks::is_checked(*this, i)) {
+			RangeChecks::gen_check(ac, dims.at(i));
+		}
 		/// (args[i] - s)*k
-		   << AsmCmd2{MOVQ, k, R9}
+		ac << AsmCmd2{MOVQ, k, R9}
 		   << AsmCmd2{IMULQ, R9, RAX}
 		/// (args[i] - s)*k + prev
 		   << AsmCmd1{POPQ, R9}
@@ -596,7 +741,15 @@ void NodeArrayAccess::m_gen_index(AsmCode& ac) {
 }
 
 void NodeVariable::declare(AsmCode& ac) {
-	this->exprtype()->gen_declare(ac, this->identifier->name);
+	if (this->symbol->is_local) {
+		/// lives in the frame
+		return;
+	}
+	if (this->symbol->is_var) {
+		NodeInteger::type_sym_ptr->gen_declare(ac, this->symbol->label);
+		return;
+	}
+	this->exprtype()->gen_declare(ac, this->symbol->label);
 }
 
 void NodeBinaryOperator::m_gen_arithm(AsmCode& ac) {
@@ -696,11 +849,11 @@ void NodeBinaryOperator::m_gen_cmp(AsmCode& ac) {
 
 void NodeBinaryOperator::m_gen_bin(AsmCode& ac) {
 	left->generate(ac);
-	ac << AsmCmd1{POPQ, RAX};
 	AsmLabel _true, _false;
 	switch (this->operation) {
 	case Token::OP_AND:
-		ac << AsmCmd2{TESTQ, RAX, RAX}
+		ac << AsmCmd1{POPQ, RAX}
+		   << AsmCmd2{TESTQ, RAX, RAX}
 		   << AsmCmd1{JZ, _false};
 		right->generate(ac);
 		ac << AsmCmd1{POPQ, RAX}
@@ -713,7 +866,8 @@ void NodeBinaryOperator::m_gen_bin(AsmCode& ac) {
 		   << _true;
 		return;
 	case Token::OP_OR:
-		ac << AsmCmd2{TESTQ, RAX, RAX}
+		ac << AsmCmd1{POPQ, RAX}
+		   << AsmCmd2{TESTQ, RAX, RAX}
 		   << AsmCmd1{JNZ, _true};
 		right->generate(ac);
 		ac << AsmCmd1{POPQ, RAX}
@@ -728,21 +882,25 @@ void NodeBinaryOperator::m_gen_bin(AsmCode& ac) {
 	case Token::OP_XOR:
 		right->generate(ac);
 		ac << AsmCmd1{POPQ, RBX}
+		   << AsmCmd1{POPQ, RAX}
 		   << AsmCmd2{XORQ, RBX, RAX};
 		break;
 	case Token::OP_SHL:
 		right->generate(ac);
 		ac << AsmCmd1{POPQ, RCX}
+		   << AsmCmd1{POPQ, RAX}
 		   << AsmCmd2{SHLQ, CL, RAX};
 		break;
 	case Token::OP_SHR:
 		right->generate(ac);
 		ac << AsmCmd1{POPQ, RCX}
+		   << AsmCmd1{POPQ, RAX}
 		   << AsmCmd2{SHRQ, CL, RAX};
 		break;
 	case Token::OP_MOD:
 		right->generate(ac);
 		ac << AsmCmd1{POPQ, RBX}
+		   << AsmCmd1{POPQ, RAX}
 		   << AsmCmd2{XORQ, RDX, RDX}
 		   << AsmCmd0{CQO}
 		   << AsmCmd1{IDIVQ, RBX}
@@ -753,7 +911,31 @@ void NodeBinaryOperator::m_gen_bin(AsmCode& ac) {
 	ac << AsmCmd1{PUSHQ, RAX};
 }
 
+bool NodeBinaryOperator::m_gen_const_operand(AsmCode& ac) {
+	int64_t c;
+	PNodeExpression operand = left;
+	if (!StrengthReducer::enabled || this->exprtype() != NodeInteger::type_sym_ptr) {
+		return false;
+	}
+	if (!is_int_constant(right, c)) {
+		/// multiplication commutes
+		if (this->operation != Token::OP_MULT || !is_int_constant(left, c)) {
+			return false;
+		}
+		operand = right;
+	}
+	if (!StrengthReducer::applies(this->operation, c)) {
+		return false;
+	}
+	operand->generate(ac);
+	StrengthReducer::generate(ac, this->operation, c);
+	return true;
+}
+
 void NodeBinaryOperator::generate(AsmCode& ac) {
+	if (m_gen_const_operand(ac)) {
+		return;
+	}
 	switch (this->operation) {
 	case Token::OP_PLUS:
 	case Token::OP_MINUS:
@@ -865,37 +1047,180 @@ void NodeExprStmtFunctionCall::generate(AsmCode& ac) {
 			}
 		}
 		if (m_predefined == Predefined::WRITELN) {
-			ac << AsmCmd2{LEAQ, AsmVar{fmt_newline}, RDI}
-			   << AsmCmd1{CALL, PRINTF};
+			ac << AsmCmd2{MOVQ, (int64_t)'\n', RDI};
+			Runtime::gen_call(ac, Runtime::write_char);
 		}
 		return;
 	}
 	if (m_predefined == EXIT) {
-		PSymbolFunction f = dynamic_pointer_cast<SymbolFunction>(proc_func_exit.top());
-		if (f) {
-			int64_t rsz = f->type->size();
-			int64_t psz = f->params ? f->params->size() : 0;
+		if (proc_func_exit.empty()) {
+			/// main program
+			Profile::gen_dump(ac);
+			Runtime::gen_call(ac, Runtime::flush);
+			ac << AsmCmd2{MOVQ, RBP, RSP}
+			   << AsmCmd1{POPQ, RBP}
+			   << AsmCmd2{XORQ, RAX, RAX}
+			   << AsmCmd0{RET};
+			return;
+		}
+		/// result goes through RAX to the epilogue
+		if (dynamic_pointer_cast<SymbolFunction>(proc_func_exit.top().proc) && this->args) {
+			PNodeExprStmtFunctionCall call = dynamic_pointer_cast<NodeExprStmtFunctionCall>(this->args->arglist.at(0));
+			if (call && call->m_generate_tail(ac)) {
+				return;
+			}
 			this->args->arglist.at(0)->generate(ac);
-/// TODO
-//			ac << AsmCmd2{MOVQ, }
-//			   << AsmCmd2{ADDQ, rsz + psz, RSP}
-//			   << AsmCmd2{SUBQ, (int64_t), RSP};
+			ac << AsmCmd1{POPQ, RAX};
 		}
-		ac << AsmCmd1{POPQ, RBP}
-		   << AsmCmd0{RET};
+		ac << AsmCmd1{JMP, proc_func_exit.top().exit};
 		return;
 	}
-	if (this->args && this->args->arglist.size() > 0) {
-		vector<PNodeExpression>& args = this->args->arglist;
-		for (auto parg = args.rbegin(); parg != args.rend(); parg++) {
-			(*parg)->generate(ac);
-		}
+	Profile::gen_count(ac, this->pos, "call " + this->proc->name);
+	NodeStmtProcedure* callee = Inliner::candidate(*this);
+	if (callee) {
+		m_generate_inline(ac, *callee);
+		return;
 	}
-	PSymbolFunction f = dynamic_pointer_cast<SymbolFunction>(this->proc);
-	if (f) {
-		ac << AsmCmd2{SUBQ, (int64_t)f->type->size(), RSP};
+	if (m_generate_tail(ac)) {
+		return;
 	}
+	m_pass_args(ac);
 	ac << AsmCmd1{CALL, AsmVar{this->proc->name}};
+	int64_t args_size = 8*this->proc->stack_args();
+	if (args_size) {
+		ac << AsmCmd2{ADDQ, args_size, RSP};
+	}
+	PSymbolFunction f = dynamic_pointer_cast<SymbolFunction>(this->proc);
+	if (f && dynamic_pointer_cast<SymbolTypeFloat>(f->type)) {
+		ac << AsmCmd2{MOVQ, XMM0, RAX}
+		   << AsmCmd1{PUSHQ, RAX};
+	} else if (f) {
+		ac << AsmCmd1{PUSHQ, RAX};
+	}
+}
+
+void NodeExprStmtFunctionCall::m_push_args(AsmCode& ac, bool is_inline) {
+	if (!this->args) {
+		return;
+	}
+	for (int i = this->args->arglist.size() - 1; i >= 0; i--) {
+		m_push_arg(ac, i, is_inline);
+	}
+}
+
+void NodeExprStmtFunctionCall::m_push_arg(AsmCode& ac, size_t i, bool is_inline) {
+	PNodeExpression arg = this->args->arglist[i];
+	PSymbolVariable formal;
+	(*this->proc->params)[i] >> formal;
+	if (this->proc->is_nth_var.at(i)) {
+		/// an expanded procedure uses the variable itself
+		if (!is_inline || !dynamic_pointer_cast<NodeVariable>(arg)) {
+			arg->generate_lvalue(ac);
+		}
+	} else if (dynamic_pointer_cast<SymbolTypeArray>(formal->type) || dynamic_pointer_cast<SymbolTypeRecord>(formal->type)) {
+		arg->generate_lvalue(ac);
+	} else {
+		arg->generate(ac);
+		arg->exprtype()->gen_typecast(ac, formal->type);
+	}
+}
+
+void NodeExprStmtFunctionCall::m_pass_args(AsmCode& ac) {
+	int n = this->args ? this->args->arglist.size() : 0;
+	Register reg;
+	int64_t slot;
+	/// all args are evaluated before the registers are loaded, a nested call would clobber them
+	for (int i = n - 1; i >= 0; i--) {
+		if (!this->proc->arg_location(i, reg, slot)) {
+			m_push_arg(ac, i, false);
+		}
+	}
+	for (int i = n - 1; i >= 0; i--) {
+		if (this->proc->arg_location(i, reg, slot)) {
+			m_push_arg(ac, i, false);
+		}
+	}
+	for (int i = 0; i < n; i++) {
+		if (!this->proc->arg_location(i, reg, slot)) {
+			continue;
+		}
+		if (this->proc->is_float_arg(i)) {
+			ac << AsmCmd1{POPQ, RAX}
+			   << AsmCmd2{MOVQ, RAX, reg};
+		} else {
+			ac << AsmCmd1{POPQ, reg};
+		}
+	}
+}
+
+void NodeExprStmtFunctionCall::m_generate_inline(AsmCode& ac, NodeStmtProcedure& callee) {
+	AsmLabel _exit;
+	m_push_args(ac, true);
+	push_inline_frame(*this->proc);
+	vector<SymbolVariable*> bound;
+	SymTable& st = *this->proc->params;
+	for (size_t i = 0; this->args && i < this->args->arglist.size(); i++) {
+		PSymbolVariable formal;
+		st[i] >> formal;
+		PNodeExpression arg = this->args->arglist[i];
+		if (this->proc->is_nth_var.at(i) && dynamic_pointer_cast<NodeVariable>(arg)) {
+			Inliner::bindings[formal.get()] = arg;
+			bound.push_back(formal.get());
+		} else {
+			formal->gen_bind(ac);
+		}
+	}
+	Inliner::active.insert(this->proc.get());
+	proc_func_exit.push({this->proc, _exit, AsmLabel{""}, false});
+	Profile::push_scope(callee.name->name, callee.pos);
+	Profile::gen_count(ac, callee.pos, "entry");
+	ac.push_buf();
+	for (PNodeStmt part: callee.parts) {
+		if (dynamic_pointer_cast<NodeStmtBlock>(part)) {
+			ac.pop_buf();
+		}
+		part->generate(ac);
+	}
+	Profile::pop_scope();
+	ac << _exit;
+	if (dynamic_pointer_cast<SymbolFunction>(this->proc)) {
+		ac << AsmCmd1{PUSHQ, RAX};
+	}
+	pop_inline_frame(*this->proc);
+	proc_func_exit.pop();
+	Inliner::active.erase(this->proc.get());
+	for (SymbolVariable* formal: bound) {
+		Inliner::bindings.erase(formal);
+	}
+}
+
+bool NodeExprStmtFunctionCall::m_generate_tail(AsmCode& ac) {
+	if (!this->is_tail || proc_func_exit.empty() || !proc_func_exit.top().has_frame || Inliner::candidate(*this)) {
+		return false;
+	}
+	ProcContext& caller = proc_func_exit.top();
+	if (this->proc == caller.proc) {
+		/// bind the new args as the prologue does and start over
+		size_t n = this->args ? this->args->arglist.size() : 0;
+		m_push_args(ac, false);
+		SymTable& st = *this->proc->params;
+		for (size_t i = 0; i < n; i++) {
+			PSymbolVariable formal;
+			st[i] >> formal;
+			formal->gen_bind(ac);
+		}
+		ac << AsmCmd1{JMP, caller.entry};
+		return true;
+	}
+	/// stack args take place of the caller's ones, the callee returns to the caller's caller
+	m_pass_args(ac);
+	for (int64_t i = 0; i < this->proc->stack_args(); i++) {
+		ac << AsmCmd1{POPQ, AsmOffs{16 + 8*i, RBP}};
+	}
+	ac << AsmCmd2{MOVQ, RBP, RSP}
+	   << AsmCmd1{POPQ, RBP}
+	   << AsmCmd1{JMP, AsmVar{this->proc->name}};
+	return true;
 }
 
 void NodeStmtIf::generate(AsmCode& ac) {
@@ -904,9 +1229,11 @@ void NodeStmtIf::generate(AsmCode& ac) {
 	ac << AsmCmd1{POPQ, RAX}
 	   << AsmCmd2{TESTQ, RAX, RAX}
 	   << AsmCmd1{JZ, _else};
+	Profile::gen_count(ac, this->pos, "then");
 	this->then_stmt->generate(ac);
 	ac << AsmCmd1{JMP, _endif}
 	   << _else;
+	Profile::gen_count(ac, this->pos, "else");
 	if (this->else_stmt) {
 		this->else_stmt->generate(ac);
 	}
@@ -916,11 +1243,13 @@ void NodeStmtIf::generate(AsmCode& ac) {
 void NodeStmtWhile::generate(AsmCode& ac) {
 	AsmLabel _body, _end;
 	cycle_continue_break.push({_body, _end});
+	Profile::gen_count(ac, this->pos, "loop");
 	ac << _body;
 	this->cond->generate(ac);
 	ac << AsmCmd1{POPQ, RAX}
 	   << AsmCmd2{TESTQ, RAX, RAX}
 	   << AsmCmd1{JZ, _end};
+	Profile::gen_count(ac, this->pos, "body");
 	this->stmt->generate(ac);
 	ac << AsmCmd1{JMP, _body}
 	   << _end;
@@ -930,7 +1259,9 @@ void NodeStmtWhile::generate(AsmCode& ac) {
 void NodeStmtRepeat::generate(AsmCode& ac) {
 	AsmLabel _body, _end;
 	cycle_continue_break.push({_body, _end});
+	Profile::gen_count(ac, this->pos, "loop");
 	ac << _body;
+	Profile::gen_count(ac, this->pos, "body");
 	this->stmt->generate(ac);
 	this->cond->generate(ac);
 	ac << AsmCmd1{POPQ, RAX}
@@ -943,19 +1274,37 @@ void NodeStmtRepeat::generate(AsmCode& ac) {
 void NodeStmtFor::generate(AsmCode& ac) {
 	AsmLabel _body, _end, _continue;
 	cycle_continue_break.push({_continue, _end});
-	/// init
-	this->low->generate(ac);
-	this->iter_var->generate_lvalue(ac);
-	this->high->generate(ac);
-	ac << AsmCmd1{POPQ, R13}
-	   << AsmCmd1{POPQ, R14}
-	   << AsmCmd1{POPQ, AsmOffs{R14}};
-	/// pre-check
-	ac << AsmCmd2{MOVQ, AsmOffs{R14}, R14}
-	   << AsmCmd2{CMPQ, R14, R13}
-	   << AsmCmd1{(is_inc ? JL : JG), _end};
+	/// vector loop does init, pre-check and the range test itself, its body has no checks;
+	/// the body is counted once per iteration, not per vector
+	bool is_vectorizable = Vectorizer::mode != Vectorizer::OFF && (!RangeChecks::enabled || RangeChecks::is_unchecked(*this)) &&
+	                       !Profile::is_generating();
+	Profile::gen_count(ac, this->pos, "loop");
+	if (!is_vectorizable || !Vectorizer(*this).generate(ac, _end)) {
+		/// init
+		this->low->generate(ac);
+		this->iter_var->generate_lvalue(ac);
+		this->high->generate(ac);
+		ac << AsmCmd1{POPQ, R13}
+		   << AsmCmd1{POPQ, R14}
+		   << AsmCmd1{POPQ, AsmOffs{R14}};
+		/// pre-check
+		ac << AsmCmd2{MOVQ, AsmOffs{R14}, R14}
+		   << AsmCmd2{CMPQ, R14, R13}
+		   << AsmCmd1{(is_inc ? JL : JG), _end};
+		int64_t low, high;
+		if (RangeChecks::enabled && RangeChecks::loop_test(*this, low, high)) {
+			/// the first and the last value, high is stable
+			this->iter_var->generate(ac);
+			ac << AsmCmd1{POPQ, RAX};
+			RangeChecks::gen_test(ac, RAX, low, high);
+			this->high->generate(ac);
+			ac << AsmCmd1{POPQ, RAX};
+			RangeChecks::gen_test(ac, RAX, low, high);
+		}
+	}
 	/// statement
 	ac << _body;
+	Profile::gen_count(ac, this->pos, "body");
 	this->stmt->generate(ac);
 	/// check condition
 	ac << _continue;
@@ -987,47 +1336,137 @@ void NodeStmtProcedure::generate(AsmCode& ac) {
 		/// If forward
 		return;
 	}
-	proc_func_exit.push(this->symbol);
+	AsmLabel _exit, _entry{""};
+	bool is_function = (bool)dynamic_pointer_cast<SymbolFunction>(this->symbol);
+	if (tail_calls) {
+		bool is_self = false;
+		m_mark_tail_calls(this->parts.back(), true, is_self);
+		if (is_self) {
+			_entry = AsmLabel();
+		}
+	}
+	Inliner::add(*this);
+	Inliner::active.insert(this->symbol.get());
+	proc_func_exit.push({this->symbol, _exit, _entry, true});
+	Profile::push_scope(this->name->name, this->pos);
 	AsmCode& pd = ac.proc_defs();
 	pd << AsmLabel{var_prefix + this->name->name};
 	/// args were pushed before in reversed order
 	pd << AsmCmd1{PUSHQ, RBP}      /// prolog
-	   << AsmCmd2{MOVQ, RSP, RBP}  ///
-	   << AsmCmd2{SUBQ, (int64_t)(symbol->locals->size() - symbol->params->size()), RSP}; /// local variables (locals = locals + params)
-
-	for (PNodeStmt stmt: this->parts) {
-		if (dynamic_pointer_cast<NodeStmtBlock>(stmt)) {
-			stmt->generate(pd);
+	   << AsmCmd2{MOVQ, RSP, RBP}; ///
+	size_t frame_at = pd.size();
+	frames.push({this->symbol->frame_size, this->symbol->frame_size});
+	m_gen_bind_params(pd);
+	if (!_entry.name.empty()) {
+		pd << _entry;
+	}
+	Profile::gen_count(pd, this->pos, "entry");
+	pd.push_buf();
+	for (PNodeStmt part: this->parts) {
+		if (dynamic_pointer_cast<NodeStmtBlock>(part)) {
+			pd.pop_buf();
 		}
+		part->generate(pd);
 	}
 
-	pd << AsmCmd1{POPQ, RBP} /// epilog
-	   << AsmCmd0{RET};       ///
+	pd << _exit;
+	if (is_function && dynamic_pointer_cast<SymbolTypeFloat>(dynamic_pointer_cast<SymbolFunction>(this->symbol)->type)) {
+		pd << AsmCmd2{MOVQ, RAX, XMM0};
+	}
+	pd << AsmCmd2{MOVQ, RBP, RSP} /// epilog
+	   << AsmCmd1{POPQ, RBP}      ///
+	   << AsmCmd0{RET};           ///
+	reserve_frame(pd, frame_at);
+	frames.pop();
+	Profile::pop_scope();
 	proc_func_exit.pop();
+	Inliner::active.erase(this->symbol.get());
+	if (ac.stream) {
+		ac.stream->flush(pd);
+	}
 }
 
-void NodeStmtFunction::generate(AsmCode& ac) {
-	if (this->parts.size() == 0) {
-		/// If forward
-		return;
+void NodeStmtProcedure::m_gen_bind_params(AsmCode& ac) {
+	vector<PSymbolVariable> formals;
+	for (PNodeFormalParameterSection section: this->params) {
+		for (PNodeVariable var: section->identifiers) {
+			var->declare(ac);
+			formals.push_back(var->symbol);
+		}
 	}
-	proc_func_exit.push(this->symbol);
-	AsmCode& pd = ac.proc_defs();
-	pd << AsmLabel{var_prefix + this->name->name};
-	/// args were pushed before in reversed order
-	pd << AsmCmd1{PUSHQ, RBP}      /// prolog
-	   << AsmCmd2{MOVQ, RSP, RBP}  ///
-	   << AsmCmd2{SUBQ, (int64_t)(symbol->locals->size() - symbol->params->size()), RSP}; /// local variables (locals = locals + params)
+	Register reg;
+	int64_t slot;
+	auto is_copied = [&](size_t i) {
+		return !formals[i]->is_var &&
+		       (dynamic_pointer_cast<SymbolTypeArray>(formals[i]->type) || dynamic_pointer_cast<SymbolTypeRecord>(formals[i]->type));
+	};
+	/// the copy of an array or record clobbers RSI and RDI, its source address is saved first
+	for (int i = formals.size() - 1; i >= 0; i--) {
+		if (!is_copied(i)) {
+			continue;
+		}
+		if (this->symbol->arg_location(i, reg, slot)) {
+			ac << AsmCmd1{PUSHQ, reg};
+		} else {
+			ac << AsmCmd1{PUSHQ, AsmOffs{16 + 8*slot, RBP}};
+		}
+	}
+	for (size_t i = 0; i < formals.size(); i++) {
+		if (is_copied(i)) {
+			continue;
+		}
+		if (this->symbol->arg_location(i, reg, slot)) {
+			ac << AsmCmd2{MOVQ, reg, formals[i]->storage()};
+		} else {
+			ac << AsmCmd1{PUSHQ, AsmOffs{16 + 8*slot, RBP}};
+			formals[i]->gen_bind(ac);
+		}
+	}
+	for (size_t i = 0; i < formals.size(); i++) {
+		if (is_copied(i)) {
+			formals[i]->gen_bind(ac);
+		}
+	}
+}
 
-	for (PNodeStmt stmt: this->parts) {
-		if (dynamic_pointer_cast<NodeStmtBlock>(stmt)) {
-			stmt->generate(pd);
+void NodeStmtProcedure::m_mark_tail_calls(PNodeStmt stmt, bool is_tail, bool& is_self) {
+	if (PNodeStmtBlock block = dynamic_pointer_cast<NodeStmtBlock>(stmt)) {
+		for (size_t i = 0; i < block->stmts.size(); i++) {
+			/// a statement followed by plain exit is in tail position too
+			bool is_last = i + 1 == block->stmts.size();
+			PNodeExprStmtFunctionCall next = is_last ? nullptr : dynamic_pointer_cast<NodeExprStmtFunctionCall>(block->stmts[i + 1]);
+			bool before_exit = next && next->is_exit() && (!next->args || next->args->arglist.empty());
+			m_mark_tail_calls(block->stmts[i], (is_tail && is_last) || before_exit, is_self);
+		}
+	} else if (PNodeStmtIf stmt_if = dynamic_pointer_cast<NodeStmtIf>(stmt)) {
+		m_mark_tail_calls(stmt_if->then_stmt, is_tail, is_self);
+		if (stmt_if->else_stmt) {
+			m_mark_tail_calls(stmt_if->else_stmt, is_tail, is_self);
+		}
+	} else if (PNodeStmtWhile stmt_while = dynamic_pointer_cast<NodeStmtWhile>(stmt)) {
+		m_mark_tail_calls(stmt_while->stmt, false, is_self);
+	} else if (PNodeStmtRepeat stmt_repeat = dynamic_pointer_cast<NodeStmtRepeat>(stmt)) {
+		m_mark_tail_calls(stmt_repeat->stmt, false, is_self);
+	} else if (PNodeStmtFor stmt_for = dynamic_pointer_cast<NodeStmtFor>(stmt)) {
+		m_mark_tail_calls(stmt_for->stmt, false, is_self);
+	} else if (PNodeExprStmtFunctionCall call = dynamic_pointer_cast<NodeExprStmtFunctionCall>(stmt)) {
+		if (call->is_exit()) {
+			/// exit(f(...)) returns the result of f as is
+			if (call->args && !call->args->arglist.empty()) {
+				m_mark_tail_call(call->args->arglist.at(0), is_self);
+			}
+		} else if (is_tail && !dynamic_pointer_cast<SymbolFunction>(this->symbol)) {
+			m_mark_tail_call(call, is_self);
 		}
 	}
+}
 
-	pd << AsmCmd1{POPQ, RBP} /// epilog
-	   << AsmCmd0{RET};       ///
-	proc_func_exit.pop();
+void NodeStmtProcedure::m_mark_tail_call(PNodeExpression expr, bool& is_self) {
+	PNodeExprStmtFunctionCall call = dynamic_pointer_cast<NodeExprStmtFunctionCall>(expr);
+	if (call && call->can_tail_call(*this->symbol)) {
+		call->is_tail = true;
+		is_self |= call->proc == this->symbol;
+	}
 }
 
 void NodeExprStmtFunctionCall::m_write(AsmCode& ac, PNodeExpression expr) {
@@ -1044,19 +1483,31 @@ void NodeStmtBlock::generate(AsmCode& ac) {
 }
 
 void NodeProgram::generate(AsmCode& ac) {
-	ac.add_data(make_shared<AsmVarString>(SymbolTypeInt::fml_label, "%Ld"));
-	ac.add_data(make_shared<AsmVarString>(SymbolTypeFloat::fml_label, "%lf"));
-	ac.add_data(make_shared<AsmVarString>(fmt_newline, "\n"));
 	ac << *ac.add_data(make_shared<AsmGlobl>("main"));
 	ac << AsmCmd1{PUSHQ, RBP}
 	   << AsmCmd2{MOVQ, RSP, RBP};
+	/// main has no variables of its own, only of expanded bodies
+	size_t frame_at = ac.size();
+	frames.push({0, 0});
 	ac.push_buf();
-	for (PNode part: this->parts) {
+	Profile::push_scope("main", this->parts.back()->pos);
+	for (PNodeStmt part: this->parts) {
 		if (dynamic_pointer_cast<NodeStmtBlock>(part)) {
 			ac.pop_buf();
+			Profile::gen_count(ac, part->pos, "entry");
 		}
 		part->generate(ac);
 	}
+	Profile::pop_scope();
+	Profile::gen_dump(ac);
+	if (Runtime::is_used()) {
+		Runtime::gen_call(ac, Runtime::flush);
+	}
+	if (frames.top().size > 0) {
+		ac << AsmCmd2{MOVQ, RBP, RSP};
+	}
+	reserve_frame(ac, frame_at);
+	frames.pop();
 	ac << AsmCmd1{POPQ, RBP}
 	   << AsmCmd2{XORQ, RAX, RAX}
 	   << AsmCmd0{RET};
@@ -1085,8 +1536,8 @@ void NodeFloat::write(AsmCode& ac) {
 }
 
 void NodeString::write(AsmCode& ac) {
-	ac << AsmCmd2{LEAQ, dynamic_pointer_cast<AsmVar>(m_label), RDI}
-	   << AsmCmd1{CALL, PRINTF};
+	ac << AsmCmd2{LEAQ, dynamic_pointer_cast<AsmVar>(m_label), RDI};
+	Runtime::gen_call(ac, Runtime::write_str);
 }
 
 
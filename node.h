@@ -121,6 +121,8 @@ private:
 	void m_gen_arithm(AsmCode& ac);
 	void m_gen_cmp(AsmCode& ac);
 	void m_gen_bin(AsmCode& ac);
+	/// integer operation with a constant, see StrengthReducer
+	bool m_gen_const_operand(AsmCode& ac);
 };
 
 class NodeActualParameters : public Node {
@@ -176,7 +178,9 @@ private:
 };
 
 class NodeStmt : public Node {
-
+public:
+	/// where the statement starts, set for procedures, blocks, calls, IF and loops
+	Pos pos = {0, 0, 0};
 };
 
 class NodeStmtIf : public NodeStmt {
@@ -311,12 +315,18 @@ public:
 	std::vector<PNodeFormalParameterSection> params;
 	std::vector<PNodeStmt> parts;
 	PSymbolProcedure symbol;
+	/// replace calls in tail position by jumps
+	static bool tail_calls;
+private:
+	void m_mark_tail_calls(PNodeStmt, bool is_tail, bool& is_self);
+	void m_mark_tail_call(PNodeExpression, bool& is_self);
+	/// copies the args from the registers and the stack to the frame
+	void m_gen_bind_params(AsmCode&);
 };
 
 class NodeStmtFunction : public NodeStmtProcedure {
 public:
 	std::string str() const override;
-	void generate(AsmCode&) override;
 	PNodeType result_type;
 };
 
@@ -362,8 +372,16 @@ public:
 	std::string str() const override;
 	void generate(AsmCode&) override;
 	void generate_lvalue(AsmCode&) override;
+	bool is_exit() const;
+	/// write or writeln
+	bool is_write() const;
+	bool is_writeln() const;
+	/// CALL can be replaced by a jump out of the frame of caller
+	bool can_tail_call(const SymbolProcedure& caller) const;
 	PSymbolProcedure proc;
 	PNodeActualParameters args;
+	/// the caller returns right after this call
+	bool is_tail = false;
 private:
 	PSymbolType m_proctype = nullptr;
 	enum Predefined {
@@ -376,6 +394,12 @@ private:
 	};
 	Predefined m_predefined = NONE;
 	void m_write(AsmCode& ac, PNodeExpression);
+	void m_push_args(AsmCode&, bool is_inline);
+	void m_push_arg(AsmCode&, size_t i, bool is_inline);
+	/// System V: leaves the stack args on top
+	void m_pass_args(AsmCode&);
+	void m_generate_inline(AsmCode&, NodeStmtProcedure&);
+	bool m_generate_tail(AsmCode&);
 };
 
 
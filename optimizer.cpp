@@ -1,464 +1,675 @@
 #include "optimizer.h"
+#include "forwarding.h"
+#include "liveness.h"
+#include "scheduler.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
 #include <iostream>
 
 using namespace std;
 
-typedef PAsmOperand PAO;
-
-Optimizer::Optimizer(AsmCode& a_ac) :
-	ac(a_ac), cmds(a_ac.m_commands)
-{
+/// in the order they are tried in a round, by the numbers of the stats
+static const std::vector<Peephole::Rule> rules = {
 	///subq/addq  $0, %rxx
 	///-->
-	optimizations.push_back(
-	{[&](int i) {
-		 PAsmCmd2 cmd = dynamic_pointer_cast<AsmCmd2>(cmds[i]);
-		 if (cmd && (cmd == ADDQ || cmd == SUBQ) && is_num(cmd->operand1, 0) && is_reg(cmd->operand2)) {
-			 replace(i, 1, {});
-			 return true;
-		 }
-		 return false;
-	}, 1});
+	{1, "addq|subq $0, r:reg", ""},
 
 	///imulq  $1, %rxx
 	///-->
-	optimizations.push_back(
-	{[&](int i) {
-		 PAsmCmd2 cmd = dynamic_pointer_cast<AsmCmd2>(cmds[i]);
-		 if (cmd && cmd == IMULQ && is_num(cmd->operand1, 1) && is_reg(cmd->operand2)) {
-			 replace(i, 1, {});
-			 return true;
-		 }
-		 return false;
-	}, 1});
+	{2, "imulq $1, r:reg", ""},
 
 	///movq  %rxx, %rxx
 	///-->
-	optimizations.push_back(
-	{[&](int i) {
-		 PAsmCmd2 cmd = dynamic_pointer_cast<AsmCmd2>(cmds[i]);
-		 if (cmd && cmd == MOVQ && cmd->operand1 == cmd->operand2) {
-			 replace(i, 1, {});
-			 return true;
-		 }
-		 return false;
-	}, 1});
+	{3, "movq a, a", ""},
 
 	///movq  $0, %rxx
 	///-->xorq  %rxx, %rxx (compiler must not generate flags-dependent code)
-	optimizations.push_back(
-	{[&](int i) {
-		 PAsmCmd2 cmd = dynamic_pointer_cast<AsmCmd2>(cmds[i]);
-		 if (cmd && cmd == MOVQ && is_num(cmd->operand1, 0) && is_reg(cmd->operand2)) {
-			 replace(i, 1, {make_shared<AsmCmd2>(XORQ, cmd->operand2, cmd->operand2)});
-			 return true;
-		 }
-		 return false;
-	}, 1});
+	{4, "movq $0, r:reg", "xorq r, r"},
 
 	///leaq  (addr), %rxx
 	///-->movq  addr, %rxx
-	optimizations.push_back(
-	{[&](int i) {
-		 PAsmCmd2 cmd = dynamic_pointer_cast<AsmCmd2>(cmds[i]);
-		 PAsmOperandOffset offs = cmd ? dynamic_pointer_cast<AsmOperandOffset>(cmd->operand1) : 0;
-		 if (cmd && cmd == LEAQ && offs && (!offs->offset && !offs->index) && is_reg(cmd->operand2)) {
-			 replace(i, 1, {make_shared<AsmCmd2>(MOVQ, PAO(offs->base), PAO(cmd->operand2))});
-			 return true;
-		 }
-		 return false;
-	}, 1});
+	{5, "leaq (a), r:reg", "movq a, r"},
 
 	///pushq  %rx1/(%rx1)/imm
 	///popq   %rx2
 	///-->movq  %rx1/(%rx1)/imm, %rx2
-	optimizations.push_back(
-	{[&](int i) {
-		 PAsmCmd1 cmd1 = dynamic_pointer_cast<AsmCmd1>(cmds[i]);
-		 PAsmCmd1 cmd2 = dynamic_pointer_cast<AsmCmd1>(cmds[i + 1]);
-		 if (cmd1 && cmd2 && cmd1 == PUSHQ && cmd2 == POPQ && (is_reg(cmd2->operand) || is_var(cmd2->operand) || (is_offs(cmd2->operand) && !is_var(cmd1->operand)))) {
-			 replace(i, 2, {make_shared<AsmCmd2>(MOVQ, cmd1->operand, cmd2->operand)});
-			 return true;
-		 }
-		 return false;
-	}, 2});
+	///memory to memory only through a register
+	{6, "pushq a; popq r:reg", "movq a, r"},
+	{6, "pushq a:nomem; popq m:mem", "movq a, m"},
 
 	///movq       $int1, %rxx
 	///addq/subq  $int2, %rxx
 	///-->cmd  $int1 +/- #int2, %rxx
-	optimizations.push_back(
-	{[&](int i) {
-		 PAsmCmd2 cmd1 = dynamic_pointer_cast<AsmCmd2>(cmds[i]);
-		 PAsmCmd2 cmd2 = dynamic_pointer_cast<AsmCmd2>(cmds[i + 1]);
-		 PAsmImmInt imm1 = cmd1 ? dynamic_pointer_cast<AsmImmInt>(cmd1->operand1) : 0;
-		 PAsmImmInt imm2 = cmd2 ? dynamic_pointer_cast<AsmImmInt>(cmd2->operand1) : 0;
-		 if (cmd1 && cmd2 && cmd1 == MOVQ &&
-			(cmd2 == ADDQ || cmd2 == SUBQ) &&
-			 is_reg(cmd1->operand2) && cmd1->operand2 == cmd2->operand2 && imm1 && imm2)
-		 {
-			 replace(i, 2, {
-				 make_shared<AsmCmd2>(
-						  MOVQ,
-						  make_shared<AsmImmInt>(imm1->value() + (cmd2 == ADDQ ? imm2->value() : -imm2->value())),
-						  cmd1->operand2)});
-			 return true;
-		 }
-		 return false;
-	}, 2});
+	{7, "movq x:imm, r:reg; addq y:imm, r", "movq x+y, r"},
+	{7, "movq x:imm, r:reg; subq y:imm, r", "movq x-y, r"},
 
 	///movq  %rx1, %rx2
 	///movq  %rx2, %rx1
 	///-->
-	optimizations.push_back(
-	{[&](int i) {
-		 PAsmCmd2 cmd1 = dynamic_pointer_cast<AsmCmd2>(cmds[i]);
-		 PAsmCmd2 cmd2 = dynamic_pointer_cast<AsmCmd2>(cmds[i + 1]);
-		 if (cmd1 && cmd2 && cmd1 == MOVQ && cmd2 == MOVQ && is_reg(cmd1->operand1) && is_reg(cmd1->operand2) &&
-			 cmd1->operand1 == cmd2->operand2 && cmd1->operand2 == cmd2->operand1) {
-			 replace(i, 2, {});
-			 return true;
-		 }
-		 return false;
-	}, 2});
+	{8, "movq a:reg, b:reg; movq b, a", ""},
 
 	///movq  operand, %rx1
 	///cmd   %rx1, %rx2
 	///-->cmd  operand, %rx2 //rx2 != xmm
-	optimizations.push_back(
-	{[&](int i) {
-		 PAsmCmd2 cmd1 = dynamic_pointer_cast<AsmCmd2>(cmds[i]);
-		 PAsmCmd2 cmd2 = dynamic_pointer_cast<AsmCmd2>(cmds[i + 1]);
-		 if (cmd1 && cmd2 && cmd1 == MOVQ && is_reg(cmd1->operand2) && is_reg(cmd2->operand2) &&
-			 cmd1->operand2 == cmd2->operand1 && cmd2->operand2 != XMM0 && cmd2->operand2 != XMM1 &&
-			 cmd2->operand1 != cmd2->operand2 && cmd2->operand1 != XMM0 && cmd2->operand1 != XMM1)
-		 {
-			 replace(i, 2, {make_shared<AsmCmd2>(cmd2->oc(), cmd1->operand1, cmd2->operand2)});
-			 return true;
-		 }
-		 return false;
-	}, 2});
+	{9, "movq a, r:reg; *o r:gpr, s:gpr!r", "*o a, s"},
 
 	///movq  %xmm, %rx1
 	///movq  %rx1, %rx2
 	///-->movq  %xmm, %rx2
-	optimizations.push_back(
-	{[&](int i) {
-		 PAsmCmd2 cmd1 = dynamic_pointer_cast<AsmCmd2>(cmds[i]);
-		 PAsmCmd2 cmd2 = dynamic_pointer_cast<AsmCmd2>(cmds[i + 1]);
-		 if (cmd1 && cmd2 && cmd1 == MOVQ && is_reg(cmd1->operand2) && is_reg(cmd2->operand2) &&
-			 cmd1->operand2 == cmd2->operand1 && cmd2->operand2 != XMM0 && cmd2->operand2 != XMM1 &&
-			 cmd2->operand1 != cmd2->operand2 && cmd2->operand1 != XMM0 && cmd2->operand1 != XMM1)
-		 {
-			 replace(i, 2, {make_shared<AsmCmd2>(cmd2->oc(), cmd1->operand1, cmd2->operand2)});
-			 return true;
-		 }
-		 return false;
-	}, 2});
+	///the same as 9, again after the rules between them
+	{10, "movq a, r:reg; *o r:gpr, s:gpr!r", "*o a, s"},
 
 	///xorq       %rx1, %rx1
 	///subq/addq  %rx1, %rx2
 	///-->xorq  %rx1, %rx1
-	optimizations.push_back(
-	{[&](int i) {
-		 PAsmCmd2 cmd1 = dynamic_pointer_cast<AsmCmd2>(cmds[i]);
-		 PAsmCmd2 cmd2 = dynamic_pointer_cast<AsmCmd2>(cmds[i + 1]);
-		 if (cmd1 && cmd2 && cmd1 == XORQ && (cmd2 == ADDQ || cmd2 == SUBQ) && is_reg(cmd1->operand1) &&
-			 cmd1->operand1 == cmd1->operand2 && cmd1->operand1 == cmd2->operand1)
-		 {
-			 replace(i, 2, {cmd1});
-			 return true;
-		 }
-		 return false;
-	}, 2});
-
-	///mov  addr, %rx1
-	///mov  oprd, (%rx1)
-	///-->mov  oprd, (addr)
-	optimizations.push_back(
-	{[&](int i) {
-		 PAsmCmd2 cmd1 = dynamic_pointer_cast<AsmCmd2>(cmds[i]);
-		 PAsmCmd2 cmd2 = dynamic_pointer_cast<AsmCmd2>(cmds[i + 1]);
-		 PAsmOperandOffset offs = cmd2 ? dynamic_pointer_cast<AsmOperandOffset>(cmd2->operand2) : 0;
-		 if (cmd1 && cmd2 && cmd1 == MOVQ && cmd2 == MOVQ && is_reg(cmd1->operand2) && is_addr(cmd1->operand1) &&
-			 offs && offs->base->equals(cmd1->operand2) && !offs->index && !offs->offset)
-		 {
-			 replace(i, 2, {make_shared<AsmCmd2>(MOVQ, cmd2->operand1, cmd1->operand1)});
-			 return true;
-		 }
-		 return false;
-	}, 2});
+	{11, "xorq r:reg, r; addq|subq r, b", "xorq r, r"},
 
 	///cmd  %rxx, operand
 	///movq  %rxx, operand(!(%rxx))
 	///-->movq  %rxx, operand
-	optimizations.push_back(
-	{[&](int i) {
-		 PAsmCmd2 cmd1 = dynamic_pointer_cast<AsmCmd2>(cmds[i]);
-		 PAsmCmd2 cmd2 = dynamic_pointer_cast<AsmCmd2>(cmds[i + 1]);
-		 PAsmOperandOffset offs = cmd2 ? dynamic_pointer_cast<AsmOperandOffset>(cmd2->operand2) : 0;
-		 if (cmd1 && cmd2 && cmd2 == MOVQ && is_reg(cmd1->operand1) && cmd1->operand1 == cmd2->operand1 &&
-			 (!offs || offs->base != cmd1->operand1) && cmd1->operand2 == cmd2->operand2)
-		 {
-			 replace(i, 2, {cmd1});
-			 return true;
-		 }
-		 return false;
-	}, 2});
+	{13, "*o r:reg, b; movq r, b!(r)", "*o r, b"},
 
 	/// leaq arg, %rxx
 	/// popq (%rxx)
 	/// --> popq arg
-	optimizations.push_back(
-	{[&](int i) {
-		 PAsmCmd2 cmd1 = dynamic_pointer_cast<AsmCmd2>(cmds[i]);
-		 PAsmCmd1 cmd2 = dynamic_pointer_cast<AsmCmd1>(cmds[i + 1]);
-		 PAsmOperandOffset offs = cmd2 ? dynamic_pointer_cast<AsmOperandOffset>(cmd2->operand) : 0;
-		 if (cmd1 && cmd2 && cmd1 == LEAQ && cmd2 == POPQ && offs && is_reg(cmd1->operand2) && cmd1->operand2->equals(offs->base) && !offs->offset && !offs->index)
-		 {
-			 replace(i, 2, {make_shared<AsmCmd1>(POPQ, cmd1->operand1)});
-			 return true;
-		 }
-		 return false;
-	}, 2});
+	{14, "leaq a, r:reg; popq (r)", "popq a"},
 
 	///leaq var, %rax
 	///cmd  opd, (%rax)
 	///-->cmd opd, var
-	optimizations.push_back(
-	{[&](int i) {
-		 PAsmCmd2 cmd1 = dynamic_pointer_cast<AsmCmd2>(cmds[i]);
-		 PAsmCmd2 cmd2 = dynamic_pointer_cast<AsmCmd2>(cmds[i + 1]);
-		 PAsmOperandOffset offs = cmd2 ? dynamic_pointer_cast<AsmOperandOffset>(cmd2->operand2) : 0;
-		 if (cmd1 && cmd2 && cmd1 == LEAQ && offs && !offs->offset && !offs->index && cmd1->operand2->equals(offs->base) &&
-			 (is_var(cmd1->operand1) || is_offs(cmd1->operand1)))
-		 {
-			 replace(i, 2, {make_shared<AsmCmd2>(cmd2->oc(), cmd2->operand1, cmd1->operand1)});
-			 return true;
-		 }
-		 return false;
-	}, 2});
+	{15, "leaq a:mem, r; *o b, (r)", "*o b, a"},
 
 	/// movq var, %rxx
 	/// cmd  oprd, %rxx
 	/// movq %rxx, var
 	///--> cmd oprd, var
-	optimizations.push_back(
-	{[&](int i) {
-		 PAsmCmd2 cmd1 = dynamic_pointer_cast<AsmCmd2>(cmds[i]);
-		 PAsmCmd2 cmd2 = dynamic_pointer_cast<AsmCmd2>(cmds[i + 1]);
-		 PAsmCmd2 cmd3 = dynamic_pointer_cast<AsmCmd2>(cmds[i + 2]);
-		 if (cmd1 && cmd2 && cmd3 && cmd1 == MOVQ && cmd3 == MOVQ && is_reg(cmd1->operand2) &&
-			 cmd1->operand2 == cmd2->operand2 && cmd1->operand2 == cmd3->operand1 &&
-			 is_var(cmd1->operand1) && cmd1->operand1 == cmd3->operand2)
-		 {
-			 replace(i, 3, {make_shared<AsmCmd2>(cmd2->oc(), cmd2->operand1, cmd1->operand1)});
-			 return true;
-		 }
-		 return false;
-	}, 3});
+	{16, "movq v:var, r:reg; *o a, r; movq r, v", "*o a, v"},
 
 	/// xorq %rxx, %rxx
 	/// test %rxx, %rxx
 	/// jz label
 	///--> jmp label
-	optimizations.push_back(
-	{[&](int i) {
-		 PAsmCmd2 cmd1 = dynamic_pointer_cast<AsmCmd2>(cmds[i]);
-		 PAsmCmd2 cmd2 = dynamic_pointer_cast<AsmCmd2>(cmds[i + 1]);
-		 PAsmCmd1 cmd3 = dynamic_pointer_cast<AsmCmd1>(cmds[i + 2]);
-		 if (cmd1 && cmd2 && cmd3 && cmd1 == XORQ && cmd2 == TESTQ && is_reg(cmd1->operand1) &&
-			 cmd1->operand1 == cmd1->operand2 && cmd1->operand2 == cmd2->operand1 &&
-			 cmd2->operand1 == cmd2->operand2 && cmd3 == JZ)
-		 {
-			 replace(i, 3, {make_shared<AsmCmd1>(JMP, cmd3->operand)});
-			 return true;
-		 }
-		 return false;
-	}, 3});
-	m_stats.resize(optimizations.size());
-}
+	{17, "xorq r:reg, r; testq r, r; jz l", "jmp l"},
+};
+
+std::string Optimizer::stats_path;
+
+Optimizer::Optimizer(AsmCode& a_ac) :
+	ac(a_ac), cmds(a_ac.m_commands)
+{}
 
 void Optimizer::optimize(bool output_stats) {
-	/// remove comments
-	cmds.erase(std::remove_if(cmds.begin(), cmds.end(), [](const PAsmCmd& cmd) {
-		return dynamic_pointer_cast<AsmComment>(cmd);
-	}), cmds.end());
-	bool changed_any = true;
-	while (changed_any) {
-		m_move_cmds();
-		changed_any = false;
-		for (int k = 0; k < optimizations.size(); k++) {
-			const pair<Optimization, HoleSize>& opt = optimizations[k];
-			for (int cmd = cmds.size() - opt.second; cmd >= 0; cmd--) {
-				bool result = opt.first(cmd);
-				changed_any |= result;
-				m_stats[k] += result;
-			}
+	optimize_quiet();
+	report(output_stats);
+}
+
+void Optimizer::optimize_quiet() {
+	Workers workers;
+	optimize_quiet(workers);
+}
+
+void Optimizer::optimize_quiet(Workers& workers) {
+	typedef chrono::steady_clock clock;
+	clock::time_point start = clock::now();
+	m_sizes[0] = m_size();
+	AsmCfg cfg(ac);
+	/// first blocks of the groups, consecutive blocks of group_size commands
+	vector<size_t> groups;
+	size_t size = group_size;
+	for (size_t b = 0; b < cfg.blocks.size(); b++) {
+		if (size >= group_size) {
+			groups.push_back(b);
+			size = 0;
 		}
+		size += cfg.blocks[b].end - cfg.blocks[b].begin;
+	}
+	groups.push_back(cfg.blocks.size());
+	ThreadPool& pool = workers.m_pool;
+	vector<Local>& locals = workers.m_locals;
+	for (Local& local: locals) {
+		local.clear_stats();
+		local.timed = !stats_path.empty();
 	}
+	vector<vector<AsmInstr>> results(groups.size() - 1);
+	pool.run(results.size(), [&](size_t group, size_t worker) {
+		for (size_t b = groups[group]; b < groups[group + 1]; b++) {
+			const AsmBlock& block = cfg.blocks[b];
+			locals[worker].optimize(cmds.data() + block.begin, cmds.data() + block.end, results[group]);
+		}
+	});
+	cmds.clear();
+	for (vector<AsmInstr>& result: results) {
+		cmds.insert(cmds.end(), result.begin(), result.end());
+		vector<AsmInstr>().swap(result);
+	}
+	m_stats.assign(locals[0].stats.size(), RuleStats());
+	for (const Local& local: locals) {
+		for (size_t k = 0; k < m_stats.size(); k++) {
+			m_stats[k].attempts += local.stats[k].attempts;
+			m_stats[k].hits += local.stats[k].hits;
+			m_stats[k].seconds += local.stats[k].seconds;
+		}
+		m_moves.attempts += local.moves.attempts;
+		m_moves.hits += local.moves.hits;
+		m_moves.seconds += local.moves.seconds;
+		m_rounds += local.rounds;
+		m_max_rounds = max(m_max_rounds, local.max_rounds);
+	}
+	m_workers = pool.size();
+	m_blocks = cfg.blocks.size();
+	m_sizes[1] = m_size();
+	clock::time_point rules_end = clock::now();
+	m_forwarded = LoadForwarding(ac).forward();
+	m_sizes[2] = m_size();
+	clock::time_point forward_end = clock::now();
+	Liveness liveness(ac);
+	m_dead = liveness.eliminate();
+	m_dead_rounds = liveness.rounds();
+	m_sizes[3] = m_size();
+	clock::time_point dead_end = clock::now();
+	if (Scheduler::enabled) {
+		Scheduler scheduler(ac);
+		m_scheduled = scheduler.schedule();
+		m_cycles[0] = scheduler.cycles_before();
+		m_cycles[1] = scheduler.cycles_after();
+	}
+	clock::time_point end = clock::now();
+	m_seconds[0] = chrono::duration<double>(end - start).count();
+	m_seconds[1] = chrono::duration<double>(rules_end - start).count();
+	m_seconds[2] = chrono::duration<double>(forward_end - rules_end).count();
+	m_seconds[3] = chrono::duration<double>(dead_end - forward_end).count();
+	m_seconds[4] = chrono::duration<double>(end - dead_end).count();
+}
+
+/// the sizes and the times as if the codes were one
+void Optimizer::add(const Optimizer& other) {
+	m_stats.resize(max(m_stats.size(), other.m_stats.size()));
+	for (size_t k = 0; k < other.m_stats.size(); k++) {
+		m_stats[k].attempts += other.m_stats[k].attempts;
+		m_stats[k].hits += other.m_stats[k].hits;
+		m_stats[k].seconds += other.m_stats[k].seconds;
+	}
+	m_moves.attempts += other.m_moves.attempts;
+	m_moves.hits += other.m_moves.hits;
+	m_moves.seconds += other.m_moves.seconds;
+	m_forwarded += other.m_forwarded;
+	m_dead += other.m_dead;
+	m_scheduled += other.m_scheduled;
+	for (int i = 0; i < 2; i++) {
+		m_cycles[i] += other.m_cycles[i];
+	}
+	m_workers = max(m_workers, other.m_workers);
+	m_blocks += other.m_blocks;
+	m_rounds += other.m_rounds;
+	m_max_rounds = max(m_max_rounds, other.m_max_rounds);
+	m_dead_rounds = max(m_dead_rounds, other.m_dead_rounds);
+	for (int i = 0; i < 4; i++) {
+		m_sizes[i] += other.m_sizes[i];
+	}
+	for (int i = 0; i < 5; i++) {
+		m_seconds[i] += other.m_seconds[i];
+	}
+}
+
+void Optimizer::report(bool output_stats) const {
 	if (output_stats) {
-		for (int i = 0; i < m_stats.size(); i++) {
-			if (m_stats[i]) {
-				cout << '#' << i + 1 << ": " << m_stats[i] << '\n';
+		for (size_t i = 0; i < m_stats.size(); i++) {
+			if (m_stats[i].hits) {
+				cout << '#' << i + 1 << ": " << m_stats[i].hits << '\n';
+			}
+		}
+		if (m_forwarded) {
+			cout << "forwarded: " << m_forwarded << '\n';
+		}
+		if (m_dead) {
+			cout << "dead: " << m_dead << '\n';
+		}
+		if (m_scheduled) {
+			cout << "scheduled: " << m_scheduled << '\n';
+		}
+	}
+	if (!stats_path.empty()) {
+		m_write_stats();
+	}
+}
+
+size_t Optimizer::m_size() const {
+	return count_if(cmds.begin(), cmds.end(), [](const AsmInstr& cmd) { return cmd.kind != AsmInstr::COMMENT; });
+}
+
+void Optimizer::m_write_stats() const {
+	ofstream os(stats_path);
+	if (!os.is_open()) {
+		cerr << "Could not open " << stats_path << endl;
+		return;
+	}
+	static const char* const stages[] = {"before", "rules", "forwarding", "after"};
+	static const char* const passes[] = {"total", "rules", "forwarding", "dead", "schedule"};
+	os << "{\n\t\"commands\": {";
+	for (int i = 0; i < 4; i++) {
+		os << (i ? ", " : "") << '"' << stages[i] << "\": " << m_sizes[i];
+	}
+	os << "},\n\t\"seconds\": {";
+	for (int i = 0; i < 5; i++) {
+		os << (i ? ", " : "") << '"' << passes[i] << "\": " << m_seconds[i];
+	}
+	os << "},\n"
+	   << "\t\"workers\": " << m_workers << ",\n"
+	   << "\t\"blocks\": " << m_blocks << ",\n"
+	   << "\t\"rounds\": {\"total\": " << m_rounds << ", \"max\": " << m_max_rounds
+	   << ", \"dead\": " << m_dead_rounds << "},\n"
+	   << "\t\"forwarded\": " << m_forwarded << ",\n"
+	   << "\t\"dead\": " << m_dead << ",\n"
+	   << "\t\"scheduled\": " << m_scheduled << ",\n"
+	   << "\t\"cycles\": {\"before\": " << m_cycles[0] << ", \"after\": " << m_cycles[1] << "},\n"
+	   << "\t\"moves\": {\"attempts\": " << m_moves.attempts << ", \"hits\": " << m_moves.hits
+	   << ", \"seconds\": " << m_moves.seconds << "},\n"
+	   << "\t\"rules\": [";
+	/// the numbers of the rules removed are skipped
+	bool first_rule = true;
+	for (size_t k = 0; k < m_stats.size(); k++) {
+		string patterns;
+		/// the patterns have no quotes nor backslashes
+		for (const Peephole::Rule& rule: rules) {
+			if (rule.number == int(k + 1)) {
+				patterns += string(patterns.empty() ? "" : ", ") + '"' + rule.pattern + '"';
 			}
 		}
+		if (patterns.empty()) {
+			continue;
+		}
+		os << (first_rule ? "" : ",") << "\n\t\t{\"rule\": " << k + 1 << ", \"patterns\": [" << patterns
+		   << "], \"attempts\": " << m_stats[k].attempts << ", \"hits\": " << m_stats[k].hits
+		   << ", \"seconds\": " << m_stats[k].seconds << '}';
+		first_rule = false;
+	}
+	os << "\n\t]\n}\n";
+}
+
+const Peephole& Optimizer::Local::m_rules() {
+	static const Peephole peephole(rules);
+	return peephole;
+}
+
+Optimizer::Local::Local() :
+	m_peephole(m_rules())
+{
+	stats.resize(m_peephole.rules());
+	m_dirty.resize(m_peephole.rules());
+}
+
+void Optimizer::Local::clear_stats() {
+	stats.assign(m_peephole.rules(), RuleStats());
+	moves = RuleStats();
+	rounds = 0;
+	max_rounds = 0;
+}
+
+void Optimizer::Local::optimize(const AsmInstr* begin, const AsmInstr* end, std::vector<AsmInstr>& out) {
+	m_nodes.clear();
+	m_head = m_tail = -1;
+	m_stamp = 0;
+	for (const AsmInstr* cmd = begin; cmd != end; cmd++) {
+		if (cmd->kind != AsmInstr::COMMENT) {
+			m_link(m_new_node(*cmd), -1);
+		}
+	}
+	for (int node = m_head; node != -1; node = m_nodes[node].next) {
+		m_touch(node);
+	}
+	int round = 0;
+	bool changed = true;
+	while (changed) {
+		round++;
+		changed = m_run(-1);
+		for (int k = 0; k < m_peephole.rules(); k++) {
+			changed |= m_run(k);
+		}
 	}
+	rounds += round;
+	max_rounds = max(max_rounds, round);
+	for (int node = m_head; node != -1; node = m_nodes[node].next) {
+		out.push_back(m_nodes[node].cmd);
+	}
+}
+
+bool Optimizer::Local::m_run(int rule) {
+	if (!timed) {
+		return rule == -1 ? m_move_cmds() : m_scan(rule);
+	}
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	bool changed = rule == -1 ? m_move_cmds() : m_scan(rule);
+	(rule == -1 ? moves : stats[rule]).seconds += chrono::duration<double>(chrono::steady_clock::now() - start).count();
+	return changed;
 }
 
-void Optimizer::m_move_cmds() {
-	for (int i = 0; i < cmds.size(); i++) {
-		bool moved = false;
-		if (cmds[i] == PUSHQ) {
-			PAsmOperand op = dynamic_pointer_cast<AsmCmd1>(cmds[i])->operand;
-			for (int j = i; j < cmds.size() - 1; j++) {
-				if (cmds[j + 1] == POPQ || cmds[j + 1] == PUSHQ || is_jmp(cmds[j + 1]) || is_label(cmds[j + 1]) || operds_eq(op, cmds[j + 1], 2)) {
+/// pushes go down past the commands they do not depend on, to the pops they may be merged with,
+/// immediate moves go down to the commands using them
+bool Optimizer::Local::m_move_cmds() {
+	static const AsmOp rsp = RSP;
+	m_stamp++;
+	m_rule = -1;
+	m_moving = true;
+	bool moved = false;
+	for (int node: m_move_dirty) {
+		if (m_nodes[node].alive && m_nodes[node].move_dirty) {
+			m_nodes[node].move_dirty = false;
+			m_queue.push_back({m_rank(node), node});
+		}
+	}
+	m_move_dirty.clear();
+	sort(m_queue.begin(), m_queue.end());
+	for (int i = m_pop(); i != -1; i = m_pop()) {
+		if (!m_nodes[i].alive) {
+			continue;
+		}
+		/// skipped by this pass, next to an immediate move that went down
+		if (m_nodes[i].skip == m_stamp) {
+			m_mark_move(i);
+			continue;
+		}
+		m_at = m_nodes[i].label;
+		moves.attempts++;
+		const AsmInstr& cmd = m_nodes[i].cmd;
+		int next = m_nodes[i].next;
+		int stop = next;
+		if (cmd.oc() == PUSHQ) {
+			const AsmOp& op = cmd.ops[0];
+			bool is_offs = op.kind == AsmOp::MEM;
+			for (; stop != -1; stop = m_nodes[stop].next) {
+				const AsmInstr& cmd2 = m_nodes[stop].cmd;
+				if (cmd2.oc() == POPQ || cmd2.oc() == PUSHQ || is_jmp(cmd2) || is_label(cmd2) || operds_eq(op, cmd2, 2) ||
+				    cmd_contains(cmd2, rsp)) {
 					break;
 				}
-				swap(cmds[j], cmds[j + 1]);
-				moved = true;
-			}
-		} else if (cmds[i] == POPQ) {
-			PAsmOperand op = dynamic_pointer_cast<AsmCmd1>(cmds[i])->operand;
-			for (int j = i; j > 0; j--) {
-				if (cmds[j - 1] == POPQ || cmds[j - 1] == PUSHQ || is_jmp(cmds[j - 1]) || is_label(cmds[j - 1]) || cmd_contains(cmds[j - 1], op)) {
+				/// the address registers of a memory operand or the memory itself is changed
+				const AsmOp& dst = cmd2.ops[1];
+				if (cmd2.kind == AsmInstr::CMD && cmd2.count == 2 &&
+				    ((is_offs && offs_contains(op, dst)) ||
+				     ((is_offs || op.kind == AsmOp::VAR) && (dst.kind == AsmOp::MEM || dst.kind == AsmOp::VAR)))) {
 					break;
 				}
-				break;
-				swap(cmds[j], cmds[j - 1]);
-//				moved = true;
 			}
-		} else if (cmds[i] == MOVQ) {
-			PAsmCmd2 cmd = dynamic_pointer_cast<AsmCmd2>(cmds[i]);
-			PAsmOperandReg op = dynamic_pointer_cast<AsmOperandReg>(cmd->operand2);
-			if (dynamic_pointer_cast<AsmImmInt>(cmd->operand1) && op && !is_special(op->reg())) {
-				for (int j = i; j < cmds.size() - 1; j++) {
-					if (cmds[j + 1] == PUSHQ || cmds[j + 1] == POPQ || is_jmp(cmds[j + 1]) ||
-						is_label(cmds[j + 1]) || cmd_contains(cmds[j + 1], op)) {
-						break;
-					}
-//					break;
-					swap(cmds[j], cmds[j + 1]);
-//					moved = true;
+		} else {
+			const AsmOp& op = cmd.ops[1];
+			for (; stop != -1; stop = m_nodes[stop].next) {
+				const AsmInstr& cmd2 = m_nodes[stop].cmd;
+				if (cmd2.oc() == PUSHQ || cmd2.oc() == POPQ || is_jmp(cmd2) || is_label(cmd2) || cmd_contains(cmd2, op)) {
+					break;
 				}
 			}
+			if (stop != next) {
+				m_nodes[next].skip = m_stamp;
+			}
+		}
+		if (stop != next) {
+			moved = true;
+			moves.hits++;
+			m_unlink(i);
+			m_touch_before(next);
+			m_link(i, stop);
+			m_touch(i);
+			m_touch_before(i);
 		}
-		i -= moved;
 	}
+	m_moving = false;
+	return moved;
 }
 
-bool Optimizer::operds_eq(PAsmOperand op, PAsmCmd cmd, int pos) {
-	switch (pos) {
-	case 0: return false;
-	case 1: {
-		PAsmCmd1 cmd1 = dynamic_pointer_cast<AsmCmd1>(cmd);
-		if (cmd1) {
-			return op->equals(cmd1->operand);
+/// from the last command to the first, the nodes the rule was not tried at are known not to match
+bool Optimizer::Local::m_scan(int rule) {
+	m_stamp++;
+	m_rule = rule;
+	m_at = UINT64_MAX;
+	for (int node: m_dirty[rule]) {
+		if (m_nodes[node].alive && (m_nodes[node].dirty & (uint64_t)1 << rule)) {
+			m_nodes[node].dirty &= ~((uint64_t)1 << rule);
+			m_queue.push_back({m_rank(node), node});
+		}
+	}
+	m_dirty[rule].clear();
+	sort(m_queue.begin(), m_queue.end());
+	bool changed = false;
+	for (int node = m_pop(); node != -1; node = m_pop()) {
+		if (!m_nodes[node].alive) {
+			continue;
 		}
-		PAsmCmd2 cmd2 = dynamic_pointer_cast<AsmCmd2>(cmd);
-		if (cmd2) {
-			return op->equals(cmd2->operand1);
+		m_at = m_nodes[node].label;
+		m_window.clear();
+		for (int k = node; k != -1 && (int)m_window.size() < m_peephole.max_length(); k = m_nodes[k].next) {
+			m_window.push_back(&m_nodes[k].cmd);
 		}
+		int length;
+		stats[rule].attempts++;
+		if (m_peephole.match(rule + 1, m_window, length, m_replacement, m_match)) {
+			replace(node, length, m_replacement);
+			changed = true;
+			stats[rule].hits++;
+		}
+	}
+	m_rule = -1;
+	return changed;
+}
+
+/// pos counts from 1, 2 is the last operand of a command of two or three
+bool Optimizer::Local::operds_eq(const AsmOp& op, const AsmInstr& cmd, int pos) {
+	if (cmd.kind != AsmInstr::CMD) {
 		return false;
 	}
-	case 2: {
-		PAsmCmd2 cmd2 = dynamic_pointer_cast<AsmCmd2>(cmd);
-		if (cmd2) {
-			return op->equals(cmd2->operand2);
+	switch (pos) {
+	case 1: return (cmd.count == 1 || cmd.count == 2) && op == cmd.ops[0];
+	case 2: return cmd.count >= 2 && op == cmd.ops[cmd.count - 1];
+	default: return false;
+	}
+}
+
+void Optimizer::Local::replace(int node, uint n, const std::vector<AsmInstr>& a_cmds) {
+	int after = node;
+	for (uint k = 0; k < n; k++) {
+		int next = m_nodes[after].next;
+		m_unlink(after);
+		m_nodes[after].alive = false;
+		after = next;
+	}
+	int first = after;
+	for (auto cmd = a_cmds.rbegin(); cmd != a_cmds.rend(); cmd++) {
+		int new_node = m_new_node(*cmd);
+		m_link(new_node, first);
+		first = new_node;
+	}
+	for (int k = first; k != after; k = m_nodes[k].next) {
+		m_touch(k);
+	}
+	m_touch_before(first);
+}
+
+int Optimizer::Local::m_new_node(const AsmInstr& cmd) {
+	Node node;
+	node.cmd = cmd;
+	node.prev = node.next = -1;
+	node.label = 0;
+	node.born = m_stamp;
+	m_nodes.push_back(node);
+	return m_nodes.size() - 1;
+}
+
+/// labels are spaced, a node linked between two takes the middle
+void Optimizer::Local::m_link(int node, int before) {
+	int prev = before == -1 ? m_tail : m_nodes[before].prev;
+	uint64_t low = prev == -1 ? 0 : m_nodes[prev].label;
+	if (before == -1) {
+		m_nodes[node].label = low + label_space;
+	} else {
+		if (m_nodes[before].label - low < 2) {
+			m_relabel();
+			low = prev == -1 ? 0 : m_nodes[prev].label;
 		}
+		m_nodes[node].label = low + (m_nodes[before].label - low) / 2;
 	}
-	default: return false;
+	m_nodes[node].prev = prev;
+	m_nodes[node].next = before;
+	(prev == -1 ? m_head : m_nodes[prev].next) = node;
+	(before == -1 ? m_tail : m_nodes[before].prev) = node;
+}
+
+void Optimizer::Local::m_unlink(int node) {
+	int prev = m_nodes[node].prev;
+	int next = m_nodes[node].next;
+	(prev == -1 ? m_head : m_nodes[prev].next) = next;
+	(next == -1 ? m_tail : m_nodes[next].prev) = prev;
+}
+
+/// the order stays, the queue stays sorted
+void Optimizer::Local::m_relabel() {
+	uint64_t label = 0;
+	for (int node = m_head; node != -1; node = m_nodes[node].next) {
+		m_nodes[node].label = label += label_space;
 	}
-	return false;
+	for (auto& entry: m_queue) {
+		entry.first = m_rank(entry.second);
+	}
+	for (auto& entry: m_heap) {
+		entry.first = m_rank(entry.second);
+	}
+	make_heap(m_heap.begin(), m_heap.end());
 }
 
-void Optimizer::replace(uint idx, uint n, const std::vector<PAsmCmd>& a_cmds) {
-	/// equalize under-replace hole size and n. of new cmds
-	if (a_cmds.size() == 0 && n == 0) {
-		return;
-	} else if (a_cmds.size() > n) {
-		vector<PAsmCmd> t(a_cmds.size() - n, 0);
-		cmds.insert(cmds.begin() + idx, t.begin(), t.end());
-	} else if (a_cmds.size() < n) {
-		cmds.erase(cmds.begin() + idx, cmds.begin() + idx + n - a_cmds.size());
+/// the windows of the rules starting before the node and the pushes and moves that may go down to it
+void Optimizer::Local::m_touch_before(int node) {
+	int prev = node == -1 ? m_tail : m_nodes[node].prev;
+	int p = prev;
+	for (int k = 1; k < m_peephole.max_length() && p != -1; k++, p = m_nodes[p].prev) {
+		m_mark(p);
 	}
-	/// replace old cmds by new
-	for (PAsmCmd cmd: a_cmds) {
-		cmds[idx++] = cmd;
+	for (p = prev; p != -1; p = m_nodes[p].prev) {
+		const AsmInstr& cmd = m_nodes[p].cmd;
+		if (cmd.oc() == POPQ || is_jmp(cmd) || is_label(cmd)) {
+			break;
+		}
+		m_mark_move(p);
+		if (cmd.oc() == PUSHQ) {
+			break;
+		}
 	}
 }
 
-bool Optimizer::is_num(PAsmOperand op, int64_t n) {
-	PAsmImmInt imm = dynamic_pointer_cast<AsmImmInt>(op);
-	return imm && imm->value() == n;
+void Optimizer::Local::m_touch(int node) {
+	m_mark(node);
+	m_mark_move(node);
 }
 
-bool Optimizer::is_int(PAsmOperand op) {
-	return (bool)dynamic_pointer_cast<AsmImmInt>(op);
+/// the rule scanning now gets the nodes it has yet to reach, made before it
+void Optimizer::Local::m_mark(int node) {
+	Node& n = m_nodes[node];
+	uint64_t bits = m_peephole.first(n.cmd.oc());
+	for (int k = 0; bits; k++, bits >>= 1) {
+		if (!(bits & 1)) {
+			continue;
+		}
+		if (k == m_rule && n.label < m_at && n.born != m_stamp) {
+			m_push(node);
+		} else if (!(n.dirty & (uint64_t)1 << k)) {
+			n.dirty |= (uint64_t)1 << k;
+			m_dirty[k].push_back(node);
+		}
+	}
 }
 
-bool Optimizer::is_reg(PAsmOperand op) {
-	return (bool)dynamic_pointer_cast<AsmOperandReg>(op);
+/// the pass running gets the nodes it has yet to reach
+void Optimizer::Local::m_mark_move(int node) {
+	Node& n = m_nodes[node];
+	if (!m_is_movable(n.cmd)) {
+		return;
+	}
+	if (m_moving && n.label > m_at && n.skip != m_stamp) {
+		m_push(node);
+	} else if (!n.move_dirty) {
+		n.move_dirty = true;
+		m_move_dirty.push_back(node);
+	}
 }
 
-bool Optimizer::is_addr(PAsmOperand op) {
-	return (bool)dynamic_pointer_cast<AsmVar>(op);
+bool Optimizer::Local::m_is_movable(const AsmInstr& cmd) {
+	if (cmd.oc() == PUSHQ) {
+		return true;
+	}
+	return cmd.oc() == MOVQ && cmd.count == 2 && cmd.ops[0].kind == AsmOp::IMM && cmd.ops[1].kind == AsmOp::REG &&
+	       !is_special(cmd.ops[1].reg());
 }
 
-bool Optimizer::is_offs(PAsmOperand op) {
-	return (bool)dynamic_pointer_cast<AsmOperandOffset>(op);
+/// the moves go up the labels, the rules down
+uint64_t Optimizer::Local::m_rank(int node) {
+	return m_moving ? ~m_nodes[node].label : m_nodes[node].label;
 }
 
-bool Optimizer::is_var(PAsmOperand op) {
-	return (bool)dynamic_pointer_cast<AsmVar>(op);
+void Optimizer::Local::m_push(int node) {
+	m_heap.push_back({m_rank(node), node});
+	push_heap(m_heap.begin(), m_heap.end());
 }
 
-bool Optimizer::cmd_contains(PAsmCmd cmd, PAsmOperand op) {
-	if (dynamic_pointer_cast<AsmCmd0>(cmd)) {
-		return false;
+/// the next of the queue, sorted when the scan or the pass starts, and of the heap of the nodes marked since
+int Optimizer::Local::m_pop() {
+	int node;
+	if (!m_heap.empty() && (m_queue.empty() || m_queue.back() < m_heap.front())) {
+		pop_heap(m_heap.begin(), m_heap.end());
+		node = m_heap.back().second;
+		m_heap.pop_back();
+	} else if (!m_queue.empty()) {
+		node = m_queue.back().second;
+		m_queue.pop_back();
+	} else {
+		return -1;
 	}
-	PAsmCmd1 cmd1 = dynamic_pointer_cast<AsmCmd1>(cmd);
-	if (cmd1) {
-		PAsmOperandOffset offs = dynamic_pointer_cast<AsmOperandOffset>(cmd1->operand);
-		return (offs && offs_contains(offs, op)) || op->equals(cmd1->operand);
+	return node;
+}
+
+bool Optimizer::Local::cmd_contains(const AsmInstr& cmd, const AsmOp& op) {
+	if (cmd.kind != AsmInstr::CMD) {
+		return false;
 	}
-	PAsmCmd2 cmd2 = dynamic_pointer_cast<AsmCmd2>(cmd);
-	if (cmd2) {
-		PAsmOperandOffset offs1 = dynamic_pointer_cast<AsmOperandOffset>(cmd2->operand1);
-		PAsmOperandOffset offs2 = dynamic_pointer_cast<AsmOperandOffset>(cmd2->operand2);
-		return (offs1 && offs_contains(offs1, op)) || (offs2 && offs_contains(offs2, op)) ||
-				op->equals(cmd2->operand1) || op->equals(cmd2->operand2);
+	for (int k = 0; k < cmd.count; k++) {
+		if ((cmd.ops[k].kind == AsmOp::MEM && offs_contains(cmd.ops[k], op)) || op == cmd.ops[k]) {
+			return true;
+		}
 	}
 	return false;
 }
 
-bool Optimizer::offs_contains(PAsmOperandOffset offs, PAsmOperand op) {
-	return op->equals(offs->base) ||
-		   (offs->index && op->equals(offs->index)) ||
-		   (offs->scale && op->equals(offs->scale)) ||
-		   (offs->offset && op->equals(offs->offset));
+/// a register of the address or the label it is displaced by
+bool Optimizer::Local::offs_contains(const AsmOp& offs, const AsmOp& op) {
+	if (op.kind == AsmOp::REG) {
+		return op.base == offs.base || (offs.scale && op.base == offs.index);
+	}
+	return op.is_label() && offs.name != AsmOp::no_name && op.name == offs.name;
 }
 
-bool Optimizer::is_jmp(PAsmCmd cmd) {
-	return
-			cmd == JZ || cmd == JNZ || cmd == JMP ||
-			cmd == JE || cmd == JGE || cmd == JLE ||
-			cmd == JG || cmd == JL || cmd == CALL ||
-			cmd == RET;
+bool Optimizer::Local::is_jmp(const AsmInstr& cmd) {
+	switch (cmd.oc()) {
+	case JZ: case JNZ: case JMP:
+	case JE: case JGE: case JLE:
+	case JG: case JL: case JB: case JAE: case CALL:
+	case RET:
+		return true;
+	default:
+		return false;
+	}
 }
 
-bool Optimizer::is_label(PAsmCmd cmd) {
-	return dynamic_pointer_cast<AsmLabel>(cmd) &&
-	      !dynamic_pointer_cast<AsmVar>(cmd) &&
-	      !dynamic_pointer_cast<AsmSyscall>(cmd) &&
-	      !dynamic_pointer_cast<AsmGlobl>(cmd);
+bool Optimizer::Local::is_label(const AsmInstr& cmd) {
+	return cmd.kind == AsmInstr::LABEL;
 }
 
-bool Optimizer::is_special(Register reg) {
+bool Optimizer::Local::is_special(Register reg) {
 	return reg == RAX || reg == RSI || reg == RDI || reg == RCX || reg == RSP || reg == RBP;
 }
 
-const std::vector<int> Optimizer::stats() const {
-	return m_stats;
+std::vector<int> Optimizer::stats() const {
+	vector<int> hits;
+	for (const RuleStats& stat: m_stats) {
+		hits.push_back(stat.hits);
+	}
+	return hits;
 }
 
 
@@ -2,38 +2,169 @@
 #define OPTIMIZER_H
 
 #include "asmcode.h"
+#include "asmcfg.h"
+#include "peephole.h"
+#include "threadpool.h"
+#include <string>
 #include <vector>
-#include <functional>
-#include <deque>
 
+/// The peephole rules of the table in optimizer.cpp applied to the commands until none applies.
+/// No rule and no move goes past a label or a jump, so each basic block is optimized on its own:
+/// the blocks in groups on a thread pool, put back in the order of the code.
+/// While it runs the commands of a block are a doubly linked list of nodes ordered by labels. A rule
+/// is tried at a command only if the command has an opcode the rule starts with, and only if a rewrite
+/// or a move has changed the commands the rule would look at since it was last tried there.
+/// Rounds go as if every rule were tried everywhere: the moves, then each rule from the last command
+/// to the first, until a round changes nothing, so the result does not depend on which commands were
+/// revisited nor on the threads.
+/// Then loads of values already in registers are replaced, see LoadForwarding,
+/// and the commands whose results are not used are removed, see Liveness. Not before the rules:
+/// these take a register loaded for a command as free after it, the forwarding keeps it longer.
+/// Last, if Scheduler::enabled, the commands of each block are reordered, see Scheduler.
+/// With stats_path the work of each rule, of the passes and the size of the code go there as JSON.
 struct Optimizer {
+	/// of a rule or of the moves, summed over the blocks and the workers
+	struct RuleStats {
+		/// windows tried, rewrites, seconds only with stats_path
+		int64_t attempts = 0;
+		int64_t hits = 0;
+		double seconds = 0;
+	};
+	static std::string stats_path;
+
 	Optimizer(AsmCode&);
+	/// then report
 	void optimize(bool output_stats = false);
+	/// on workers of its own
+	void optimize_quiet();
+	class Workers;
+	/// on the workers given, to optimize many codes without new threads for each
+	void optimize_quiet(Workers&);
+	/// the work of an optimizer of other code counted as of this one, for a code optimized in parts
+	void add(const Optimizer&);
+	/// the rewrites of the rules and the passes to cout if asked, everything to stats_path if set
+	void report(bool output_stats) const;
 	AsmCode& ac;
-	const std::vector<int> stats() const;
+	/// rewrites of each rule
+	std::vector<int> stats() const;
 private:
-	using Optimization = std::function<bool(int)>;
-	using HoleSize = int;
-	void m_move_cmds();
-	void replace(uint, uint, const std::vector<PAsmCmd>& = std::vector<PAsmCmd>());
-
-	bool is_num(PAsmOperand, int64_t n);
-	bool is_int(PAsmOperand);
-	bool is_reg(PAsmOperand);
-	bool is_jmp(PAsmCmd);
-	bool is_offs(PAsmOperand);
-	bool is_var(PAsmOperand);
-	bool is_label(PAsmCmd);
-	bool is_special(Register);
-	bool is_addr(PAsmOperand);
-	bool operds_eq(PAsmOperand op, PAsmCmd cmd, int pos);
-	bool cmd_contains(PAsmCmd, PAsmOperand);
-	bool offs_contains(PAsmOperandOffset, PAsmOperand);
-
-	std::vector<std::pair<Optimization, HoleSize>> optimizations;
-	std::deque<PAsmCmd>& cmds;
-	std::vector<int> m_stats;
+	/// the rules applied to a block at a time, one for each worker
+	class Local {
+	public:
+		Local();
+		/// the stats zero, for other code
+		void clear_stats();
+		/// the commands of the block, without the comments, optimized to out
+		void optimize(const AsmInstr* begin, const AsmInstr* end, std::vector<AsmInstr>& out);
+		std::vector<RuleStats> stats;
+		RuleStats moves;
+		/// rounds of all the blocks, of the block taking most
+		int64_t rounds = 0;
+		int max_rounds = 0;
+		bool timed = false;
+	private:
+		struct Node {
+			AsmInstr cmd;
+			int prev;
+			int next;
+			uint64_t label;
+			/// a bit per rule still to be tried at the node, so at most 64 rules, see Peephole::Rule
+			uint64_t dirty = 0;
+			bool move_dirty = false;
+			bool alive = true;
+			/// the scan that made it, the pass that skips it
+			int born = 0;
+			int skip = 0;
+		};
+		/// the moves for -1, timed if asked
+		bool m_run(int rule);
+		/// true if a command moved
+		bool m_move_cmds();
+		bool m_scan(int rule);
+		void replace(int node, uint n, const std::vector<AsmInstr>&);
+
+		int m_new_node(const AsmInstr&);
+		/// links before the node, at the end for -1
+		void m_link(int node, int before);
+		void m_unlink(int node);
+		void m_relabel();
+		/// the commands before the node are followed by something else now
+		void m_touch_before(int node);
+		/// the node is new where it is
+		void m_touch(int node);
+		void m_mark(int node);
+		void m_mark_move(int node);
+		bool m_is_movable(const AsmInstr&);
+		uint64_t m_rank(int node);
+		void m_push(int node);
+		/// -1 when done
+		int m_pop();
+
+		bool is_jmp(const AsmInstr&);
+		bool is_label(const AsmInstr&);
+		bool is_special(Register);
+		bool operds_eq(const AsmOp& op, const AsmInstr& cmd, int pos);
+		bool cmd_contains(const AsmInstr&, const AsmOp&);
+		bool offs_contains(const AsmOp& offs, const AsmOp&);
+
+		/// the rules parsed once, shared by the Locals of all the threads
+		static const Peephole& m_rules();
+		const Peephole& m_peephole;
+		Peephole::Match m_match;
+		/// commands from the node a rule is tried at, what replaces them
+		std::vector<const AsmInstr*> m_window;
+		std::vector<AsmInstr> m_replacement;
 
+		static const uint64_t label_space = 1ull << 32;
+		std::vector<Node> m_nodes;
+		int m_head = -1;
+		int m_tail = -1;
+		/// nodes each rule is to be tried at, the nodes of the moves
+		std::vector<std::vector<int>> m_dirty;
+		std::vector<int> m_move_dirty;
+		/// rank and node still to visit, the queue sorted and the heap of the nodes marked on the way
+		std::vector<std::pair<uint64_t, int>> m_queue;
+		std::vector<std::pair<uint64_t, int>> m_heap;
+		/// of the scan or the pass running: its number, its rule or -1 for the moves, the node it is at
+		int m_stamp = 0;
+		int m_rule = -1;
+		uint64_t m_at = 0;
+		bool m_moving = false;
+	};
+	/// commands of the blocks a worker takes at once, at least
+	static const size_t group_size = 4096;
+
+	std::vector<AsmInstr>& cmds;
+	std::vector<RuleStats> m_stats;
+	RuleStats m_moves;
+	/// commands replaced by LoadForwarding, removed by Liveness
+	int m_forwarded = 0;
+	int m_dead = 0;
+	/// commands placed elsewhere by Scheduler, its estimate of the cycles before and after
+	int m_scheduled = 0;
+	int64_t m_cycles[2] = {};
+	/// of the JSON
+	size_t m_workers = 0;
+	size_t m_blocks = 0;
+	int64_t m_rounds = 0;
+	int m_max_rounds = 0;
+	int m_dead_rounds = 0;
+	/// lines of code but comments before the rules, after the rules, the forwarding and the removal
+	size_t m_sizes[4] = {};
+	/// of the whole, the rules, the forwarding, the removal and the scheduling
+	double m_seconds[5] = {};
+	size_t m_size() const;
+	void m_write_stats() const;
+};
+
+/// The thread pool of the optimizer and a Local for each of its workers.
+class Optimizer::Workers {
+public:
+	Workers() : m_locals(m_pool.size()) {}
+private:
+	friend struct Optimizer;
+	ThreadPool m_pool;
+	std::vector<Local> m_locals;
 };
 
 #endif // OPTIMIZER_H
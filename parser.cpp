@@ -216,6 +216,7 @@ PNodeStmt Parser::parse_stmt() {
 
 PNodeStmtIf Parser::parse_if() {
 	PNodeStmtIf node = make_shared<NodeStmtIf>();
+	node->pos = scanner.top().position;
 	++scanner;
 	node->cond = parse_expression(precedence(Token::OP_EQUAL));
 	require({Token::R_THEN}, "keyword THEN");
@@ -232,6 +233,7 @@ PNodeStmtIf Parser::parse_if() {
 
 PNodeStmtWhile Parser::parse_while() {
 	PNodeStmtWhile node = make_shared<NodeStmtWhile>();
+	node->pos = scanner.top().position;
 	++scanner;
 	node->cond = parse_expression(precedence(Token::OP_EQUAL));
 	require({Token::R_DO}, "keyword DO");
@@ -244,6 +246,7 @@ PNodeStmtWhile Parser::parse_while() {
 
 PNodeStmtRepeat Parser::parse_repeat() {
 	PNodeStmtRepeat node = make_shared<NodeStmtRepeat>();
+	node->pos = scanner.top().position;
 	m_current_cycle.push(node);
 	node->stmt = parse_repeat_block();
 	m_current_cycle.pop();
@@ -303,6 +306,7 @@ PNodeStmtVar Parser::parse_var() {
 
 PNodeStmtFor Parser::parse_for () {
 	PNodeStmtFor node = make_shared<NodeStmtFor>();
+	node->pos = scanner.top().position;
 	++scanner;
 	require({Token::C_IDENTIFIER}, "identifier");
 	PNodeIdentifier id = make_shared<NodeIdentifier>(scanner++);
@@ -353,6 +357,7 @@ PNodeFormalParameterSection Parser::parse_formal_parameter_section() {
 	node->type = parse_type();
 	for (PNodeIdentifier var: vars) {
 		PSymbolVariable pv = make_shared<SymbolVariable>(var->name, node->type->symtype);
+		pv->is_var = node->is_var;
 		node->identifiers.push_back(make_shared<NodeVariable>(var, pv));
 	}
 	return node;
@@ -458,13 +463,25 @@ void Parser::parse_function_header(PNodeIdentifier& name, std::vector<PNodeForma
 	result_type = parse_type();
 }
 
+bool Parser::parse_inline_directive() {
+	if (scanner != Token::R_INLINE) {
+		return false;
+	}
+	++scanner;
+	require({Token::S_SEMICOLON}, ";");
+	++scanner;
+	return true;
+}
+
 PNodeStmtProcedure Parser::parse_procedure() {
 	PNodeStmtProcedure procedure = make_shared<NodeStmtProcedure>();
+	procedure->pos = scanner.top().position;
 	++scanner;
 	parse_procedure_header(procedure->name, procedure->params);
 	require({Token::S_SEMICOLON}, ";");
 	++scanner;
 	procedure->symbol = make_shared<SymbolProcedure>(procedure->name->name);
+	procedure->symbol->is_inline = parse_inline_directive();
 	for (PNodeFormalParameterSection psection: procedure->params) {
 		for (PNodeVariable var: psection->identifiers) {
 			procedure->symbol->is_nth_var.push_back(psection->is_var);
@@ -488,6 +505,7 @@ PNodeStmtProcedure Parser::parse_procedure() {
 	m_symtables.push_back(procedure->symbol->locals);
 	procedure->parts = parse_procedure_body();
 	m_symtables.pop_back();
+	procedure->symbol->layout_frame();
 
 	require({Token::S_SEMICOLON}, ";");
 	++scanner;
@@ -499,11 +517,13 @@ PNodeStmtProcedure Parser::parse_procedure() {
 
 PNodeStmtFunction Parser::parse_function() {
 	PNodeStmtFunction function = make_shared<NodeStmtFunction>();
+	function->pos = scanner.top().position;
 	++scanner;
 	parse_function_header(function->name, function->params, function->result_type);
 	require({Token::S_SEMICOLON}, ";");
 	++scanner;
 	PSymbolFunction sf = make_shared<SymbolFunction>(function->name->name);
+	sf->is_inline = parse_inline_directive();
 	sf->type = function->result_type->symtype;
 	function->symbol = sf;
 	for (PNodeFormalParameterSection psection: function->params) {
@@ -530,6 +550,7 @@ PNodeStmtFunction Parser::parse_function() {
 	m_symtables.push_back(function->symbol->locals);
 	function->parts = parse_procedure_body();
 	m_symtables.pop_back();
+	function->symbol->layout_frame();
 
 	require({Token::S_SEMICOLON}, ";");
 	++scanner;
@@ -718,6 +739,7 @@ PNodeType Parser::parse_type() {
 
 PNodeStmtBlock Parser::parse_block() {
 	PNodeStmtBlock node = make_shared<NodeStmtBlock>();
+	node->pos = scanner.top().position;
 	while (++scanner != Token::R_END) {
 		node->stmts.push_back(parse_stmt());
 		if (scanner == Token::R_END) {
@@ -817,6 +839,10 @@ PNodeExpression Parser::parse_expression(int prec) {
 			} else {
 				throw ParseError(token, "need procedure or function identifier");
 			}
+			if (f != left) {
+				PNodeExprStmtFunctionCall named = dynamic_pointer_cast<NodeExprStmtFunctionCall>(left);
+				f->pos = named ? named->pos : token.position;
+			}
 			f->args = parse_actual_parameters();
 			require({Token::OP_RIGHT_PAREN}, ")");
 			f->check_parameters(scanner.current_position());
@@ -861,7 +887,9 @@ PNodeExpression Parser::parse_factor() {
 		PSymbolProcedure s_f;
 		m_symtables[node->name] >> s_f;
 		if (s_f) {
-			return make_shared<NodeExprStmtFunctionCall>(s_f);
+			PNodeExprStmtFunctionCall call = make_shared<NodeExprStmtFunctionCall>(s_f);
+			call->pos = token.position;
+			return call;
 		}
 		return make_shared<NodeIdentifier>(token);
 	}
@@ -73,6 +73,7 @@ private:
 	PNodeConstant evaluate(PNodeExpression);
 	void parse_procedure_header(PNodeIdentifier&, std::vector<PNodeFormalParameterSection>&, bool skip_identifier = false);
 	void parse_function_header(PNodeIdentifier&, std::vector<PNodeFormalParameterSection>&, PNodeType&, bool skip_identifier = false);
+	bool parse_inline_directive();
 
 	Scanner scanner;
 	PNode m_syntax_tree = nullptr;
@@ -0,0 +1,352 @@
+#include "peephole.h"
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+Peephole::Peephole(const std::vector<Rule>& rules) :
+	m_tree(1), m_first(NONE + 1)
+{
+	uint64_t any = 0;
+	for (const Rule& rule: rules) {
+		if (rule.number < 1 || rule.number > 64) {
+			throw runtime_error("Internal error: peephole rule number out of range");
+		}
+		m_vars.clear();
+		m_opcode_vars.clear();
+		Pattern pattern;
+		pattern.rule = rule.number;
+		pattern.commands = m_parse(rule.pattern, true);
+		pattern.replacement = m_parse(rule.replacement, false);
+		pattern.vars = m_vars.size();
+		pattern.opcode_vars = m_opcode_vars.size();
+		if (pattern.commands.empty()) {
+			throw runtime_error("Internal error: empty peephole pattern");
+		}
+		m_patterns.push_back(pattern);
+		m_insert(0, m_patterns.size() - 1, 0);
+		uint64_t bit = (uint64_t)1 << (rule.number - 1);
+		if (pattern.commands[0].opcode_var >= 0) {
+			any |= bit;
+		}
+		for (Opcode oc: pattern.commands[0].opcodes) {
+			m_first[oc] |= bit;
+		}
+		m_rules = max(m_rules, rule.number);
+		m_max_length = max(m_max_length, (int)pattern.commands.size());
+	}
+	for (uint64_t& first: m_first) {
+		first |= any;
+	}
+}
+
+int Peephole::rules() const {
+	return m_rules;
+}
+
+int Peephole::max_length() const {
+	return m_max_length;
+}
+
+uint64_t Peephole::first(Opcode oc) const {
+	return m_first[oc];
+}
+
+/// the tree gives the patterns whose opcodes are those of the window, the first of them to match wins
+bool Peephole::match(int rule, const std::vector<const AsmInstr*>& window, int& length, std::vector<AsmInstr>& replacement,
+                     Match& match) const {
+	match.m_found.clear();
+	m_walk(0, rule, window, 0, match);
+	sort(match.m_found.begin(), match.m_found.end());
+	for (int p: match.m_found) {
+		const Pattern& pattern = m_patterns[p];
+		if (!m_match(pattern, window, match) || !m_replace(pattern, replacement, match)) {
+			continue;
+		}
+		length = pattern.commands.size();
+		return true;
+	}
+	return false;
+}
+
+/// false if an immediate computed does not fit its command
+bool Peephole::m_replace(const Pattern& pattern, std::vector<AsmInstr>& replacement, const Match& match) const {
+	replacement.clear();
+	for (const Command& command: pattern.replacement) {
+		Opcode oc = command.opcode_var >= 0 ? match.m_bound_opcodes[command.opcode_var] : command.opcodes[0];
+		AsmInstr cmd = AsmCmd0(oc);
+		cmd.count = command.operands.size();
+		for (int k = 0; k < cmd.count; k++) {
+			cmd.ops[k] = m_make(command.operands[k], match);
+		}
+		for (int k = 0; k < cmd.count; k++) {
+			Kind kind = command.operands[k].kind;
+			if ((kind == SUM || kind == DIFF) && !m_fits(cmd, k)) {
+				return false;
+			}
+		}
+		replacement.push_back(cmd);
+	}
+	return true;
+}
+
+/// 64 bits for a movq to a register, made a movabsq, 32 bits sign-extended for the rest
+bool Peephole::m_fits(const AsmInstr& cmd, int k) {
+	int64_t value = cmd.ops[k].value;
+	if (cmd.oc() == MOVQ && cmd.count == 2 && k == 0 && cmd.ops[1].kind == AsmOp::REG) {
+		return true;
+	}
+	return value == (int32_t)value;
+}
+
+std::vector<Peephole::Command> Peephole::m_parse(const std::string& text, bool is_pattern) {
+	vector<Command> commands;
+	size_t start = 0;
+	while (start <= text.size()) {
+		size_t end = text.find(';', start);
+		if (end == string::npos) {
+			end = text.size();
+		}
+		string command = m_trim(text.substr(start, end - start));
+		if (!command.empty()) {
+			commands.push_back(m_parse_command(command, is_pattern));
+		}
+		start = end + 1;
+	}
+	return commands;
+}
+
+Peephole::Command Peephole::m_parse_command(const std::string& text, bool is_pattern) {
+	Command command;
+	size_t space = text.find_first_of(" \t");
+	string opcode = text.substr(0, space);
+	if (opcode[0] == '*') {
+		string name = opcode.substr(1);
+		if (!m_opcode_vars.count(name)) {
+			if (!is_pattern) {
+				throw runtime_error("Internal error: unknown opcode variable " + name + " in a peephole rule");
+			}
+			int var = m_opcode_vars.size();
+			m_opcode_vars[name] = var;
+		}
+		command.opcode_var = m_opcode_vars[name];
+	} else {
+		size_t start = 0;
+		while (start <= opcode.size()) {
+			size_t end = min(opcode.find('|', start), opcode.size());
+			string mnemonic = opcode.substr(start, end - start);
+			auto it = find_if(opcodes.begin(), opcodes.end(), [&](const pair<const Opcode, string>& oc) {
+				return oc.second == mnemonic;
+			});
+			if (it == opcodes.end()) {
+				throw runtime_error("Internal error: unknown opcode " + mnemonic + " in a peephole rule");
+			}
+			command.opcodes.push_back(it->first);
+			start = end + 1;
+		}
+		if (!is_pattern && command.opcodes.size() != 1) {
+			throw runtime_error("Internal error: opcode alternatives in a peephole replacement");
+		}
+	}
+	if (space == string::npos) {
+		return command;
+	}
+	string operands = text.substr(space);
+	size_t start = 0;
+	while (start <= operands.size()) {
+		size_t end = min(operands.find(',', start), operands.size());
+		command.operands.push_back(m_parse_operand(m_trim(operands.substr(start, end - start)), is_pattern));
+		start = end + 1;
+	}
+	return command;
+}
+
+Peephole::Operand Peephole::m_parse_operand(const std::string& text, bool is_pattern) {
+	static const map<string, Kind> kinds = {
+		{"reg", REG}, {"gpr", GPR}, {"imm", IMM}, {"var", VAR}, {"offs", OFFS}, {"mem", MEM}, {"nomem", NOMEM},
+	};
+	Operand operand;
+	if (text.empty()) {
+		throw runtime_error("Internal error: empty operand in a peephole rule");
+	}
+	if (text[0] == '$') {
+		operand.kind = LITERAL;
+		operand.value = stoll(text.substr(1));
+		return operand;
+	}
+	if (text[0] == '(' && text.back() == ')') {
+		operand.kind = AT;
+		operand.var = m_var(text.substr(1, text.size() - 2), is_pattern);
+		return operand;
+	}
+	if (!is_pattern) {
+		size_t sign = text.find_first_of("+-");
+		operand.var = m_var(text.substr(0, sign), false);
+		if (sign != string::npos) {
+			operand.kind = text[sign] == '+' ? SUM : DIFF;
+			operand.var2 = m_var(text.substr(sign + 1), false);
+		}
+		return operand;
+	}
+	size_t colon = text.find(':');
+	size_t bang = text.find('!');
+	if (bang != string::npos) {
+		string other = text.substr(bang + 1);
+		if (!other.empty() && other[0] == '(' && other.back() == ')') {
+			operand.not_at = m_var(other.substr(1, other.size() - 2), false);
+		} else {
+			operand.not_var = m_var(other, false);
+		}
+	}
+	if (colon != string::npos && colon < bang) {
+		auto kind = kinds.find(text.substr(colon + 1, bang == string::npos ? string::npos : bang - colon - 1));
+		if (kind == kinds.end()) {
+			throw runtime_error("Internal error: unknown operand kind in a peephole rule: " + text);
+		}
+		operand.kind = kind->second;
+	}
+	operand.var = m_var(text.substr(0, min(colon, bang)), true);
+	return operand;
+}
+
+/// the names of a replacement and of constraints are those the pattern made
+int Peephole::m_var(const std::string& name, bool is_pattern) {
+	auto it = m_vars.find(name);
+	if (it != m_vars.end()) {
+		return it->second;
+	}
+	if (!is_pattern || name.empty()) {
+		throw runtime_error("Internal error: unknown variable '" + name + "' in a peephole rule");
+	}
+	int var = m_vars.size();
+	m_vars[name] = var;
+	return var;
+}
+
+void Peephole::m_insert(int tree_node, int pattern, size_t command) {
+	const vector<Command>& commands = m_patterns[pattern].commands;
+	if (command == commands.size()) {
+		m_tree[tree_node].patterns.push_back(pattern);
+		return;
+	}
+	if (commands[command].opcode_var >= 0) {
+		if (m_tree[tree_node].any == -1) {
+			m_tree[tree_node].any = m_tree.size();
+			m_tree.emplace_back();
+		}
+		m_insert(m_tree[tree_node].any, pattern, command + 1);
+		return;
+	}
+	for (Opcode oc: commands[command].opcodes) {
+		auto it = m_tree[tree_node].next.find(oc);
+		int next;
+		if (it == m_tree[tree_node].next.end()) {
+			next = m_tree[tree_node].next[oc] = m_tree.size();
+			m_tree.emplace_back();
+		} else {
+			next = it->second;
+		}
+		m_insert(next, pattern, command + 1);
+	}
+}
+
+void Peephole::m_walk(int tree_node, int rule, const std::vector<const AsmInstr*>& window, size_t depth, Match& match) const {
+	const TreeNode& node = m_tree[tree_node];
+	for (int p: node.patterns) {
+		if (m_patterns[p].rule == rule) {
+			match.m_found.push_back(p);
+		}
+	}
+	if (depth == window.size()) {
+		return;
+	}
+	auto it = node.next.find(window[depth]->oc());
+	if (it != node.next.end()) {
+		m_walk(it->second, rule, window, depth + 1, match);
+	}
+	if (node.any != -1) {
+		m_walk(node.any, rule, window, depth + 1, match);
+	}
+}
+
+bool Peephole::m_match(const Pattern& pattern, const std::vector<const AsmInstr*>& window, Match& match) const {
+	match.m_bound.assign(pattern.vars, AsmOp());
+	match.m_bound_opcodes.assign(pattern.opcode_vars, NONE);
+	for (size_t i = 0; i < pattern.commands.size(); i++) {
+		const Command& command = pattern.commands[i];
+		if (window[i]->kind != AsmInstr::CMD || window[i]->count != command.operands.size()) {
+			return false;
+		}
+		Opcode oc = window[i]->oc();
+		if (command.opcode_var >= 0) {
+			Opcode& bound = match.m_bound_opcodes[command.opcode_var];
+			if (bound != NONE && bound != oc) {
+				return false;
+			}
+			bound = oc;
+		} else if (find(command.opcodes.begin(), command.opcodes.end(), oc) == command.opcodes.end()) {
+			return false;
+		}
+		for (size_t k = 0; k < command.operands.size(); k++) {
+			if (!m_match(command.operands[k], window[i]->ops[k], match)) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+bool Peephole::m_match(const Operand& operand, AsmOp op, Match& match) const {
+	bool is_reg = op.kind == AsmOp::REG;
+	bool is_offs = op.kind == AsmOp::MEM;
+	bool is_var = op.kind == AsmOp::VAR;
+	Register base = op.reg();
+	switch (operand.kind) {
+	case REG: if (!is_reg) return false; break;
+	case GPR: if (!is_reg || op.reg() == XMM0 || op.reg() == XMM1 || (op.reg() >= XMM2 && op.reg() <= YMM15)) return false; break;
+	case IMM: if (op.kind != AsmOp::IMM) return false; break;
+	case VAR: if (!is_var) return false; break;
+	case OFFS: if (!is_offs) return false; break;
+	case MEM: if (!is_var && !is_offs) return false; break;
+	case NOMEM: if (is_var || is_offs) return false; break;
+	case LITERAL: return op.kind == AsmOp::IMM && op.value == operand.value;
+	case AT:
+		if (!is_offs || op.value || op.name != AsmOp::no_name || op.scale) {
+			return false;
+		}
+		op = base;
+		break;
+	default: break;
+	}
+	AsmOp& bound = match.m_bound[operand.var];
+	if (bound.kind != AsmOp::NONE && bound != op) {
+		return false;
+	}
+	bound = op;
+	if (operand.not_var >= 0 && match.m_bound[operand.not_var] == op) {
+		return false;
+	}
+	return operand.not_at < 0 || !is_offs || match.m_bound[operand.not_at] != base;
+}
+
+AsmOp Peephole::m_make(const Operand& operand, const Match& match) const {
+	switch (operand.kind) {
+	case LITERAL: return operand.value;
+	case SUM:
+	case DIFF: {
+		/// wrapping, as the commands would
+		uint64_t a = match.m_bound[operand.var].value;
+		uint64_t b = match.m_bound[operand.var2].value;
+		return int64_t(operand.kind == SUM ? a + b : a - b);
+	}
+	default: return match.m_bound[operand.var];
+	}
+}
+
+std::string Peephole::m_trim(const std::string& text) {
+	size_t start = text.find_first_not_of(" \t");
+	if (start == string::npos) {
+		return "";
+	}
+	return text.substr(start, text.find_last_not_of(" \t") - start + 1);
+}
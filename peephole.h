@@ -0,0 +1,105 @@
+#ifndef PEEPHOLE_H
+#define PEEPHOLE_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include "asmcode.h"
+
+/// Peephole rules written as patterns of commands, compiled into a decision tree on their opcodes.
+/// A rule rewrites the commands of its pattern to those of its replacement, ';' between commands:
+///   "movq x:imm, r:reg; addq y:imm, r"  ->  "movq x+y, r"
+/// An opcode is a mnemonic, alternatives as "addq|subq" or "*o", any opcode named o.
+/// An operand is
+///   $5        the immediate 5
+///   (r)       memory at the register r, without an index or a displacement
+///   a         anything, or what a is if a was named before
+///   a:kind    one of a kind: reg, gpr (a register but xmm and ymm), imm, var, offs, mem (var or offs)
+///             or nomem
+///   a!b       and not b
+///   a!(b)     and not memory addressed by the register b
+/// The command has as many operands as the pattern. A replacement names the opcodes and operands of
+/// the pattern, x+y and x-y are immediates computed from x and y; the rule does not apply if one does
+/// not fit its command, 32 bits sign-extended but for a movq to a register.
+/// Patterns of a rule are tried in the order they were added.
+/// Once built it is read only, the state of a match is kept apart so threads can share it.
+class Peephole {
+public:
+	struct Rule {
+		/// from 1 to 64, as in the stats, several patterns may share it; a rule is a bit of a uint64_t
+		/// here and in the Optimizer, the constructor throws for a number past 64
+		int number;
+		const char* pattern;
+		const char* replacement;
+	};
+	/// the bindings of a match, one per thread
+	class Match {
+		friend class Peephole;
+		std::vector<int> m_found;
+		std::vector<AsmOp> m_bound;
+		std::vector<Opcode> m_bound_opcodes;
+	};
+	Peephole(const std::vector<Rule>&);
+	/// largest rule number
+	int rules() const;
+	/// commands in the longest pattern
+	int max_length() const;
+	/// rules with a pattern starting with the opcode, a bit per rule from bit 0 for rule 1 to bit 63 for rule 64
+	uint64_t first(Opcode) const;
+	/// the commands from the start of the window a pattern of the rule matches and what replaces them
+	bool match(int rule, const std::vector<const AsmInstr*>& window, int& length, std::vector<AsmInstr>& replacement,
+	           Match&) const;
+private:
+	enum Kind {ANY, REG, GPR, IMM, VAR, OFFS, MEM, NOMEM, LITERAL, AT, SUM, DIFF};
+	struct Operand {
+		Kind kind = ANY;
+		/// variable of the operand, of the register of AT, the left one of SUM and DIFF
+		int var = -1;
+		int var2 = -1;
+		int64_t value = 0;
+		int not_var = -1;
+		int not_at = -1;
+	};
+	struct Command {
+		/// empty for an opcode variable
+		std::vector<Opcode> opcodes;
+		int opcode_var = -1;
+		std::vector<Operand> operands;
+	};
+	struct Pattern {
+		int rule;
+		int vars;
+		int opcode_vars;
+		std::vector<Command> commands;
+		std::vector<Command> replacement;
+	};
+	/// a node per opcode of the commands so far, an opcode variable goes to any
+	struct TreeNode {
+		std::map<Opcode, int> next;
+		int any = -1;
+		std::vector<int> patterns;
+	};
+	std::vector<Pattern> m_patterns;
+	std::vector<TreeNode> m_tree;
+	std::vector<uint64_t> m_first;
+	int m_rules = 0;
+	int m_max_length = 0;
+	/// names of the pattern being parsed
+	std::map<std::string, int> m_vars;
+	std::map<std::string, int> m_opcode_vars;
+
+	std::vector<Command> m_parse(const std::string& text, bool is_pattern);
+	Command m_parse_command(const std::string& text, bool is_pattern);
+	Operand m_parse_operand(const std::string& text, bool is_pattern);
+	int m_var(const std::string& name, bool is_pattern);
+	void m_insert(int tree_node, int pattern, size_t command);
+	void m_walk(int tree_node, int rule, const std::vector<const AsmInstr*>& window, size_t depth, Match&) const;
+	bool m_match(const Pattern&, const std::vector<const AsmInstr*>& window, Match&) const;
+	bool m_match(const Operand&, AsmOp, Match&) const;
+	AsmOp m_make(const Operand&, const Match&) const;
+	bool m_replace(const Pattern&, std::vector<AsmInstr>& replacement, const Match&) const;
+	static bool m_fits(const AsmInstr&, int operand);
+	static std::string m_trim(const std::string&);
+};
+
+#endif // PEEPHOLE_H
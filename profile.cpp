@@ -0,0 +1,127 @@
+#include "profile.h"
+#include <fstream>
+#include <sstream>
+#include "runtime.h"
+
+using namespace std;
+
+std::string Profile::generate_path;
+const std::string Profile::dump = "._rt_profile_dump";
+std::map<std::string, int64_t> Profile::m_counts;
+int64_t Profile::m_max_count = 0;
+bool Profile::m_is_loaded = false;
+std::vector<std::pair<std::string, Pos>> Profile::m_scopes;
+std::vector<std::string> Profile::m_keys;
+std::map<std::string, int> Profile::m_counters;
+
+/// a key counted twice, by an expanded body and a call, adds up
+bool Profile::load(const std::string& path) {
+	ifstream file(path);
+	if (!file.is_open()) {
+		return false;
+	}
+	string line;
+	while (getline(file, line)) {
+		istringstream is(line);
+		int64_t count;
+		string key;
+		if (!(is >> count) || count < 0 || !getline(is >> ws, key) || key.empty()) {
+			return false;
+		}
+		m_counts[key] += count;
+		m_max_count = max(m_max_count, m_counts[key]);
+	}
+	m_is_loaded = true;
+	return true;
+}
+
+bool Profile::is_generating() {
+	return !generate_path.empty();
+}
+
+bool Profile::is_loaded() {
+	return m_is_loaded;
+}
+
+void Profile::push_scope(const std::string& name, Pos pos) {
+	m_scopes.push_back({name, pos});
+}
+
+void Profile::pop_scope() {
+	m_scopes.pop_back();
+}
+
+std::string Profile::key(Pos pos, const std::string& what) {
+	const pair<string, Pos>& scope = m_scopes.back();
+	return scope.first + ":" + to_string((int64_t)pos.line - (int64_t)scope.second.line) + ":" + to_string(pos.column) + ":" + what;
+}
+
+int64_t Profile::count(Pos pos, const std::string& what) {
+	if (!m_is_loaded) {
+		return -1;
+	}
+	auto it = m_counts.find(key(pos, what));
+	return it == m_counts.end() ? -1 : it->second;
+}
+
+bool Profile::is_hot(int64_t count) {
+	return m_is_loaded && count > 0 && count * 100 >= m_max_count;
+}
+
+void Profile::gen_count(AsmCode& ac, Pos pos, const std::string& what) {
+	if (is_generating()) {
+		gen_increment(ac, counter(key(pos, what)));
+	}
+}
+
+void Profile::gen_increment(AsmCode& ac, int counter) {
+	ac << AsmCmd1{INCQ, AsmOffs{AsmVar{m_counter_var(counter)}, RIP}};
+}
+
+int Profile::counter(const std::string& key) {
+	auto it = m_counters.find(key);
+	if (it != m_counters.end()) {
+		return it->second;
+	}
+	m_keys.push_back(key);
+	return m_counters[key] = m_keys.size() - 1;
+}
+
+void Profile::gen_dump(AsmCode& ac) {
+	if (is_generating()) {
+		ac << AsmCmd1{CALL, AsmLabel{dump}};
+	}
+}
+
+/// a line per counter, in the order the counters were made
+void Profile::generate(AsmCode& ac) {
+	if (!is_generating()) {
+		return;
+	}
+	string path;
+	for (char c: generate_path) {
+		if (c == '\\' || c == '"') {
+			path += '\\';
+		}
+		path += c;
+	}
+	PAsmVar path_var = make_shared<AsmVarString>(dump + "_path", path);
+	ac.add_data(path_var);
+	ac << AsmLabel{dump}
+	   << AsmCmd2{LEAQ, path_var, RDI};
+	Runtime::gen_call(ac, Runtime::profile_open);
+	for (size_t i = 0; i < m_keys.size(); i++) {
+		PAsmVar key = make_shared<AsmVarString>(m_counter_var(i) + "_key", m_keys[i]);
+		ac.add_data(make_shared<AsmVarInt>(m_counter_var(i)));
+		ac.add_data(key);
+		ac << AsmCmd2{LEAQ, key, RDI}
+		   << AsmCmd2{MOVQ, AsmOffs{AsmVar{m_counter_var(i)}, RIP}, RSI};
+		Runtime::gen_call(ac, Runtime::profile_line);
+	}
+	Runtime::gen_call(ac, Runtime::profile_close);
+	ac << AsmCmd0{RET};
+}
+
+std::string Profile::m_counter_var(int counter) {
+	return "._rt_profile_" + to_string(counter);
+}
@@ -0,0 +1,54 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include <map>
+#include <string>
+#include <vector>
+#include "asmcode.h"
+#include "types.h"
+
+/// Counts of a run of the program, --profile-generate and --profile-use.
+/// A count is keyed by what happened where in the source: "SORT:3:5:then" is the THEN branch of
+/// the IF at column 5, 3 lines below the header of SORT. Lines of the main program are counted
+/// from its BEGIN, so editing one procedure leaves the keys of the others as they were.
+/// Keyed are the entries of procedures, the branches of IF, the entries and bodies of loops
+/// and the calls, the same for the native code and the IR.
+/// The instrumented program writes "count key" lines to the file when main returns.
+class Profile {
+public:
+	/// file of --profile-generate, empty without it
+	static std::string generate_path;
+	/// reads the file of --profile-use, false if it cannot be read
+	static bool load(const std::string& path);
+	static bool is_generating();
+	static bool is_loaded();
+	/// what the keys are relative to: a procedure at its header or the main program at its BEGIN
+	static void push_scope(const std::string& name, Pos);
+	static void pop_scope();
+	static std::string key(Pos, const std::string& what);
+	/// of the loaded profile, -1 if the key was never generated
+	static int64_t count(Pos, const std::string& what);
+	/// at least a hundredth of the highest count of the profile
+	static bool is_hot(int64_t count);
+	/// adds one to the counter of the key, with --profile-generate
+	static void gen_count(AsmCode&, Pos, const std::string& what);
+	/// the counter numbered by counter()
+	static void gen_increment(AsmCode&, int counter);
+	/// number of the counter of the key, made on first use
+	static int counter(const std::string& key);
+	/// writes the counts to the file, before main returns
+	static void gen_dump(AsmCode&);
+	/// counters, their keys and the dump routine, before Runtime::generate
+	static void generate(AsmCode&);
+private:
+	static const std::string dump;
+	static std::map<std::string, int64_t> m_counts;
+	static int64_t m_max_count;
+	static bool m_is_loaded;
+	static std::vector<std::pair<std::string, Pos>> m_scopes;
+	static std::vector<std::string> m_keys;
+	static std::map<std::string, int> m_counters;
+	static std::string m_counter_var(int counter);
+};
+
+#endif // PROFILE_H
@@ -0,0 +1,547 @@
+#include "rangecheck.h"
+#include "runtime.h"
+#include "symbol.h"
+
+using namespace std;
+
+bool RangeChecks::enabled = false;
+map<const NodeArrayAccess*, vector<bool>> RangeChecks::m_checks;
+map<const NodeStmtFor*, RangeChecks::Range> RangeChecks::m_loop_tests;
+set<const NodeStmtFor*> RangeChecks::m_unchecked_loops;
+int RangeChecks::m_kept = 0;
+
+/// offsets and bounds beyond it are left to the checks
+static const int64_t max_offset = (int64_t)1 << 31;
+
+void RangeChecks::analyze(PNodeProgram program) {
+	m_checks.clear();
+	m_loop_tests.clear();
+	m_unchecked_loops.clear();
+	m_kept = 0;
+	m_parts(program->parts);
+}
+
+bool RangeChecks::is_checked(const NodeArrayAccess& access, size_t dim) {
+	auto it = m_checks.find(&access);
+	return it == m_checks.end() || it->second.at(dim);
+}
+
+bool RangeChecks::loop_test(const NodeStmtFor& loop, int64_t& low, int64_t& high) {
+	auto it = m_loop_tests.find(&loop);
+	if (it == m_loop_tests.end()) {
+		return false;
+	}
+	low = it->second.low;
+	high = it->second.high;
+	return true;
+}
+
+bool RangeChecks::is_unchecked(const NodeStmtFor& loop) {
+	return m_unchecked_loops.count(&loop) > 0;
+}
+
+void RangeChecks::gen_check(AsmCode& ac, int64_t size, Register scratch) {
+	if (size <= 0) {
+		Runtime::gen_jump(ac, JMP, Runtime::range_error);
+		return;
+	}
+	/// negative differences are above every size unsigned
+	ac << AsmCmd2{MOVQ, size, scratch}
+	   << AsmCmd2{CMPQ, scratch, RAX};
+	Runtime::gen_jump(ac, JAE, Runtime::range_error);
+}
+
+void RangeChecks::gen_test(AsmCode& ac, Register value, int64_t low, int64_t high, Register scratch) {
+	if (value != RAX) {
+		ac << AsmCmd2{MOVQ, value, RAX};
+	}
+	ac << AsmCmd2{MOVQ, low, scratch}
+	   << AsmCmd2{SUBQ, scratch, RAX};
+	gen_check(ac, high - low + 1, scratch);
+}
+
+void RangeChecks::print_stats(ostream& os) {
+	int total = 0, kept = 0;
+	for (const pair<const NodeArrayAccess* const, vector<bool>>& p: m_checks) {
+		for (bool is_checked: p.second) {
+			total++;
+			kept += is_checked;
+		}
+	}
+	os << "# range checks: " << kept << " of " << total << " kept, "
+	   << m_loop_tests.size() << " loop tests\n";
+}
+
+/// every procedure starts knowing nothing, its calls may come from anywhere
+void RangeChecks::m_parts(const vector<PNodeStmt>& parts) {
+	Facts facts;
+	for (PNodeStmt part: parts) {
+		m_stmt(part, facts);
+	}
+}
+
+/// in the order the code runs, Node::generate and IrBuilder agree on it
+void RangeChecks::m_stmt(PNodeStmt stmt, Facts& facts) {
+	if (PNodeStmtBlock block = dynamic_pointer_cast<NodeStmtBlock>(stmt)) {
+		for (PNodeStmt s: block->stmts) {
+			m_stmt(s, facts);
+		}
+	} else if (PNodeStmtAssign assign = dynamic_pointer_cast<NodeStmtAssign>(stmt)) {
+		m_expr(assign->right, facts);
+		m_expr(assign->left, facts);
+		Effects effects;
+		m_target(assign->left, effects);
+		m_kill(facts, effects);
+		PNodeVariable var = dynamic_pointer_cast<NodeVariable>(assign->left);
+		int64_t value;
+		if (var && m_is_tracked(*var->symbol) && m_constant(assign->right, value)) {
+			facts[var->symbol.get()] = {value, value};
+		}
+	} else if (PNodeExprStmtFunctionCall call = dynamic_pointer_cast<NodeExprStmtFunctionCall>(stmt)) {
+		m_call(*call, facts);
+	} else if (PNodeStmtIf stmt_if = dynamic_pointer_cast<NodeStmtIf>(stmt)) {
+		m_expr(stmt_if->cond, facts);
+		Facts then_facts = facts;
+		m_stmt(stmt_if->then_stmt, then_facts);
+		if (stmt_if->else_stmt) {
+			m_stmt(stmt_if->else_stmt, facts);
+		}
+		/// what both branches know, in the wider range
+		for (auto it = facts.begin(); it != facts.end();) {
+			auto then_it = then_facts.find(it->first);
+			if (then_it == then_facts.end()) {
+				it = facts.erase(it);
+				continue;
+			}
+			it->second.low = min(it->second.low, then_it->second.low);
+			it->second.high = max(it->second.high, then_it->second.high);
+			++it;
+		}
+	} else if (PNodeStmtWhile stmt_while = dynamic_pointer_cast<NodeStmtWhile>(stmt)) {
+		/// the facts left hold on every entry to the condition and after the loop
+		Effects effects;
+		m_expr_effects(stmt_while->cond, effects);
+		m_effects(stmt_while->stmt, effects);
+		m_kill(facts, effects);
+		Facts body_facts = facts;
+		m_expr(stmt_while->cond, body_facts);
+		m_stmt(stmt_while->stmt, body_facts);
+	} else if (PNodeStmtRepeat stmt_repeat = dynamic_pointer_cast<NodeStmtRepeat>(stmt)) {
+		/// continue goes to the body, the condition comes only after it
+		Effects effects;
+		m_effects(stmt_repeat->stmt, effects);
+		m_expr_effects(stmt_repeat->cond, effects);
+		m_kill(facts, effects);
+		Facts body_facts = facts;
+		m_stmt(stmt_repeat->stmt, body_facts);
+		m_expr(stmt_repeat->cond, body_facts);
+	} else if (PNodeStmtFor stmt_for = dynamic_pointer_cast<NodeStmtFor>(stmt)) {
+		m_stmt_for(*stmt_for, facts);
+	} else if (PNodeStmtVar stmt_var = dynamic_pointer_cast<NodeStmtVar>(stmt)) {
+		/// initializers are generated apart from the statements, before them
+		Effects effects;
+		for (PNodeVarDeclarationUnit unit: stmt_var->units) {
+			if (!unit->initializer) {
+				continue;
+			}
+			Facts none;
+			m_expr(unit->initializer->expr, none);
+			for (PNodeVariable var: unit->vars) {
+				m_target(var, effects);
+			}
+		}
+		m_kill(facts, effects);
+	} else if (PNodeStmtProcedure proc = dynamic_pointer_cast<NodeStmtProcedure>(stmt)) {
+		m_parts(proc->parts);
+	}
+}
+
+/// The variable keeps to the bounds of the loop when they are constant.
+/// Otherwise the accesses every iteration runs into tell the range it has to keep to,
+/// which is tested on the values of low and high once the loop is known to run.
+/// Either holds in the whole body only if nothing in it assigns the variable.
+void RangeChecks::m_stmt_for(NodeStmtFor& loop, Facts& facts) {
+	m_expr(loop.low, facts);
+	Effects body;
+	m_effects(loop.stmt, body);
+	/// high is evaluated again after each iteration
+	Effects effects = body;
+	m_expr_effects(loop.high, effects);
+	m_target(loop.iter_var, effects);
+	m_kill(facts, effects);
+	m_expr(loop.high, facts);
+	m_kill(facts, effects);
+	Facts body_facts = facts;
+	SymbolVariable& iter = *loop.iter_var->symbol;
+	int64_t low, high;
+	if (m_is_tracked(iter) && !m_is_killed(iter, body)) {
+		if (m_constant(loop.low, low) && m_constant(loop.high, high)) {
+			body_facts[&iter] = loop.is_inc ? Range{low, high} : Range{high, low};
+		} else if (m_is_stable(loop.high, effects) && !m_leaves(loop.stmt, loop, false)) {
+			vector<Range> ranges;
+			m_collect(loop.stmt, loop, ranges);
+			if (!ranges.empty()) {
+				Range range = ranges[0];
+				for (const Range& r: ranges) {
+					range.low = max(range.low, r.low);
+					range.high = min(range.high, r.high);
+				}
+				m_loop_tests[&loop] = range;
+				body_facts[&iter] = range;
+			}
+		}
+	}
+	int kept = m_kept;
+	m_stmt(loop.stmt, body_facts);
+	if (m_kept == kept) {
+		m_unchecked_loops.insert(&loop);
+	}
+}
+
+void RangeChecks::m_expr(PNodeExpression expr, Facts& facts) {
+	if (PNodeArrayAccess access = dynamic_pointer_cast<NodeArrayAccess>(expr)) {
+		m_access(*access, facts);
+	} else if (PNodeRecordAccess access = dynamic_pointer_cast<NodeRecordAccess>(expr)) {
+		m_expr(access->record, facts);
+	} else if (PNodeExprStmtFunctionCall call = dynamic_pointer_cast<NodeExprStmtFunctionCall>(expr)) {
+		m_call(*call, facts);
+	} else if (PNodeUnaryOperator unary = dynamic_pointer_cast<NodeUnaryOperator>(expr)) {
+		m_expr(unary->node, facts);
+	} else if (PNodeBinaryOperator binary = dynamic_pointer_cast<NodeBinaryOperator>(expr)) {
+		m_expr(binary->left, facts);
+		if (binary->operation != Token::OP_AND && binary->operation != Token::OP_OR) {
+			m_expr(binary->right, facts);
+			return;
+		}
+		/// the right operand may not run
+		Effects effects;
+		m_expr_effects(binary->right, effects);
+		Facts right_facts = facts;
+		m_expr(binary->right, right_facts);
+		m_kill(facts, effects);
+	}
+}
+
+/// The start address, then each index followed by its check.
+/// An index var + c is in bounds if the facts say var is, otherwise it is after the check.
+/// An access may be reached twice, a += b has a as both operand and target:
+/// it is checked if either place needs it.
+void RangeChecks::m_access(NodeArrayAccess& access, Facts& facts) {
+	m_expr(access.array, facts);
+	const vector<pair<int, int>>& bounds = dynamic_pointer_cast<SymbolTypeArray>(access.array->exprtype())->bounds;
+	vector<bool>& checks = m_checks[&access];
+	checks.resize(bounds.size(), false);
+	for (size_t i = 0; i < bounds.size(); i++) {
+		PNodeExpression index = access.index->arglist.at(i);
+		m_expr(index, facts);
+		SymbolVariable* var;
+		int64_t offset;
+		bool is_needed = true;
+		if (m_index(index, var, offset)) {
+			Range range = {bounds[i].first - offset, bounds[i].second - offset};
+			if (!var) {
+				is_needed = range.low > 0 || range.high < 0;
+			} else {
+				auto it = facts.find(var);
+				if (it == facts.end()) {
+					facts[var] = range;
+				} else if (it->second.low >= range.low && it->second.high <= range.high) {
+					is_needed = false;
+				} else {
+					it->second.low = max(it->second.low, range.low);
+					it->second.high = min(it->second.high, range.high);
+				}
+			}
+		}
+		if (is_needed) {
+			checks[i] = true;
+			m_kept++;
+		}
+	}
+}
+
+/// the arguments are evaluated in an order of their own, each knows only what the call does not change
+void RangeChecks::m_call(NodeExprStmtFunctionCall& call, Facts& facts) {
+	Effects effects;
+	m_call_effects(call, effects);
+	m_kill(facts, effects);
+	if (!call.args) {
+		return;
+	}
+	for (PNodeExpression arg: call.args->arglist) {
+		Facts arg_facts = facts;
+		m_expr(arg, arg_facts);
+	}
+}
+
+/// memory of arrays and records is not tracked
+void RangeChecks::m_target(PNodeExpression lvalue, Effects& effects) {
+	if (PNodeVariable var = dynamic_pointer_cast<NodeVariable>(lvalue)) {
+		effects.vars.insert(var->symbol.get());
+		/// the argument of a VAR parameter may be a global
+		effects.globals |= var->symbol->is_var;
+		return;
+	}
+	while (true) {
+		if (PNodeArrayAccess access = dynamic_pointer_cast<NodeArrayAccess>(lvalue)) {
+			lvalue = access->array;
+		} else if (PNodeRecordAccess access = dynamic_pointer_cast<NodeRecordAccess>(lvalue)) {
+			lvalue = access->record;
+		} else {
+			break;
+		}
+	}
+	/// a pointer reaches only variables whose address is taken, a global through a VAR parameter too
+	PNodeUnaryOperator deref = dynamic_pointer_cast<NodeUnaryOperator>(lvalue);
+	effects.globals |= deref && deref->operation == Token::OP_DEREFERENCE;
+}
+
+void RangeChecks::m_effects(PNodeStmt stmt, Effects& effects) {
+	if (PNodeStmtBlock block = dynamic_pointer_cast<NodeStmtBlock>(stmt)) {
+		for (PNodeStmt s: block->stmts) {
+			m_effects(s, effects);
+		}
+	} else if (PNodeStmtAssign assign = dynamic_pointer_cast<NodeStmtAssign>(stmt)) {
+		m_expr_effects(assign->right, effects);
+		m_expr_effects(assign->left, effects);
+		m_target(assign->left, effects);
+	} else if (PNodeExprStmtFunctionCall call = dynamic_pointer_cast<NodeExprStmtFunctionCall>(stmt)) {
+		m_call_effects(*call, effects);
+	} else if (PNodeStmtIf stmt_if = dynamic_pointer_cast<NodeStmtIf>(stmt)) {
+		m_expr_effects(stmt_if->cond, effects);
+		m_effects(stmt_if->then_stmt, effects);
+		if (stmt_if->else_stmt) {
+			m_effects(stmt_if->else_stmt, effects);
+		}
+	} else if (PNodeStmtWhile stmt_while = dynamic_pointer_cast<NodeStmtWhile>(stmt)) {
+		m_expr_effects(stmt_while->cond, effects);
+		m_effects(stmt_while->stmt, effects);
+	} else if (PNodeStmtRepeat stmt_repeat = dynamic_pointer_cast<NodeStmtRepeat>(stmt)) {
+		m_effects(stmt_repeat->stmt, effects);
+		m_expr_effects(stmt_repeat->cond, effects);
+	} else if (PNodeStmtFor stmt_for = dynamic_pointer_cast<NodeStmtFor>(stmt)) {
+		m_expr_effects(stmt_for->low, effects);
+		m_expr_effects(stmt_for->high, effects);
+		m_target(stmt_for->iter_var, effects);
+		m_effects(stmt_for->stmt, effects);
+	}
+}
+
+void RangeChecks::m_expr_effects(PNodeExpression expr, Effects& effects) {
+	if (PNodeArrayAccess access = dynamic_pointer_cast<NodeArrayAccess>(expr)) {
+		m_expr_effects(access->array, effects);
+		for (PNodeExpression index: access->index->arglist) {
+			m_expr_effects(index, effects);
+		}
+	} else if (PNodeRecordAccess access = dynamic_pointer_cast<NodeRecordAccess>(expr)) {
+		m_expr_effects(access->record, effects);
+	} else if (PNodeExprStmtFunctionCall call = dynamic_pointer_cast<NodeExprStmtFunctionCall>(expr)) {
+		m_call_effects(*call, effects);
+	} else if (PNodeUnaryOperator unary = dynamic_pointer_cast<NodeUnaryOperator>(expr)) {
+		m_expr_effects(unary->node, effects);
+	} else if (PNodeBinaryOperator binary = dynamic_pointer_cast<NodeBinaryOperator>(expr)) {
+		m_expr_effects(binary->left, effects);
+		m_expr_effects(binary->right, effects);
+	}
+}
+
+/// a called procedure may assign any global and the arguments of its VAR parameters
+void RangeChecks::m_call_effects(NodeExprStmtFunctionCall& call, Effects& effects) {
+	if (call.args) {
+		for (PNodeExpression arg: call.args->arglist) {
+			m_expr_effects(arg, effects);
+		}
+	}
+	if (call.is_write() || call.is_exit()) {
+		return;
+	}
+	effects.globals = true;
+	const vector<bool>& is_var = call.proc->is_nth_var;
+	for (size_t i = 0; call.args && i < call.args->arglist.size() && i < is_var.size(); i++) {
+		if (is_var[i]) {
+			m_target(call.args->arglist[i], effects);
+		}
+	}
+}
+
+void RangeChecks::m_kill(Facts& facts, const Effects& effects) {
+	for (auto it = facts.begin(); it != facts.end();) {
+		if (m_is_killed(*it->first, effects)) {
+			it = facts.erase(it);
+		} else {
+			++it;
+		}
+	}
+}
+
+bool RangeChecks::m_is_killed(const SymbolVariable& var, const Effects& effects) {
+	return effects.vars.count(const_cast<SymbolVariable*>(&var)) > 0 || (effects.globals && !var.is_local);
+}
+
+bool RangeChecks::m_is_tracked(const SymbolVariable& var) {
+	return !var.is_var && !var.is_addressed &&
+	       !dynamic_cast<const SymbolConst*>(&var) && dynamic_pointer_cast<SymbolTypeInt>(var.type);
+}
+
+bool RangeChecks::m_constant(PNodeExpression expr, int64_t& value) {
+	if (PNodeInteger integer = dynamic_pointer_cast<NodeInteger>(expr)) {
+		value = integer->value;
+		return true;
+	}
+	if (PNodeVariable var = dynamic_pointer_cast<NodeVariable>(expr)) {
+		if (PSymbolConstInt c = dynamic_pointer_cast<SymbolConstInt>(var->symbol)) {
+			value = c->value;
+			return true;
+		}
+		return false;
+	}
+	PNodeUnaryOperator unary = dynamic_pointer_cast<NodeUnaryOperator>(expr);
+	if (unary && unary->operation == Token::OP_MINUS && m_constant(unary->node, value)) {
+		value = -value;
+		return true;
+	}
+	return false;
+}
+
+bool RangeChecks::m_index(PNodeExpression expr, SymbolVariable*& var, int64_t& offset) {
+	if (m_constant(expr, offset)) {
+		var = nullptr;
+		return offset > -max_offset && offset < max_offset;
+	}
+	if (PNodeVariable node = dynamic_pointer_cast<NodeVariable>(expr)) {
+		var = node->symbol.get();
+		offset = 0;
+		return m_is_tracked(*var);
+	}
+	PNodeBinaryOperator binary = dynamic_pointer_cast<NodeBinaryOperator>(expr);
+	if (!binary || (binary->operation != Token::OP_PLUS && binary->operation != Token::OP_MINUS)) {
+		return false;
+	}
+	int64_t c;
+	PNodeExpression operand;
+	if (m_constant(binary->right, c)) {
+		operand = binary->left;
+		c = binary->operation == Token::OP_MINUS ? -c : c;
+	} else if (binary->operation == Token::OP_PLUS && m_constant(binary->left, c)) {
+		operand = binary->right;
+	} else {
+		return false;
+	}
+	PNodeVariable node = dynamic_pointer_cast<NodeVariable>(operand);
+	if (!node || !m_is_tracked(*node->symbol) || c <= -max_offset || c >= max_offset) {
+		return false;
+	}
+	var = node->symbol.get();
+	offset = c;
+	return true;
+}
+
+bool RangeChecks::m_is_stable(PNodeExpression expr, const Effects& effects) {
+	int64_t value;
+	if (m_constant(expr, value)) {
+		return true;
+	}
+	if (PNodeVariable var = dynamic_pointer_cast<NodeVariable>(expr)) {
+		return m_is_tracked(*var->symbol) && !m_is_killed(*var->symbol, effects);
+	}
+	PNodeBinaryOperator binary = dynamic_pointer_cast<NodeBinaryOperator>(expr);
+	return binary &&
+	       (binary->operation == Token::OP_PLUS || binary->operation == Token::OP_MINUS || binary->operation == Token::OP_MULT) &&
+	       m_is_stable(binary->left, effects) && m_is_stable(binary->right, effects);
+}
+
+bool RangeChecks::m_leaves(PNodeStmt stmt, const NodeStmt& loop, bool with_continue) {
+	if (PNodeStmtBreak stmt_break = dynamic_pointer_cast<NodeStmtBreak>(stmt)) {
+		return stmt_break->cycle.get() == &loop;
+	}
+	if (PNodeStmtContinue stmt_continue = dynamic_pointer_cast<NodeStmtContinue>(stmt)) {
+		return with_continue && stmt_continue->cycle.get() == &loop;
+	}
+	if (PNodeExprStmtFunctionCall call = dynamic_pointer_cast<NodeExprStmtFunctionCall>(stmt)) {
+		return call->is_exit();
+	}
+	if (PNodeStmtBlock block = dynamic_pointer_cast<NodeStmtBlock>(stmt)) {
+		for (PNodeStmt s: block->stmts) {
+			if (m_leaves(s, loop, with_continue)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	if (PNodeStmtIf stmt_if = dynamic_pointer_cast<NodeStmtIf>(stmt)) {
+		return m_leaves(stmt_if->then_stmt, loop, with_continue) ||
+		       (stmt_if->else_stmt && m_leaves(stmt_if->else_stmt, loop, with_continue));
+	}
+	if (PNodeStmtWhile stmt_while = dynamic_pointer_cast<NodeStmtWhile>(stmt)) {
+		return m_leaves(stmt_while->stmt, loop, with_continue);
+	}
+	if (PNodeStmtRepeat stmt_repeat = dynamic_pointer_cast<NodeStmtRepeat>(stmt)) {
+		return m_leaves(stmt_repeat->stmt, loop, with_continue);
+	}
+	if (PNodeStmtFor stmt_for = dynamic_pointer_cast<NodeStmtFor>(stmt)) {
+		return m_leaves(stmt_for->stmt, loop, with_continue);
+	}
+	return false;
+}
+
+bool RangeChecks::m_collect(PNodeStmt stmt, const NodeStmtFor& loop, vector<Range>& ranges) {
+	const SymbolVariable& iter = *loop.iter_var->symbol;
+	if (PNodeStmtBlock block = dynamic_pointer_cast<NodeStmtBlock>(stmt)) {
+		for (PNodeStmt s: block->stmts) {
+			if (!m_collect(s, loop, ranges)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	if (PNodeStmtAssign assign = dynamic_pointer_cast<NodeStmtAssign>(stmt)) {
+		m_collect_expr(assign->right, iter, ranges);
+		m_collect_expr(assign->left, iter, ranges);
+		return true;
+	}
+	if (PNodeExprStmtFunctionCall call = dynamic_pointer_cast<NodeExprStmtFunctionCall>(stmt)) {
+		m_collect_expr(call, iter, ranges);
+		return !call->is_exit();
+	}
+	/// only the condition or the bounds of a statement run for sure
+	if (PNodeStmtIf stmt_if = dynamic_pointer_cast<NodeStmtIf>(stmt)) {
+		m_collect_expr(stmt_if->cond, iter, ranges);
+	} else if (PNodeStmtWhile stmt_while = dynamic_pointer_cast<NodeStmtWhile>(stmt)) {
+		m_collect_expr(stmt_while->cond, iter, ranges);
+	} else if (PNodeStmtFor stmt_for = dynamic_pointer_cast<NodeStmtFor>(stmt)) {
+		m_collect_expr(stmt_for->low, iter, ranges);
+		m_collect_expr(stmt_for->high, iter, ranges);
+	}
+	return !m_leaves(stmt, loop, true);
+}
+
+void RangeChecks::m_collect_expr(PNodeExpression expr, const SymbolVariable& iter, vector<Range>& ranges) {
+	if (PNodeArrayAccess access = dynamic_pointer_cast<NodeArrayAccess>(expr)) {
+		m_collect_expr(access->array, iter, ranges);
+		const vector<pair<int, int>>& bounds = dynamic_pointer_cast<SymbolTypeArray>(access->array->exprtype())->bounds;
+		for (size_t i = 0; i < bounds.size(); i++) {
+			PNodeExpression index = access->index->arglist.at(i);
+			m_collect_expr(index, iter, ranges);
+			SymbolVariable* var;
+			int64_t offset;
+			if (m_index(index, var, offset) && var == &iter) {
+				ranges.push_back({bounds[i].first - offset, bounds[i].second - offset});
+			}
+		}
+	} else if (PNodeRecordAccess access = dynamic_pointer_cast<NodeRecordAccess>(expr)) {
+		m_collect_expr(access->record, iter, ranges);
+	} else if (PNodeExprStmtFunctionCall call = dynamic_pointer_cast<NodeExprStmtFunctionCall>(expr)) {
+		if (call->args) {
+			for (PNodeExpression arg: call->args->arglist) {
+				m_collect_expr(arg, iter, ranges);
+			}
+		}
+	} else if (PNodeUnaryOperator unary = dynamic_pointer_cast<NodeUnaryOperator>(expr)) {
+		m_collect_expr(unary->node, iter, ranges);
+	} else if (PNodeBinaryOperator binary = dynamic_pointer_cast<NodeBinaryOperator>(expr)) {
+		m_collect_expr(binary->left, iter, ranges);
+		if (binary->operation != Token::OP_AND && binary->operation != Token::OP_OR) {
+			m_collect_expr(binary->right, iter, ranges);
+		}
+	}
+}
@@ -0,0 +1,81 @@
+#ifndef RANGECHECK_H
+#define RANGECHECK_H
+
+#include <map>
+#include <ostream>
+#include <set>
+#include <vector>
+#include "node.h"
+#include "asmcode.h"
+
+/// Array indexes checked against the bounds of their dimension, --range-checks.
+/// The program is analyzed once before generation. Facts are ranges of integer variables
+/// whose address is never taken: a passed check proves its index variable is in bounds until
+/// the variable may change, a FOR proves its variable is between constant bounds.
+/// Only the checks not proven are generated.
+/// An index of the iteration variable every iteration reaches is instead tested once before
+/// the first one: such a loop stops with the error before it runs if any of its iterations would.
+class RangeChecks {
+public:
+	static bool enabled;
+	static void analyze(PNodeProgram);
+	/// the index of dimension dim is tested when the access is generated
+	static bool is_checked(const NodeArrayAccess&, size_t dim);
+	/// the bounds the iteration variable is tested against when the loop is entered
+	static bool loop_test(const NodeStmtFor&, int64_t& low, int64_t& high);
+	/// no index in the body is checked, the loop test aside
+	static bool is_unchecked(const NodeStmtFor&);
+	/// RAX: index minus the low bound, jumps to the error unless below size
+	static void gen_check(AsmCode&, int64_t size, Register scratch = R9);
+	/// the error unless low <= value <= high, RAX is clobbered
+	static void gen_test(AsmCode&, Register value, int64_t low, int64_t high, Register scratch = R9);
+	/// checks kept and removed as comments of the assembly
+	static void print_stats(std::ostream&);
+private:
+	struct Range {
+		int64_t low;
+		int64_t high;
+	};
+	typedef std::map<SymbolVariable*, Range> Facts;
+	/// what may be assigned: variables, every global
+	struct Effects {
+		std::set<SymbolVariable*> vars;
+		bool globals = false;
+	};
+	static std::map<const NodeArrayAccess*, std::vector<bool>> m_checks;
+	static std::map<const NodeStmtFor*, Range> m_loop_tests;
+	static std::set<const NodeStmtFor*> m_unchecked_loops;
+	/// checks decided so far, an access reached twice counts twice
+	static int m_kept;
+
+	static void m_parts(const std::vector<PNodeStmt>&);
+	static void m_stmt(PNodeStmt, Facts&);
+	static void m_stmt_for(NodeStmtFor&, Facts&);
+	static void m_expr(PNodeExpression, Facts&);
+	static void m_access(NodeArrayAccess&, Facts&);
+	static void m_call(NodeExprStmtFunctionCall&, Facts&);
+
+	static void m_effects(PNodeStmt, Effects&);
+	static void m_expr_effects(PNodeExpression, Effects&);
+	static void m_call_effects(NodeExprStmtFunctionCall&, Effects&);
+	/// what an assignment to the lvalue changes
+	static void m_target(PNodeExpression lvalue, Effects&);
+	static void m_kill(Facts&, const Effects&);
+	static bool m_is_killed(const SymbolVariable&, const Effects&);
+
+	/// a variable with no other way to change than by its name
+	static bool m_is_tracked(const SymbolVariable&);
+	static bool m_constant(PNodeExpression, int64_t&);
+	/// var + offset, var is nullptr for a constant
+	static bool m_index(PNodeExpression, SymbolVariable*& var, int64_t& offset);
+	/// same value every time the loop evaluates it
+	static bool m_is_stable(PNodeExpression, const Effects&);
+	/// break out of the loop, continue of it or exit somewhere in the statement
+	static bool m_leaves(PNodeStmt, const NodeStmt& loop, bool with_continue);
+	/// ranges of the iteration variable required by the accesses each iteration runs into,
+	/// false after the first statement that may end the iteration
+	static bool m_collect(PNodeStmt, const NodeStmtFor&, std::vector<Range>&);
+	static void m_collect_expr(PNodeExpression, const SymbolVariable& iter, std::vector<Range>&);
+};
+
+#endif // RANGECHECK_H
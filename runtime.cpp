@@ -0,0 +1,411 @@
+#include "runtime.h"
+
+using namespace std;
+
+const std::string Runtime::write_int = "._rt_write_int";
+const std::string Runtime::write_float = "._rt_write_float";
+const std::string Runtime::write_str = "._rt_write_str";
+const std::string Runtime::write_char = "._rt_write_char";
+const std::string Runtime::flush = "._rt_flush";
+const std::string Runtime::range_error = "._rt_range_error";
+const std::string Runtime::profile_open = "._rt_profile_open";
+const std::string Runtime::profile_line = "._rt_profile_line";
+const std::string Runtime::profile_close = "._rt_profile_close";
+const std::string Runtime::buf = "._rt_buf";
+const std::string Runtime::len = "._rt_len";
+const std::string Runtime::fmt_float = "._rt_fmt_float";
+const std::string Runtime::reserve = "._rt_reserve";
+const std::string Runtime::commit = "._rt_commit";
+const std::string Runtime::utoa = "._rt_utoa";
+const std::string Runtime::range_msg = "._rt_range_msg";
+const std::string Runtime::profile_fd = "._rt_profile_fd";
+const std::string Runtime::profile_flush = "._rt_profile_flush";
+const int Runtime::buf_size = 1 << 16;
+bool Runtime::m_is_used = false;
+bool Runtime::m_is_range_error_used = false;
+bool Runtime::m_is_profile_used = false;
+
+void Runtime::gen_call(AsmCode& ac, const std::string& routine) {
+	m_is_used = true;
+	m_is_profile_used |= routine == profile_open;
+	ac << AsmCmd1{CALL, AsmLabel{routine}};
+}
+
+void Runtime::gen_jump(AsmCode& ac, Opcode opcode, const std::string& routine) {
+	m_is_used = true;
+	m_is_range_error_used |= routine == range_error;
+	ac << AsmCmd1{opcode, AsmLabel{routine}};
+}
+
+bool Runtime::is_used() {
+	return m_is_used;
+}
+
+/// ._rt_len is the number of bytes in ._rt_buf.
+/// Every write first makes room for its longest output, 28 bytes for numbers.
+/// Floats are split into integer and fraction parts and the fraction is rounded
+/// to 6 digits half to even like printf does; |x| >= 2^63, inf and nan go to snprintf.
+void Runtime::generate(AsmCode& ac) {
+	if (!m_is_used) {
+		return;
+	}
+	ac.add_data(make_shared<AsmVarBss>(buf, buf_size));
+	ac.add_data(make_shared<AsmVarInt>(len));
+	ac.add_data(make_shared<AsmVarString>(fmt_float, "%lf"));
+	m_gen_buffer(ac);
+	m_gen_utoa(ac);
+	m_gen_write(ac);
+	m_gen_write_float(ac);
+	if (m_is_range_error_used) {
+		m_gen_range_error(ac);
+	}
+	if (m_is_profile_used) {
+		m_gen_profile(ac);
+	}
+}
+
+/// data of the runtime, named like variables
+AsmOffs Runtime::m_rip(const std::string& var) {
+	return AsmOffs{AsmVar{var}, RIP};
+}
+
+/// local label of a routine
+AsmLabel Runtime::m_local(const std::string& routine, int n) {
+	return AsmLabel{routine + "." + to_string(n)};
+}
+
+void Runtime::m_gen_buffer(AsmCode& ac) {
+	m_gen_flush(ac, flush, false);
+	/// RSI: where to write
+	AsmLabel room = m_local(reserve, 1);
+	ac << AsmLabel{reserve}
+	   << AsmCmd2{MOVQ, m_rip(len), RAX}
+	   << AsmCmd2{CMPQ, (int64_t)(buf_size - 32), RAX}
+	   << AsmCmd1{JBE, room}
+	   << AsmCmd1{PUSHQ, RDI}
+	   << AsmCmd1{CALL, AsmLabel{flush}}
+	   << AsmCmd1{POPQ, RDI}
+	   << AsmCmd2{XORQ, RAX, RAX}
+	   << room
+	   << AsmCmd2{LEAQ, m_rip(buf), RSI}
+	   << AsmCmd2{ADDQ, RAX, RSI}
+	   << AsmCmd0{RET};
+	/// RSI: past the written bytes
+	ac << AsmLabel{commit}
+	   << AsmCmd2{LEAQ, m_rip(buf), RAX}
+	   << AsmCmd2{SUBQ, RAX, RSI}
+	   << AsmCmd2{MOVQ, RSI, m_rip(len)}
+	   << AsmCmd0{RET};
+}
+
+void Runtime::m_gen_flush(AsmCode& ac, const std::string& routine, bool to_profile) {
+	AsmLabel again = m_local(routine, 1), done = m_local(routine, 2);
+	ac << AsmLabel{routine}
+	   << AsmCmd2{MOVQ, m_rip(len), RDX}
+	   << AsmCmd2{LEAQ, m_rip(buf), RSI}
+	   << again
+	   << AsmCmd2{TESTQ, RDX, RDX}
+	   << AsmCmd1{JZ, done}
+	   << AsmCmd2{MOVQ, (int64_t)1, RAX};
+	if (to_profile) {
+		ac << AsmCmd2{MOVQ, m_rip(profile_fd), RDI};
+	} else {
+		ac << AsmCmd2{MOVQ, (int64_t)1, RDI};
+	}
+	ac << AsmCmd0{SYSCALL}
+	/// EINTR
+	   << AsmCmd2{CMPQ, (int64_t)-4, RAX}
+	   << AsmCmd1{JE, again}
+	   << AsmCmd2{TESTQ, RAX, RAX}
+	   << AsmCmd1{JLE, done}
+	   << AsmCmd2{ADDQ, RAX, RSI}
+	   << AsmCmd2{SUBQ, RAX, RDX}
+	   << AsmCmd1{JMP, again}
+	   << done
+	   << AsmCmd2{MOVQ, (int64_t)0, m_rip(len)}
+	   << AsmCmd0{RET};
+}
+
+/// RAX: unsigned value, RSI: output, advanced past the digits
+void Runtime::m_gen_utoa(AsmCode& ac) {
+	AsmLabel digit = m_local(utoa, 1), copy = m_local(utoa, 2);
+	/// digits go backwards into the red zone
+	ac << AsmLabel{utoa}
+	   << AsmCmd2{MOVQ, RSP, RDI}
+	   << AsmCmd2{MOVABSQ, (int64_t)0xCCCCCCCCCCCCCCCD, R8}
+	   << AsmCmd2{MOVQ, RAX, RCX}
+	   << digit;
+	m_gen_divmod10(ac);
+	ac << AsmCmd1{DECQ, RDI}
+	   << AsmCmd2{MOVB, CL, AsmOffs{RDI}}
+	   << AsmCmd2{MOVQ, RDX, RCX}
+	   << AsmCmd2{TESTQ, RCX, RCX}
+	   << AsmCmd1{JNZ, digit}
+	   << copy
+	   << AsmCmd2{MOVB, AsmOffs{RDI}, AL}
+	   << AsmCmd2{MOVB, AL, AsmOffs{RSI}}
+	   << AsmCmd1{INCQ, RSI}
+	   << AsmCmd1{INCQ, RDI}
+	   << AsmCmd2{CMPQ, RSP, RDI}
+	   << AsmCmd1{JB, copy}
+	   << AsmCmd0{RET};
+}
+
+/// RDX = RCX / 10, CL = the last digit char; R8 holds the reciprocal
+void Runtime::m_gen_divmod10(AsmCode& ac) {
+	ac << AsmCmd2{MOVQ, RCX, RAX}
+	   << AsmCmd1{MULQ, R8}
+	   << AsmCmd2{SHRQ, (int64_t)3, RDX}
+	   << AsmCmd2{LEAQ, AsmOffs{RDX, RDX, 4}, RAX}
+	   << AsmCmd2{ADDQ, RAX, RAX}
+	   << AsmCmd2{SUBQ, RAX, RCX}
+	   << AsmCmd2{ADDB, (int64_t)'0', CL};
+}
+
+void Runtime::m_gen_write(AsmCode& ac) {
+	ac << AsmLabel{write_char}
+	   << AsmCmd1{CALL, AsmLabel{reserve}}
+	   << AsmCmd2{MOVB, DIL, AsmOffs{RSI}}
+	   << AsmCmd1{INCQ, RSI}
+	   << AsmCmd1{JMP, AsmLabel{commit}};
+	/// flushes in the middle of a string longer than the room left
+	AsmLabel next = m_local(write_str, 1), store = m_local(write_str, 2);
+	ac << AsmLabel{write_str}
+	   << AsmCmd1{CALL, AsmLabel{reserve}};
+	m_gen_buf_end(ac, RDX);
+	ac << next
+	   << AsmCmd2{MOVB, AsmOffs{RDI}, CL}
+	   << AsmCmd2{TESTB, CL, CL}
+	   << AsmCmd1{JZ, AsmLabel{commit}}
+	   << AsmCmd2{CMPQ, RDX, RSI}
+	   << AsmCmd1{JB, store}
+	   << AsmCmd1{CALL, AsmLabel{commit}}
+	   << AsmCmd1{PUSHQ, RDI}
+	   << AsmCmd1{CALL, AsmLabel{flush}}
+	   << AsmCmd1{POPQ, RDI}
+	   << AsmCmd1{CALL, AsmLabel{reserve}};
+	m_gen_buf_end(ac, RDX);
+	ac << AsmCmd2{MOVB, AsmOffs{RDI}, CL}
+	   << store
+	   << AsmCmd2{MOVB, CL, AsmOffs{RSI}}
+	   << AsmCmd1{INCQ, RSI}
+	   << AsmCmd1{INCQ, RDI}
+	   << AsmCmd1{JMP, next};
+	AsmLabel positive = m_local(write_int, 1);
+	ac << AsmLabel{write_int}
+	   << AsmCmd1{CALL, AsmLabel{reserve}}
+	   << AsmCmd2{MOVQ, RDI, RAX}
+	   << AsmCmd2{TESTQ, RAX, RAX}
+	   << AsmCmd1{JNS, positive}
+	   << AsmCmd2{MOVB, (int64_t)'-', AsmOffs{RSI}}
+	   << AsmCmd1{INCQ, RSI}
+	   << AsmCmd1{NEGQ, RAX}
+	   << positive
+	   << AsmCmd1{CALL, AsmLabel{utoa}}
+	   << AsmCmd1{JMP, AsmLabel{commit}};
+}
+
+void Runtime::m_gen_buf_end(AsmCode& ac, Register reg) {
+	ac << AsmCmd2{LEAQ, m_rip(buf), reg}
+	   << AsmCmd2{ADDQ, (int64_t)buf_size, reg};
+}
+
+void Runtime::m_gen_write_float(AsmCode& ac) {
+	const string& wf = write_float;
+	AsmLabel slow{wf + ".slow"}, out{wf + ".out"};
+	AsmLabel positive = m_local(wf, 1), denormal = m_local(wf, 2), split = m_local(wf, 3), has_fraction = m_local(wf, 4),
+	         fraction = m_local(wf, 5), long_shift = m_local(wf, 6), round = m_local(wf, 7), round_up = m_local(wf, 8),
+	         digit = m_local(wf, 9);
+	ac << AsmLabel{wf}
+	   << AsmCmd1{CALL, AsmLabel{reserve}}
+	   << AsmCmd2{MOVQ, RDI, R11}
+	   << AsmCmd2{SHRQ, (int64_t)52, R11}
+	   << AsmCmd2{ANDQ, (int64_t)0x7ff, R11}
+	   << AsmCmd2{CMPQ, (int64_t)(1023 + 63), R11}
+	   << AsmCmd1{JAE, slow}
+	   << AsmCmd2{TESTQ, RDI, RDI}
+	   << AsmCmd1{JNS, positive}
+	   << AsmCmd2{MOVB, (int64_t)'-', AsmOffs{RSI}}
+	   << AsmCmd1{INCQ, RSI}
+	/// x = M * 2^-s
+	   << positive
+	   << AsmCmd2{MOVABSQ, (int64_t)0xFFFFFFFFFFFFF, R8}
+	   << AsmCmd2{ANDQ, RDI, R8}
+	   << AsmCmd2{MOVQ, (int64_t)1075, RCX}
+	   << AsmCmd2{TESTQ, R11, R11}
+	   << AsmCmd1{JZ, denormal}
+	   << AsmCmd2{BTSQ, (int64_t)52, R8}
+	   << AsmCmd2{SUBQ, R11, RCX}
+	   << AsmCmd1{JMP, split}
+	   << denormal
+	   << AsmCmd1{DECQ, RCX}
+	   << split
+	   << AsmCmd2{XORQ, R9, R9}
+	   << AsmCmd2{TESTQ, RCX, RCX}
+	   << AsmCmd1{JG, has_fraction}
+	/// integer: M << -s, no fraction
+	   << AsmCmd1{NEGQ, RCX}
+	   << AsmCmd2{SHLQ, CL, R8}
+	   << AsmCmd2{MOVQ, R8, R10}
+	   << AsmCmd1{JMP, out}
+	   << has_fraction
+	   << AsmCmd2{XORQ, R10, R10}
+	   << AsmCmd2{CMPQ, (int64_t)64, RCX}
+	   << AsmCmd1{JAE, fraction}
+	   << AsmCmd2{MOVQ, R8, R10}
+	   << AsmCmd2{SHRQ, CL, R10}
+	   << AsmCmd2{MOVQ, (int64_t)1, RAX}
+	   << AsmCmd2{SHLQ, CL, RAX}
+	   << AsmCmd1{DECQ, RAX}
+	   << AsmCmd2{ANDQ, RAX, R8}
+	/// r10 integer part, r8 fraction bits; q = round(r8 * 10^6 / 2^s)
+	   << fraction
+	   << AsmCmd2{CMPQ, (int64_t)74, RCX}
+	   << AsmCmd1{JAE, out}
+	   << AsmCmd2{MOVQ, R8, RAX}
+	   << AsmCmd2{MOVQ, (int64_t)1000000, RDX}
+	   << AsmCmd1{MULQ, RDX}
+	   << AsmCmd1{DECQ, RCX}
+	   << AsmCmd2{CMPQ, (int64_t)64, RCX}
+	   << AsmCmd1{JAE, long_shift}
+	/// t = s - 1 < 64: twice q plus the half bit, the bits below go to sticky
+	   << AsmCmd2{MOVQ, (int64_t)1, R11}
+	   << AsmCmd2{SHLQ, CL, R11}
+	   << AsmCmd1{DECQ, R11}
+	   << AsmCmd2{ANDQ, RAX, R11}
+	   << AsmCmd3{SHRDQ, CL, RDX, RAX}
+	   << AsmCmd1{JMP, round}
+	   << long_shift
+	   << AsmCmd2{SUBQ, (int64_t)64, RCX}
+	   << AsmCmd2{MOVQ, (int64_t)1, R11}
+	   << AsmCmd2{SHLQ, CL, R11}
+	   << AsmCmd1{DECQ, R11}
+	   << AsmCmd2{ANDQ, RDX, R11}
+	   << AsmCmd2{ORQ, RAX, R11}
+	   << AsmCmd2{MOVQ, RDX, RAX}
+	   << AsmCmd2{SHRQ, CL, RAX}
+	   << round
+	   << AsmCmd2{MOVQ, RAX, R9}
+	   << AsmCmd2{SHRQ, (int64_t)1, R9}
+	   << AsmCmd2{TESTQ, (int64_t)1, RAX}
+	   << AsmCmd1{JZ, out}
+	   << AsmCmd2{TESTQ, R11, R11}
+	   << AsmCmd1{JNZ, round_up}
+	   << AsmCmd2{TESTQ, (int64_t)1, R9}
+	   << AsmCmd1{JZ, out}
+	   << round_up
+	   << AsmCmd1{INCQ, R9}
+	   << AsmCmd2{CMPQ, (int64_t)1000000, R9}
+	   << AsmCmd1{JB, out}
+	   << AsmCmd2{XORQ, R9, R9}
+	   << AsmCmd1{INCQ, R10}
+	/// integer part, point and 6 digits of r9 written backwards
+	   << out
+	   << AsmCmd2{MOVQ, R10, RAX}
+	   << AsmCmd1{PUSHQ, R9}
+	   << AsmCmd1{CALL, AsmLabel{utoa}}
+	   << AsmCmd1{POPQ, RCX}
+	   << AsmCmd2{MOVB, (int64_t)'.', AsmOffs{RSI}}
+	   << AsmCmd2{LEAQ, AsmOffs{6, RSI}, RDI}
+	   << AsmCmd2{MOVABSQ, (int64_t)0xCCCCCCCCCCCCCCCD, R8}
+	   << digit;
+	m_gen_divmod10(ac);
+	ac << AsmCmd2{MOVB, CL, AsmOffs{RDI}}
+	   << AsmCmd2{MOVQ, RDX, RCX}
+	   << AsmCmd1{DECQ, RDI}
+	   << AsmCmd2{CMPQ, RSI, RDI}
+	   << AsmCmd1{JNZ, digit}
+	   << AsmCmd2{ADDQ, (int64_t)7, RSI}
+	   << AsmCmd1{JMP, AsmLabel{commit}};
+	/// snprintf into the flushed buffer on an aligned stack
+	ac << slow
+	   << AsmCmd1{PUSHQ, RDI}
+	   << AsmCmd1{CALL, AsmLabel{flush}}
+	   << AsmCmd1{POPQ, RDI}
+	   << AsmCmd1{PUSHQ, RBP}
+	   << AsmCmd2{MOVQ, RSP, RBP}
+	   << AsmCmd2{ANDQ, (int64_t)-16, RSP}
+	   << AsmCmd2{MOVQ, RDI, XMM0}
+	   << AsmCmd2{LEAQ, m_rip(buf), RDI}
+	   << AsmCmd2{MOVQ, (int64_t)buf_size, RSI}
+	   << AsmCmd2{LEAQ, m_rip(fmt_float), RDX}
+	   << AsmCmd2{MOVQ, (int64_t)1, RAX}
+	   << AsmCmd1{CALL, AsmLabel{"snprintf"}}
+	   << AsmCmd2{MOVQ, RAX, m_rip(len)}
+	   << AsmCmd2{MOVQ, RBP, RSP}
+	   << AsmCmd1{POPQ, RBP}
+	   << AsmCmd0{RET};
+}
+
+/// what was written goes out before the message
+void Runtime::m_gen_range_error(AsmCode& ac) {
+	static const string msg = "range check error";
+	ac.add_data(make_shared<AsmVarString>(range_msg, msg + "\\n"));
+	ac << AsmLabel{range_error}
+	   << AsmCmd1{CALL, AsmLabel{flush}}
+	   << AsmCmd2{MOVQ, (int64_t)1, RAX}
+	   << AsmCmd2{MOVQ, (int64_t)2, RDI}
+	   << AsmCmd2{LEAQ, m_rip(range_msg), RSI}
+	   << AsmCmd2{MOVQ, (int64_t)(msg.size() + 1), RDX}
+	   << AsmCmd0{SYSCALL}
+	/// exit_group
+	   << AsmCmd2{MOVQ, (int64_t)231, RAX}
+	   << AsmCmd2{MOVQ, (int64_t)201, RDI}
+	   << AsmCmd0{SYSCALL};
+}
+
+/// open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644); the lines are written at most 4096 bytes
+/// apart to the file, a failed open makes the writes fail and the counts are lost
+void Runtime::m_gen_profile(AsmCode& ac) {
+	ac.add_data(make_shared<AsmVarInt>(profile_fd, -1));
+	m_gen_flush(ac, profile_flush, true);
+	ac << AsmLabel{profile_open}
+	   << AsmCmd1{PUSHQ, RDI}
+	   << AsmCmd1{CALL, AsmLabel{flush}}
+	   << AsmCmd1{POPQ, RDI}
+	   << AsmCmd2{MOVQ, (int64_t)2, RAX}
+	   << AsmCmd2{MOVQ, (int64_t)(01 | 0100 | 01000), RSI}
+	   << AsmCmd2{MOVQ, (int64_t)0644, RDX}
+	   << AsmCmd0{SYSCALL}
+	   << AsmCmd2{MOVQ, RAX, m_rip(profile_fd)}
+	   << AsmCmd0{RET};
+	AsmLabel room = m_local(profile_line, 1), copy = m_local(profile_line, 2), end = m_local(profile_line, 3);
+	ac << AsmLabel{profile_line}
+	   << AsmCmd2{MOVQ, m_rip(len), RAX}
+	   << AsmCmd2{CMPQ, (int64_t)(buf_size - 4096), RAX}
+	   << AsmCmd1{JBE, room}
+	   << AsmCmd1{PUSHQ, RDI}
+	   << AsmCmd1{PUSHQ, RSI}
+	   << AsmCmd1{CALL, AsmLabel{profile_flush}}
+	   << AsmCmd1{POPQ, RSI}
+	   << AsmCmd1{POPQ, RDI}
+	   << AsmCmd2{XORQ, RAX, RAX}
+	   << room
+	/// utoa keeps R9 and R10
+	   << AsmCmd2{MOVQ, RDI, R9}
+	   << AsmCmd2{MOVQ, RSI, R10}
+	   << AsmCmd2{LEAQ, m_rip(buf), RSI}
+	   << AsmCmd2{ADDQ, RAX, RSI}
+	   << AsmCmd2{MOVQ, R10, RAX}
+	   << AsmCmd1{CALL, AsmLabel{utoa}}
+	   << AsmCmd2{MOVB, (int64_t)' ', AsmOffs{RSI}}
+	   << AsmCmd1{INCQ, RSI}
+	   << copy
+	   << AsmCmd2{MOVB, AsmOffs{R9}, CL}
+	   << AsmCmd2{TESTB, CL, CL}
+	   << AsmCmd1{JZ, end}
+	   << AsmCmd2{MOVB, CL, AsmOffs{RSI}}
+	   << AsmCmd1{INCQ, RSI}
+	   << AsmCmd1{INCQ, R9}
+	   << AsmCmd1{JMP, copy}
+	   << end
+	   << AsmCmd2{MOVB, (int64_t)'\n', AsmOffs{RSI}}
+	   << AsmCmd1{INCQ, RSI}
+	   << AsmCmd1{JMP, AsmLabel{commit}};
+	ac << AsmLabel{profile_close}
+	   << AsmCmd1{CALL, AsmLabel{profile_flush}}
+	   << AsmCmd2{MOVQ, (int64_t)3, RAX}
+	   << AsmCmd2{MOVQ, m_rip(profile_fd), RDI}
+	   << AsmCmd0{SYSCALL}
+	   << AsmCmd0{RET};
+}
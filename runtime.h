@@ -0,0 +1,55 @@
+#ifndef RUNTIME_H
+#define RUNTIME_H
+
+#include <string>
+#include "asmcode.h"
+
+/// Output library appended to the program after optimization.
+/// Everything written goes to one buffer, written out when full and on return from main.
+/// Routines take their argument in RDI and clobber the caller-saved registers like printf.
+class Runtime {
+public:
+	static const std::string write_int;   /// RDI: integer
+	static const std::string write_float; /// RDI: bits of a float, printed as %lf
+	static const std::string write_str;   /// RDI: address of a zero-terminated string
+	static const std::string write_char;  /// RDI: char code
+	static const std::string flush;
+	static const std::string range_error; /// jumped to, writes the error to stderr and exits with 201
+	/// the counts of Profile go through the buffer to a file of their own
+	static const std::string profile_open;  /// RDI: path, what was written goes out first
+	static const std::string profile_line;  /// RDI: key, RSI: count
+	static const std::string profile_close;
+	static const int buf_size;
+	static void gen_call(AsmCode&, const std::string& routine);
+	static void gen_jump(AsmCode&, Opcode, const std::string& routine);
+	static bool is_used();
+	/// routines and their data, if any was called
+	static void generate(AsmCode&);
+private:
+	static const std::string buf;
+	static const std::string len;
+	static const std::string fmt_float;
+	static const std::string reserve;
+	static const std::string commit;
+	static const std::string utoa;
+	static const std::string range_msg;
+	static const std::string profile_fd;
+	static const std::string profile_flush;
+	static bool m_is_used;
+	static bool m_is_range_error_used;
+	static bool m_is_profile_used;
+	static AsmOffs m_rip(const std::string& var);
+	static AsmLabel m_local(const std::string& routine, int n);
+	static void m_gen_buffer(AsmCode&);
+	/// writes the buffer out to stdout or to the profile
+	static void m_gen_flush(AsmCode&, const std::string& routine, bool to_profile);
+	static void m_gen_utoa(AsmCode&);
+	static void m_gen_divmod10(AsmCode&);
+	static void m_gen_write(AsmCode&);
+	static void m_gen_buf_end(AsmCode&, Register);
+	static void m_gen_write_float(AsmCode&);
+	static void m_gen_range_error(AsmCode&);
+	static void m_gen_profile(AsmCode&);
+};
+
+#endif // RUNTIME_H
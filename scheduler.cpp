@@ -0,0 +1,277 @@
+#include "scheduler.h"
+#include "asmcfg.h"
+#include <algorithm>
+
+using namespace std;
+
+const int AsmTiming::pipes[PIPES] = {4, 1, 1, 2, 1, 2};
+
+AsmTiming::AsmTiming(const AsmInstr& cmd, const AsmEffects& e) {
+	bool loads = e.read.kind != AsmOp::NONE || e.reads_any;
+	bool stores = e.write.kind != AsmOp::NONE || e.writes_any;
+	bool moves = false;
+	switch (cmd.oc()) {
+	case MOVQ: case MOVABSQ: case MOVSD: case MOVB:
+	case MOVUPD: case MOVDQU: case MOVAPD: case MOVDQA:
+	case VMOVUPD: case VMOVDQU: case VMOVAPD: case VMOVDQA:
+		moves = true;
+		break;
+	/// the stack is not a slot
+	case PUSHQ:
+		moves = stores = true;
+		break;
+	case POPQ:
+		moves = loads = true;
+		break;
+	case IMULQ: case MULQ: case SHRDQ:
+		pipe = MUL;
+		latency = 3;
+		break;
+	case IDIVQ:
+		pipe = DIV;
+		latency = 42;
+		busy = 24;
+		break;
+	case DIVSD: case DIVPD:
+		pipe = DIV;
+		latency = 14;
+		busy = 4;
+		break;
+	case VDIVPD:
+		pipe = DIV;
+		latency = 14;
+		busy = 8;
+		break;
+	case CVTSI2SD: case ADDSD: case SUBSD: case MULSD:
+	case ADDPD: case SUBPD: case MULPD: case VADDPD: case VSUBPD: case VMULPD:
+		pipe = FP;
+		latency = 4;
+		break;
+	case CVTSD2SI:
+		pipe = FP;
+		latency = 6;
+		break;
+	case COMISD: case VBROADCASTSD: case VPBROADCASTQ:
+		pipe = FP;
+		latency = 3;
+		break;
+	default:
+		break;
+	}
+	if (moves && stores) {
+		pipe = STORE;
+		latency = 1;
+	} else if (moves && loads) {
+		pipe = LOAD;
+		latency = load_latency;
+	} else if (loads) {
+		latency += load_latency;
+	}
+}
+
+bool Scheduler::enabled = false;
+
+Scheduler::Scheduler(AsmCode& a_ac) :
+	ac(a_ac), cmds(a_ac.m_commands)
+{}
+
+Scheduler::Node::Node(const AsmInstr& cmd) :
+	effects(cmd), timing(cmd, effects)
+{}
+
+int Scheduler::schedule() {
+	size_t begin = 0;
+	for (size_t i = 0; i < cmds.size(); i++) {
+		if (m_is_barrier(cmds[i], AsmEffects(cmds[i]))) {
+			m_run(begin, i);
+			begin = i + 1;
+		} else if (i + 1 - begin == max_run) {
+			m_run(begin, i + 1);
+			begin = i + 1;
+		}
+	}
+	m_run(begin, cmds.size());
+	return m_moved;
+}
+
+int64_t Scheduler::cycles_before() const {
+	return m_before;
+}
+
+int64_t Scheduler::cycles_after() const {
+	return m_after;
+}
+
+bool Scheduler::m_is_barrier(const AsmInstr& cmd, const AsmEffects& e) {
+	return cmd.kind != AsmInstr::CMD || AsmCfg::is_jump(cmd.oc()) || cmd.oc() == CALL || cmd.oc() == VZEROUPPER ||
+	       e.uses == AsmEffects::all_units;
+}
+
+void Scheduler::m_run(size_t begin, size_t end) {
+	if (end - begin < 2) {
+		return;
+	}
+	m_nodes.clear();
+	for (size_t i = begin; i < end; i++) {
+		m_nodes.emplace_back(cmds[i]);
+	}
+	m_depend();
+	vector<int> order = m_list();
+	vector<int> same(order.size());
+	for (size_t k = 0; k < same.size(); k++) {
+		same[k] = k;
+	}
+	int64_t before = m_cycles(same);
+	int64_t after = m_cycles(order);
+	m_before += before;
+	if (after >= before) {
+		m_after += before;
+		return;
+	}
+	m_after += after;
+	vector<AsmInstr> run(cmds.begin() + begin, cmds.begin() + end);
+	for (size_t k = 0; k < order.size(); k++) {
+		cmds[begin + k] = run[order[k]];
+		m_moved += order[k] != int(k);
+	}
+}
+
+/// the flags live at the end of the run, for a jump after it may read them
+void Scheduler::m_depend() {
+	const uint64_t flags = 1ull << AsmEffects::flags;
+	int n = m_nodes.size();
+	bool live = true;
+	for (int i = n - 1; i >= 0; i--) {
+		const AsmEffects& e = m_nodes[i].effects;
+		m_nodes[i].flags_live = (e.defs & flags) && live;
+		live = (live && !(e.kills & flags)) || ((e.uses | (e.defs & ~e.kills)) & flags);
+	}
+	for (int i = 0; i < n; i++) {
+		for (int j = i + 1; j < n; j++) {
+			int wait = m_latency(i, j);
+			if (wait != -1) {
+				m_nodes[i].succs.push_back({j, wait});
+				m_nodes[j].preds++;
+			}
+		}
+	}
+	for (int i = n - 1; i >= 0; i--) {
+		Node& node = m_nodes[i];
+		node.height = node.timing.latency;
+		for (const pair<int, int>& succ: node.succs) {
+			node.height = max(node.height, succ.second + m_nodes[succ.first].height);
+		}
+	}
+}
+
+/// a write only partial reads the rest of the register or of the flags
+int Scheduler::m_latency(int i, int j) {
+	const uint64_t flags = 1ull << AsmEffects::flags;
+	const AsmEffects& a = m_nodes[i].effects;
+	const AsmEffects& b = m_nodes[j].effects;
+	uint64_t a_uses = a.uses | (a.defs & ~a.kills);
+	uint64_t b_uses = b.uses | (b.defs & ~b.kills);
+	uint64_t both_defs = a.defs & b.defs;
+	if (!m_nodes[j].flags_live) {
+		both_defs &= ~flags;
+	}
+	int wait = -1;
+	if (a.defs & b_uses) {
+		wait = m_nodes[i].timing.latency;
+	} else if ((a_uses & b.defs) || both_defs) {
+		wait = 0;
+	}
+	if (m_overlap(a.write, a.writes_any, b.read, b.reads_any)) {
+		wait = max({wait, m_nodes[i].timing.latency, AsmTiming::store_forward});
+	} else if (m_overlap(a.read, a.reads_any, b.write, b.writes_any) ||
+	           m_overlap(a.write, a.writes_any, b.write, b.writes_any)) {
+		wait = max(wait, 0);
+	}
+	return wait;
+}
+
+bool Scheduler::m_overlap(const AsmOp& a, bool a_any, const AsmOp& b, bool b_any) {
+	bool has_a = a_any || a.kind != AsmOp::NONE;
+	bool has_b = b_any || b.kind != AsmOp::NONE;
+	if (!has_a || !has_b) {
+		return false;
+	}
+	return a_any || b_any || AsmEffects::slot_key(a) == AsmEffects::slot_key(b);
+}
+
+/// each cycle the ready node of the longest chain, the first of them in the run on a tie
+std::vector<int> Scheduler::m_list() {
+	int n = m_nodes.size();
+	vector<int> preds(n), ready(n, 0);
+	vector<bool> done(n, false);
+	for (int k = 0; k < n; k++) {
+		preds[k] = m_nodes[k].preds;
+	}
+	vector<vector<int>> free(AsmTiming::PIPES);
+	for (int p = 0; p < AsmTiming::PIPES; p++) {
+		free[p].assign(AsmTiming::pipes[p], 0);
+	}
+	vector<int> order;
+	int cycle = 0;
+	int issued = 0;
+	while (int(order.size()) < n) {
+		int best = -1;
+		for (int k = 0; k < n && issued < AsmTiming::width; k++) {
+			if (done[k] || preds[k] || ready[k] > cycle) {
+				continue;
+			}
+			const vector<int>& pipe = free[m_nodes[k].timing.pipe];
+			if (*min_element(pipe.begin(), pipe.end()) <= cycle &&
+			    (best == -1 || m_nodes[k].height > m_nodes[best].height)) {
+				best = k;
+			}
+		}
+		if (best == -1) {
+			cycle++;
+			issued = 0;
+			continue;
+		}
+		const Node& node = m_nodes[best];
+		vector<int>& pipe = free[node.timing.pipe];
+		*min_element(pipe.begin(), pipe.end()) = cycle + node.timing.busy;
+		done[best] = true;
+		issued++;
+		order.push_back(best);
+		for (const pair<int, int>& succ: node.succs) {
+			preds[succ.first]--;
+			ready[succ.first] = max(ready[succ.first], cycle + succ.second);
+		}
+	}
+	return order;
+}
+
+int64_t Scheduler::m_cycles(const std::vector<int>& order) {
+	vector<int> ready(m_nodes.size(), 0);
+	vector<vector<int>> free(AsmTiming::PIPES);
+	for (int p = 0; p < AsmTiming::PIPES; p++) {
+		free[p].assign(AsmTiming::pipes[p], 0);
+	}
+	int cycle = 0;
+	int issued = 0;
+	int64_t end = 0;
+	for (int k: order) {
+		const Node& node = m_nodes[k];
+		vector<int>& pipe = free[node.timing.pipe];
+		vector<int>::iterator it = min_element(pipe.begin(), pipe.end());
+		int at = max({cycle, ready[k], *it});
+		if (at == cycle && issued == AsmTiming::width) {
+			at++;
+		}
+		if (at > cycle) {
+			cycle = at;
+			issued = 0;
+		}
+		issued++;
+		*it = at + node.timing.busy;
+		end = max<int64_t>(end, at + node.timing.latency);
+		for (const pair<int, int>& succ: node.succs) {
+			ready[succ.first] = max(ready[succ.first], at + succ.second);
+		}
+	}
+	return end;
+}
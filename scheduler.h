@@ -0,0 +1,86 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <utility>
+#include <vector>
+#include "asmcode.h"
+#include "liveness.h"
+
+/// The cost of a command on the core the scheduler plans for: width commands issued a cycle in order,
+/// each when its operands are ready and a pipe of its kind is free. A load from memory takes
+/// load_latency more, a load of a slot just stored store_forward after the store.
+/// Roughly the latencies and throughputs of current x86-64 cores.
+struct AsmTiming {
+	enum Pipe : uint8_t {
+		ALU,
+		MUL,
+		DIV,
+		LOAD,
+		STORE,
+		FP,
+		PIPES,
+	};
+	/// of each kind
+	static const int pipes[PIPES];
+	static const int width = 4;
+	static const int load_latency = 5;
+	static const int store_forward = 5;
+
+	AsmTiming(const AsmInstr&, const AsmEffects&);
+	Pipe pipe = ALU;
+	/// cycles until the result may be used, cycles the pipe takes no other command
+	int latency = 1;
+	int busy = 1;
+};
+
+/// Each run of commands between labels, jumps, calls and commands of unknown effects reordered by
+/// a list scheduler to start long chains, loads, multiplications and divisions early and fill
+/// their latency with independent commands. The order keeps every dependence of AsmEffects:
+/// a register or a slot written and read, read and written, written twice, the flags as long as they
+/// are read. The new order is taken only if the model of AsmTiming runs it in fewer cycles.
+class Scheduler {
+public:
+	static bool enabled;
+	Scheduler(AsmCode&);
+	/// the number of commands placed elsewhere
+	int schedule();
+	/// estimated cycles of the runs as they were and as they are
+	int64_t cycles_before() const;
+	int64_t cycles_after() const;
+private:
+	struct Node {
+		Node(const AsmInstr&);
+		AsmEffects effects;
+		AsmTiming timing;
+		/// the nodes after it depending on it, the cycles they wait
+		std::vector<std::pair<int, int>> succs;
+		int preds = 0;
+		/// the longest chain of latencies from it to the end of the run
+		int height = 0;
+		/// the flags it writes are read after it
+		bool flags_live = false;
+	};
+	/// commands of a run scheduled at once, a longer run goes in parts
+	static const size_t max_run = 128;
+
+	static bool m_is_barrier(const AsmInstr&, const AsmEffects&);
+	/// commands [begin, end) of the code
+	void m_run(size_t begin, size_t end);
+	void m_depend();
+	/// cycles waited by j after i, -1 if it may go before i
+	int m_latency(int i, int j);
+	/// accesses of a slot or of any memory
+	static bool m_overlap(const AsmOp& a, bool a_any, const AsmOp& b, bool b_any);
+	std::vector<int> m_list();
+	/// of the commands issued in the order, until the last result
+	int64_t m_cycles(const std::vector<int>& order);
+
+	AsmCode& ac;
+	std::vector<AsmInstr>& cmds;
+	std::vector<Node> m_nodes;
+	int m_moved = 0;
+	int64_t m_before = 0;
+	int64_t m_after = 0;
+};
+
+#endif // SCHEDULER_H
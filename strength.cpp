@@ -0,0 +1,166 @@
+#include "strength.h"
+
+using namespace std;
+
+bool StrengthReducer::enabled = false;
+
+bool StrengthReducer::applies(Token::Operator op, int64_t c) {
+	uint64_t ac = c < 0 ? -(uint64_t)c : c;
+	switch (op) {
+	case Token::OP_MULT: {
+		vector<int> factors;
+		int shift;
+		if (c == 0 || ac == 1) {
+			return true;
+		}
+		/// longer chains are slower than IMUL
+		return m_mult_chain(ac, factors, shift) && factors.size() + (shift > 0) + (c < 0) <= 2;
+	}
+	case Token::OP_DIV:
+	case Token::OP_MOD:
+		/// IDIV traps on zero and on the overflow of min int by -1, keep it there
+		return c != 0 && c != -1 && ac < (1ull << 31);
+	default:
+		return false;
+	}
+}
+
+void StrengthReducer::generate(AsmCode& ac, Token::Operator op, int64_t c) {
+	if (op == Token::OP_MULT) {
+		m_gen_mult(ac, c);
+	} else {
+		m_gen_div(ac, c, op == Token::OP_MOD);
+	}
+}
+
+void StrengthReducer::m_gen_mult(AsmCode& ac, int64_t c) {
+	ac << AsmCmd1{POPQ, RAX};
+	if (c == 0) {
+		ac << AsmCmd2{XORQ, RAX, RAX}
+		   << AsmCmd1{PUSHQ, RAX};
+		return;
+	}
+	vector<int> factors;
+	int shift = 0;
+	m_mult_chain(c < 0 ? -(uint64_t)c : c, factors, shift);
+	for (int f: factors) {
+		ac << AsmCmd2{LEAQ, AsmOffs{0, RAX, RAX, f - 1}, RAX};
+	}
+	if (shift) {
+		ac << AsmCmd2{SHLQ, (int64_t)shift, RAX};
+	}
+	if (c < 0) {
+		ac << AsmCmd1{NEGQ, RAX};
+	}
+	ac << AsmCmd1{PUSHQ, RAX};
+}
+
+void StrengthReducer::m_gen_div(AsmCode& ac, int64_t d, bool is_mod) {
+	uint64_t ad = d < 0 ? -(uint64_t)d : d;
+	if (ad == 1) {
+		/// x div 1 is x, already on the stack
+		if (is_mod) {
+			ac << AsmCmd1{POPQ, RAX}
+			   << AsmCmd1{PUSHQ, (int64_t)0};
+		}
+		return;
+	}
+	int k = m_log2(ad);
+	if (k > 0) {
+		/// negative x is biased by 2^k - 1 to round toward zero
+		ac << AsmCmd1{POPQ, RAX}
+		   << AsmCmd0{CQO}
+		   << AsmCmd2{SHRQ, (int64_t)(64 - k), RDX}
+		   << AsmCmd2{ADDQ, RDX, RAX};
+		if (is_mod) {
+			ac << AsmCmd2{ANDQ, (int64_t)(ad - 1), RAX}
+			   << AsmCmd2{SUBQ, RDX, RAX};
+		} else {
+			ac << AsmCmd2{SARQ, (int64_t)k, RAX};
+			if (d < 0) {
+				ac << AsmCmd1{NEGQ, RAX};
+			}
+		}
+		ac << AsmCmd1{PUSHQ, RAX};
+		return;
+	}
+	int64_t m;
+	int shift;
+	m_magic(ad, m, shift);
+	/// q = hi(m * x) (+ x), shifted, plus one for negative q
+	ac << AsmCmd1{POPQ, R10}
+	   << AsmCmd2{MOVQ, m, RAX}
+	   << AsmCmd1{IMULQ, R10};
+	if (m < 0) {
+		ac << AsmCmd2{ADDQ, R10, RDX};
+	}
+	if (shift) {
+		ac << AsmCmd2{SARQ, (int64_t)shift, RDX};
+	}
+	ac << AsmCmd2{MOVQ, RDX, RAX}
+	   << AsmCmd2{SHRQ, (int64_t)63, RAX}
+	   << AsmCmd2{ADDQ, RDX, RAX};
+	if (is_mod) {
+		ac << AsmCmd2{IMULQ, (int64_t)ad, RAX}
+		   << AsmCmd2{SUBQ, RAX, R10}
+		   << AsmCmd1{PUSHQ, R10};
+		return;
+	}
+	if (d < 0) {
+		ac << AsmCmd1{NEGQ, RAX};
+	}
+	ac << AsmCmd1{PUSHQ, RAX};
+}
+
+bool StrengthReducer::m_mult_chain(uint64_t c, std::vector<int>& factors, int& shift) {
+	shift = 0;
+	while (c && !(c & 1)) {
+		c >>= 1;
+		shift++;
+	}
+	for (int f: {9, 5, 3}) {
+		while (c % f == 0 && factors.size() < 2) {
+			c /= f;
+			factors.push_back(f);
+		}
+	}
+	return c == 1;
+}
+
+void StrengthReducer::m_magic(uint64_t d, int64_t& m, int& shift) {
+	const uint64_t two63 = 1ull << 63;
+	uint64_t anc = two63 - 1 - two63 % d;
+	uint64_t q1 = two63 / anc, r1 = two63 - q1 * anc;
+	uint64_t q2 = two63 / d, r2 = two63 - q2 * d;
+	uint64_t delta;
+	int p = 63;
+	do {
+		p++;
+		q1 *= 2;
+		r1 *= 2;
+		if (r1 >= anc) {
+			q1++;
+			r1 -= anc;
+		}
+		q2 *= 2;
+		r2 *= 2;
+		if (r2 >= d) {
+			q2++;
+			r2 -= d;
+		}
+		delta = d - r2;
+	} while (q1 < delta || (q1 == delta && r1 == 0));
+	m = (int64_t)(q2 + 1);
+	shift = p - 64;
+}
+
+int StrengthReducer::m_log2(uint64_t x) {
+	if (x & (x - 1)) {
+		return -1;
+	}
+	int k = 0;
+	while (x >>= 1) {
+		k++;
+	}
+	return k;
+}
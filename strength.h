@@ -0,0 +1,29 @@
+#ifndef STRENGTH_H
+#define STRENGTH_H
+
+#include <vector>
+#include "asmcode.h"
+#include "token.h"
+
+/// Integer *, DIV and MOD by a constant without IMUL and IDIV.
+/// Multiplication goes to LEA and shifts, division by a power of two to shifts
+/// rounded toward zero, other divisors to multiplication by a magic reciprocal
+/// (Hacker's Delight, 10-1). Results are the same as of IMUL and IDIV.
+class StrengthReducer {
+public:
+	static bool enabled;
+	/// operation with constant right operand c has a cheaper form
+	static bool applies(Token::Operator, int64_t c);
+	/// left operand on top of the stack, the result is pushed
+	static void generate(AsmCode&, Token::Operator, int64_t c);
+private:
+	static void m_gen_mult(AsmCode&, int64_t c);
+	static void m_gen_div(AsmCode&, int64_t d, bool is_mod);
+	/// c = factors (3, 5 or 9) * 2^shift
+	static bool m_mult_chain(uint64_t c, std::vector<int>& factors, int& shift);
+	static void m_magic(uint64_t d, int64_t& m, int& shift);
+	/// -1 if not a power of two
+	static int m_log2(uint64_t);
+};
+
+#endif // STRENGTH_H
@@ -1,11 +1,10 @@
 #include "symbol.h"
 #include "symboltable.h"
+#include "runtime.h"
 
 using namespace std;
 
 bool Symbol::use_strict;
-std::string SymbolTypeInt::fml_label = "._fmt_int_";
-std::string SymbolTypeFloat::fml_label = "._fmt_float_";
 
 uint64_t SymbolType::counter = 0;
 
@@ -107,7 +106,7 @@ SymbolTypePointer::SymbolTypePointer(PSymbolType type) :
 }
 
 SymbolVariable::SymbolVariable(const std::string& a_name, PSymbolType type) :
-    Symbol(a_name), type(type) {
+    Symbol(a_name), type(type), label(a_name) {
 }
 
 SymbolConst::SymbolConst(const std::string& a_name, PSymbolType type) :
@@ -190,6 +189,71 @@ SymbolProcedure::SymbolProcedure(const std::string& a_name) :
 	locals = make_shared<SymTable>();
 }
 
+void SymbolProcedure::layout_frame() {
+	/// in declaration order down from RBP, each in whole quads
+	int64_t offs = 0;
+	for (PSymbol sym: *this->locals) {
+		PSymbolVariable var = dynamic_pointer_cast<SymbolVariable>(sym);
+		if (!var || dynamic_pointer_cast<SymbolConst>(sym)) {
+			continue;
+		}
+		offs += var->is_var ? 8 : (var->size() + 7) / 8 * 8;
+		var->is_local = true;
+		var->offset = -offs;
+	}
+	this->frame_size = (offs + 15) / 16 * 16;
+}
+
+bool SymbolProcedure::is_float_arg(size_t n) const {
+	PSymbolVariable formal;
+	(*this->params)[n] >> formal;
+	return !this->is_nth_var.at(n) && dynamic_pointer_cast<SymbolTypeFloat>(formal->type);
+}
+
+bool SymbolProcedure::arg_location(size_t n, Register& reg, int64_t& slot) const {
+	static const vector<Register> int_regs = {RDI, RSI, RDX, RCX, R8, R9};
+	static const vector<Register> float_regs = {XMM0, XMM1, XMM2, XMM3, XMM4, XMM5, XMM6, XMM7};
+	size_t ints = 0, floats = 0;
+	slot = 0;
+	for (size_t i = 0; i <= n; i++) {
+		bool is_float = is_float_arg(i);
+		size_t& used = is_float ? floats : ints;
+		const vector<Register>& regs = is_float ? float_regs : int_regs;
+		bool in_reg = used < regs.size();
+		if (i == n) {
+			if (in_reg) {
+				reg = regs[used];
+			}
+			return in_reg;
+		}
+		if (in_reg) {
+			used++;
+		} else {
+			slot++;
+		}
+	}
+	return false;
+}
+
+int64_t SymbolProcedure::stack_args() const {
+	int64_t result = 0;
+	for (size_t i = 0; i < this->is_nth_var.size(); i++) {
+		Register reg;
+		int64_t slot;
+		result += !arg_location(i, reg, slot);
+	}
+	return result;
+}
+
+void SymbolProcedure::rebase_frame(int64_t delta) {
+	for (PSymbol sym: *this->locals) {
+		PSymbolVariable var = dynamic_pointer_cast<SymbolVariable>(sym);
+		if (var && var->is_local) {
+			var->offset += delta;
+		}
+	}
+}
+
 SymbolFunction::SymbolFunction(const std::string& a_name) :
     SymbolProcedure(a_name) {
 }
@@ -202,6 +266,27 @@ uint SymbolVariable::size() const {
 	return type->size();
 }
 
+AsmOp SymbolVariable::storage() const {
+	if (is_local) {
+		return AsmOffs{offset, RBP};
+	}
+	return AsmVar{label};
+}
+
+void SymbolVariable::gen_bind(AsmCode& ac) const {
+	if (is_var || !(dynamic_pointer_cast<SymbolTypeArray>(type) || dynamic_pointer_cast<SymbolTypeRecord>(type))) {
+		ac << AsmCmd1{POPQ, storage()};
+		return;
+	}
+	/// arrays and records are passed by address and copied here
+	ac << AsmCmd1{POPQ, RSI}
+	   << AsmCmd2{LEAQ, storage(), RDI};
+	for (int64_t offs = 0; offs + 8 <= type->size(); offs += 8) {
+		ac << AsmCmd2{MOVQ, AsmOffs{offs, RSI}, RAX}
+		   << AsmCmd2{MOVQ, RAX, AsmOffs{offs, RDI}};
+	}
+}
+
 uint SymbolTypePointer::size() const {
 	return 8;
 }
@@ -238,17 +323,13 @@ void SymbolType::gen_write(AsmCode&) {}
 void SymbolType::gen_declare(AsmCode&, const string&) {}
 
 void SymbolTypeInt::gen_write(AsmCode& ac) {
-	ac << AsmCmd2{LEAQ, AsmVar{SymbolTypeInt::fml_label}, RDI}
-	   << AsmCmd1{POPQ, RSI}
-	   << AsmCmd1{CALL, PRINTF};
+	ac << AsmCmd1{POPQ, RDI};
+	Runtime::gen_call(ac, Runtime::write_int);
 }
 
 void SymbolTypeFloat::gen_write(AsmCode& ac) {
-	ac << AsmCmd2{LEAQ, AsmVar{SymbolTypeFloat::fml_label}, RDI}
-	   << AsmCmd1{POPQ, RAX}
-	   << AsmCmd2{MOVQ, RAX, XMM0}
-	   << AsmCmd2{MOVQ, (int64_t)1, RAX}
-	   << AsmCmd1{CALL, PRINTF};
+	ac << AsmCmd1{POPQ, RDI};
+	Runtime::gen_call(ac, Runtime::write_float);
 }
 
 void SymbolTypeRecord::gen_declare(AsmCode& ac, const std::string& a_name) {
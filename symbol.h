@@ -31,6 +31,19 @@ public:
 	std::string output_str() const override;
 	PSymbolType type;
 	uint size() const override;
+	/// pops an argument pushed by the caller into the parameter storage
+	void gen_bind(AsmCode&) const;
+	/// VAR parameter, its storage holds the address of the argument
+	bool is_var = false;
+	/// name of the storage of a global
+	std::string label;
+	/// procedure variable or parameter, kept in the stack frame at offset(%rbp)
+	bool is_local = false;
+	int64_t offset = 0;
+	/// address is taken with @
+	bool is_addressed = false;
+	/// memory operand of the storage
+	AsmOp storage() const;
 };
 
 class SymbolConst : public SymbolVariable {
@@ -93,7 +106,6 @@ public:
 	uint size() const override;
 	void gen_write(AsmCode&) override;
 	void gen_declare(AsmCode&, const std::string&) override;
-	static std::string fml_label;
 
 	void gen_typecast(AsmCode&, PSymbolType) const override;
 	void gen_typecast(AsmCode&, const SymbolTypeFloat&) const override; /// float to int
@@ -105,7 +117,6 @@ public:
 class SymbolTypeFloat : public SymbolType {
 public:
 	SymbolTypeFloat(const std::string& name);
-	static std::string fml_label;
 	void gen_write(AsmCode&) override;
 	void gen_declare(AsmCode&, const std::string&) override;
 	uint size() const override;
@@ -202,6 +213,18 @@ public:
 	PSymTable params;
 	PSymTable locals;
 	std::vector<bool> is_nth_var;
+	bool is_inline = false;
+	/// bytes of variables and parameters below RBP
+	int64_t frame_size = 0;
+	/// places variables and parameters in the frame
+	void layout_frame();
+	/// moves them by delta bytes, for a copy of the body in another frame
+	void rebase_frame(int64_t delta);
+	/// System V: the n-th argument comes in reg or, if false, in the n-th quad above the return address
+	bool arg_location(size_t n, Register& reg, int64_t& slot) const;
+	int64_t stack_args() const;
+	/// passed in an XMM register
+	bool is_float_arg(size_t n) const;
 };
 
 class SymbolFunction : public SymbolProcedure {
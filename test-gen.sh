@@ -10,16 +10,53 @@ for filename in $test_dir/*.in; do
 	answer=$test_dir/$(basename "$filename" .in).std
 	output=$test_dir/$(basename "$filename" .in).out
 	opt_output=$test_dir/$(basename "$filename" .in).opt.out
+	opt_stats=$test_dir/$(basename "$filename" .in).opt.json
 	executable=$test_dir/$(basename "$filename" .in).exe
 	opt_executable=$test_dir/$(basename "$filename" .in).opt.exe
+	object=$test_dir/$(basename "$filename" .in).o
+	obj_output=$test_dir/$(basename "$filename" .in).obj.out
+	obj_executable=$test_dir/$(basename "$filename" .in).obj.exe
+	run_output=$test_dir/$(basename "$filename" .in).run.out
+	stream_asm=$test_dir/$(basename "$filename" .in).stream.s
+	stream_executable=$test_dir/$(basename "$filename" .in).stream.exe
+	stream_output=$test_dir/$(basename "$filename" .in).stream.out
+	interp_output=$test_dir/$(basename "$filename" .in).interp.out
+	ssa_output=$test_dir/$(basename "$filename" .in).ssa.out
+	range_answer=$test_dir/$(basename "$filename" .in).range.out
+	range_output=$test_dir/$(basename "$filename" .in).range.run.out
+	profile_answer=$test_dir/$(basename "$filename" .in).prof.out
+	profile=$test_dir/$(basename "$filename" .in).prof.run.out
+	profile_output=$test_dir/$(basename "$filename" .in).prof.opt.out
 
 	{ $script_dir/compiler -S $filename >$asm          || { echo "$dots pascal compilation failed"     && false; }; }  &&
-	{ $script_dir/compiler -S -O $filename -o $opt_asm || { echo "$dots pascal compilation failed"     && false; }; }  &&
+	{ $script_dir/compiler -S -O --opt-stats=$opt_stats $filename -o $opt_asm || { echo "$dots pascal compilation failed" && false; }; }  &&
+	{ { ! grep -q '"patterns": \[\]' $opt_stats && rm $opt_stats ;} || { echo "$dots opt stats have a rule without patterns" && false; }; }  &&
 	{ clang $asm -o $executable                        || { echo "$dots asm compilation failed"        && false; }; }  &&
 	{ clang $opt_asm -o $opt_executable                || { echo "$dots opt_asm compilation failed"    && false; }; }  &&
+	{ $script_dir/compiler -c -O $filename -o $object  || { echo "$dots object generation failed"      && false; }; }  &&
+	{ clang $object -o $obj_executable                 || { echo "$dots object linking failed"         && false; }; }  &&
 	{ $executable >$output                             || { echo "$dots execution failed"              && false; }; }  &&
 	{ $opt_executable >$opt_output                     || { echo "$dots opt_execution failed"          && false; }; }  &&
+	{ $obj_executable >$obj_output                     || { echo "$dots obj_execution failed"          && false; }; }  &&
+	{ { diff $opt_output $obj_output && rm $obj_output ;} || { echo "$dots object outputs are different" && false; }; }  &&
+	{ $script_dir/compiler -S -O --stream $filename -o $stream_asm >/dev/null &&
+	  clang $stream_asm -o $stream_executable && $stream_executable >$stream_output || { echo "$dots stream failed" && false; }; }  &&
+	{ { diff $opt_output $stream_output && rm $stream_asm $stream_executable $stream_output ;} || { echo "$dots stream outputs are different" && false; }; }  &&
+	{ $script_dir/compiler --run -O $filename >$run_output || { echo "$dots run failed"               && false; }; }  &&
+	{ { diff $opt_output $run_output && rm $run_output ;} || { echo "$dots run outputs are different"  && false; }; }  &&
+	{ $script_dir/compiler --interpret $filename >$interp_output || { echo "$dots interpretation failed" && false; }; }  &&
+	{ { diff $opt_output $interp_output && rm $interp_output ;} || { echo "$dots interpreted outputs are different" && false; }; }  &&
+	{ $script_dir/compiler --run -O --ssa $filename >$ssa_output || { echo "$dots ssa run failed"        && false; }; }  &&
+	{ { diff $opt_output $ssa_output && rm $ssa_output ;} || { echo "$dots ssa outputs are different"     && false; }; }  &&
+	{ [ ! -f $range_answer ] || { $script_dir/compiler --run -O --range-checks $filename >$range_output ;
+	  $script_dir/compiler --run -O --ssa --range-checks $filename >>$range_output ;
+	  diff <(cat $range_answer $range_answer) $range_output && rm $range_output ;} || { echo "$dots range check outputs are different" && false; }; }  &&
+	{ [ ! -f $profile_answer ] || { profile_ok=true; for ssa in "" --ssa; do
+	  $script_dir/compiler --run $ssa --profile-generate=$profile $filename >/dev/null &&
+	  diff <(sort $profile_answer) <(sort $profile) &&
+	  $script_dir/compiler --run -O $ssa --profile-use=$profile $filename >$profile_output &&
+	  diff $opt_output $profile_output || profile_ok=false; done; $profile_ok && rm $profile $profile_output ;} || { echo "$dots profile outputs are different" && false; }; }  &&
 	{ { diff $output $opt_output && rm $output ;}      || { echo "$dots outputs are different"         && false; }; }  &&
-	{ { rm $executable && rm $opt_executable ;}        || { echo "$dots rm executable failed"          && false; }; }  
+	{ { rm $executable $opt_executable $object $obj_executable ;} || { echo "$dots rm executable failed" && false; }; }  
 	# diff $asm $opt_asm
 done
@@ -0,0 +1,1222 @@
+	.globl main
+.data
+	.__I: .quad 0
+.data
+	.__J: .quad 0
+.data
+	.__X: .double 0
+.data
+	.__V: .fill 24,1,0
+.__.str0:
+	.string " "
+.__.str1:
+	.string " "
+.__.str2:
+	.string " "
+	.lcomm .__._rt_buf, 65536
+.data
+	.__._rt_len: .quad 0
+.__._rt_fmt_float:
+	.string "%lf"
+.text
+main:
+	movq	$1, %rax
+	pushq	%rbp
+	cvtsi2sd	%rax, %xmm0
+	movq	%rsp, %rbp
+	subq	$128, %rsp
+	movq	$1, -8(%rbp)
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	$8, %rax
+	cvtsi2sd	%rax, %xmm0
+	popq	%rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	divsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	$1, %rax
+	cvtsi2sd	%rax, %xmm0
+	pushq	$6
+	pushq	$5
+	pushq	$4
+	pushq	$3
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	$4, %rax
+	cvtsi2sd	%rax, %xmm0
+	popq	%rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	divsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	$1, %rax
+	cvtsi2sd	%rax, %xmm0
+	pushq	$2
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	$2, %rax
+	cvtsi2sd	%rax, %xmm0
+	popq	%rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	popq	-24(%rbp)
+	divsd	%xmm1, %xmm0
+	popq	-32(%rbp)
+	popq	-40(%rbp)
+	popq	-48(%rbp)
+	popq	-56(%rbp)
+	popq	-64(%rbp)
+	popq	-72(%rbp)
+	movq	%xmm0, %rax
+	movq	%rax, -16(%rbp)
+	movq	-8(%rbp), %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	-16(%rbp), %r10
+	movq	%xmm0, %rax
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	-24(%rbp), %rax
+	cvtsi2sd	%rax, %xmm0
+	popq	%rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	movq	-32(%rbp), %r10
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	movq	%r10, %xmm1
+	movq	%rax, %xmm0
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	-40(%rbp), %rax
+	cvtsi2sd	%rax, %xmm0
+	popq	%rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	-48(%rbp), %rax
+	cvtsi2sd	%rax, %xmm0
+	popq	%rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	-56(%rbp), %rax
+	cvtsi2sd	%rax, %xmm0
+	popq	%rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	-64(%rbp), %rax
+	cvtsi2sd	%rax, %xmm0
+	popq	%rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	movq	-72(%rbp), %r10
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	movq	%r10, %xmm1
+	movq	%rax, %xmm0
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	jmp	..L17
+..L17:
+	movq	%rax, %rdi
+	call	._rt_write_float
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	$1, -8(%rbp)
+	movq	$2, -16(%rbp)
+	movq	$3, -24(%rbp)
+	movq	$4, -32(%rbp)
+	movq	$5, -40(%rbp)
+	movq	-8(%rbp), %rax
+	movq	$6, -48(%rbp)
+	movq	-16(%rbp), %r10
+	movq	$7, -56(%rbp)
+	movq	$8, -64(%rbp)
+	subq	%r10, %rax
+	addq	-24(%rbp), %rax
+	subq	-32(%rbp), %rax
+	addq	-40(%rbp), %rax
+	subq	-48(%rbp), %rax
+	addq	-56(%rbp), %rax
+	pushq	%rax
+	movq	-64(%rbp), %rax
+	shlq	$1, %rax
+	movq	%rax, %r10
+	popq	%rax
+	subq	%r10, %rax
+	jmp	..L18
+..L18:
+	movq	%rax, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	$10, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	$9, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	$8, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	$7, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	$6, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	$5, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	$4, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	$3, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	$2, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	$1, %rax
+	cvtsi2sd	%rax, %xmm0
+	popq	%rax
+	movq	%rax, %xmm1
+	popq	%rax
+	movq	%rax, %xmm2
+	popq	%rax
+	movq	%rax, %xmm3
+	popq	%rax
+	movq	%rax, %xmm4
+	popq	%rax
+	movq	%rax, %xmm5
+	popq	%rax
+	movq	%rax, %xmm6
+	popq	%rax
+	movq	%rax, %xmm7
+	call	.__REALS
+	addq	$16, %rsp
+	movq	%xmm0, %rdi
+	call	._rt_write_float
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	$3, %rax
+	movq	$0, .__J
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm0, %rax
+	addq	$1, .__J
+	pushq	%rax
+	movq	$2, %rax
+	cvtsi2sd	%rax, %xmm0
+	popq	%rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	divsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	movq	%rax, .__X
+	movq	$4, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm0, %rax
+	movq	%rax, %r10
+	movq	.__X, %rax
+	movq	%r10, %xmm1
+	movq	%rax, %xmm0
+	mulsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	movq	%rax, .__X
+..L19:
+	movq	$1, %rax
+	addq	$1, .__J
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	$2, %rax
+	cvtsi2sd	%rax, %xmm0
+	popq	%rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	divsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	movq	%rax, -16(%rbp)
+	movq	%rax, %r10
+	movq	.__X, %rax
+	movq	%r10, %xmm1
+	movq	%rax, %xmm0
+	mulsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	movq	%rax, .__X
+..L20:
+	movq	%rax, %rdi
+	call	._rt_write_float
+	leaq	.__.str0, %rdi
+	call	._rt_write_str
+	movq	.__J, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	$1, %rax
+	xorq	%rcx, %rcx
+	leaq	-24(%rbp), %rdi
+	movq	$3, %r13
+	cvtsi2sd	%rax, %xmm0
+	imulq	$8, %rcx
+	movq	%xmm0, %rax
+	pushq	%rax
+	leaq	.__V, %rax
+	popq	(%rax,%rcx,1)
+	movq	$2, %rax
+	movq	$1, %rcx
+	cvtsi2sd	%rax, %xmm0
+	imulq	$8, %rcx
+	movq	%xmm0, %rax
+	pushq	%rax
+	leaq	.__V, %rax
+	popq	(%rax,%rcx,1)
+	movq	$4, %rax
+	movq	$2, %rcx
+	cvtsi2sd	%rax, %xmm0
+	imulq	$8, %rcx
+	movq	%xmm0, %rax
+	pushq	%rax
+	leaq	.__V, %rax
+	popq	(%rax,%rcx,1)
+	leaq	.__V, %rax
+	movq	%rax, %rsi
+	movq	(%rsi), %rax
+	movq	%rax, (%rdi)
+	movq	8(%rsi), %rax
+	movq	%rax, 8(%rdi)
+	movq	16(%rsi), %rax
+	movq	%rax, 16(%rdi)
+	xorq	%rax, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	$1, -32(%rbp)
+	movq	%xmm0, %rax
+	movq	%rax, -48(%rbp)
+	leaq	-40(%rbp), %rax
+	movq	%rax, %r14
+	pushq	-32(%rbp)
+	popq	(%r14)
+	cmpq	(%r14), %r13
+	jl	..L23
+..L22:
+	leaq	-24(%rbp), %rax
+	pushq	-48(%rbp)
+	pushq	%rax
+	movq	-40(%rbp), %rax
+	popq	%r10
+	subq	$1, %rax
+	movq	%rax, %r12
+	popq	%rax
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	movq	%rax, -48(%rbp)
+..L24:
+	movq	-40(%rbp), %r13
+	movq	$3, %r14
+	cmpq	%r13, %r14
+	jle	..L23
+	leaq	-40(%rbp), %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L22
+..L23:
+	movq	$100, %rax
+	xorq	%rcx, %rcx
+	cvtsi2sd	%rax, %xmm0
+	imulq	$8, %rcx
+	movq	%xmm0, %rax
+	pushq	%rax
+	leaq	-24(%rbp), %rax
+	popq	(%rax,%rcx,1)
+	movq	-48(%rbp), %rax
+	jmp	..L21
+..L21:
+	movq	%rax, %rdi
+	call	._rt_write_float
+	leaq	.__.str1, %rdi
+	call	._rt_write_str
+	leaq	.__V, %rax
+	leaq	-24(%rbp), %rdi
+	movq	$3, %r13
+	movq	%rax, %rsi
+	movq	(%rsi), %rax
+	movq	%rax, (%rdi)
+	movq	8(%rsi), %rax
+	movq	%rax, 8(%rdi)
+	movq	16(%rsi), %rax
+	movq	%rax, 16(%rdi)
+	xorq	%rax, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	$2, -32(%rbp)
+	movq	%xmm0, %rax
+	movq	%rax, -48(%rbp)
+	leaq	-40(%rbp), %rax
+	movq	%rax, %r14
+	pushq	-32(%rbp)
+	popq	(%r14)
+	cmpq	(%r14), %r13
+	jl	..L27
+..L26:
+	leaq	-24(%rbp), %rax
+	pushq	-48(%rbp)
+	pushq	%rax
+	movq	-40(%rbp), %rax
+	popq	%r10
+	subq	$1, %rax
+	movq	%rax, %r12
+	popq	%rax
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	movq	%rax, -48(%rbp)
+..L28:
+	movq	-40(%rbp), %r13
+	movq	$3, %r14
+	cmpq	%r13, %r14
+	jle	..L27
+	leaq	-40(%rbp), %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L26
+..L27:
+	movq	$100, %rax
+	xorq	%rcx, %rcx
+	cvtsi2sd	%rax, %xmm0
+	imulq	$8, %rcx
+	movq	%xmm0, %rax
+	pushq	%rax
+	leaq	-24(%rbp), %rax
+	popq	(%rax,%rcx,1)
+	movq	-48(%rbp), %rax
+	jmp	..L25
+..L25:
+	movq	%rax, %rdi
+	call	._rt_write_float
+	leaq	.__.str2, %rdi
+	call	._rt_write_str
+	leaq	.__V, %rax
+	xorq	%r12, %r12
+	imulq	$8, %r12
+	movq	%rax, %r10
+	movq	(%r10,%r12,1), %rdi
+	call	._rt_write_float
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	$8, -8(%rbp)
+	movq	$7, -16(%rbp)
+	movq	$6, -24(%rbp)
+	movq	$5, -32(%rbp)
+	movq	$4, -40(%rbp)
+	movq	-8(%rbp), %rax
+	movq	$3, -48(%rbp)
+	movq	-16(%rbp), %r10
+	movq	$2, -56(%rbp)
+	movq	$1, -64(%rbp)
+	subq	%r10, %rax
+	addq	-24(%rbp), %rax
+	subq	-32(%rbp), %rax
+	addq	-40(%rbp), %rax
+	subq	-48(%rbp), %rax
+	addq	-56(%rbp), %rax
+	pushq	%rax
+	movq	-64(%rbp), %rax
+	shlq	$1, %rax
+	movq	%rax, %r10
+	popq	%rax
+	subq	%r10, %rax
+	jmp	..L30
+..L30:
+	movq	$1, -8(%rbp)
+	movq	$1, -16(%rbp)
+	pushq	%rax
+	movq	$1, -24(%rbp)
+	movq	$1, -32(%rbp)
+	movq	-8(%rbp), %rax
+	movq	$1, -40(%rbp)
+	movq	-16(%rbp), %r10
+	movq	$1, -48(%rbp)
+	movq	$1, -56(%rbp)
+	pushq	$7
+	movq	$1, -64(%rbp)
+	pushq	$6
+	subq	%r10, %rax
+	pushq	$5
+	addq	-24(%rbp), %rax
+	pushq	$4
+	pushq	$3
+	pushq	$2
+	subq	-32(%rbp), %rax
+	addq	-40(%rbp), %rax
+	subq	-48(%rbp), %rax
+	addq	-56(%rbp), %rax
+	pushq	%rax
+	movq	-64(%rbp), %rax
+	shlq	$1, %rax
+	movq	%rax, %r10
+	popq	%rax
+	subq	%r10, %rax
+	jmp	..L31
+..L31:
+	popq	-16(%rbp)
+	popq	-24(%rbp)
+	movq	%rax, -8(%rbp)
+	popq	-32(%rbp)
+	popq	-40(%rbp)
+	movq	-16(%rbp), %r10
+	popq	-48(%rbp)
+	popq	-56(%rbp)
+	popq	-64(%rbp)
+	subq	%r10, %rax
+	addq	-24(%rbp), %rax
+	subq	-32(%rbp), %rax
+	addq	-40(%rbp), %rax
+	subq	-48(%rbp), %rax
+	addq	-56(%rbp), %rax
+	pushq	%rax
+	movq	-64(%rbp), %rax
+	shlq	$1, %rax
+	movq	%rax, %r10
+	popq	%rax
+	subq	%r10, %rax
+	jmp	..L29
+..L29:
+	movq	%rax, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	$0, -56(%rbp)
+	xorq	%r11, %r11
+	movq	$5, -64(%rbp)
+	movq	$0, -48(%rbp)
+	movq	$0, -40(%rbp)
+	movq	$0, -32(%rbp)
+	movq	-56(%rbp), %rax
+	movq	$0, -24(%rbp)
+	movq	-64(%rbp), %r10
+	movq	$1, -16(%rbp)
+	movq	$10000, -8(%rbp)
+	addq	%r10, %rax
+	pushq	%rax
+	xorq	%rax, %rax
+	pushq	-48(%rbp)
+	pushq	-40(%rbp)
+	pushq	-32(%rbp)
+	pushq	-24(%rbp)
+	pushq	-16(%rbp)
+	pushq	-8(%rbp)
+	popq	-72(%rbp)
+	popq	-80(%rbp)
+	popq	-88(%rbp)
+	popq	-96(%rbp)
+	popq	-104(%rbp)
+	movq	-72(%rbp), %rdx
+	popq	-112(%rbp)
+	popq	-120(%rbp)
+	cmpq	%r11, %rdx
+	sete	%al
+	testq	%rax, %rax
+	jz	..L34
+	movq	-120(%rbp), %rax
+	jmp	..L33
+	jmp	..L35
+..L34:
+..L35:
+	movq	-80(%rbp), %r10
+	movq	-120(%rbp), %rax
+	movq	-88(%rbp), %rdx
+	movq	-96(%rbp), %rcx
+	movq	-104(%rbp), %r8
+	movq	-112(%rbp), %r9
+	addq	%r10, %rax
+	movq	%r10, %rsi
+	pushq	%rax
+	movq	-72(%rbp), %rax
+	subq	$1, %rax
+	movq	%rax, %rdi
+	call	.__DOWN
+	addq	$8, %rsp
+	jmp	..L33
+..L33:
+	jmp	..L32
+..L32:
+	movq	%rax, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	call	._rt_flush
+	movq	%rbp, %rsp
+	popq	%rbp
+	xorq	%rax, %rax
+	ret
+.__MIX:
+	pushq	%rbp
+	movq	%rdi, %rax
+	movq	%rsp, %rbp
+	subq	$80, %rsp
+	movq	%xmm0, -16(%rbp)
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm1, -32(%rbp)
+	movq	%xmm2, -72(%rbp)
+	movq	%rdi, -8(%rbp)
+	movq	%xmm0, %rax
+	movq	%rsi, -24(%rbp)
+	movq	-16(%rbp), %r10
+	movq	%rax, %xmm0
+	movq	%rdx, -40(%rbp)
+	movq	%rcx, -48(%rbp)
+	movq	%r8, -56(%rbp)
+	movq	%r9, -64(%rbp)
+	movq	%r10, %xmm1
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	%rsi, %rax
+	cvtsi2sd	%rax, %xmm0
+	popq	%rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	movq	-32(%rbp), %r10
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	movq	%r10, %xmm1
+	movq	%rax, %xmm0
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	%rdx, %rax
+	cvtsi2sd	%rax, %xmm0
+	popq	%rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	%rcx, %rax
+	cvtsi2sd	%rax, %xmm0
+	popq	%rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	%r8, %rax
+	cvtsi2sd	%rax, %xmm0
+	popq	%rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	%r9, %rax
+	cvtsi2sd	%rax, %xmm0
+	popq	%rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	movq	-72(%rbp), %r10
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	movq	%r10, %xmm1
+	movq	%rax, %xmm0
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	jmp	..L1
+..L1:
+	movq	%rax, %xmm0
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+.__MANY:
+	pushq	%rbp
+	movq	%rsi, %r10
+	movq	%rdi, %rax
+	movq	%rsp, %rbp
+	subq	$64, %rsp
+	subq	%r10, %rax
+	pushq	16(%rbp)
+	addq	%rdx, %rax
+	popq	-56(%rbp)
+	subq	%rcx, %rax
+	addq	%r8, %rax
+	pushq	24(%rbp)
+	subq	%r9, %rax
+	popq	-64(%rbp)
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	addq	-56(%rbp), %rax
+	movq	%rdx, -24(%rbp)
+	movq	%rcx, -32(%rbp)
+	movq	%r8, -40(%rbp)
+	movq	%r9, -48(%rbp)
+	pushq	%rax
+	movq	-64(%rbp), %rax
+	shlq	$1, %rax
+	movq	%rax, %r10
+	popq	%rax
+	subq	%r10, %rax
+	jmp	..L2
+..L2:
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+.__REALS:
+	pushq	%rbp
+	movq	$2, %rax
+	movq	%rsp, %rbp
+	subq	$80, %rsp
+	movq	%xmm1, -16(%rbp)
+	movq	%xmm0, -8(%rbp)
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm2, -24(%rbp)
+	pushq	16(%rbp)
+	popq	-72(%rbp)
+	movq	-16(%rbp), %rax
+	movq	%xmm0, %r10
+	pushq	24(%rbp)
+	movq	%r10, %xmm1
+	popq	-80(%rbp)
+	movq	%xmm3, -32(%rbp)
+	movq	%xmm4, -40(%rbp)
+	movq	%xmm5, -48(%rbp)
+	movq	%rax, %xmm0
+	movq	-8(%rbp), %rax
+	movq	%xmm6, -56(%rbp)
+	mulsd	%xmm1, %xmm0
+	movq	%xmm7, -64(%rbp)
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	$3, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	-24(%rbp), %rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	popq	%rax
+	mulsd	%xmm1, %xmm0
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	movq	-32(%rbp), %r10
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	movq	%r10, %xmm1
+	movq	-40(%rbp), %r10
+	movq	%rax, %xmm0
+	addsd	%xmm1, %xmm0
+	movq	%r10, %xmm1
+	movq	-48(%rbp), %r10
+	movq	%xmm0, %rax
+	movq	%rax, %xmm0
+	addsd	%xmm1, %xmm0
+	movq	%r10, %xmm1
+	movq	-56(%rbp), %r10
+	movq	%xmm0, %rax
+	movq	%rax, %xmm0
+	addsd	%xmm1, %xmm0
+	movq	%r10, %xmm1
+	movq	-64(%rbp), %r10
+	movq	%xmm0, %rax
+	movq	%rax, %xmm0
+	addsd	%xmm1, %xmm0
+	movq	%r10, %xmm1
+	movq	%xmm0, %rax
+	movq	%rax, %xmm0
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	$10, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	-72(%rbp), %rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	popq	%rax
+	mulsd	%xmm1, %xmm0
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	movq	-80(%rbp), %r10
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	movq	%r10, %xmm1
+	movq	%rax, %xmm0
+	subsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	jmp	..L3
+..L3:
+	movq	%rax, %xmm0
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+.__SCALE:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$32, %rsp
+	movq	%rdi, -8(%rbp)
+	movq	%xmm0, -16(%rbp)
+	movq	%rsi, -24(%rbp)
+	movq	%rdi, %rax
+	movq	-16(%rbp), %r10
+	movq	(%rax), %rax
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	mulsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	%rdi, %rax
+	popq	(%rax)
+	movq	-24(%rbp), %rax
+	movq	(%rax), %rax
+	addq	$1, %rax
+	pushq	%rax
+	movq	-24(%rbp), %rax
+	popq	(%rax)
+..L4:
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+.__NORM1:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$48, %rsp
+	movq	%rsi, -32(%rbp)
+	movq	%rdi, %rsi
+	leaq	-24(%rbp), %rdi
+	movq	(%rsi), %rax
+	movq	%rax, (%rdi)
+	movq	8(%rsi), %rax
+	movq	%rax, 8(%rdi)
+	movq	16(%rsi), %rax
+	movq	%rax, 16(%rdi)
+	xorq	%rax, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm0, %rax
+	movq	%rax, -48(%rbp)
+	leaq	-40(%rbp), %rax
+	movq	%rax, %r14
+	movq	$3, %r13
+	pushq	-32(%rbp)
+	popq	(%r14)
+	cmpq	(%r14), %r13
+	jl	..L7
+..L6:
+	leaq	-24(%rbp), %rax
+	pushq	-48(%rbp)
+	pushq	%rax
+	movq	-40(%rbp), %rax
+	popq	%r10
+	subq	$1, %rax
+	movq	%rax, %r12
+	popq	%rax
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	movq	%rax, -48(%rbp)
+..L8:
+	movq	-40(%rbp), %r13
+	movq	$3, %r14
+	cmpq	%r13, %r14
+	jle	..L7
+	leaq	-40(%rbp), %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L6
+..L7:
+	movq	$100, %rax
+	xorq	%rcx, %rcx
+	cvtsi2sd	%rax, %xmm0
+	imulq	$8, %rcx
+	movq	%xmm0, %rax
+	pushq	%rax
+	leaq	-24(%rbp), %rax
+	popq	(%rax,%rcx,1)
+	movq	-48(%rbp), %rax
+	jmp	..L5
+..L5:
+	movq	%rax, %xmm0
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+.__DOWN:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$64, %rsp
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	movq	%rdx, -24(%rbp)
+	movq	%rcx, -32(%rbp)
+	movq	%r8, -40(%rbp)
+	movq	%r9, -48(%rbp)
+	pushq	16(%rbp)
+	popq	-56(%rbp)
+..L10:
+	xorq	%r11, %r11
+	movq	-8(%rbp), %rdx
+	xorq	%rax, %rax
+	cmpq	%r11, %rdx
+	sete	%al
+	testq	%rax, %rax
+	jz	..L11
+	movq	-56(%rbp), %rax
+	jmp	..L9
+	jmp	..L12
+..L11:
+..L12:
+	movq	-16(%rbp), %r10
+	movq	-56(%rbp), %rax
+	addq	%r10, %rax
+	pushq	%rax
+	movq	-8(%rbp), %rax
+	pushq	-48(%rbp)
+	pushq	-40(%rbp)
+	pushq	-32(%rbp)
+	pushq	-24(%rbp)
+	pushq	%r10
+	subq	$1, %rax
+	popq	-16(%rbp)
+	popq	-24(%rbp)
+	popq	-32(%rbp)
+	popq	-40(%rbp)
+	popq	-48(%rbp)
+	movq	%rax, -8(%rbp)
+	popq	-56(%rbp)
+	jmp	..L10
+..L9:
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+.__UP:
+	pushq	%rbp
+	xorq	%r11, %r11
+	movq	%rsp, %rbp
+	subq	$128, %rsp
+	pushq	16(%rbp)
+	popq	-56(%rbp)
+	pushq	24(%rbp)
+	popq	-64(%rbp)
+	movq	%rdx, -24(%rbp)
+	movq	%rdi, -8(%rbp)
+	movq	-56(%rbp), %rax
+	movq	%rsi, -16(%rbp)
+	movq	%rcx, -32(%rbp)
+	movq	-64(%rbp), %r10
+	movq	%r8, -40(%rbp)
+	movq	%r9, -48(%rbp)
+	addq	%r10, %rax
+	pushq	%rax
+	xorq	%rax, %rax
+	pushq	%r9
+	pushq	%r8
+	pushq	%rcx
+	pushq	%rdx
+	pushq	%rsi
+	pushq	%rdi
+	popq	-72(%rbp)
+	popq	-80(%rbp)
+	popq	-88(%rbp)
+	popq	-96(%rbp)
+	popq	-104(%rbp)
+	movq	-72(%rbp), %rdx
+	popq	-112(%rbp)
+	popq	-120(%rbp)
+	cmpq	%r11, %rdx
+	sete	%al
+	testq	%rax, %rax
+	jz	..L15
+	movq	-120(%rbp), %rax
+	jmp	..L14
+	jmp	..L16
+..L15:
+..L16:
+	movq	-80(%rbp), %r10
+	movq	-120(%rbp), %rax
+	movq	-88(%rbp), %rdx
+	movq	-96(%rbp), %rcx
+	movq	-104(%rbp), %r8
+	movq	-112(%rbp), %r9
+	addq	%r10, %rax
+	movq	%r10, %rsi
+	pushq	%rax
+	movq	-72(%rbp), %rax
+	subq	$1, %rax
+	movq	%rax, %rdi
+	call	.__DOWN
+	addq	$8, %rsp
+	jmp	..L14
+..L14:
+	jmp	..L13
+..L13:
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+._rt_flush:
+	movq	.__._rt_len(%rip), %rdx
+	leaq	.__._rt_buf(%rip), %rsi
+._rt_flush.1:
+	testq	%rdx, %rdx
+	jz	._rt_flush.2
+	movq	$1, %rax
+	movq	$1, %rdi
+	syscall
+	cmpq	$-4, %rax
+	je	._rt_flush.1
+	testq	%rax, %rax
+	jle	._rt_flush.2
+	addq	%rax, %rsi
+	subq	%rax, %rdx
+	jmp	._rt_flush.1
+._rt_flush.2:
+	movq	$0, .__._rt_len(%rip)
+	ret
+._rt_reserve:
+	movq	.__._rt_len(%rip), %rax
+	cmpq	$65504, %rax
+	jbe	._rt_reserve.1
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	xorq	%rax, %rax
+._rt_reserve.1:
+	leaq	.__._rt_buf(%rip), %rsi
+	addq	%rax, %rsi
+	ret
+._rt_commit:
+	leaq	.__._rt_buf(%rip), %rax
+	subq	%rax, %rsi
+	movq	%rsi, .__._rt_len(%rip)
+	ret
+._rt_utoa:
+	movq	%rsp, %rdi
+	movabsq	$-3689348814741910323, %r8
+	movq	%rax, %rcx
+._rt_utoa.1:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	decq	%rdi
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	testq	%rcx, %rcx
+	jnz	._rt_utoa.1
+._rt_utoa.2:
+	movb	(%rdi), %al
+	movb	%al, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	cmpq	%rsp, %rdi
+	jb	._rt_utoa.2
+	ret
+._rt_write_char:
+	call	._rt_reserve
+	movb	%dil, (%rsi)
+	incq	%rsi
+	jmp	._rt_commit
+._rt_write_str:
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+._rt_write_str.1:
+	movb	(%rdi), %cl
+	testb	%cl, %cl
+	jz	._rt_commit
+	cmpq	%rdx, %rsi
+	jb	._rt_write_str.2
+	call	._rt_commit
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+	movb	(%rdi), %cl
+._rt_write_str.2:
+	movb	%cl, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	jmp	._rt_write_str.1
+._rt_write_int:
+	call	._rt_reserve
+	movq	%rdi, %rax
+	testq	%rax, %rax
+	jns	._rt_write_int.1
+	movb	$45, (%rsi)
+	incq	%rsi
+	negq	%rax
+._rt_write_int.1:
+	call	._rt_utoa
+	jmp	._rt_commit
+._rt_write_float:
+	call	._rt_reserve
+	movq	%rdi, %r11
+	shrq	$52, %r11
+	andq	$2047, %r11
+	cmpq	$1086, %r11
+	jae	._rt_write_float.slow
+	testq	%rdi, %rdi
+	jns	._rt_write_float.1
+	movb	$45, (%rsi)
+	incq	%rsi
+._rt_write_float.1:
+	movabsq	$4503599627370495, %r8
+	andq	%rdi, %r8
+	movq	$1075, %rcx
+	testq	%r11, %r11
+	jz	._rt_write_float.2
+	btsq	$52, %r8
+	subq	%r11, %rcx
+	jmp	._rt_write_float.3
+._rt_write_float.2:
+	decq	%rcx
+._rt_write_float.3:
+	xorq	%r9, %r9
+	testq	%rcx, %rcx
+	jg	._rt_write_float.4
+	negq	%rcx
+	shlq	%cl, %r8
+	movq	%r8, %r10
+	jmp	._rt_write_float.out
+._rt_write_float.4:
+	xorq	%r10, %r10
+	cmpq	$64, %rcx
+	jae	._rt_write_float.5
+	movq	%r8, %r10
+	shrq	%cl, %r10
+	movq	$1, %rax
+	shlq	%cl, %rax
+	decq	%rax
+	andq	%rax, %r8
+._rt_write_float.5:
+	cmpq	$74, %rcx
+	jae	._rt_write_float.out
+	movq	%r8, %rax
+	movq	$1000000, %rdx
+	mulq	%rdx
+	decq	%rcx
+	cmpq	$64, %rcx
+	jae	._rt_write_float.6
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rax, %r11
+	shrdq	%cl, %rdx, %rax
+	jmp	._rt_write_float.7
+._rt_write_float.6:
+	subq	$64, %rcx
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rdx, %r11
+	orq	%rax, %r11
+	movq	%rdx, %rax
+	shrq	%cl, %rax
+._rt_write_float.7:
+	movq	%rax, %r9
+	shrq	$1, %r9
+	testq	$1, %rax
+	jz	._rt_write_float.out
+	testq	%r11, %r11
+	jnz	._rt_write_float.8
+	testq	$1, %r9
+	jz	._rt_write_float.out
+._rt_write_float.8:
+	incq	%r9
+	cmpq	$1000000, %r9
+	jb	._rt_write_float.out
+	xorq	%r9, %r9
+	incq	%r10
+._rt_write_float.out:
+	movq	%r10, %rax
+	pushq	%r9
+	call	._rt_utoa
+	popq	%rcx
+	movb	$46, (%rsi)
+	leaq	6(%rsi), %rdi
+	movabsq	$-3689348814741910323, %r8
+._rt_write_float.9:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	decq	%rdi
+	cmpq	%rsi, %rdi
+	jnz	._rt_write_float.9
+	addq	$7, %rsi
+	jmp	._rt_commit
+._rt_write_float.slow:
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	pushq	%rbp
+	movq	%rsp, %rbp
+	andq	$-16, %rsp
+	movq	%rdi, %xmm0
+	leaq	.__._rt_buf(%rip), %rdi
+	movq	$65536, %rsi
+	leaq	.__._rt_fmt_float(%rip), %rdx
+	movq	$1, %rax
+	call	snprintf
+	movq	%rax, .__._rt_len(%rip)
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+
@@ -0,0 +1,431 @@
+	.globl main
+.data
+	.__A: .quad 0
+.data
+	.__B: .quad 0
+.data
+	.__C: .quad 0
+.data
+	.__P: .quad 0
+.data
+	.__V: .fill 24,1,0
+.__.str0:
+	.string " "
+.__.str1:
+	.string " "
+.__.str2:
+	.string " "
+.__.str3:
+	.string " "
+.__.str4:
+	.string " "
+.__.str5:
+	.string " "
+.__.str6:
+	.string " "
+	.lcomm .__._rt_buf, 65536
+.data
+	.__._rt_len: .quad 0
+.__._rt_fmt_float:
+	.string "%lf"
+.text
+main:
+	movq	$1, .__A
+	leaq	.__A, %rax
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	movq	%rax, .__P
+	leaq	.__B, %rax
+	pushq	.__A
+	popq	(%rax)
+	movq	.__P, %rax
+	movq	$10, (%rax)
+	leaq	.__C, %rax
+	pushq	.__A
+	popq	(%rax)
+	movq	.__B, %rdi
+	call	._rt_write_int
+	leaq	.__.str0, %rdi
+	call	._rt_write_str
+	movq	.__C, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	addq	$2, .__A
+..L3:
+	leaq	.__B, %rax
+	pushq	.__A
+	popq	(%rax)
+	movq	.__B, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	$1, %rcx
+	leaq	.__V, %rax
+	movq	$1, %r12
+	imulq	$8, %rcx
+	imulq	$8, %r12
+	movq	$5, (%rax,%rcx,1)
+	leaq	.__V, %rax
+	movq	$1, %rcx
+	movq	%rax, %r10
+	imulq	$8, %rcx
+	leaq	.__V, %rax
+	movq	(%r10,%r12,1), %r10
+	movq	%r10, .__A
+	movq	$6, (%rax,%rcx,1)
+	movq	.__A, %rdi
+	call	._rt_write_int
+	leaq	.__.str1, %rdi
+	call	._rt_write_str
+	leaq	.__V, %rax
+	movq	$1, %r12
+	imulq	$8, %r12
+	movq	%rax, %r10
+	movq	(%r10,%r12,1), %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	.__A, %r10
+	movq	%r10, %rax
+	addq	%r10, %rax
+	movq	%rax, .__B
+	subq	%r10, %rax
+	movq	%rax, .__C
+	leaq	.__B, %rax
+	pushq	.__C
+	popq	(%rax)
+	movq	.__A, %rdi
+	call	._rt_write_int
+	leaq	.__.str2, %rdi
+	call	._rt_write_str
+	movq	.__B, %rdi
+	call	._rt_write_int
+	leaq	.__.str3, %rdi
+	call	._rt_write_str
+	movq	.__C, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	pushq	.__A
+	popq	-8(%rbp)
+	leaq	-16(%rbp), %rax
+	pushq	-8(%rbp)
+	popq	(%rax)
+	movq	-8(%rbp), %r10
+	movq	-16(%rbp), %rax
+	addq	%r10, %rax
+	movq	%rax, -16(%rbp)
+	jmp	..L4
+..L4:
+	movq	%rax, .__A
+	movq	.__B, %r11
+	movq	%rax, %rdx
+	xorq	%rax, %rax
+	cmpq	%r11, %rdx
+	setg	%al
+	testq	%rax, %rax
+	jz	..L5
+	leaq	.__C, %rax
+	pushq	%rdx
+	popq	(%rax)
+	jmp	..L6
+..L5:
+	leaq	.__C, %rax
+	pushq	%r11
+	popq	(%rax)
+..L6:
+	movq	.__C, %rdi
+	call	._rt_write_int
+	leaq	.__.str4, %rdi
+	call	._rt_write_str
+	movq	.__A, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+..L7:
+	xorq	%r11, %r11
+	movq	.__A, %rdx
+	xorq	%rax, %rax
+	cmpq	%r11, %rdx
+	setg	%al
+	testq	%rax, %rax
+	jz	..L8
+	leaq	.__B, %rax
+	pushq	%rdx
+	popq	(%rax)
+	subq	$3, .__A
+	movq	.__B, %r10
+	addq	%r10, .__C
+	jmp	..L7
+..L8:
+	movq	%rdx, %rdi
+	call	._rt_write_int
+	leaq	.__.str5, %rdi
+	call	._rt_write_str
+	movq	.__B, %rdi
+	call	._rt_write_int
+	leaq	.__.str6, %rdi
+	call	._rt_write_str
+	movq	.__C, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	call	._rt_flush
+	movq	%rbp, %rsp
+	popq	%rbp
+	xorq	%rax, %rax
+	ret
+.__ADD2:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	movq	%rdi, -8(%rbp)
+	movq	%rdi, %rax
+	movq	(%rax), %rax
+	addq	$2, %rax
+	pushq	%rax
+	movq	%rdi, %rax
+	popq	(%rax)
+..L1:
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+.__TWICE:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	movq	%rdi, -8(%rbp)
+	leaq	-16(%rbp), %rax
+	pushq	%rdi
+	popq	(%rax)
+	movq	-8(%rbp), %r10
+	movq	-16(%rbp), %rax
+	addq	%r10, %rax
+	movq	%rax, -16(%rbp)
+	jmp	..L2
+..L2:
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+._rt_flush:
+	movq	.__._rt_len(%rip), %rdx
+	leaq	.__._rt_buf(%rip), %rsi
+._rt_flush.1:
+	testq	%rdx, %rdx
+	jz	._rt_flush.2
+	movq	$1, %rax
+	movq	$1, %rdi
+	syscall
+	cmpq	$-4, %rax
+	je	._rt_flush.1
+	testq	%rax, %rax
+	jle	._rt_flush.2
+	addq	%rax, %rsi
+	subq	%rax, %rdx
+	jmp	._rt_flush.1
+._rt_flush.2:
+	movq	$0, .__._rt_len(%rip)
+	ret
+._rt_reserve:
+	movq	.__._rt_len(%rip), %rax
+	cmpq	$65504, %rax
+	jbe	._rt_reserve.1
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	xorq	%rax, %rax
+._rt_reserve.1:
+	leaq	.__._rt_buf(%rip), %rsi
+	addq	%rax, %rsi
+	ret
+._rt_commit:
+	leaq	.__._rt_buf(%rip), %rax
+	subq	%rax, %rsi
+	movq	%rsi, .__._rt_len(%rip)
+	ret
+._rt_utoa:
+	movq	%rsp, %rdi
+	movabsq	$-3689348814741910323, %r8
+	movq	%rax, %rcx
+._rt_utoa.1:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	decq	%rdi
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	testq	%rcx, %rcx
+	jnz	._rt_utoa.1
+._rt_utoa.2:
+	movb	(%rdi), %al
+	movb	%al, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	cmpq	%rsp, %rdi
+	jb	._rt_utoa.2
+	ret
+._rt_write_char:
+	call	._rt_reserve
+	movb	%dil, (%rsi)
+	incq	%rsi
+	jmp	._rt_commit
+._rt_write_str:
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+._rt_write_str.1:
+	movb	(%rdi), %cl
+	testb	%cl, %cl
+	jz	._rt_commit
+	cmpq	%rdx, %rsi
+	jb	._rt_write_str.2
+	call	._rt_commit
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+	movb	(%rdi), %cl
+._rt_write_str.2:
+	movb	%cl, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	jmp	._rt_write_str.1
+._rt_write_int:
+	call	._rt_reserve
+	movq	%rdi, %rax
+	testq	%rax, %rax
+	jns	._rt_write_int.1
+	movb	$45, (%rsi)
+	incq	%rsi
+	negq	%rax
+._rt_write_int.1:
+	call	._rt_utoa
+	jmp	._rt_commit
+._rt_write_float:
+	call	._rt_reserve
+	movq	%rdi, %r11
+	shrq	$52, %r11
+	andq	$2047, %r11
+	cmpq	$1086, %r11
+	jae	._rt_write_float.slow
+	testq	%rdi, %rdi
+	jns	._rt_write_float.1
+	movb	$45, (%rsi)
+	incq	%rsi
+._rt_write_float.1:
+	movabsq	$4503599627370495, %r8
+	andq	%rdi, %r8
+	movq	$1075, %rcx
+	testq	%r11, %r11
+	jz	._rt_write_float.2
+	btsq	$52, %r8
+	subq	%r11, %rcx
+	jmp	._rt_write_float.3
+._rt_write_float.2:
+	decq	%rcx
+._rt_write_float.3:
+	xorq	%r9, %r9
+	testq	%rcx, %rcx
+	jg	._rt_write_float.4
+	negq	%rcx
+	shlq	%cl, %r8
+	movq	%r8, %r10
+	jmp	._rt_write_float.out
+._rt_write_float.4:
+	xorq	%r10, %r10
+	cmpq	$64, %rcx
+	jae	._rt_write_float.5
+	movq	%r8, %r10
+	shrq	%cl, %r10
+	movq	$1, %rax
+	shlq	%cl, %rax
+	decq	%rax
+	andq	%rax, %r8
+._rt_write_float.5:
+	cmpq	$74, %rcx
+	jae	._rt_write_float.out
+	movq	%r8, %rax
+	movq	$1000000, %rdx
+	mulq	%rdx
+	decq	%rcx
+	cmpq	$64, %rcx
+	jae	._rt_write_float.6
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rax, %r11
+	shrdq	%cl, %rdx, %rax
+	jmp	._rt_write_float.7
+._rt_write_float.6:
+	subq	$64, %rcx
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rdx, %r11
+	orq	%rax, %r11
+	movq	%rdx, %rax
+	shrq	%cl, %rax
+._rt_write_float.7:
+	movq	%rax, %r9
+	shrq	$1, %r9
+	testq	$1, %rax
+	jz	._rt_write_float.out
+	testq	%r11, %r11
+	jnz	._rt_write_float.8
+	testq	$1, %r9
+	jz	._rt_write_float.out
+._rt_write_float.8:
+	incq	%r9
+	cmpq	$1000000, %r9
+	jb	._rt_write_float.out
+	xorq	%r9, %r9
+	incq	%r10
+._rt_write_float.out:
+	movq	%r10, %rax
+	pushq	%r9
+	call	._rt_utoa
+	popq	%rcx
+	movb	$46, (%rsi)
+	leaq	6(%rsi), %rdi
+	movabsq	$-3689348814741910323, %r8
+._rt_write_float.9:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	decq	%rdi
+	cmpq	%rsi, %rdi
+	jnz	._rt_write_float.9
+	addq	$7, %rsi
+	jmp	._rt_commit
+._rt_write_float.slow:
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	pushq	%rbp
+	movq	%rsp, %rbp
+	andq	$-16, %rsp
+	movq	%rdi, %xmm0
+	leaq	.__._rt_buf(%rip), %rdi
+	movq	$65536, %rsi
+	leaq	.__._rt_fmt_float(%rip), %rdx
+	movq	$1, %rax
+	call	snprintf
+	movq	%rax, .__._rt_len(%rip)
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+
@@ -0,0 +1,991 @@
+	.globl main
+.data
+	.__I: .quad 0
+.data
+	.__K: .quad 0
+.data
+	.__S: .quad 0
+.data
+	.__X: .double 0
+.data
+	.__A: .fill 32,1,0
+.__.str0:
+	.string " "
+.__.str1:
+	.string " "
+.__.str2:
+	.string " "
+.__.str3:
+	.string " "
+	.lcomm .__._rt_buf, 65536
+.data
+	.__._rt_len: .quad 0
+.__._rt_fmt_float:
+	.string "%lf"
+.text
+main:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$48, %rsp
+	movq	$7, -8(%rbp)
+	movq	-8(%rbp), %r10
+	movq	%r10, %rax
+	imulq	%r10, %rax
+	jmp	..L26
+..L26:
+	movq	$2, -8(%rbp)
+	movq	-8(%rbp), %r10
+	pushq	%rax
+	movq	%r10, %rax
+	imulq	%r10, %rax
+	jmp	..L28
+..L28:
+	movq	%rax, -8(%rbp)
+	movq	%rax, %r10
+	imulq	%r10, %rax
+	jmp	..L27
+..L27:
+	movq	%rax, %r10
+	popq	%rax
+	addq	%r10, %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	$5, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm0, %rax
+	movq	%rax, -8(%rbp)
+	movq	$2, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm0, %r10
+	movq	-8(%rbp), %rax
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	divsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	jmp	..L29
+..L29:
+	movq	%rax, .__X
+	movq	%rax, %rdi
+	call	._rt_write_float
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	$3, -8(%rbp)
+	movq	-8(%rbp), %r10
+	movq	%r10, %rax
+	imulq	%r10, %rax
+	jmp	..L31
+..L31:
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm0, %rax
+	movq	%rax, -8(%rbp)
+	movq	$2, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm0, %r10
+	movq	-8(%rbp), %rax
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	divsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	jmp	..L30
+..L30:
+	movq	%rax, .__X
+	movq	%rax, %rdi
+	call	._rt_write_float
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	$1, .__I
+	movq	$2, .__K
+	leaq	-24(%rbp), %rax
+	pushq	.__I
+	popq	(%rax)
+	leaq	.__I, %rax
+	pushq	.__K
+	popq	(%rax)
+	leaq	.__K, %rax
+	pushq	-24(%rbp)
+	popq	(%rax)
+..L32:
+	movq	.__I, %rdi
+	call	._rt_write_int
+	leaq	.__.str0, %rdi
+	call	._rt_write_str
+	movq	.__K, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	leaq	.__I, %rax
+	movq	%rax, %r14
+	movq	$1, (%r14)
+	movq	$4, %r13
+	cmpq	(%r14), %r13
+	jl	..L34
+..L33:
+	movq	.__I, %rax
+	leaq	(%rax,%rax,4), %rax
+	shlq	$1, %rax
+	pushq	%rax
+	leaq	.__A, %rax
+	pushq	%rax
+	movq	.__I, %rax
+	subq	$1, %rax
+	movq	%rax, %rcx
+	popq	%rax
+	imulq	$8, %rcx
+	popq	(%rax,%rcx,1)
+..L35:
+	movq	.__I, %r13
+	movq	$4, %r14
+	cmpq	%r13, %r14
+	jle	..L34
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L33
+..L34:
+	movq	$3, %rcx
+	leaq	.__A, %rax
+	imulq	$8, %rcx
+	leaq	(%rax,%rcx,1), %rax
+	xorq	%rcx, %rcx
+	imulq	$8, %rcx
+	pushq	%rax
+	leaq	.__A, %rax
+	popq	-16(%rbp)
+	leaq	(%rax,%rcx,1), %rax
+	movq	%rax, -8(%rbp)
+	pushq	(%rax)
+	movq	-16(%rbp), %rax
+	popq	-24(%rbp)
+	pushq	(%rax)
+	movq	-8(%rbp), %rax
+	popq	(%rax)
+	movq	-16(%rbp), %rax
+	pushq	-24(%rbp)
+	popq	(%rax)
+..L36:
+	leaq	.__A, %rax
+	xorq	%r12, %r12
+	imulq	$8, %r12
+	movq	%rax, %r10
+	movq	(%r10,%r12,1), %rdi
+	call	._rt_write_int
+	leaq	.__.str1, %rdi
+	call	._rt_write_str
+	leaq	.__A, %rax
+	movq	$3, %r12
+	imulq	$8, %r12
+	movq	%rax, %r10
+	movq	(%r10,%r12,1), %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	$1, -16(%rbp)
+	leaq	.__A, %rax
+	movq	%rax, %r9
+	movq	-16(%rbp), %rax
+	movq	%rax, %xmm0
+	punpcklqdq	%xmm0, %xmm0
+	movq	$1, %rcx
+	movq	$4, %rdx
+..L41:
+	cmpq	%rdx, %rcx
+	jg	..L44
+..L42:
+	leaq	1(%rcx), %rax
+	cmpq	%rdx, %rax
+	jg	..L43
+	movdqu	-8(%r9,%rcx,8), %xmm1
+	paddq	%xmm0, %xmm1
+	movdqu	%xmm1, -8(%r9,%rcx,8)
+	addq	$2, %rcx
+	jmp	..L42
+..L43:
+	cmpq	%rdx, %rcx
+	jle	..L45
+	movq	%rdx, %rcx
+..L44:
+	movq	%rcx, -24(%rbp)
+	jmp	..L39
+..L45:
+	movq	%rcx, -24(%rbp)
+..L38:
+	leaq	.__A, %rax
+	pushq	%rax
+	movq	-24(%rbp), %rax
+	popq	%r10
+	subq	$1, %rax
+	movq	%rax, %r12
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	pushq	%r10
+	movq	-16(%rbp), %r10
+	popq	%rax
+	addq	%r10, %rax
+	pushq	%rax
+	leaq	.__A, %rax
+	pushq	%rax
+	movq	-24(%rbp), %rax
+	subq	$1, %rax
+	movq	%rax, %rcx
+	popq	%rax
+	imulq	$8, %rcx
+	popq	(%rax,%rcx,1)
+..L40:
+	movq	-24(%rbp), %r13
+	movq	$4, %r14
+	cmpq	%r13, %r14
+	jle	..L39
+	leaq	-24(%rbp), %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L38
+..L39:
+..L37:
+	leaq	.__A, %rax
+	xorq	%r12, %r12
+	imulq	$8, %r12
+	movq	%rax, %r10
+	movq	(%r10,%r12,1), %rdi
+	call	._rt_write_int
+	leaq	.__.str2, %rdi
+	call	._rt_write_str
+	leaq	.__A, %rax
+	movq	$1, %r12
+	imulq	$8, %r12
+	movq	%rax, %r10
+	movq	(%r10,%r12,1), %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	leaq	.__A, %rax
+	leaq	-32(%rbp), %rdi
+	movq	$4, %r13
+	movq	%rax, %rsi
+	movq	(%rsi), %rax
+	movq	%rax, (%rdi)
+	movq	8(%rsi), %rax
+	movq	%rax, 8(%rdi)
+	movq	16(%rsi), %rax
+	movq	%rax, 16(%rdi)
+	movq	24(%rsi), %rax
+	movq	%rax, 24(%rdi)
+	leaq	-40(%rbp), %rax
+	movq	%rax, %r14
+	movq	$0, -48(%rbp)
+	movq	$1, (%r14)
+	cmpq	(%r14), %r13
+	jl	..L48
+..L47:
+	leaq	-32(%rbp), %rax
+	pushq	-48(%rbp)
+	pushq	%rax
+	movq	-40(%rbp), %rax
+	popq	%r10
+	subq	$1, %rax
+	movq	%rax, %r12
+	popq	%rax
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	addq	%r10, %rax
+	movq	%rax, -48(%rbp)
+..L49:
+	movq	-40(%rbp), %r13
+	movq	$4, %r14
+	cmpq	%r13, %r14
+	jle	..L48
+	leaq	-40(%rbp), %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L47
+..L48:
+	movq	-48(%rbp), %rax
+	jmp	..L46
+..L46:
+	movq	%rax, .__S
+	movq	%rax, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	xorq	%rcx, %rcx
+	leaq	.__A, %rax
+	leaq	-32(%rbp), %rdi
+	movq	$4, %r13
+	imulq	$8, %rcx
+	movq	$0, (%rax,%rcx,1)
+	leaq	.__A, %rax
+	movq	%rax, %rsi
+	movq	(%rsi), %rax
+	movq	%rax, (%rdi)
+	movq	8(%rsi), %rax
+	movq	%rax, 8(%rdi)
+	movq	16(%rsi), %rax
+	movq	%rax, 16(%rdi)
+	movq	24(%rsi), %rax
+	movq	%rax, 24(%rdi)
+	leaq	-40(%rbp), %rax
+	movq	%rax, %r14
+	movq	$0, -48(%rbp)
+	movq	$1, (%r14)
+	cmpq	(%r14), %r13
+	jl	..L52
+..L51:
+	leaq	-32(%rbp), %rax
+	pushq	-48(%rbp)
+	pushq	%rax
+	movq	-40(%rbp), %rax
+	popq	%r10
+	subq	$1, %rax
+	movq	%rax, %r12
+	popq	%rax
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	addq	%r10, %rax
+	movq	%rax, -48(%rbp)
+..L53:
+	movq	-40(%rbp), %r13
+	movq	$4, %r14
+	cmpq	%r13, %r14
+	jle	..L52
+	leaq	-40(%rbp), %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L51
+..L52:
+	movq	-48(%rbp), %rax
+	jmp	..L50
+..L50:
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str3, %rdi
+	call	._rt_write_str
+	leaq	.__A, %rax
+	xorq	%r12, %r12
+	imulq	$8, %r12
+	movq	%rax, %r10
+	movq	(%r10,%r12,1), %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	leaq	.__A, %rax
+	movq	%rax, %rsi
+	leaq	-32(%rbp), %rdi
+	movq	(%rsi), %rax
+	movq	%rax, (%rdi)
+	movq	8(%rsi), %rax
+	movq	%rax, 8(%rdi)
+	movq	16(%rsi), %rax
+	movq	%rax, 16(%rdi)
+	movq	24(%rsi), %rax
+	movq	%rax, 24(%rdi)
+	leaq	-40(%rbp), %rax
+	movq	%rax, %r14
+	movq	$1, (%r14)
+	movq	$4, %r13
+	cmpq	(%r14), %r13
+	jl	..L56
+..L55:
+	leaq	-32(%rbp), %rax
+	xorq	%r11, %r11
+	pushq	%rax
+	movq	-40(%rbp), %rax
+	popq	%r10
+	subq	$1, %rax
+	movq	%rax, %r12
+	xorq	%rax, %rax
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	movq	%r10, %rdx
+	cmpq	%r11, %rdx
+	setl	%al
+	testq	%rax, %rax
+	jz	..L58
+	movq	-40(%rbp), %rax
+	jmp	..L54
+	jmp	..L59
+..L58:
+..L59:
+..L57:
+	movq	-40(%rbp), %r13
+	movq	$4, %r14
+	cmpq	%r13, %r14
+	jle	..L56
+	leaq	-40(%rbp), %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L55
+..L56:
+	xorq	%rax, %rax
+	jmp	..L54
+..L54:
+	movq	%rax, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	$2, %rcx
+	movq	$1, %rax
+	leaq	-32(%rbp), %rdi
+	movq	$4, %r13
+	imulq	$8, %rcx
+	negq	%rax
+	pushq	%rax
+	leaq	.__A, %rax
+	popq	(%rax,%rcx,1)
+	leaq	.__A, %rax
+	movq	%rax, %rsi
+	movq	(%rsi), %rax
+	movq	%rax, (%rdi)
+	movq	8(%rsi), %rax
+	movq	%rax, 8(%rdi)
+	movq	16(%rsi), %rax
+	movq	%rax, 16(%rdi)
+	movq	24(%rsi), %rax
+	movq	%rax, 24(%rdi)
+	leaq	-40(%rbp), %rax
+	movq	%rax, %r14
+	movq	$1, (%r14)
+	cmpq	(%r14), %r13
+	jl	..L62
+..L61:
+	leaq	-32(%rbp), %rax
+	xorq	%r11, %r11
+	pushq	%rax
+	movq	-40(%rbp), %rax
+	popq	%r10
+	subq	$1, %rax
+	movq	%rax, %r12
+	xorq	%rax, %rax
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	movq	%r10, %rdx
+	cmpq	%r11, %rdx
+	setl	%al
+	testq	%rax, %rax
+	jz	..L64
+	movq	-40(%rbp), %rax
+	jmp	..L60
+	jmp	..L65
+..L64:
+..L65:
+..L63:
+	movq	-40(%rbp), %r13
+	movq	$4, %r14
+	cmpq	%r13, %r14
+	jle	..L62
+	leaq	-40(%rbp), %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L61
+..L62:
+	xorq	%rax, %rax
+	jmp	..L60
+..L60:
+	movq	%rax, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	$10, -8(%rbp)
+	movq	-8(%rbp), %rdx
+	xorq	%rax, %rax
+	cmpq	$1, %rdx
+	setle	%al
+	testq	%rax, %rax
+	jz	..L67
+	movq	$1, %rax
+	jmp	..L66
+	jmp	..L68
+..L67:
+..L68:
+	movq	-8(%rbp), %rax
+	subq	$1, %rax
+	movq	%rax, %rdi
+	pushq	-8(%rbp)
+	call	.__FACT
+	movq	%rax, %r10
+	popq	%rax
+	imulq	%r10, %rax
+	jmp	..L66
+..L66:
+	movq	%rax, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	call	._rt_flush
+	movq	%rbp, %rsp
+	popq	%rbp
+	xorq	%rax, %rax
+	ret
+.__SQR:
+	pushq	%rbp
+	movq	%rdi, %r10
+	movq	%rdi, %rax
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	imulq	%r10, %rax
+	movq	%rdi, -8(%rbp)
+	jmp	..L1
+..L1:
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+.__HALF:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	movq	%xmm0, -8(%rbp)
+	movq	$2, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm0, %r10
+	movq	-8(%rbp), %rax
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	divsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	jmp	..L2
+..L2:
+	movq	%rax, %xmm0
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+.__SWAP:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$32, %rsp
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	movq	%rdi, %rax
+	pushq	(%rax)
+	popq	-24(%rbp)
+	movq	%rsi, %rax
+	pushq	(%rax)
+	movq	%rdi, %rax
+	popq	(%rax)
+	movq	-16(%rbp), %rax
+	pushq	-24(%rbp)
+	popq	(%rax)
+..L3:
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+.__INC_ALL:
+	pushq	%rbp
+	movq	%rsi, %rax
+	movq	%rdi, %r9
+	movq	$1, %rcx
+	movq	%rsp, %rbp
+	movq	%rax, %xmm0
+	subq	$32, %rsp
+	movq	$4, %rdx
+	movq	%rdi, -8(%rbp)
+	punpcklqdq	%xmm0, %xmm0
+	movq	%rsi, -16(%rbp)
+..L8:
+	cmpq	%rdx, %rcx
+	jg	..L11
+..L9:
+	leaq	1(%rcx), %rax
+	cmpq	%rdx, %rax
+	jg	..L10
+	movdqu	-8(%r9,%rcx,8), %xmm1
+	paddq	%xmm0, %xmm1
+	movdqu	%xmm1, -8(%r9,%rcx,8)
+	addq	$2, %rcx
+	jmp	..L9
+..L10:
+	cmpq	%rdx, %rcx
+	jle	..L12
+	movq	%rdx, %rcx
+..L11:
+	movq	%rcx, -24(%rbp)
+	jmp	..L6
+..L12:
+	movq	%rcx, -24(%rbp)
+..L5:
+	movq	-24(%rbp), %rax
+	movq	-8(%rbp), %r10
+	subq	$1, %rax
+	movq	%rax, %r12
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	pushq	%r10
+	movq	-16(%rbp), %r10
+	popq	%rax
+	addq	%r10, %rax
+	pushq	%rax
+	movq	-24(%rbp), %rax
+	subq	$1, %rax
+	movq	%rax, %rcx
+	movq	-8(%rbp), %rax
+	imulq	$8, %rcx
+	popq	(%rax,%rcx,1)
+..L7:
+	movq	-24(%rbp), %r13
+	movq	$4, %r14
+	cmpq	%r13, %r14
+	jle	..L6
+	leaq	-24(%rbp), %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L5
+..L6:
+..L4:
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+.__SUM:
+	movq	%rdi, %rsi
+	pushq	%rbp
+	movq	$4, %r13
+	movq	(%rsi), %rax
+	movq	%rsp, %rbp
+	subq	$48, %rsp
+	leaq	-32(%rbp), %rdi
+	movq	%rax, (%rdi)
+	movq	8(%rsi), %rax
+	movq	%rax, 8(%rdi)
+	movq	16(%rsi), %rax
+	movq	%rax, 16(%rdi)
+	movq	24(%rsi), %rax
+	movq	%rax, 24(%rdi)
+	leaq	-40(%rbp), %rax
+	movq	%rax, %r14
+	movq	$0, -48(%rbp)
+	movq	$1, (%r14)
+	cmpq	(%r14), %r13
+	jl	..L15
+..L14:
+	leaq	-32(%rbp), %rax
+	pushq	-48(%rbp)
+	pushq	%rax
+	movq	-40(%rbp), %rax
+	popq	%r10
+	subq	$1, %rax
+	movq	%rax, %r12
+	popq	%rax
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	addq	%r10, %rax
+	movq	%rax, -48(%rbp)
+..L16:
+	movq	-40(%rbp), %r13
+	movq	$4, %r14
+	cmpq	%r13, %r14
+	jle	..L15
+	leaq	-40(%rbp), %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L14
+..L15:
+	movq	-48(%rbp), %rax
+	jmp	..L13
+..L13:
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+.__FIRST_NEG:
+	movq	%rdi, %rsi
+	pushq	%rbp
+	movq	$4, %r13
+	movq	(%rsi), %rax
+	movq	%rsp, %rbp
+	subq	$48, %rsp
+	leaq	-32(%rbp), %rdi
+	movq	%rax, (%rdi)
+	movq	8(%rsi), %rax
+	movq	%rax, 8(%rdi)
+	movq	16(%rsi), %rax
+	movq	%rax, 16(%rdi)
+	movq	24(%rsi), %rax
+	movq	%rax, 24(%rdi)
+	leaq	-40(%rbp), %rax
+	movq	%rax, %r14
+	movq	$1, (%r14)
+	cmpq	(%r14), %r13
+	jl	..L19
+..L18:
+	leaq	-32(%rbp), %rax
+	xorq	%r11, %r11
+	pushq	%rax
+	movq	-40(%rbp), %rax
+	popq	%r10
+	subq	$1, %rax
+	movq	%rax, %r12
+	xorq	%rax, %rax
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	movq	%r10, %rdx
+	cmpq	%r11, %rdx
+	setl	%al
+	testq	%rax, %rax
+	jz	..L21
+	movq	-40(%rbp), %rax
+	jmp	..L17
+	jmp	..L22
+..L21:
+..L22:
+..L20:
+	movq	-40(%rbp), %r13
+	movq	$4, %r14
+	cmpq	%r13, %r14
+	jle	..L19
+	leaq	-40(%rbp), %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L18
+..L19:
+	xorq	%rax, %rax
+	jmp	..L17
+..L17:
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+.__FACT:
+	pushq	%rbp
+	movq	%rdi, %rdx
+	xorq	%rax, %rax
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	cmpq	$1, %rdx
+	setle	%al
+	movq	%rdi, -8(%rbp)
+	testq	%rax, %rax
+	jz	..L24
+	movq	$1, %rax
+	jmp	..L23
+	jmp	..L25
+..L24:
+..L25:
+	movq	-8(%rbp), %rax
+	subq	$1, %rax
+	movq	%rax, %rdi
+	pushq	-8(%rbp)
+	call	.__FACT
+	movq	%rax, %r10
+	popq	%rax
+	imulq	%r10, %rax
+	jmp	..L23
+..L23:
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+._rt_flush:
+	movq	.__._rt_len(%rip), %rdx
+	leaq	.__._rt_buf(%rip), %rsi
+._rt_flush.1:
+	testq	%rdx, %rdx
+	jz	._rt_flush.2
+	movq	$1, %rax
+	movq	$1, %rdi
+	syscall
+	cmpq	$-4, %rax
+	je	._rt_flush.1
+	testq	%rax, %rax
+	jle	._rt_flush.2
+	addq	%rax, %rsi
+	subq	%rax, %rdx
+	jmp	._rt_flush.1
+._rt_flush.2:
+	movq	$0, .__._rt_len(%rip)
+	ret
+._rt_reserve:
+	movq	.__._rt_len(%rip), %rax
+	cmpq	$65504, %rax
+	jbe	._rt_reserve.1
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	xorq	%rax, %rax
+._rt_reserve.1:
+	leaq	.__._rt_buf(%rip), %rsi
+	addq	%rax, %rsi
+	ret
+._rt_commit:
+	leaq	.__._rt_buf(%rip), %rax
+	subq	%rax, %rsi
+	movq	%rsi, .__._rt_len(%rip)
+	ret
+._rt_utoa:
+	movq	%rsp, %rdi
+	movabsq	$-3689348814741910323, %r8
+	movq	%rax, %rcx
+._rt_utoa.1:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	decq	%rdi
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	testq	%rcx, %rcx
+	jnz	._rt_utoa.1
+._rt_utoa.2:
+	movb	(%rdi), %al
+	movb	%al, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	cmpq	%rsp, %rdi
+	jb	._rt_utoa.2
+	ret
+._rt_write_char:
+	call	._rt_reserve
+	movb	%dil, (%rsi)
+	incq	%rsi
+	jmp	._rt_commit
+._rt_write_str:
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+._rt_write_str.1:
+	movb	(%rdi), %cl
+	testb	%cl, %cl
+	jz	._rt_commit
+	cmpq	%rdx, %rsi
+	jb	._rt_write_str.2
+	call	._rt_commit
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+	movb	(%rdi), %cl
+._rt_write_str.2:
+	movb	%cl, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	jmp	._rt_write_str.1
+._rt_write_int:
+	call	._rt_reserve
+	movq	%rdi, %rax
+	testq	%rax, %rax
+	jns	._rt_write_int.1
+	movb	$45, (%rsi)
+	incq	%rsi
+	negq	%rax
+._rt_write_int.1:
+	call	._rt_utoa
+	jmp	._rt_commit
+._rt_write_float:
+	call	._rt_reserve
+	movq	%rdi, %r11
+	shrq	$52, %r11
+	andq	$2047, %r11
+	cmpq	$1086, %r11
+	jae	._rt_write_float.slow
+	testq	%rdi, %rdi
+	jns	._rt_write_float.1
+	movb	$45, (%rsi)
+	incq	%rsi
+._rt_write_float.1:
+	movabsq	$4503599627370495, %r8
+	andq	%rdi, %r8
+	movq	$1075, %rcx
+	testq	%r11, %r11
+	jz	._rt_write_float.2
+	btsq	$52, %r8
+	subq	%r11, %rcx
+	jmp	._rt_write_float.3
+._rt_write_float.2:
+	decq	%rcx
+._rt_write_float.3:
+	xorq	%r9, %r9
+	testq	%rcx, %rcx
+	jg	._rt_write_float.4
+	negq	%rcx
+	shlq	%cl, %r8
+	movq	%r8, %r10
+	jmp	._rt_write_float.out
+._rt_write_float.4:
+	xorq	%r10, %r10
+	cmpq	$64, %rcx
+	jae	._rt_write_float.5
+	movq	%r8, %r10
+	shrq	%cl, %r10
+	movq	$1, %rax
+	shlq	%cl, %rax
+	decq	%rax
+	andq	%rax, %r8
+._rt_write_float.5:
+	cmpq	$74, %rcx
+	jae	._rt_write_float.out
+	movq	%r8, %rax
+	movq	$1000000, %rdx
+	mulq	%rdx
+	decq	%rcx
+	cmpq	$64, %rcx
+	jae	._rt_write_float.6
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rax, %r11
+	shrdq	%cl, %rdx, %rax
+	jmp	._rt_write_float.7
+._rt_write_float.6:
+	subq	$64, %rcx
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rdx, %r11
+	orq	%rax, %r11
+	movq	%rdx, %rax
+	shrq	%cl, %rax
+._rt_write_float.7:
+	movq	%rax, %r9
+	shrq	$1, %r9
+	testq	$1, %rax
+	jz	._rt_write_float.out
+	testq	%r11, %r11
+	jnz	._rt_write_float.8
+	testq	$1, %r9
+	jz	._rt_write_float.out
+._rt_write_float.8:
+	incq	%r9
+	cmpq	$1000000, %r9
+	jb	._rt_write_float.out
+	xorq	%r9, %r9
+	incq	%r10
+._rt_write_float.out:
+	movq	%r10, %rax
+	pushq	%r9
+	call	._rt_utoa
+	popq	%rcx
+	movb	$46, (%rsi)
+	leaq	6(%rsi), %rdi
+	movabsq	$-3689348814741910323, %r8
+._rt_write_float.9:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	decq	%rdi
+	cmpq	%rsi, %rdi
+	jnz	._rt_write_float.9
+	addq	$7, %rsi
+	jmp	._rt_commit
+._rt_write_float.slow:
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	pushq	%rbp
+	movq	%rsp, %rbp
+	andq	$-16, %rsp
+	movq	%rdi, %xmm0
+	leaq	.__._rt_buf(%rip), %rdi
+	movq	$65536, %rsi
+	leaq	.__._rt_fmt_float(%rip), %rdx
+	movq	$1, %rax
+	call	snprintf
+	movq	%rax, .__._rt_len(%rip)
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+
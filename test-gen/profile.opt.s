@@ -0,0 +1,503 @@
+	.globl main
+.data
+	.__A: .fill 800,1,0
+.data
+	.__I: .quad 0
+.data
+	.__J: .quad 0
+.data
+	.__S: .quad 0
+.__.str0:
+	.string " "
+	.lcomm .__._rt_buf, 65536
+.data
+	.__._rt_len: .quad 0
+.__._rt_fmt_float:
+	.string "%lf"
+.text
+main:
+	leaq	.__I, %rax
+	movq	$0, .__S
+	movq	$1000, %r13
+	movq	%rax, %r14
+	pushq	%rbp
+	movq	$1, (%r14)
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	cmpq	(%r14), %r13
+	jl	..L8
+..L7:
+	movq	.__I, %rsi
+	leaq	.__S, %rax
+	movq	%rax, %rdi
+	call	.__MID
+	xorq	%r11, %r11
+	movq	.__I, %rdx
+	xorq	%rax, %rax
+	cmpq	%r11, %rdx
+	setl	%al
+	testq	%rax, %rax
+	jz	..L10
+	pushq	.__S
+	popq	-8(%rbp)
+	movq	-8(%rbp), %rax
+	addq	$1, %rax
+	jmp	..L12
+..L12:
+	movq	%rax, .__S
+	jmp	..L11
+..L10:
+..L11:
+..L9:
+	movq	.__I, %r13
+	movq	$1000, %r14
+	cmpq	%r13, %r14
+	jle	..L8
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L7
+..L8:
+	movq	.__S, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	leaq	.__J, %rax
+	movq	%rax, %r14
+	movq	$1, (%r14)
+	movq	$20, %r13
+	cmpq	(%r14), %r13
+	jl	..L14
+..L13:
+	leaq	.__I, %rax
+	movq	%rax, %r14
+	movq	$1, (%r14)
+	movq	$100, %r13
+	cmpq	(%r14), %r13
+	jl	..L17
+..L16:
+	leaq	.__A, %rax
+	pushq	%rax
+	movq	.__I, %rax
+	popq	%r10
+	subq	$1, %rax
+	movq	%rax, %r12
+	movq	.__I, %rax
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	pushq	%r10
+	movq	.__J, %r10
+	imulq	%r10, %rax
+	movq	%rax, %r10
+	popq	%rax
+	addq	%r10, %rax
+	movq	%rax, %r10
+	movq	$2361183241434822607, %rax
+	imulq	%r10
+	sarq	$7, %rdx
+	movq	%rdx, %rax
+	shrq	$63, %rax
+	addq	%rdx, %rax
+	imulq	$1000, %rax
+	subq	%rax, %r10
+	leaq	.__A, %rax
+	pushq	%r10
+	pushq	%rax
+	movq	.__I, %rax
+	subq	$1, %rax
+	movq	%rax, %rcx
+	popq	%rax
+	imulq	$8, %rcx
+	popq	(%rax,%rcx,1)
+..L18:
+	movq	.__I, %r13
+	movq	$100, %r14
+	cmpq	%r13, %r14
+	jle	..L17
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L16
+..L17:
+..L15:
+	movq	.__J, %r13
+	movq	$20, %r14
+	cmpq	%r13, %r14
+	jle	..L14
+	leaq	.__J, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L13
+..L14:
+	movq	$0, .__S
+	movq	$1, .__I
+..L19:
+	movq	.__I, %rdx
+	xorq	%rax, %rax
+	cmpq	$100, %rdx
+	setle	%al
+	testq	%rax, %rax
+	jz	..L20
+	leaq	.__A, %rax
+	pushq	.__S
+	pushq	%rax
+	movq	%rdx, %rax
+	subq	$1, %rax
+	popq	%r10
+	movq	%rax, %r12
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	popq	%rax
+	addq	%r10, %rax
+	addq	$1, .__I
+	movq	%rax, .__S
+	jmp	..L19
+..L20:
+..L21:
+	movq	.__S, %rax
+	cqo
+	shrq	$63, %rdx
+	addq	%rdx, %rax
+	sarq	$1, %rax
+	movq	%rax, .__S
+	movq	%rax, %rdx
+	xorq	%rax, %rax
+	cmpq	$10, %rdx
+	setl	%al
+	testq	%rax, %rax
+	jz	..L21
+..L22:
+	movq	%rdx, %rdi
+	call	._rt_write_int
+	leaq	.__.str0, %rdi
+	call	._rt_write_str
+	leaq	.__A, %rax
+	movq	$6, %r12
+	imulq	$8, %r12
+	movq	%rax, %r10
+	movq	(%r10,%r12,1), %r10
+	movq	%r10, -8(%rbp)
+	movq	%r10, %rax
+	addq	$1, %rax
+	jmp	..L23
+..L23:
+	movq	%rax, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	call	._rt_flush
+	movq	%rbp, %rsp
+	popq	%rbp
+	xorq	%rax, %rax
+	ret
+.__SMALL:
+	pushq	%rbp
+	movq	%rdi, %rax
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	addq	$1, %rax
+	movq	%rdi, -8(%rbp)
+	jmp	..L1
+..L1:
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+.__MID:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+	movq	%rdi, %rax
+	movq	%rsi, %r10
+	movq	(%rax), %rax
+	addq	%r10, %rax
+	pushq	%rax
+	movq	%rdi, %rax
+	popq	(%rax)
+	movq	-8(%rbp), %rax
+	pushq	(%rax)
+	movq	-16(%rbp), %rax
+	shlq	$1, %rax
+	movq	%rax, %r10
+	popq	%rax
+	addq	%r10, %rax
+	pushq	%rax
+	movq	-8(%rbp), %rax
+	popq	(%rax)
+	movq	-8(%rbp), %rax
+	movq	-16(%rbp), %r10
+	movq	(%rax), %rax
+	subq	%r10, %rax
+	pushq	%rax
+	movq	-8(%rbp), %rax
+	popq	(%rax)
+	movq	-8(%rbp), %rax
+	movq	(%rax), %rdx
+	xorq	%rax, %rax
+	cmpq	$1000000, %rdx
+	setg	%al
+	testq	%rax, %rax
+	jz	..L3
+	movq	-8(%rbp), %rax
+	movq	(%rax), %r10
+	movq	$2361183241434822607, %rax
+	imulq	%r10
+	sarq	$7, %rdx
+	movq	%rdx, %rax
+	shrq	$63, %rax
+	addq	%rdx, %rax
+	imulq	$1000, %rax
+	subq	%rax, %r10
+	movq	-8(%rbp), %rax
+	movq	%r10, (%rax)
+	jmp	..L4
+..L3:
+..L4:
+	movq	-8(%rbp), %rax
+	xorq	%r11, %r11
+	movq	(%rax), %rdx
+	xorq	%rax, %rax
+	cmpq	%r11, %rdx
+	setl	%al
+	testq	%rax, %rax
+	jz	..L5
+	movq	-8(%rbp), %rax
+	movq	(%rax), %rax
+	negq	%rax
+	pushq	%rax
+	movq	-8(%rbp), %rax
+	popq	(%rax)
+	jmp	..L6
+..L5:
+..L6:
+	movq	-8(%rbp), %rax
+	movq	(%rax), %rax
+	addq	$1, %rax
+	pushq	%rax
+	movq	-8(%rbp), %rax
+	popq	(%rax)
+..L2:
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+._rt_flush:
+	movq	.__._rt_len(%rip), %rdx
+	leaq	.__._rt_buf(%rip), %rsi
+._rt_flush.1:
+	testq	%rdx, %rdx
+	jz	._rt_flush.2
+	movq	$1, %rax
+	movq	$1, %rdi
+	syscall
+	cmpq	$-4, %rax
+	je	._rt_flush.1
+	testq	%rax, %rax
+	jle	._rt_flush.2
+	addq	%rax, %rsi
+	subq	%rax, %rdx
+	jmp	._rt_flush.1
+._rt_flush.2:
+	movq	$0, .__._rt_len(%rip)
+	ret
+._rt_reserve:
+	movq	.__._rt_len(%rip), %rax
+	cmpq	$65504, %rax
+	jbe	._rt_reserve.1
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	xorq	%rax, %rax
+._rt_reserve.1:
+	leaq	.__._rt_buf(%rip), %rsi
+	addq	%rax, %rsi
+	ret
+._rt_commit:
+	leaq	.__._rt_buf(%rip), %rax
+	subq	%rax, %rsi
+	movq	%rsi, .__._rt_len(%rip)
+	ret
+._rt_utoa:
+	movq	%rsp, %rdi
+	movabsq	$-3689348814741910323, %r8
+	movq	%rax, %rcx
+._rt_utoa.1:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	decq	%rdi
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	testq	%rcx, %rcx
+	jnz	._rt_utoa.1
+._rt_utoa.2:
+	movb	(%rdi), %al
+	movb	%al, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	cmpq	%rsp, %rdi
+	jb	._rt_utoa.2
+	ret
+._rt_write_char:
+	call	._rt_reserve
+	movb	%dil, (%rsi)
+	incq	%rsi
+	jmp	._rt_commit
+._rt_write_str:
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+._rt_write_str.1:
+	movb	(%rdi), %cl
+	testb	%cl, %cl
+	jz	._rt_commit
+	cmpq	%rdx, %rsi
+	jb	._rt_write_str.2
+	call	._rt_commit
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+	movb	(%rdi), %cl
+._rt_write_str.2:
+	movb	%cl, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	jmp	._rt_write_str.1
+._rt_write_int:
+	call	._rt_reserve
+	movq	%rdi, %rax
+	testq	%rax, %rax
+	jns	._rt_write_int.1
+	movb	$45, (%rsi)
+	incq	%rsi
+	negq	%rax
+._rt_write_int.1:
+	call	._rt_utoa
+	jmp	._rt_commit
+._rt_write_float:
+	call	._rt_reserve
+	movq	%rdi, %r11
+	shrq	$52, %r11
+	andq	$2047, %r11
+	cmpq	$1086, %r11
+	jae	._rt_write_float.slow
+	testq	%rdi, %rdi
+	jns	._rt_write_float.1
+	movb	$45, (%rsi)
+	incq	%rsi
+._rt_write_float.1:
+	movabsq	$4503599627370495, %r8
+	andq	%rdi, %r8
+	movq	$1075, %rcx
+	testq	%r11, %r11
+	jz	._rt_write_float.2
+	btsq	$52, %r8
+	subq	%r11, %rcx
+	jmp	._rt_write_float.3
+._rt_write_float.2:
+	decq	%rcx
+._rt_write_float.3:
+	xorq	%r9, %r9
+	testq	%rcx, %rcx
+	jg	._rt_write_float.4
+	negq	%rcx
+	shlq	%cl, %r8
+	movq	%r8, %r10
+	jmp	._rt_write_float.out
+._rt_write_float.4:
+	xorq	%r10, %r10
+	cmpq	$64, %rcx
+	jae	._rt_write_float.5
+	movq	%r8, %r10
+	shrq	%cl, %r10
+	movq	$1, %rax
+	shlq	%cl, %rax
+	decq	%rax
+	andq	%rax, %r8
+._rt_write_float.5:
+	cmpq	$74, %rcx
+	jae	._rt_write_float.out
+	movq	%r8, %rax
+	movq	$1000000, %rdx
+	mulq	%rdx
+	decq	%rcx
+	cmpq	$64, %rcx
+	jae	._rt_write_float.6
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rax, %r11
+	shrdq	%cl, %rdx, %rax
+	jmp	._rt_write_float.7
+._rt_write_float.6:
+	subq	$64, %rcx
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rdx, %r11
+	orq	%rax, %r11
+	movq	%rdx, %rax
+	shrq	%cl, %rax
+._rt_write_float.7:
+	movq	%rax, %r9
+	shrq	$1, %r9
+	testq	$1, %rax
+	jz	._rt_write_float.out
+	testq	%r11, %r11
+	jnz	._rt_write_float.8
+	testq	$1, %r9
+	jz	._rt_write_float.out
+._rt_write_float.8:
+	incq	%r9
+	cmpq	$1000000, %r9
+	jb	._rt_write_float.out
+	xorq	%r9, %r9
+	incq	%r10
+._rt_write_float.out:
+	movq	%r10, %rax
+	pushq	%r9
+	call	._rt_utoa
+	popq	%rcx
+	movb	$46, (%rsi)
+	leaq	6(%rsi), %rdi
+	movabsq	$-3689348814741910323, %r8
+._rt_write_float.9:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	decq	%rdi
+	cmpq	%rsi, %rdi
+	jnz	._rt_write_float.9
+	addq	$7, %rsi
+	jmp	._rt_commit
+._rt_write_float.slow:
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	pushq	%rbp
+	movq	%rsp, %rbp
+	andq	$-16, %rsp
+	movq	%rdi, %xmm0
+	leaq	.__._rt_buf(%rip), %rdi
+	movq	$65536, %rsi
+	leaq	.__._rt_fmt_float(%rip), %rdx
+	movq	$1, %rax
+	call	snprintf
+	movq	%rax, .__._rt_len(%rip)
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+
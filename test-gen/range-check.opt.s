@@ -0,0 +1,597 @@
+	.globl main
+.data
+	.__A: .fill 80,1,0
+.data
+	.__B: .fill 80,1,0
+.data
+	.__M: .fill 72,1,0
+.data
+	.__I: .quad 0
+.data
+	.__J: .quad 0
+.data
+	.__K: .quad 0
+.data
+	.__N: .quad 0
+.data
+	.__S: .quad 0
+.__.str0:
+	.string " "
+.__.str1:
+	.string " "
+	.lcomm .__._rt_buf, 65536
+.data
+	.__._rt_len: .quad 0
+.__._rt_fmt_float:
+	.string "%lf"
+.text
+main:
+	leaq	.__I, %rax
+	movq	$10, .__N
+	movq	$10, %r13
+	movq	%rax, %r14
+	pushq	%rbp
+	movq	$1, (%r14)
+	movq	%rsp, %rbp
+	cmpq	(%r14), %r13
+	jl	..L2
+..L1:
+	movq	.__I, %r10
+	movq	%r10, %rax
+	imulq	%r10, %rax
+	pushq	%rax
+	leaq	.__A, %rax
+	pushq	%rax
+	movq	%r10, %rax
+	subq	$1, %rax
+	movq	%rax, %rcx
+	popq	%rax
+	imulq	$8, %rcx
+	popq	(%rax,%rcx,1)
+..L3:
+	movq	.__I, %r13
+	movq	$10, %r14
+	cmpq	%r13, %r14
+	jle	..L2
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L1
+..L2:
+	movq	.__N, %rax
+	subq	$1, %rax
+	pushq	$2
+	pushq	%rax
+	leaq	.__B, %rax
+	pushq	%rax
+	leaq	.__A, %rax
+	movq	%rax, %r10
+	popq	%r9
+	popq	%rdx
+	popq	%rcx
+..L7:
+	cmpq	%rdx, %rcx
+	jg	..L10
+..L8:
+	leaq	1(%rcx), %rax
+	cmpq	%rdx, %rax
+	jg	..L9
+	movdqu	-16(%r10,%rcx,8), %xmm0
+	movdqu	(%r10,%rcx,8), %xmm1
+	paddq	%xmm1, %xmm0
+	movdqu	%xmm0, -8(%r9,%rcx,8)
+	addq	$2, %rcx
+	jmp	..L8
+..L9:
+	cmpq	%rdx, %rcx
+	jle	..L11
+	movq	%rdx, %rcx
+..L10:
+	movq	%rcx, .__I
+	jmp	..L5
+..L11:
+	movq	%rcx, .__I
+..L4:
+	leaq	.__A, %rax
+	pushq	%rax
+	movq	.__I, %rax
+	popq	%r10
+	subq	$1, %rax
+	subq	$1, %rax
+	movq	%rax, %r12
+	leaq	.__A, %rax
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	pushq	%r10
+	pushq	%rax
+	movq	.__I, %rax
+	popq	%r10
+	addq	$1, %rax
+	subq	$1, %rax
+	movq	%rax, %r12
+	popq	%rax
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	addq	%r10, %rax
+	pushq	%rax
+	leaq	.__B, %rax
+	pushq	%rax
+	movq	.__I, %rax
+	subq	$1, %rax
+	movq	%rax, %rcx
+	popq	%rax
+	imulq	$8, %rcx
+	popq	(%rax,%rcx,1)
+..L6:
+	movq	.__N, %rax
+	movq	.__I, %r13
+	subq	$1, %rax
+	movq	%rax, %r14
+	cmpq	%r13, %r14
+	jle	..L5
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L4
+..L5:
+	leaq	.__B, %rax
+	movq	$1, %r12
+	imulq	$8, %r12
+	movq	%rax, %r10
+	movq	(%r10,%r12,1), %rdi
+	call	._rt_write_int
+	leaq	.__.str0, %rdi
+	call	._rt_write_str
+	leaq	.__B, %rax
+	movq	$8, %r12
+	imulq	$8, %r12
+	movq	%rax, %r10
+	movq	(%r10,%r12,1), %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	$0, .__S
+	leaq	.__I, %rax
+	movq	.__N, %r13
+	movq	%rax, %r14
+	movq	$1, (%r14)
+	cmpq	(%r14), %r13
+	jl	..L13
+..L12:
+	movq	.__I, %rax
+	movq	.__N, %rbx
+	pushq	.__S
+	imulq	$7, %rax
+	cqo
+	idivq	%rbx
+	movq	%rdx, %rax
+	addq	$1, %rax
+	movq	%rax, .__K
+	leaq	.__A, %rax
+	pushq	%rax
+	popq	%r10
+	movq	.__K, %rax
+	subq	$1, %rax
+	movq	%rax, %r12
+	popq	%rax
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	addq	%r10, %rax
+	pushq	%rax
+	leaq	.__B, %rax
+	pushq	%rax
+	movq	.__K, %rax
+	popq	%r10
+	subq	$1, %rax
+	movq	%rax, %r12
+	popq	%rax
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	subq	%r10, %rax
+	movq	%rax, .__S
+..L14:
+	movq	.__I, %r13
+	movq	%rbx, %r14
+	cmpq	%r13, %r14
+	jle	..L13
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L12
+..L13:
+	movq	.__S, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	leaq	.__I, %rax
+	pushq	.__N
+	popq	(%rax)
+..L17:
+	xorq	%r11, %r11
+	movq	.__I, %rdx
+	xorq	%rax, %rax
+	cmpq	%r11, %rdx
+	setg	%al
+	testq	%rax, %rax
+	jz	..L18
+	leaq	.__A, %rax
+	pushq	.__S
+	pushq	%rax
+	movq	%rdx, %rax
+	subq	$1, %rax
+	popq	%r10
+	movq	%rax, %r12
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	popq	%rax
+	addq	%r10, %rax
+	subq	$1, .__I
+	movq	%rax, .__S
+	jmp	..L17
+..L18:
+	movq	.__S, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	leaq	.__I, %rax
+	movq	%rax, %r14
+	movq	$3, (%r14)
+	movq	$1, %r13
+	cmpq	(%r14), %r13
+	jg	..L20
+..L19:
+	leaq	.__J, %rax
+	movq	%rax, %r14
+	movq	$1, (%r14)
+	movq	$3, %r13
+	cmpq	(%r14), %r13
+	jl	..L23
+..L22:
+	movq	.__I, %rax
+	movq	$1, %r9
+	leaq	(%rax,%rax,4), %rax
+	shlq	$1, %rax
+	addq	.__J, %rax
+	pushq	%rax
+	leaq	.__M, %rax
+	pushq	%rax
+	movq	.__I, %rax
+	subq	$1, %rax
+	imulq	$3, %rax
+	pushq	%rax
+	movq	.__J, %rax
+	subq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	movq	%rax, %rcx
+	popq	%rax
+	imulq	$8, %rcx
+	popq	(%rax,%rcx,1)
+..L24:
+	movq	.__J, %r13
+	movq	$3, %r14
+	cmpq	%r13, %r14
+	jle	..L23
+	leaq	.__J, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L22
+..L23:
+..L21:
+	movq	.__I, %r13
+	movq	$1, %r14
+	cmpq	%r13, %r14
+	jge	..L20
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	subq	$1, (%r12)
+	jmp	..L19
+..L20:
+	leaq	.__M, %rax
+	movq	$1, %r9
+	pushq	%rax
+	xorq	%rax, %rax
+	imulq	$3, %rax
+	pushq	%rax
+	movq	$1, %rax
+	subq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	popq	%r10
+	movq	%rax, %r12
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %rdi
+	call	._rt_write_int
+	leaq	.__.str1, %rdi
+	call	._rt_write_str
+	leaq	.__M, %rax
+	movq	$1, %r9
+	pushq	%rax
+	movq	$2, %rax
+	imulq	$3, %rax
+	pushq	%rax
+	movq	$3, %rax
+	subq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	popq	%r10
+	movq	%rax, %r12
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	$4, .__N
+	leaq	.__J, %rax
+	movq	%rax, %r14
+	movq	.__N, %r13
+	movq	$1, (%r14)
+	cmpq	(%r14), %r13
+	jl	..L26
+..L25:
+	leaq	.__M, %rax
+	pushq	.__J
+	movq	$1, %r9
+	pushq	%rax
+	xorq	%rax, %rax
+	imulq	$3, %rax
+	pushq	%rax
+	movq	.__J, %rax
+	subq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	movq	%rax, %rcx
+	popq	%rax
+	imulq	$8, %rcx
+	popq	(%rax,%rcx,1)
+..L27:
+	movq	.__J, %r13
+	movq	.__N, %r14
+	cmpq	%r13, %r14
+	jle	..L26
+	leaq	.__J, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L25
+..L26:
+	leaq	.__M, %rax
+	movq	$1, %r9
+	pushq	%rax
+	movq	$1, %rax
+	imulq	$3, %rax
+	pushq	%rax
+	movq	$1, %rax
+	subq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	popq	%r10
+	movq	%rax, %r12
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	call	._rt_flush
+	popq	%rbp
+	xorq	%rax, %rax
+	ret
+._rt_flush:
+	movq	.__._rt_len(%rip), %rdx
+	leaq	.__._rt_buf(%rip), %rsi
+._rt_flush.1:
+	testq	%rdx, %rdx
+	jz	._rt_flush.2
+	movq	$1, %rax
+	movq	$1, %rdi
+	syscall
+	cmpq	$-4, %rax
+	je	._rt_flush.1
+	testq	%rax, %rax
+	jle	._rt_flush.2
+	addq	%rax, %rsi
+	subq	%rax, %rdx
+	jmp	._rt_flush.1
+._rt_flush.2:
+	movq	$0, .__._rt_len(%rip)
+	ret
+._rt_reserve:
+	movq	.__._rt_len(%rip), %rax
+	cmpq	$65504, %rax
+	jbe	._rt_reserve.1
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	xorq	%rax, %rax
+._rt_reserve.1:
+	leaq	.__._rt_buf(%rip), %rsi
+	addq	%rax, %rsi
+	ret
+._rt_commit:
+	leaq	.__._rt_buf(%rip), %rax
+	subq	%rax, %rsi
+	movq	%rsi, .__._rt_len(%rip)
+	ret
+._rt_utoa:
+	movq	%rsp, %rdi
+	movabsq	$-3689348814741910323, %r8
+	movq	%rax, %rcx
+._rt_utoa.1:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	decq	%rdi
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	testq	%rcx, %rcx
+	jnz	._rt_utoa.1
+._rt_utoa.2:
+	movb	(%rdi), %al
+	movb	%al, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	cmpq	%rsp, %rdi
+	jb	._rt_utoa.2
+	ret
+._rt_write_char:
+	call	._rt_reserve
+	movb	%dil, (%rsi)
+	incq	%rsi
+	jmp	._rt_commit
+._rt_write_str:
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+._rt_write_str.1:
+	movb	(%rdi), %cl
+	testb	%cl, %cl
+	jz	._rt_commit
+	cmpq	%rdx, %rsi
+	jb	._rt_write_str.2
+	call	._rt_commit
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+	movb	(%rdi), %cl
+._rt_write_str.2:
+	movb	%cl, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	jmp	._rt_write_str.1
+._rt_write_int:
+	call	._rt_reserve
+	movq	%rdi, %rax
+	testq	%rax, %rax
+	jns	._rt_write_int.1
+	movb	$45, (%rsi)
+	incq	%rsi
+	negq	%rax
+._rt_write_int.1:
+	call	._rt_utoa
+	jmp	._rt_commit
+._rt_write_float:
+	call	._rt_reserve
+	movq	%rdi, %r11
+	shrq	$52, %r11
+	andq	$2047, %r11
+	cmpq	$1086, %r11
+	jae	._rt_write_float.slow
+	testq	%rdi, %rdi
+	jns	._rt_write_float.1
+	movb	$45, (%rsi)
+	incq	%rsi
+._rt_write_float.1:
+	movabsq	$4503599627370495, %r8
+	andq	%rdi, %r8
+	movq	$1075, %rcx
+	testq	%r11, %r11
+	jz	._rt_write_float.2
+	btsq	$52, %r8
+	subq	%r11, %rcx
+	jmp	._rt_write_float.3
+._rt_write_float.2:
+	decq	%rcx
+._rt_write_float.3:
+	xorq	%r9, %r9
+	testq	%rcx, %rcx
+	jg	._rt_write_float.4
+	negq	%rcx
+	shlq	%cl, %r8
+	movq	%r8, %r10
+	jmp	._rt_write_float.out
+._rt_write_float.4:
+	xorq	%r10, %r10
+	cmpq	$64, %rcx
+	jae	._rt_write_float.5
+	movq	%r8, %r10
+	shrq	%cl, %r10
+	movq	$1, %rax
+	shlq	%cl, %rax
+	decq	%rax
+	andq	%rax, %r8
+._rt_write_float.5:
+	cmpq	$74, %rcx
+	jae	._rt_write_float.out
+	movq	%r8, %rax
+	movq	$1000000, %rdx
+	mulq	%rdx
+	decq	%rcx
+	cmpq	$64, %rcx
+	jae	._rt_write_float.6
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rax, %r11
+	shrdq	%cl, %rdx, %rax
+	jmp	._rt_write_float.7
+._rt_write_float.6:
+	subq	$64, %rcx
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rdx, %r11
+	orq	%rax, %r11
+	movq	%rdx, %rax
+	shrq	%cl, %rax
+._rt_write_float.7:
+	movq	%rax, %r9
+	shrq	$1, %r9
+	testq	$1, %rax
+	jz	._rt_write_float.out
+	testq	%r11, %r11
+	jnz	._rt_write_float.8
+	testq	$1, %r9
+	jz	._rt_write_float.out
+._rt_write_float.8:
+	incq	%r9
+	cmpq	$1000000, %r9
+	jb	._rt_write_float.out
+	xorq	%r9, %r9
+	incq	%r10
+._rt_write_float.out:
+	movq	%r10, %rax
+	pushq	%r9
+	call	._rt_utoa
+	popq	%rcx
+	movb	$46, (%rsi)
+	leaq	6(%rsi), %rdi
+	movabsq	$-3689348814741910323, %r8
+._rt_write_float.9:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	decq	%rdi
+	cmpq	%rsi, %rdi
+	jnz	._rt_write_float.9
+	addq	$7, %rsi
+	jmp	._rt_commit
+._rt_write_float.slow:
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	pushq	%rbp
+	movq	%rsp, %rbp
+	andq	$-16, %rsp
+	movq	%rdi, %xmm0
+	leaq	.__._rt_buf(%rip), %rdi
+	movq	$65536, %rsi
+	leaq	.__._rt_fmt_float(%rip), %rdx
+	movq	$1, %rax
+	call	snprintf
+	movq	%rax, .__._rt_len(%rip)
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+
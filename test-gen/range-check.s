@@ -0,0 +1,850 @@
+	.globl main
+.data
+	.__A: .fill 80,1,0
+.data
+	.__B: .fill 80,1,0
+.data
+	.__M: .fill 72,1,0
+.data
+	.__I: .quad 0
+.data
+	.__J: .quad 0
+.data
+	.__K: .quad 0
+.data
+	.__N: .quad 0
+.data
+	.__S: .quad 0
+.__.str0:
+	.string " "
+.__.str1:
+	.string " "
+	.lcomm .__._rt_buf, 65536
+.data
+	.__._rt_len: .quad 0
+.__._rt_fmt_float:
+	.string "%lf"
+.text
+main:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	pushq	$10
+	leaq	.__N, %rax
+	pushq	%rax
+	popq	%rax
+	popq	(%rax)
+	pushq	$1
+	leaq	.__I, %rax
+	pushq	%rax
+	pushq	$10
+	popq	%r13
+	popq	%r14
+	popq	(%r14)
+	movq	(%r14), %r14
+	cmpq	%r14, %r13
+	jl	..L2
+..L1:
+	pushq	.__I
+	pushq	.__I
+	popq	%r10
+	popq	%rax
+	imulq	%r10, %rax
+	pushq	%rax
+	leaq	.__A, %rax
+	pushq	%rax
+	pushq	$0
+	pushq	.__I
+	movq	$1, %r9
+	popq	%rax
+	subq	%r9, %rax
+	movq	$1, %r9
+	imulq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	pushq	%rax
+	popq	%rcx
+	imulq	$8, %rcx
+	popq	%rax
+	leaq	(%rax,%rcx,1), %rax
+	pushq	%rax
+	popq	%rax
+	popq	(%rax)
+..L3:
+	pushq	$10
+	pushq	.__I
+	popq	%r13
+	popq	%r14
+	cmpq	%r13, %r14
+	jle	..L2
+	leaq	.__I, %rax
+	pushq	%rax
+	popq	%r12
+	addq	$1, (%r12)
+	jmp	..L1
+..L2:
+	pushq	$2
+	leaq	.__I, %rax
+	pushq	%rax
+	pushq	.__N
+	pushq	$1
+	popq	%r10
+	popq	%rax
+	subq	%r10, %rax
+	pushq	%rax
+	popq	%r13
+	popq	%r14
+	popq	(%r14)
+	movq	(%r14), %r14
+	cmpq	%r14, %r13
+	jl	..L5
+..L4:
+	leaq	.__A, %rax
+	pushq	%rax
+	pushq	$0
+	pushq	.__I
+	pushq	$1
+	popq	%r10
+	popq	%rax
+	subq	%r10, %rax
+	pushq	%rax
+	movq	$1, %r9
+	popq	%rax
+	subq	%r9, %rax
+	movq	$1, %r9
+	imulq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	pushq	%rax
+	popq	%r12
+	imulq	$8, %r12
+	popq	%r10
+	movq	(%r10,%r12,1), %r10
+	pushq	%r10
+	leaq	.__A, %rax
+	pushq	%rax
+	pushq	$0
+	pushq	.__I
+	pushq	$1
+	popq	%r10
+	popq	%rax
+	addq	%r10, %rax
+	pushq	%rax
+	movq	$1, %r9
+	popq	%rax
+	subq	%r9, %rax
+	movq	$1, %r9
+	imulq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	pushq	%rax
+	popq	%r12
+	imulq	$8, %r12
+	popq	%r10
+	movq	(%r10,%r12,1), %r10
+	pushq	%r10
+	popq	%r10
+	popq	%rax
+	addq	%r10, %rax
+	pushq	%rax
+	leaq	.__B, %rax
+	pushq	%rax
+	pushq	$0
+	pushq	.__I
+	movq	$1, %r9
+	popq	%rax
+	subq	%r9, %rax
+	movq	$1, %r9
+	imulq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	pushq	%rax
+	popq	%rcx
+	imulq	$8, %rcx
+	popq	%rax
+	leaq	(%rax,%rcx,1), %rax
+	pushq	%rax
+	popq	%rax
+	popq	(%rax)
+..L6:
+	pushq	.__N
+	pushq	$1
+	popq	%r10
+	popq	%rax
+	subq	%r10, %rax
+	pushq	%rax
+	pushq	.__I
+	popq	%r13
+	popq	%r14
+	cmpq	%r13, %r14
+	jle	..L5
+	leaq	.__I, %rax
+	pushq	%rax
+	popq	%r12
+	addq	$1, (%r12)
+	jmp	..L4
+..L5:
+	leaq	.__B, %rax
+	pushq	%rax
+	pushq	$0
+	pushq	$2
+	movq	$1, %r9
+	popq	%rax
+	subq	%r9, %rax
+	movq	$1, %r9
+	imulq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	pushq	%rax
+	popq	%r12
+	imulq	$8, %r12
+	popq	%r10
+	movq	(%r10,%r12,1), %r10
+	pushq	%r10
+	popq	%rdi
+	call	._rt_write_int
+	leaq	.__.str0, %rdi
+	call	._rt_write_str
+	leaq	.__B, %rax
+	pushq	%rax
+	pushq	$0
+	pushq	$9
+	movq	$1, %r9
+	popq	%rax
+	subq	%r9, %rax
+	movq	$1, %r9
+	imulq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	pushq	%rax
+	popq	%r12
+	imulq	$8, %r12
+	popq	%r10
+	movq	(%r10,%r12,1), %r10
+	pushq	%r10
+	popq	%rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	pushq	$0
+	leaq	.__S, %rax
+	pushq	%rax
+	popq	%rax
+	popq	(%rax)
+	pushq	$1
+	leaq	.__I, %rax
+	pushq	%rax
+	pushq	.__N
+	popq	%r13
+	popq	%r14
+	popq	(%r14)
+	movq	(%r14), %r14
+	cmpq	%r14, %r13
+	jl	..L8
+..L7:
+	pushq	.__I
+	pushq	$7
+	popq	%r10
+	popq	%rax
+	imulq	%r10, %rax
+	pushq	%rax
+	pushq	.__N
+	popq	%rbx
+	popq	%rax
+	xorq	%rdx, %rdx
+	cqo
+	idivq	%rbx
+	movq	%rdx, %rax
+	pushq	%rax
+	pushq	$1
+	popq	%r10
+	popq	%rax
+	addq	%r10, %rax
+	pushq	%rax
+	leaq	.__K, %rax
+	pushq	%rax
+	popq	%rax
+	popq	(%rax)
+	pushq	.__S
+	leaq	.__A, %rax
+	pushq	%rax
+	pushq	$0
+	pushq	.__K
+	movq	$1, %r9
+	popq	%rax
+	subq	%r9, %rax
+	movq	$1, %r9
+	imulq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	pushq	%rax
+	popq	%r12
+	imulq	$8, %r12
+	popq	%r10
+	movq	(%r10,%r12,1), %r10
+	pushq	%r10
+	popq	%r10
+	popq	%rax
+	addq	%r10, %rax
+	pushq	%rax
+	leaq	.__B, %rax
+	pushq	%rax
+	pushq	$0
+	pushq	.__K
+	movq	$1, %r9
+	popq	%rax
+	subq	%r9, %rax
+	movq	$1, %r9
+	imulq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	pushq	%rax
+	popq	%r12
+	imulq	$8, %r12
+	popq	%r10
+	movq	(%r10,%r12,1), %r10
+	pushq	%r10
+	popq	%r10
+	popq	%rax
+	subq	%r10, %rax
+	pushq	%rax
+	leaq	.__S, %rax
+	pushq	%rax
+	popq	%rax
+	popq	(%rax)
+..L9:
+	pushq	.__N
+	pushq	.__I
+	popq	%r13
+	popq	%r14
+	cmpq	%r13, %r14
+	jle	..L8
+	leaq	.__I, %rax
+	pushq	%rax
+	popq	%r12
+	addq	$1, (%r12)
+	jmp	..L7
+..L8:
+	pushq	.__S
+	popq	%rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	pushq	.__N
+	leaq	.__I, %rax
+	pushq	%rax
+	popq	%rax
+	popq	(%rax)
+..L12:
+	pushq	.__I
+	pushq	$0
+	popq	%r11
+	popq	%rdx
+	xorq	%rax, %rax
+	cmpq	%r11, %rdx
+	setg	%al
+	pushq	%rax
+	popq	%rax
+	testq	%rax, %rax
+	jz	..L13
+	pushq	.__S
+	leaq	.__A, %rax
+	pushq	%rax
+	pushq	$0
+	pushq	.__I
+	movq	$1, %r9
+	popq	%rax
+	subq	%r9, %rax
+	movq	$1, %r9
+	imulq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	pushq	%rax
+	popq	%r12
+	imulq	$8, %r12
+	popq	%r10
+	movq	(%r10,%r12,1), %r10
+	pushq	%r10
+	popq	%r10
+	popq	%rax
+	addq	%r10, %rax
+	pushq	%rax
+	leaq	.__S, %rax
+	pushq	%rax
+	popq	%rax
+	popq	(%rax)
+	pushq	.__I
+	pushq	$1
+	popq	%r10
+	popq	%rax
+	subq	%r10, %rax
+	pushq	%rax
+	leaq	.__I, %rax
+	pushq	%rax
+	popq	%rax
+	popq	(%rax)
+	jmp	..L12
+..L13:
+	pushq	.__S
+	popq	%rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	pushq	$3
+	leaq	.__I, %rax
+	pushq	%rax
+	pushq	$1
+	popq	%r13
+	popq	%r14
+	popq	(%r14)
+	movq	(%r14), %r14
+	cmpq	%r14, %r13
+	jg	..L15
+..L14:
+	pushq	$1
+	leaq	.__J, %rax
+	pushq	%rax
+	pushq	$3
+	popq	%r13
+	popq	%r14
+	popq	(%r14)
+	movq	(%r14), %r14
+	cmpq	%r14, %r13
+	jl	..L18
+..L17:
+	pushq	.__I
+	pushq	$10
+	popq	%r10
+	popq	%rax
+	imulq	%r10, %rax
+	pushq	%rax
+	pushq	.__J
+	popq	%r10
+	popq	%rax
+	addq	%r10, %rax
+	pushq	%rax
+	leaq	.__M, %rax
+	pushq	%rax
+	pushq	$0
+	pushq	.__I
+	movq	$1, %r9
+	popq	%rax
+	subq	%r9, %rax
+	movq	$3, %r9
+	imulq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	pushq	%rax
+	pushq	.__J
+	movq	$1, %r9
+	popq	%rax
+	subq	%r9, %rax
+	movq	$1, %r9
+	imulq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	pushq	%rax
+	popq	%rcx
+	imulq	$8, %rcx
+	popq	%rax
+	leaq	(%rax,%rcx,1), %rax
+	pushq	%rax
+	popq	%rax
+	popq	(%rax)
+..L19:
+	pushq	$3
+	pushq	.__J
+	popq	%r13
+	popq	%r14
+	cmpq	%r13, %r14
+	jle	..L18
+	leaq	.__J, %rax
+	pushq	%rax
+	popq	%r12
+	addq	$1, (%r12)
+	jmp	..L17
+..L18:
+..L16:
+	pushq	$1
+	pushq	.__I
+	popq	%r13
+	popq	%r14
+	cmpq	%r13, %r14
+	jge	..L15
+	leaq	.__I, %rax
+	pushq	%rax
+	popq	%r12
+	subq	$1, (%r12)
+	jmp	..L14
+..L15:
+	leaq	.__M, %rax
+	pushq	%rax
+	pushq	$0
+	pushq	$1
+	movq	$1, %r9
+	popq	%rax
+	subq	%r9, %rax
+	movq	$3, %r9
+	imulq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	pushq	%rax
+	pushq	$1
+	movq	$1, %r9
+	popq	%rax
+	subq	%r9, %rax
+	movq	$1, %r9
+	imulq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	pushq	%rax
+	popq	%r12
+	imulq	$8, %r12
+	popq	%r10
+	movq	(%r10,%r12,1), %r10
+	pushq	%r10
+	popq	%rdi
+	call	._rt_write_int
+	leaq	.__.str1, %rdi
+	call	._rt_write_str
+	leaq	.__M, %rax
+	pushq	%rax
+	pushq	$0
+	pushq	$3
+	movq	$1, %r9
+	popq	%rax
+	subq	%r9, %rax
+	movq	$3, %r9
+	imulq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	pushq	%rax
+	pushq	$3
+	movq	$1, %r9
+	popq	%rax
+	subq	%r9, %rax
+	movq	$1, %r9
+	imulq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	pushq	%rax
+	popq	%r12
+	imulq	$8, %r12
+	popq	%r10
+	movq	(%r10,%r12,1), %r10
+	pushq	%r10
+	popq	%rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	pushq	$4
+	leaq	.__N, %rax
+	pushq	%rax
+	popq	%rax
+	popq	(%rax)
+	pushq	$1
+	leaq	.__J, %rax
+	pushq	%rax
+	pushq	.__N
+	popq	%r13
+	popq	%r14
+	popq	(%r14)
+	movq	(%r14), %r14
+	cmpq	%r14, %r13
+	jl	..L21
+..L20:
+	pushq	.__J
+	leaq	.__M, %rax
+	pushq	%rax
+	pushq	$0
+	pushq	$1
+	movq	$1, %r9
+	popq	%rax
+	subq	%r9, %rax
+	movq	$3, %r9
+	imulq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	pushq	%rax
+	pushq	.__J
+	movq	$1, %r9
+	popq	%rax
+	subq	%r9, %rax
+	movq	$1, %r9
+	imulq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	pushq	%rax
+	popq	%rcx
+	imulq	$8, %rcx
+	popq	%rax
+	leaq	(%rax,%rcx,1), %rax
+	pushq	%rax
+	popq	%rax
+	popq	(%rax)
+..L22:
+	pushq	.__N
+	pushq	.__J
+	popq	%r13
+	popq	%r14
+	cmpq	%r13, %r14
+	jle	..L21
+	leaq	.__J, %rax
+	pushq	%rax
+	popq	%r12
+	addq	$1, (%r12)
+	jmp	..L20
+..L21:
+	leaq	.__M, %rax
+	pushq	%rax
+	pushq	$0
+	pushq	$2
+	movq	$1, %r9
+	popq	%rax
+	subq	%r9, %rax
+	movq	$3, %r9
+	imulq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	pushq	%rax
+	pushq	$1
+	movq	$1, %r9
+	popq	%rax
+	subq	%r9, %rax
+	movq	$1, %r9
+	imulq	%r9, %rax
+	popq	%r9
+	addq	%r9, %rax
+	pushq	%rax
+	popq	%r12
+	imulq	$8, %r12
+	popq	%r10
+	movq	(%r10,%r12,1), %r10
+	pushq	%r10
+	popq	%rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	call	._rt_flush
+	popq	%rbp
+	xorq	%rax, %rax
+	ret
+._rt_flush:
+	movq	.__._rt_len(%rip), %rdx
+	leaq	.__._rt_buf(%rip), %rsi
+._rt_flush.1:
+	testq	%rdx, %rdx
+	jz	._rt_flush.2
+	movq	$1, %rax
+	movq	$1, %rdi
+	syscall
+	cmpq	$-4, %rax
+	je	._rt_flush.1
+	testq	%rax, %rax
+	jle	._rt_flush.2
+	addq	%rax, %rsi
+	subq	%rax, %rdx
+	jmp	._rt_flush.1
+._rt_flush.2:
+	movq	$0, .__._rt_len(%rip)
+	ret
+._rt_reserve:
+	movq	.__._rt_len(%rip), %rax
+	cmpq	$65504, %rax
+	jbe	._rt_reserve.1
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	xorq	%rax, %rax
+._rt_reserve.1:
+	leaq	.__._rt_buf(%rip), %rsi
+	addq	%rax, %rsi
+	ret
+._rt_commit:
+	leaq	.__._rt_buf(%rip), %rax
+	subq	%rax, %rsi
+	movq	%rsi, .__._rt_len(%rip)
+	ret
+._rt_utoa:
+	movq	%rsp, %rdi
+	movabsq	$-3689348814741910323, %r8
+	movq	%rax, %rcx
+._rt_utoa.1:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	decq	%rdi
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	testq	%rcx, %rcx
+	jnz	._rt_utoa.1
+._rt_utoa.2:
+	movb	(%rdi), %al
+	movb	%al, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	cmpq	%rsp, %rdi
+	jb	._rt_utoa.2
+	ret
+._rt_write_char:
+	call	._rt_reserve
+	movb	%dil, (%rsi)
+	incq	%rsi
+	jmp	._rt_commit
+._rt_write_str:
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+._rt_write_str.1:
+	movb	(%rdi), %cl
+	testb	%cl, %cl
+	jz	._rt_commit
+	cmpq	%rdx, %rsi
+	jb	._rt_write_str.2
+	call	._rt_commit
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+	movb	(%rdi), %cl
+._rt_write_str.2:
+	movb	%cl, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	jmp	._rt_write_str.1
+._rt_write_int:
+	call	._rt_reserve
+	movq	%rdi, %rax
+	testq	%rax, %rax
+	jns	._rt_write_int.1
+	movb	$45, (%rsi)
+	incq	%rsi
+	negq	%rax
+._rt_write_int.1:
+	call	._rt_utoa
+	jmp	._rt_commit
+._rt_write_float:
+	call	._rt_reserve
+	movq	%rdi, %r11
+	shrq	$52, %r11
+	andq	$2047, %r11
+	cmpq	$1086, %r11
+	jae	._rt_write_float.slow
+	testq	%rdi, %rdi
+	jns	._rt_write_float.1
+	movb	$45, (%rsi)
+	incq	%rsi
+._rt_write_float.1:
+	movabsq	$4503599627370495, %r8
+	andq	%rdi, %r8
+	movq	$1075, %rcx
+	testq	%r11, %r11
+	jz	._rt_write_float.2
+	btsq	$52, %r8
+	subq	%r11, %rcx
+	jmp	._rt_write_float.3
+._rt_write_float.2:
+	decq	%rcx
+._rt_write_float.3:
+	xorq	%r9, %r9
+	testq	%rcx, %rcx
+	jg	._rt_write_float.4
+	negq	%rcx
+	shlq	%cl, %r8
+	movq	%r8, %r10
+	jmp	._rt_write_float.out
+._rt_write_float.4:
+	xorq	%r10, %r10
+	cmpq	$64, %rcx
+	jae	._rt_write_float.5
+	movq	%r8, %r10
+	shrq	%cl, %r10
+	movq	$1, %rax
+	shlq	%cl, %rax
+	decq	%rax
+	andq	%rax, %r8
+._rt_write_float.5:
+	cmpq	$74, %rcx
+	jae	._rt_write_float.out
+	movq	%r8, %rax
+	movq	$1000000, %rdx
+	mulq	%rdx
+	decq	%rcx
+	cmpq	$64, %rcx
+	jae	._rt_write_float.6
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rax, %r11
+	shrdq	%cl, %rdx, %rax
+	jmp	._rt_write_float.7
+._rt_write_float.6:
+	subq	$64, %rcx
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rdx, %r11
+	orq	%rax, %r11
+	movq	%rdx, %rax
+	shrq	%cl, %rax
+._rt_write_float.7:
+	movq	%rax, %r9
+	shrq	$1, %r9
+	testq	$1, %rax
+	jz	._rt_write_float.out
+	testq	%r11, %r11
+	jnz	._rt_write_float.8
+	testq	$1, %r9
+	jz	._rt_write_float.out
+._rt_write_float.8:
+	incq	%r9
+	cmpq	$1000000, %r9
+	jb	._rt_write_float.out
+	xorq	%r9, %r9
+	incq	%r10
+._rt_write_float.out:
+	movq	%r10, %rax
+	pushq	%r9
+	call	._rt_utoa
+	popq	%rcx
+	movb	$46, (%rsi)
+	leaq	6(%rsi), %rdi
+	movabsq	$-3689348814741910323, %r8
+._rt_write_float.9:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	decq	%rdi
+	cmpq	%rsi, %rdi
+	jnz	._rt_write_float.9
+	addq	$7, %rsi
+	jmp	._rt_commit
+._rt_write_float.slow:
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	pushq	%rbp
+	movq	%rsp, %rbp
+	andq	$-16, %rsp
+	movq	%rdi, %xmm0
+	leaq	.__._rt_buf(%rip), %rdi
+	movq	$65536, %rsi
+	leaq	.__._rt_fmt_float(%rip), %rdx
+	movq	$1, %rax
+	call	snprintf
+	movq	%rax, .__._rt_len(%rip)
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+
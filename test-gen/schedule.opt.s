@@ -0,0 +1,574 @@
+	.globl main
+.data
+	.__A: .quad 0
+.data
+	.__B: .quad 0
+.data
+	.__C: .quad 0
+.data
+	.__D: .quad 0
+.data
+	.__E: .quad 0
+.data
+	.__Q: .quad 0
+.data
+	.__R: .quad 0
+.data
+	.__I: .quad 0
+.data
+	.__X: .double 0
+.data
+	.__Y: .double 0
+.data
+	.__Z: .double 0
+.data
+	.__V: .fill 64,1,0
+.data
+	.__P: .quad 0
+.__.str0:
+	.string " "
+.__.str1:
+	.string " "
+.__.str2:
+	.string " "
+.__.str3:
+	.string " "
+.__.str4:
+	.string " "
+.__.str5:
+	.string " "
+.__.str6:
+	.string " "
+	.lcomm .__._rt_buf, 65536
+.data
+	.__._rt_len: .quad 0
+.__._rt_fmt_float:
+	.string "%lf"
+.text
+main:
+	leaq	.__D, %rax
+	pushq	%rbp
+	movq	$8, %r13
+	movq	%rax, .__P
+	movq	$3, %rax
+	movq	%rsp, %rbp
+	cvtsi2sd	%rax, %xmm0
+	movq	$12, .__A
+	movq	$7, .__B
+	movq	$5, .__C
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	$2, %rax
+	cvtsi2sd	%rax, %xmm0
+	popq	%rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	divsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	movq	%rax, .__X
+	leaq	.__I, %rax
+	movq	%rax, %r14
+	movq	$1, (%r14)
+	cmpq	(%r14), %r13
+	jl	..L2
+..L1:
+	movq	.__I, %r10
+	movq	%r10, %rax
+	imulq	%r10, %rax
+	pushq	%rax
+	leaq	.__V, %rax
+	pushq	%rax
+	movq	%r10, %rax
+	subq	$1, %rax
+	movq	%rax, %rcx
+	popq	%rax
+	imulq	$8, %rcx
+	popq	(%rax,%rcx,1)
+..L3:
+	movq	.__I, %r13
+	movq	$8, %r14
+	cmpq	%r13, %r14
+	jle	..L2
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L1
+..L2:
+	leaq	.__I, %rax
+	movq	%rax, %r14
+	movq	$1, (%r14)
+	movq	$4, %r13
+	cmpq	(%r14), %r13
+	jl	..L5
+..L4:
+	movq	.__A, %rax
+	movq	.__B, %r10
+	movq	.__C, %rbx
+	cqo
+	idivq	%r10
+	movq	.__I, %r10
+	pushq	%rax
+	movq	.__C, %rax
+	imulq	%r10, %rax
+	movq	%rax, %r10
+	popq	%rax
+	addq	%r10, %rax
+	movq	.__I, %r10
+	movq	%rax, .__Q
+	movq	.__A, %rax
+	cqo
+	idivq	%rbx
+	movq	%rdx, %rax
+	pushq	%rax
+	movq	.__B, %rax
+	imulq	%r10, %rax
+	movq	%rax, %r10
+	popq	%rax
+	subq	%r10, %rax
+	movq	%rax, .__R
+	leaq	.__V, %rax
+	pushq	%rax
+	movq	.__I, %rax
+	popq	%r10
+	subq	$1, %rax
+	movq	%rax, %r12
+	leaq	.__V, %rax
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	pushq	%r10
+	pushq	%rax
+	movq	.__I, %rax
+	popq	%r10
+	addq	$1, %rax
+	subq	$1, %rax
+	movq	%rax, %r12
+	popq	%rax
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	imulq	%r10, %rax
+	movq	.__I, %r10
+	pushq	%rax
+	leaq	.__V, %rax
+	pushq	%rax
+	movq	$9, %rax
+	subq	%r10, %rax
+	popq	%r10
+	subq	$1, %rax
+	movq	%rax, %r12
+	imulq	$8, %r12
+	popq	%rax
+	movq	(%r10,%r12,1), %r10
+	addq	%r10, %rax
+	movq	.__Q, %r10
+	movq	%rax, .__D
+	movq	.__P, %rax
+	movq	(%rax), %rax
+	addq	%r10, %rax
+	pushq	%rax
+	movq	.__P, %rax
+	popq	(%rax)
+	movq	.__B, %r10
+	movq	.__A, %rax
+	addq	%r10, %rax
+	movq	.__I, %r10
+	pushq	%rax
+	movq	.__C, %rax
+	subq	%r10, %rax
+	movq	%rax, %r10
+	popq	%rax
+	imulq	%r10, %rax
+	movq	.__D, %r10
+	pushq	%rax
+	movq	$6148914691236517206, %rax
+	imulq	%r10
+	movq	%rdx, %rax
+	shrq	$63, %rax
+	addq	%rdx, %rax
+	movq	%rax, %r10
+	popq	%rax
+	addq	%r10, %rax
+	movq	%rax, .__E
+	movq	.__I, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	.__X, %rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	mulsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	.__A, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	$4, %rax
+	cvtsi2sd	%rax, %xmm0
+	popq	%rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	popq	%rax
+	divsd	%xmm1, %xmm0
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	movq	%rax, .__Y
+	movq	$3, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	.__Y, %rax
+	movq	%xmm0, %r10
+	movq	%r10, %xmm1
+	movq	%rax, %xmm0
+	divsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	.__I, %rax
+	shlq	$1, %rax
+	cvtsi2sd	%rax, %xmm0
+	popq	%rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	movq	.__R, %r11
+	movq	.__Q, %rdx
+	subsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	movq	%rax, .__Z
+	xorq	%rax, %rax
+	cmpq	%r11, %rdx
+	setg	%al
+	testq	%rax, %rax
+	jz	..L9
+	movq	.__E, %r10
+	movq	$7378697629483820647, %rax
+	imulq	%r10
+	sarq	$1, %rdx
+	movq	%rdx, %rax
+	shrq	$63, %rax
+	addq	%rdx, %rax
+	imulq	$5, %rax
+	subq	%rax, %r10
+	addq	%r10, .__A
+	jmp	..L10
+..L9:
+	subq	$1, .__B
+..L10:
+	movq	.__R, %r10
+	movq	.__Q, %rax
+	addq	%r10, %rax
+	addq	.__D, %rax
+	pushq	%rax
+	leaq	.__V, %rax
+	pushq	%rax
+	movq	.__I, %rax
+	subq	$1, %rax
+	movq	%rax, %rcx
+	popq	%rax
+	imulq	$8, %rcx
+	popq	(%rax,%rcx,1)
+	movq	.__Q, %rdi
+	call	._rt_write_int
+	leaq	.__.str0, %rdi
+	call	._rt_write_str
+	movq	.__R, %rdi
+	call	._rt_write_int
+	leaq	.__.str1, %rdi
+	call	._rt_write_str
+	movq	.__D, %rdi
+	call	._rt_write_int
+	leaq	.__.str2, %rdi
+	call	._rt_write_str
+	movq	.__E, %rdi
+	call	._rt_write_int
+	leaq	.__.str3, %rdi
+	call	._rt_write_str
+	movq	.__A, %rdi
+	call	._rt_write_int
+	leaq	.__.str4, %rdi
+	call	._rt_write_str
+	movq	.__B, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	.__Y, %rdi
+	call	._rt_write_float
+	leaq	.__.str5, %rdi
+	call	._rt_write_str
+	movq	.__Z, %rdi
+	call	._rt_write_float
+	movq	$10, %rdi
+	call	._rt_write_char
+..L6:
+	movq	.__I, %r13
+	movq	$4, %r14
+	cmpq	%r13, %r14
+	jle	..L5
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L4
+..L5:
+	xorq	%r12, %r12
+	leaq	.__V, %rax
+	imulq	$8, %r12
+	movq	%rax, %r10
+	leaq	.__V, %rax
+	movq	(%r10,%r12,1), %r10
+	movq	$1, %r12
+	imulq	$8, %r12
+	pushq	%r10
+	movq	%rax, %r10
+	movq	(%r10,%r12,1), %r10
+	popq	%rax
+	movq	$2, %r12
+	imulq	$8, %r12
+	addq	%r10, %rax
+	pushq	%rax
+	leaq	.__V, %rax
+	movq	%rax, %r10
+	popq	%rax
+	movq	(%r10,%r12,1), %r10
+	movq	$3, %r12
+	imulq	$8, %r12
+	addq	%r10, %rax
+	pushq	%rax
+	leaq	.__V, %rax
+	movq	%rax, %r10
+	popq	%rax
+	movq	(%r10,%r12,1), %r10
+	addq	%r10, %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str6, %rdi
+	call	._rt_write_str
+	movq	.__D, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	call	._rt_flush
+	popq	%rbp
+	xorq	%rax, %rax
+	ret
+._rt_flush:
+	movq	.__._rt_len(%rip), %rdx
+	leaq	.__._rt_buf(%rip), %rsi
+._rt_flush.1:
+	testq	%rdx, %rdx
+	jz	._rt_flush.2
+	movq	$1, %rax
+	movq	$1, %rdi
+	syscall
+	cmpq	$-4, %rax
+	je	._rt_flush.1
+	testq	%rax, %rax
+	jle	._rt_flush.2
+	addq	%rax, %rsi
+	subq	%rax, %rdx
+	jmp	._rt_flush.1
+._rt_flush.2:
+	movq	$0, .__._rt_len(%rip)
+	ret
+._rt_reserve:
+	movq	.__._rt_len(%rip), %rax
+	cmpq	$65504, %rax
+	jbe	._rt_reserve.1
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	xorq	%rax, %rax
+._rt_reserve.1:
+	leaq	.__._rt_buf(%rip), %rsi
+	addq	%rax, %rsi
+	ret
+._rt_commit:
+	leaq	.__._rt_buf(%rip), %rax
+	subq	%rax, %rsi
+	movq	%rsi, .__._rt_len(%rip)
+	ret
+._rt_utoa:
+	movq	%rsp, %rdi
+	movabsq	$-3689348814741910323, %r8
+	movq	%rax, %rcx
+._rt_utoa.1:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	decq	%rdi
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	testq	%rcx, %rcx
+	jnz	._rt_utoa.1
+._rt_utoa.2:
+	movb	(%rdi), %al
+	movb	%al, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	cmpq	%rsp, %rdi
+	jb	._rt_utoa.2
+	ret
+._rt_write_char:
+	call	._rt_reserve
+	movb	%dil, (%rsi)
+	incq	%rsi
+	jmp	._rt_commit
+._rt_write_str:
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+._rt_write_str.1:
+	movb	(%rdi), %cl
+	testb	%cl, %cl
+	jz	._rt_commit
+	cmpq	%rdx, %rsi
+	jb	._rt_write_str.2
+	call	._rt_commit
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+	movb	(%rdi), %cl
+._rt_write_str.2:
+	movb	%cl, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	jmp	._rt_write_str.1
+._rt_write_int:
+	call	._rt_reserve
+	movq	%rdi, %rax
+	testq	%rax, %rax
+	jns	._rt_write_int.1
+	movb	$45, (%rsi)
+	incq	%rsi
+	negq	%rax
+._rt_write_int.1:
+	call	._rt_utoa
+	jmp	._rt_commit
+._rt_write_float:
+	call	._rt_reserve
+	movq	%rdi, %r11
+	shrq	$52, %r11
+	andq	$2047, %r11
+	cmpq	$1086, %r11
+	jae	._rt_write_float.slow
+	testq	%rdi, %rdi
+	jns	._rt_write_float.1
+	movb	$45, (%rsi)
+	incq	%rsi
+._rt_write_float.1:
+	movabsq	$4503599627370495, %r8
+	andq	%rdi, %r8
+	movq	$1075, %rcx
+	testq	%r11, %r11
+	jz	._rt_write_float.2
+	btsq	$52, %r8
+	subq	%r11, %rcx
+	jmp	._rt_write_float.3
+._rt_write_float.2:
+	decq	%rcx
+._rt_write_float.3:
+	xorq	%r9, %r9
+	testq	%rcx, %rcx
+	jg	._rt_write_float.4
+	negq	%rcx
+	shlq	%cl, %r8
+	movq	%r8, %r10
+	jmp	._rt_write_float.out
+._rt_write_float.4:
+	xorq	%r10, %r10
+	cmpq	$64, %rcx
+	jae	._rt_write_float.5
+	movq	%r8, %r10
+	shrq	%cl, %r10
+	movq	$1, %rax
+	shlq	%cl, %rax
+	decq	%rax
+	andq	%rax, %r8
+._rt_write_float.5:
+	cmpq	$74, %rcx
+	jae	._rt_write_float.out
+	movq	%r8, %rax
+	movq	$1000000, %rdx
+	mulq	%rdx
+	decq	%rcx
+	cmpq	$64, %rcx
+	jae	._rt_write_float.6
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rax, %r11
+	shrdq	%cl, %rdx, %rax
+	jmp	._rt_write_float.7
+._rt_write_float.6:
+	subq	$64, %rcx
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rdx, %r11
+	orq	%rax, %r11
+	movq	%rdx, %rax
+	shrq	%cl, %rax
+._rt_write_float.7:
+	movq	%rax, %r9
+	shrq	$1, %r9
+	testq	$1, %rax
+	jz	._rt_write_float.out
+	testq	%r11, %r11
+	jnz	._rt_write_float.8
+	testq	$1, %r9
+	jz	._rt_write_float.out
+._rt_write_float.8:
+	incq	%r9
+	cmpq	$1000000, %r9
+	jb	._rt_write_float.out
+	xorq	%r9, %r9
+	incq	%r10
+._rt_write_float.out:
+	movq	%r10, %rax
+	pushq	%r9
+	call	._rt_utoa
+	popq	%rcx
+	movb	$46, (%rsi)
+	leaq	6(%rsi), %rdi
+	movabsq	$-3689348814741910323, %r8
+._rt_write_float.9:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	decq	%rdi
+	cmpq	%rsi, %rdi
+	jnz	._rt_write_float.9
+	addq	$7, %rsi
+	jmp	._rt_commit
+._rt_write_float.slow:
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	pushq	%rbp
+	movq	%rsp, %rbp
+	andq	$-16, %rsp
+	movq	%rdi, %xmm0
+	leaq	.__._rt_buf(%rip), %rdi
+	movq	$65536, %rsi
+	leaq	.__._rt_fmt_float(%rip), %rdx
+	movq	$1, %rax
+	call	snprintf
+	movq	%rax, .__._rt_len(%rip)
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+
@@ -1,10 +1,3 @@
-.__._fmt_int_:
-	.string "%Ld"
-.__._fmt_float_:
-	.string "%lf"
-.__._fmt_newline_:
-	.string "
-"
 	.globl main
 .data
 	.__K: .quad 0
@@ -26,105 +19,111 @@
 	.__GOT0N: .quad 0
 .__.str0:
 	.string " "
+	.lcomm .__._rt_buf, 65536
+.data
+	.__._rt_len: .quad 0
+.__._rt_fmt_float:
+	.string "%lf"
+.text
 main:
 	pushq	%rbp
-	movq	%rsp, %rbp
-	movq	$5, .__N
-	movq	$0, .__K
-	movq	$0, .__I
-	movq	$0, .__J
-	movq	$3, .__D
 	leaq	.__DI, %rax
 	xorq	%r9, %r9
+	movq	%rsp, %rbp
 	pushq	$0
 	pushq	%rax
 	xorq	%rax, %rax
 	subq	%r9, %rax
+	movq	$5, .__N
+	xorq	%r9, %r9
 	movq	%rax, %rcx
-	imulq	$8, %rcx
 	popq	%rax
+	movq	$0, .__K
+	imulq	$8, %rcx
+	movq	$0, .__I
+	movq	$0, .__J
+	movq	$3, .__D
 	popq	(%rax,%rcx,1)
 	leaq	.__DI, %rax
-	xorq	%r9, %r9
 	pushq	$1
 	pushq	%rax
 	movq	$1, %rax
 	subq	%r9, %rax
+	xorq	%r9, %r9
 	movq	%rax, %rcx
-	imulq	$8, %rcx
 	popq	%rax
+	imulq	$8, %rcx
 	popq	(%rax,%rcx,1)
 	leaq	.__DI, %rax
-	xorq	%r9, %r9
 	pushq	$1
 	pushq	%rax
 	movq	$2, %rax
 	subq	%r9, %rax
+	xorq	%r9, %r9
 	movq	%rax, %rcx
-	imulq	$8, %rcx
 	popq	%rax
+	imulq	$8, %rcx
 	popq	(%rax,%rcx,1)
 	movq	$1, %rax
 	negq	%rax
 	pushq	%rax
 	leaq	.__DI, %rax
-	xorq	%r9, %r9
 	pushq	%rax
 	movq	$3, %rax
 	subq	%r9, %rax
+	xorq	%r9, %r9
 	movq	%rax, %rcx
-	imulq	$8, %rcx
 	popq	%rax
+	imulq	$8, %rcx
 	popq	(%rax,%rcx,1)
 	leaq	.__DJ, %rax
-	xorq	%r9, %r9
 	pushq	$1
 	pushq	%rax
 	xorq	%rax, %rax
 	subq	%r9, %rax
+	xorq	%r9, %r9
 	movq	%rax, %rcx
-	imulq	$8, %rcx
 	popq	%rax
+	imulq	$8, %rcx
 	popq	(%rax,%rcx,1)
 	movq	$1, %rax
 	negq	%rax
 	pushq	%rax
 	leaq	.__DJ, %rax
-	xorq	%r9, %r9
 	pushq	%rax
 	movq	$1, %rax
 	subq	%r9, %rax
+	xorq	%r9, %r9
 	movq	%rax, %rcx
-	imulq	$8, %rcx
 	popq	%rax
+	imulq	$8, %rcx
 	popq	(%rax,%rcx,1)
 	leaq	.__DJ, %rax
-	xorq	%r9, %r9
 	pushq	$0
 	pushq	%rax
 	movq	$2, %rax
 	subq	%r9, %rax
+	xorq	%r9, %r9
 	movq	%rax, %rcx
-	imulq	$8, %rcx
 	popq	%rax
+	imulq	$8, %rcx
 	popq	(%rax,%rcx,1)
 	leaq	.__DJ, %rax
-	xorq	%r9, %r9
 	pushq	$1
 	pushq	%rax
 	movq	$3, %rax
 	subq	%r9, %rax
 	movq	%rax, %rcx
-	imulq	$8, %rcx
 	popq	%rax
+	imulq	$8, %rcx
 	popq	(%rax,%rcx,1)
 	movq	$0, .__GOT0N
 ..L1:
 	movq	.__N, %r10
-	movq	.__N, %rax
+	movq	.__K, %rdx
+	movq	%r10, %rax
 	imulq	%r10, %rax
 	movq	%rax, %r11
-	movq	.__K, %rdx
 	xorq	%rax, %rax
 	cmpq	%r11, %rdx
 	setle	%al
@@ -153,9 +152,9 @@ main:
 	testq	%rax, %rax
 	jnz	..L7
 	movq	.__N, %rax
+	movq	.__I, %rdx
 	subq	$1, %rax
 	movq	%rax, %r11
-	movq	.__I, %rdx
 	xorq	%rax, %rax
 	cmpq	%r11, %rdx
 	sete	%al
@@ -170,9 +169,9 @@ main:
 	testq	%rax, %rax
 	jnz	..L9
 	movq	.__N, %rax
+	movq	.__J, %rdx
 	subq	$1, %rax
 	movq	%rax, %r11
-	movq	.__J, %rdx
 	xorq	%rax, %rax
 	cmpq	%r11, %rdx
 	sete	%al
@@ -198,184 +197,403 @@ main:
 ..L3:
 ..L4:
 	leaq	.__A, %rax
-	xorq	%r9, %r9
 	pushq	.__K
+	xorq	%r9, %r9
 	pushq	%rax
 	movq	.__I, %rax
 	subq	%r9, %rax
-	imulq	$6, %rax
 	xorq	%r9, %r9
+	imulq	$6, %rax
 	pushq	%rax
 	movq	.__J, %rax
 	subq	%r9, %rax
 	popq	%r9
 	addq	%r9, %rax
+	xorq	%r9, %r9
 	movq	%rax, %rcx
-	imulq	$8, %rcx
 	popq	%rax
+	imulq	$8, %rcx
 	popq	(%rax,%rcx,1)
 	leaq	.__DI, %rax
 	pushq	.__I
 	pushq	%rax
 	movq	.__D, %rax
-	xorq	%rdx, %rdx
+	popq	%r10
 	cqo
-	movq	$4, %rbx
-	idivq	%rbx
-	movq	%rdx, %rax
-	xorq	%r9, %r9
+	shrq	$62, %rdx
+	addq	%rdx, %rax
+	andq	$3, %rax
+	subq	%rdx, %rax
 	movq	%rax, %r12
+	popq	%rax
 	imulq	$8, %r12
-	popq	%r10
 	movq	(%r10,%r12,1), %r10
-	popq	%rax
+	pushq	.__J
 	addq	%r10, %rax
 	movq	%rax, .__I
 	leaq	.__DJ, %rax
-	pushq	.__J
 	pushq	%rax
 	movq	.__D, %rax
-	xorq	%rdx, %rdx
+	popq	%r10
 	cqo
-	movq	$4, %rbx
-	idivq	%rbx
-	movq	%rdx, %rax
-	xorq	%r9, %r9
+	shrq	$62, %rdx
+	addq	%rdx, %rax
+	andq	$3, %rax
+	subq	%rdx, %rax
 	movq	%rax, %r12
+	popq	%rax
 	imulq	$8, %r12
-	popq	%r10
 	movq	(%r10,%r12,1), %r10
-	popq	%rax
+	addq	$1, .__K
+	pushq	.__I
 	addq	%r10, %rax
 	movq	%rax, .__J
-	addq	$1, .__K
 	movq	.__N, %rax
 	subq	$1, %rax
-	pushq	.__I
 	pushq	%rax
 	movq	.__N, %rax
-	xorq	%rdx, %rdx
 	cqo
-	movq	$2, %rbx
-	idivq	%rbx
-	movq	%rdx, %r10
+	shrq	$63, %rdx
+	addq	%rdx, %rax
+	andq	$1, %rax
+	subq	%rdx, %rax
+	movq	%rax, %r10
 	movq	$1, %rax
 	subq	%r10, %rax
 	movq	%rax, %r10
 	popq	%rax
+	popq	%rdx
 	imulq	%r10, %rax
 	movq	%rax, %r11
-	popq	%rdx
 	xorq	%rax, %rax
 	cmpq	%r11, %rdx
 	sete	%al
 	testq	%rax, %rax
-	jz	..L22
+	jz	..L16
 	movq	.__N, %rax
-	subq	$1, %rax
 	pushq	.__J
+	subq	$1, %rax
 	pushq	%rax
 	movq	.__N, %rax
-	xorq	%rdx, %rdx
 	cqo
-	movq	$2, %rbx
-	idivq	%rbx
-	movq	%rdx, %r10
+	shrq	$63, %rdx
+	addq	%rdx, %rax
+	andq	$1, %rax
+	subq	%rdx, %rax
+	movq	%rax, %r10
 	popq	%rax
+	popq	%rdx
 	imulq	%r10, %rax
 	movq	%rax, %r11
-	popq	%rdx
 	xorq	%rax, %rax
 	cmpq	%r11, %rdx
 	sete	%al
 	testq	%rax, %rax
-	jz	..L22
+	jz	..L16
 	pushq	$1
-	jmp	..L21
-..L22:
+	jmp	..L15
+..L16:
 	pushq	$0
-..L21:
+..L15:
 	popq	%rax
 	testq	%rax, %rax
-	jz	..L17
+	jz	..L13
 	movq	$1, .__GOT0N
-	jmp	..L18
-..L17:
-..L18:
+	jmp	..L14
+..L13:
+..L14:
 	jmp	..L1
 ..L2:
 	leaq	.__I, %rax
-	movq	$1, %r10
 	pushq	$0
+	movq	$1, %r10
 	pushq	%rax
 	movq	.__N, %rax
-	subq	%r10, %rax
-	movq	%rax, %r13
 	popq	%r14
+	subq	%r10, %rax
 	popq	(%r14)
+	movq	%rax, %r13
 	cmpq	(%r14), %r13
-	jl	..L26
-..L25:
+	jl	..L18
+..L17:
 	leaq	.__J, %rax
-	movq	$1, %r10
 	pushq	$0
+	movq	$1, %r10
 	pushq	%rax
 	movq	.__N, %rax
-	subq	%r10, %rax
-	movq	%rax, %r13
 	popq	%r14
+	subq	%r10, %rax
 	popq	(%r14)
+	movq	%rax, %r13
 	cmpq	(%r14), %r13
-	jl	..L29
-..L28:
+	jl	..L21
+..L20:
 	leaq	.__A, %rax
 	xorq	%r9, %r9
 	pushq	%rax
 	movq	.__I, %rax
 	subq	%r9, %rax
-	imulq	$6, %rax
 	xorq	%r9, %r9
+	imulq	$6, %rax
 	pushq	%rax
 	movq	.__J, %rax
 	subq	%r9, %rax
 	popq	%r9
 	addq	%r9, %rax
+	popq	%r10
 	movq	%rax, %r12
 	imulq	$8, %r12
-	popq	%r10
-	movq	(%r10,%r12,1), %r10
-	leaq	.__._fmt_int_, %rdi
-	movq	%r10, %rsi
-	call	printf
+	movq	(%r10,%r12,1), %rdi
+	call	._rt_write_int
 	leaq	.__.str0, %rdi
-	call	printf
-..L30:
+	call	._rt_write_str
+..L22:
 	movq	.__N, %rax
-	subq	$1, %rax
 	movq	.__J, %r13
+	subq	$1, %rax
 	movq	%rax, %r14
 	cmpq	%r13, %r14
-	jle	..L29
+	jle	..L21
 	leaq	.__J, %rax
 	movq	%rax, %r12
 	addq	$1, (%r12)
-	jmp	..L28
-..L29:
-	leaq	.__._fmt_newline_, %rdi
-	call	printf
-..L27:
+	jmp	..L20
+..L21:
+	movq	$10, %rdi
+	call	._rt_write_char
+..L19:
 	movq	.__N, %rax
-	subq	$1, %rax
 	movq	.__I, %r13
+	subq	$1, %rax
 	movq	%rax, %r14
 	cmpq	%r13, %r14
-	jle	..L26
+	jle	..L18
 	leaq	.__I, %rax
 	movq	%rax, %r12
 	addq	$1, (%r12)
-	jmp	..L25
-..L26:
+	jmp	..L17
+..L18:
+	call	._rt_flush
 	popq	%rbp
 	xorq	%rax, %rax
 	ret
+._rt_flush:
+	movq	.__._rt_len(%rip), %rdx
+	leaq	.__._rt_buf(%rip), %rsi
+._rt_flush.1:
+	testq	%rdx, %rdx
+	jz	._rt_flush.2
+	movq	$1, %rax
+	movq	$1, %rdi
+	syscall
+	cmpq	$-4, %rax
+	je	._rt_flush.1
+	testq	%rax, %rax
+	jle	._rt_flush.2
+	addq	%rax, %rsi
+	subq	%rax, %rdx
+	jmp	._rt_flush.1
+._rt_flush.2:
+	movq	$0, .__._rt_len(%rip)
+	ret
+._rt_reserve:
+	movq	.__._rt_len(%rip), %rax
+	cmpq	$65504, %rax
+	jbe	._rt_reserve.1
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	xorq	%rax, %rax
+._rt_reserve.1:
+	leaq	.__._rt_buf(%rip), %rsi
+	addq	%rax, %rsi
+	ret
+._rt_commit:
+	leaq	.__._rt_buf(%rip), %rax
+	subq	%rax, %rsi
+	movq	%rsi, .__._rt_len(%rip)
+	ret
+._rt_utoa:
+	movq	%rsp, %rdi
+	movabsq	$-3689348814741910323, %r8
+	movq	%rax, %rcx
+._rt_utoa.1:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	decq	%rdi
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	testq	%rcx, %rcx
+	jnz	._rt_utoa.1
+._rt_utoa.2:
+	movb	(%rdi), %al
+	movb	%al, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	cmpq	%rsp, %rdi
+	jb	._rt_utoa.2
+	ret
+._rt_write_char:
+	call	._rt_reserve
+	movb	%dil, (%rsi)
+	incq	%rsi
+	jmp	._rt_commit
+._rt_write_str:
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+._rt_write_str.1:
+	movb	(%rdi), %cl
+	testb	%cl, %cl
+	jz	._rt_commit
+	cmpq	%rdx, %rsi
+	jb	._rt_write_str.2
+	call	._rt_commit
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+	movb	(%rdi), %cl
+._rt_write_str.2:
+	movb	%cl, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	jmp	._rt_write_str.1
+._rt_write_int:
+	call	._rt_reserve
+	movq	%rdi, %rax
+	testq	%rax, %rax
+	jns	._rt_write_int.1
+	movb	$45, (%rsi)
+	incq	%rsi
+	negq	%rax
+._rt_write_int.1:
+	call	._rt_utoa
+	jmp	._rt_commit
+._rt_write_float:
+	call	._rt_reserve
+	movq	%rdi, %r11
+	shrq	$52, %r11
+	andq	$2047, %r11
+	cmpq	$1086, %r11
+	jae	._rt_write_float.slow
+	testq	%rdi, %rdi
+	jns	._rt_write_float.1
+	movb	$45, (%rsi)
+	incq	%rsi
+._rt_write_float.1:
+	movabsq	$4503599627370495, %r8
+	andq	%rdi, %r8
+	movq	$1075, %rcx
+	testq	%r11, %r11
+	jz	._rt_write_float.2
+	btsq	$52, %r8
+	subq	%r11, %rcx
+	jmp	._rt_write_float.3
+._rt_write_float.2:
+	decq	%rcx
+._rt_write_float.3:
+	xorq	%r9, %r9
+	testq	%rcx, %rcx
+	jg	._rt_write_float.4
+	negq	%rcx
+	shlq	%cl, %r8
+	movq	%r8, %r10
+	jmp	._rt_write_float.out
+._rt_write_float.4:
+	xorq	%r10, %r10
+	cmpq	$64, %rcx
+	jae	._rt_write_float.5
+	movq	%r8, %r10
+	shrq	%cl, %r10
+	movq	$1, %rax
+	shlq	%cl, %rax
+	decq	%rax
+	andq	%rax, %r8
+._rt_write_float.5:
+	cmpq	$74, %rcx
+	jae	._rt_write_float.out
+	movq	%r8, %rax
+	movq	$1000000, %rdx
+	mulq	%rdx
+	decq	%rcx
+	cmpq	$64, %rcx
+	jae	._rt_write_float.6
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rax, %r11
+	shrdq	%cl, %rdx, %rax
+	jmp	._rt_write_float.7
+._rt_write_float.6:
+	subq	$64, %rcx
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rdx, %r11
+	orq	%rax, %r11
+	movq	%rdx, %rax
+	shrq	%cl, %rax
+._rt_write_float.7:
+	movq	%rax, %r9
+	shrq	$1, %r9
+	testq	$1, %rax
+	jz	._rt_write_float.out
+	testq	%r11, %r11
+	jnz	._rt_write_float.8
+	testq	$1, %r9
+	jz	._rt_write_float.out
+._rt_write_float.8:
+	incq	%r9
+	cmpq	$1000000, %r9
+	jb	._rt_write_float.out
+	xorq	%r9, %r9
+	incq	%r10
+._rt_write_float.out:
+	movq	%r10, %rax
+	pushq	%r9
+	call	._rt_utoa
+	popq	%rcx
+	movb	$46, (%rsi)
+	leaq	6(%rsi), %rdi
+	movabsq	$-3689348814741910323, %r8
+._rt_write_float.9:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	decq	%rdi
+	cmpq	%rsi, %rdi
+	jnz	._rt_write_float.9
+	addq	$7, %rsi
+	jmp	._rt_commit
+._rt_write_float.slow:
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	pushq	%rbp
+	movq	%rsp, %rbp
+	andq	$-16, %rsp
+	movq	%rdi, %xmm0
+	leaq	.__._rt_buf(%rip), %rdi
+	movq	$65536, %rsi
+	leaq	.__._rt_fmt_float(%rip), %rdx
+	movq	$1, %rax
+	call	snprintf
+	movq	%rax, .__._rt_len(%rip)
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
 
@@ -1,10 +1,3 @@
-.__._fmt_int_:
-	.string "%Ld"
-.__._fmt_float_:
-	.string "%lf"
-.__._fmt_newline_:
-	.string "
-"
 	.globl main
 .data
 	.__A: .fill 168,1,0
@@ -18,6 +11,12 @@
 	.__X: .double 0
 .__.str0:
 	.string " "
+	.lcomm .__._rt_buf, 65536
+.data
+	.__._rt_len: .quad 0
+.__._rt_fmt_float:
+	.string "%lf"
+.text
 main:
 	pushq	%rbp
 	movq	%rsp, %rbp
@@ -30,21 +29,21 @@ main:
 	call	.__PRINT_ARRAY
 	call	.__BUBBLE_SORT
 	call	.__PRINT_ARRAY
-	leaq	.__._fmt_newline_, %rdi
-	call	printf
+	movq	$10, %rdi
+	call	._rt_write_char
 	call	.__FILL_ARRAY
 	call	.__PRINT_ARRAY
 	call	.__INSERTION_SORT
 	call	.__PRINT_ARRAY
-	leaq	.__._fmt_newline_, %rdi
-	call	printf
+	movq	$10, %rdi
+	call	._rt_write_char
+	call	._rt_flush
 	popq	%rbp
 	xorq	%rax, %rax
 	ret
 .__FILL_ARRAY:
 	pushq	%rbp
 	movq	%rsp, %rbp
-	subq	$0, %rsp
 	pushq	.__N
 	popq	%rax
 	negq	%rax
@@ -57,8 +56,8 @@ main:
 	popq	(%r14)
 	movq	(%r14), %r14
 	cmpq	%r14, %r13
-	jl	..L2
-..L1:
+	jl	..L3
+..L2:
 	pushq	.__I
 	popq	%rax
 	negq	%rax
@@ -91,25 +90,26 @@ main:
 	pushq	%rax
 	popq	%rax
 	popq	(%rax)
-..L3:
+..L4:
 	pushq	$0
 	pushq	.__I
 	popq	%r13
 	popq	%r14
 	cmpq	%r13, %r14
-	jle	..L2
+	jle	..L3
 	leaq	.__I, %rax
 	pushq	%rax
 	popq	%r12
 	addq	$1, (%r12)
-	jmp	..L1
-..L2:
+	jmp	..L2
+..L3:
+..L1:
+	movq	%rbp, %rsp
 	popq	%rbp
 	ret
 .__PRINT_ARRAY:
 	pushq	%rbp
 	movq	%rsp, %rbp
-	subq	$0, %rsp
 	pushq	$0
 	leaq	.__I, %rax
 	pushq	%rax
@@ -119,8 +119,8 @@ main:
 	popq	(%r14)
 	movq	(%r14), %r14
 	cmpq	%r14, %r13
-	jl	..L5
-..L4:
+	jl	..L7
+..L6:
 	leaq	.__A, %rax
 	pushq	%rax
 	pushq	$0
@@ -138,34 +138,32 @@ main:
 	popq	%r10
 	movq	(%r10,%r12,1), %r10
 	pushq	%r10
-	leaq	.__._fmt_float_, %rdi
-	popq	%rax
-	movq	%rax, %xmm0
-	movq	$1, %rax
-	call	printf
+	popq	%rdi
+	call	._rt_write_float
 	leaq	.__.str0, %rdi
-	call	printf
-..L6:
+	call	._rt_write_str
+..L8:
 	pushq	.__N
 	pushq	.__I
 	popq	%r13
 	popq	%r14
 	cmpq	%r13, %r14
-	jle	..L5
+	jle	..L7
 	leaq	.__I, %rax
 	pushq	%rax
 	popq	%r12
 	addq	$1, (%r12)
-	jmp	..L4
+	jmp	..L6
+..L7:
+	movq	$10, %rdi
+	call	._rt_write_char
 ..L5:
-	leaq	.__._fmt_newline_, %rdi
-	call	printf
+	movq	%rbp, %rsp
 	popq	%rbp
 	ret
 .__BUBBLE_SORT:
 	pushq	%rbp
 	movq	%rsp, %rbp
-	subq	$0, %rsp
 	pushq	$0
 	leaq	.__I, %rax
 	pushq	%rax
@@ -175,8 +173,8 @@ main:
 	popq	(%r14)
 	movq	(%r14), %r14
 	cmpq	%r14, %r13
-	jl	..L8
-..L7:
+	jl	..L11
+..L10:
 	pushq	.__I
 	leaq	.__J, %rax
 	pushq	%rax
@@ -186,8 +184,8 @@ main:
 	popq	(%r14)
 	movq	(%r14), %r14
 	cmpq	%r14, %r13
-	jg	..L11
-..L10:
+	jg	..L14
+..L13:
 	leaq	.__A, %rax
 	pushq	%rax
 	pushq	$0
@@ -235,7 +233,7 @@ main:
 	pushq	%rax
 	popq	%rax
 	testq	%rax, %rax
-	jz	..L13
+	jz	..L16
 	leaq	.__A, %rax
 	pushq	%rax
 	pushq	$0
@@ -323,41 +321,42 @@ main:
 	pushq	%rax
 	popq	%rax
 	popq	(%rax)
-	jmp	..L14
-..L13:
-..L14:
-..L12:
+	jmp	..L17
+..L16:
+..L17:
+..L15:
 	pushq	$1
 	pushq	.__J
 	popq	%r13
 	popq	%r14
 	cmpq	%r13, %r14
-	jge	..L11
+	jge	..L14
 	leaq	.__J, %rax
 	pushq	%rax
 	popq	%r12
 	subq	$1, (%r12)
-	jmp	..L10
-..L11:
-..L9:
+	jmp	..L13
+..L14:
+..L12:
 	pushq	.__N
 	pushq	.__I
 	popq	%r13
 	popq	%r14
 	cmpq	%r13, %r14
-	jle	..L8
+	jle	..L11
 	leaq	.__I, %rax
 	pushq	%rax
 	popq	%r12
 	addq	$1, (%r12)
-	jmp	..L7
-..L8:
+	jmp	..L10
+..L11:
+..L9:
+	movq	%rbp, %rsp
 	popq	%rbp
 	ret
 .__INSERTION_SORT:
 	pushq	%rbp
 	movq	%rsp, %rbp
-	subq	$0, %rsp
 	pushq	$1
 	leaq	.__I, %rax
 	pushq	%rax
@@ -372,8 +371,8 @@ main:
 	popq	(%r14)
 	movq	(%r14), %r14
 	cmpq	%r14, %r13
-	jl	..L16
-..L15:
+	jl	..L20
+..L19:
 	leaq	.__A, %rax
 	pushq	%rax
 	pushq	$0
@@ -400,7 +399,7 @@ main:
 	pushq	%rax
 	popq	%rax
 	popq	(%rax)
-..L18:
+..L22:
 	pushq	.__J
 	pushq	$0
 	popq	%r11
@@ -411,7 +410,7 @@ main:
 	pushq	%rax
 	popq	%rax
 	testq	%rax, %rax
-	jz	..L21
+	jz	..L25
 	leaq	.__A, %rax
 	pushq	%rax
 	pushq	$0
@@ -443,15 +442,15 @@ main:
 	pushq	%rax
 	popq	%rax
 	testq	%rax, %rax
-	jz	..L21
+	jz	..L25
 	pushq	$1
-	jmp	..L20
-..L21:
+	jmp	..L24
+..L25:
 	pushq	$0
-..L20:
+..L24:
 	popq	%rax
 	testq	%rax, %rax
-	jz	..L19
+	jz	..L23
 	leaq	.__A, %rax
 	pushq	%rax
 	pushq	$0
@@ -503,8 +502,8 @@ main:
 	pushq	%rax
 	popq	%rax
 	popq	(%rax)
-	jmp	..L18
-..L19:
+	jmp	..L22
+..L23:
 	pushq	.__X
 	leaq	.__A, %rax
 	pushq	%rax
@@ -525,7 +524,7 @@ main:
 	pushq	%rax
 	popq	%rax
 	popq	(%rax)
-..L17:
+..L21:
 	pushq	.__N
 	pushq	$1
 	popq	%r10
@@ -536,13 +535,234 @@ main:
 	popq	%r13
 	popq	%r14
 	cmpq	%r13, %r14
-	jle	..L16
+	jle	..L20
 	leaq	.__I, %rax
 	pushq	%rax
 	popq	%r12
 	addq	$1, (%r12)
-	jmp	..L15
-..L16:
+	jmp	..L19
+..L20:
+..L18:
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+._rt_flush:
+	movq	.__._rt_len(%rip), %rdx
+	leaq	.__._rt_buf(%rip), %rsi
+._rt_flush.1:
+	testq	%rdx, %rdx
+	jz	._rt_flush.2
+	movq	$1, %rax
+	movq	$1, %rdi
+	syscall
+	cmpq	$-4, %rax
+	je	._rt_flush.1
+	testq	%rax, %rax
+	jle	._rt_flush.2
+	addq	%rax, %rsi
+	subq	%rax, %rdx
+	jmp	._rt_flush.1
+._rt_flush.2:
+	movq	$0, .__._rt_len(%rip)
+	ret
+._rt_reserve:
+	movq	.__._rt_len(%rip), %rax
+	cmpq	$65504, %rax
+	jbe	._rt_reserve.1
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	xorq	%rax, %rax
+._rt_reserve.1:
+	leaq	.__._rt_buf(%rip), %rsi
+	addq	%rax, %rsi
+	ret
+._rt_commit:
+	leaq	.__._rt_buf(%rip), %rax
+	subq	%rax, %rsi
+	movq	%rsi, .__._rt_len(%rip)
+	ret
+._rt_utoa:
+	movq	%rsp, %rdi
+	movabsq	$-3689348814741910323, %r8
+	movq	%rax, %rcx
+._rt_utoa.1:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	decq	%rdi
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	testq	%rcx, %rcx
+	jnz	._rt_utoa.1
+._rt_utoa.2:
+	movb	(%rdi), %al
+	movb	%al, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	cmpq	%rsp, %rdi
+	jb	._rt_utoa.2
+	ret
+._rt_write_char:
+	call	._rt_reserve
+	movb	%dil, (%rsi)
+	incq	%rsi
+	jmp	._rt_commit
+._rt_write_str:
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+._rt_write_str.1:
+	movb	(%rdi), %cl
+	testb	%cl, %cl
+	jz	._rt_commit
+	cmpq	%rdx, %rsi
+	jb	._rt_write_str.2
+	call	._rt_commit
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+	movb	(%rdi), %cl
+._rt_write_str.2:
+	movb	%cl, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	jmp	._rt_write_str.1
+._rt_write_int:
+	call	._rt_reserve
+	movq	%rdi, %rax
+	testq	%rax, %rax
+	jns	._rt_write_int.1
+	movb	$45, (%rsi)
+	incq	%rsi
+	negq	%rax
+._rt_write_int.1:
+	call	._rt_utoa
+	jmp	._rt_commit
+._rt_write_float:
+	call	._rt_reserve
+	movq	%rdi, %r11
+	shrq	$52, %r11
+	andq	$2047, %r11
+	cmpq	$1086, %r11
+	jae	._rt_write_float.slow
+	testq	%rdi, %rdi
+	jns	._rt_write_float.1
+	movb	$45, (%rsi)
+	incq	%rsi
+._rt_write_float.1:
+	movabsq	$4503599627370495, %r8
+	andq	%rdi, %r8
+	movq	$1075, %rcx
+	testq	%r11, %r11
+	jz	._rt_write_float.2
+	btsq	$52, %r8
+	subq	%r11, %rcx
+	jmp	._rt_write_float.3
+._rt_write_float.2:
+	decq	%rcx
+._rt_write_float.3:
+	xorq	%r9, %r9
+	testq	%rcx, %rcx
+	jg	._rt_write_float.4
+	negq	%rcx
+	shlq	%cl, %r8
+	movq	%r8, %r10
+	jmp	._rt_write_float.out
+._rt_write_float.4:
+	xorq	%r10, %r10
+	cmpq	$64, %rcx
+	jae	._rt_write_float.5
+	movq	%r8, %r10
+	shrq	%cl, %r10
+	movq	$1, %rax
+	shlq	%cl, %rax
+	decq	%rax
+	andq	%rax, %r8
+._rt_write_float.5:
+	cmpq	$74, %rcx
+	jae	._rt_write_float.out
+	movq	%r8, %rax
+	movq	$1000000, %rdx
+	mulq	%rdx
+	decq	%rcx
+	cmpq	$64, %rcx
+	jae	._rt_write_float.6
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rax, %r11
+	shrdq	%cl, %rdx, %rax
+	jmp	._rt_write_float.7
+._rt_write_float.6:
+	subq	$64, %rcx
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rdx, %r11
+	orq	%rax, %r11
+	movq	%rdx, %rax
+	shrq	%cl, %rax
+._rt_write_float.7:
+	movq	%rax, %r9
+	shrq	$1, %r9
+	testq	$1, %rax
+	jz	._rt_write_float.out
+	testq	%r11, %r11
+	jnz	._rt_write_float.8
+	testq	$1, %r9
+	jz	._rt_write_float.out
+._rt_write_float.8:
+	incq	%r9
+	cmpq	$1000000, %r9
+	jb	._rt_write_float.out
+	xorq	%r9, %r9
+	incq	%r10
+._rt_write_float.out:
+	movq	%r10, %rax
+	pushq	%r9
+	call	._rt_utoa
+	popq	%rcx
+	movb	$46, (%rsi)
+	leaq	6(%rsi), %rdi
+	movabsq	$-3689348814741910323, %r8
+._rt_write_float.9:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	decq	%rdi
+	cmpq	%rsi, %rdi
+	jnz	._rt_write_float.9
+	addq	$7, %rsi
+	jmp	._rt_commit
+._rt_write_float.slow:
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	pushq	%rbp
+	movq	%rsp, %rbp
+	andq	$-16, %rsp
+	movq	%rdi, %xmm0
+	leaq	.__._rt_buf(%rip), %rdi
+	movq	$65536, %rsi
+	leaq	.__._rt_fmt_float(%rip), %rdx
+	movq	$1, %rax
+	call	snprintf
+	movq	%rax, .__._rt_len(%rip)
+	movq	%rbp, %rsp
 	popq	%rbp
 	ret
 
@@ -0,0 +1,753 @@
+	.globl main
+.data
+	.__I: .quad 0
+.data
+	.__X: .quad 0
+.data
+	.__BIG: .quad 0
+.__.str0:
+	.string " "
+.__.str1:
+	.string " "
+.__.str2:
+	.string " "
+.__.str3:
+	.string " "
+.__.str4:
+	.string " "
+.__.str5:
+	.string " "
+.__.str6:
+	.string " "
+.__.str7:
+	.string " "
+.__.str8:
+	.string " "
+.__.str9:
+	.string " "
+.__.str10:
+	.string " "
+.__.str11:
+	.string " "
+.__.str12:
+	.string " "
+.__.str13:
+	.string " "
+.__.str14:
+	.string " "
+.__.str15:
+	.string " "
+.__.str16:
+	.string " "
+.__.str17:
+	.string " "
+.__.str18:
+	.string " "
+.__.str19:
+	.string " "
+.__.str20:
+	.string " "
+.__.str21:
+	.string " "
+.__.str22:
+	.string " "
+.__.str23:
+	.string " "
+.__.str24:
+	.string " "
+.__.str25:
+	.string " "
+.__.str26:
+	.string " "
+.__.str27:
+	.string " "
+.__.str28:
+	.string " "
+.__.str29:
+	.string " "
+.__.str30:
+	.string " "
+.__.str31:
+	.string " "
+.__.str32:
+	.string " "
+.__.str33:
+	.string " "
+.__.str34:
+	.string " "
+	.lcomm .__._rt_buf, 65536
+.data
+	.__._rt_len: .quad 0
+.__._rt_fmt_float:
+	.string "%lf"
+.text
+main:
+	movq	$1073741824, .__BIG
+	movq	$12, %r13
+	pushq	%rbp
+	movq	%rsp, %rbp
+	movq	.__BIG, %r10
+	movq	%r10, %rax
+	imulq	%r10, %rax
+	shlq	$2, %rax
+	movq	%rax, .__BIG
+	subq	$1, %rax
+	movq	%rax, %r10
+	movq	$12, %rax
+	negq	%rax
+	pushq	%rax
+	leaq	.__I, %rax
+	movq	%rax, %r14
+	addq	%r10, .__BIG
+	popq	(%r14)
+	cmpq	(%r14), %r13
+	jl	..L2
+..L1:
+	movq	.__I, %rax
+	imulq	$7, %rax
+	subq	$3, %rax
+	movq	%rax, .__X
+	xorq	%rax, %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str0, %rdi
+	call	._rt_write_str
+	movq	.__X, %rdi
+	call	._rt_write_int
+	leaq	.__.str1, %rdi
+	call	._rt_write_str
+	movq	.__X, %rax
+	negq	%rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str2, %rdi
+	call	._rt_write_str
+	movq	.__X, %rax
+	shlq	$3, %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str3, %rdi
+	call	._rt_write_str
+	movq	.__X, %rax
+	shlq	$4, %rax
+	negq	%rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str4, %rdi
+	call	._rt_write_str
+	movq	.__X, %rax
+	leaq	(%rax,%rax,2), %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str5, %rdi
+	call	._rt_write_str
+	movq	.__X, %rax
+	leaq	(%rax,%rax,4), %rax
+	shlq	$3, %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str6, %rdi
+	call	._rt_write_str
+	movq	.__X, %rax
+	leaq	(%rax,%rax,8), %rax
+	leaq	(%rax,%rax,4), %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str7, %rdi
+	call	._rt_write_str
+	movq	.__X, %rax
+	imulq	$11, %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	.__X, %rdi
+	call	._rt_write_int
+	leaq	.__.str8, %rdi
+	call	._rt_write_str
+	movq	.__X, %rax
+	cqo
+	shrq	$63, %rdx
+	addq	%rdx, %rax
+	sarq	$1, %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str9, %rdi
+	call	._rt_write_str
+	movq	.__X, %rax
+	cqo
+	shrq	$61, %rdx
+	addq	%rdx, %rax
+	sarq	$3, %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str10, %rdi
+	call	._rt_write_str
+	movq	.__X, %rax
+	cqo
+	shrq	$62, %rdx
+	addq	%rdx, %rax
+	sarq	$2, %rax
+	negq	%rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str11, %rdi
+	call	._rt_write_str
+	movq	.__X, %r10
+	movq	$6148914691236517206, %rax
+	imulq	%r10
+	movq	%rdx, %rax
+	shrq	$63, %rax
+	addq	%rdx, %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str12, %rdi
+	call	._rt_write_str
+	movq	.__X, %r10
+	movq	$5270498306774157605, %rax
+	imulq	%r10
+	sarq	$1, %rdx
+	movq	%rdx, %rax
+	shrq	$63, %rax
+	addq	%rdx, %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str13, %rdi
+	call	._rt_write_str
+	movq	.__X, %r10
+	movq	$7378697629483820647, %rax
+	imulq	%r10
+	sarq	$2, %rdx
+	movq	%rdx, %rax
+	shrq	$63, %rax
+	addq	%rdx, %rax
+	negq	%rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str14, %rdi
+	call	._rt_write_str
+	movq	.__X, %r10
+	movq	$7367186400732675841, %rax
+	imulq	%r10
+	sarq	$8, %rdx
+	movq	%rdx, %rax
+	shrq	$63, %rax
+	addq	%rdx, %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str15, %rdi
+	call	._rt_write_str
+	movq	$1, %rax
+	negq	%rax
+	movq	%rax, %r10
+	movq	.__X, %rax
+	cqo
+	idivq	%r10
+	movq	%rax, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	xorq	%rdi, %rdi
+	call	._rt_write_int
+	leaq	.__.str16, %rdi
+	call	._rt_write_str
+	movq	.__X, %rax
+	cqo
+	shrq	$63, %rdx
+	addq	%rdx, %rax
+	andq	$1, %rax
+	subq	%rdx, %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str17, %rdi
+	call	._rt_write_str
+	movq	.__X, %rax
+	cqo
+	shrq	$60, %rdx
+	addq	%rdx, %rax
+	andq	$15, %rax
+	subq	%rdx, %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str18, %rdi
+	call	._rt_write_str
+	movq	.__X, %rax
+	cqo
+	shrq	$62, %rdx
+	addq	%rdx, %rax
+	andq	$3, %rax
+	subq	%rdx, %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str19, %rdi
+	call	._rt_write_str
+	movq	.__X, %r10
+	movq	$6148914691236517206, %rax
+	imulq	%r10
+	movq	%rdx, %rax
+	shrq	$63, %rax
+	addq	%rdx, %rax
+	imulq	$3, %rax
+	subq	%rax, %r10
+	movq	%r10, %rdi
+	call	._rt_write_int
+	leaq	.__.str20, %rdi
+	call	._rt_write_str
+	movq	.__X, %r10
+	movq	$5270498306774157605, %rax
+	imulq	%r10
+	sarq	$1, %rdx
+	movq	%rdx, %rax
+	shrq	$63, %rax
+	addq	%rdx, %rax
+	imulq	$7, %rax
+	subq	%rax, %r10
+	movq	%r10, %rdi
+	call	._rt_write_int
+	leaq	.__.str21, %rdi
+	call	._rt_write_str
+	movq	.__X, %r10
+	movq	$7378697629483820647, %rax
+	imulq	%r10
+	sarq	$2, %rdx
+	movq	%rdx, %rax
+	shrq	$63, %rax
+	addq	%rdx, %rax
+	imulq	$10, %rax
+	subq	%rax, %r10
+	movq	%r10, %rdi
+	call	._rt_write_int
+	leaq	.__.str22, %rdi
+	call	._rt_write_str
+	movq	.__X, %r10
+	movq	$7367186400732675841, %rax
+	imulq	%r10
+	sarq	$8, %rdx
+	movq	%rdx, %rax
+	shrq	$63, %rax
+	addq	%rdx, %rax
+	imulq	$641, %rax
+	subq	%rax, %r10
+	movq	%r10, %rdi
+	call	._rt_write_int
+	leaq	.__.str23, %rdi
+	call	._rt_write_str
+	movq	$1, %rax
+	negq	%rax
+	movq	%rax, %rbx
+	movq	.__X, %rax
+	cqo
+	idivq	%rbx
+	movq	%rdx, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+..L3:
+	movq	.__I, %r13
+	movq	$12, %r14
+	cmpq	%r13, %r14
+	jle	..L2
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L1
+..L2:
+	leaq	.__I, %rax
+	movq	%rax, %r14
+	movq	$0, (%r14)
+	movq	$3, %r13
+	cmpq	(%r14), %r13
+	jl	..L7
+..L6:
+	movq	.__I, %r10
+	movq	.__BIG, %rax
+	subq	%r10, %rax
+	movq	%rax, .__X
+	cqo
+	shrq	$63, %rdx
+	addq	%rdx, %rax
+	sarq	$1, %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str24, %rdi
+	call	._rt_write_str
+	movq	.__X, %r10
+	movq	$5270498306774157605, %rax
+	imulq	%r10
+	sarq	$1, %rdx
+	movq	%rdx, %rax
+	shrq	$63, %rax
+	addq	%rdx, %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str25, %rdi
+	call	._rt_write_str
+	movq	.__X, %r10
+	movq	$-8543223828751151131, %rax
+	imulq	%r10
+	addq	%r10, %rdx
+	sarq	$29, %rdx
+	movq	%rdx, %rax
+	shrq	$63, %rax
+	addq	%rdx, %rax
+	negq	%rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str26, %rdi
+	call	._rt_write_str
+	movq	.__X, %rax
+	cqo
+	shrq	$61, %rdx
+	addq	%rdx, %rax
+	andq	$7, %rax
+	subq	%rdx, %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str27, %rdi
+	call	._rt_write_str
+	movq	.__X, %r10
+	movq	$5270498306774157605, %rax
+	imulq	%r10
+	sarq	$1, %rdx
+	movq	%rdx, %rax
+	shrq	$63, %rax
+	addq	%rdx, %rax
+	imulq	$7, %rax
+	subq	%rax, %r10
+	movq	%r10, %rdi
+	call	._rt_write_int
+	leaq	.__.str28, %rdi
+	call	._rt_write_str
+	movq	.__X, %r10
+	movq	$-8543223828751151131, %rax
+	imulq	%r10
+	addq	%r10, %rdx
+	sarq	$29, %rdx
+	movq	%rdx, %rax
+	shrq	$63, %rax
+	addq	%rdx, %rax
+	imulq	$1000000007, %rax
+	subq	%rax, %r10
+	movq	%r10, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	.__X, %rax
+	negq	%rax
+	subq	$1, %rax
+	movq	%rax, .__X
+	cqo
+	shrq	$63, %rdx
+	addq	%rdx, %rax
+	sarq	$1, %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str29, %rdi
+	call	._rt_write_str
+	movq	.__X, %r10
+	movq	$5270498306774157605, %rax
+	imulq	%r10
+	sarq	$1, %rdx
+	movq	%rdx, %rax
+	shrq	$63, %rax
+	addq	%rdx, %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str30, %rdi
+	call	._rt_write_str
+	movq	.__X, %r10
+	movq	$-8543223828751151131, %rax
+	imulq	%r10
+	addq	%r10, %rdx
+	sarq	$29, %rdx
+	movq	%rdx, %rax
+	shrq	$63, %rax
+	addq	%rdx, %rax
+	negq	%rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str31, %rdi
+	call	._rt_write_str
+	movq	.__X, %rax
+	cqo
+	shrq	$61, %rdx
+	addq	%rdx, %rax
+	andq	$7, %rax
+	subq	%rdx, %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str32, %rdi
+	call	._rt_write_str
+	movq	.__X, %r10
+	movq	$5270498306774157605, %rax
+	imulq	%r10
+	sarq	$1, %rdx
+	movq	%rdx, %rax
+	shrq	$63, %rax
+	addq	%rdx, %rax
+	imulq	$7, %rax
+	subq	%rax, %r10
+	movq	%r10, %rdi
+	call	._rt_write_int
+	leaq	.__.str33, %rdi
+	call	._rt_write_str
+	movq	.__X, %r10
+	movq	$-8543223828751151131, %rax
+	imulq	%r10
+	addq	%r10, %rdx
+	sarq	$29, %rdx
+	movq	%rdx, %rax
+	shrq	$63, %rax
+	addq	%rdx, %rax
+	imulq	$1000000007, %rax
+	subq	%rax, %r10
+	movq	%r10, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	.__X, %rax
+	leaq	(%rax,%rax,4), %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str34, %rdi
+	call	._rt_write_str
+	movq	.__X, %rax
+	shlq	$1, %rax
+	movq	%rax, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+..L8:
+	movq	.__I, %r13
+	movq	$3, %r14
+	cmpq	%r13, %r14
+	jle	..L7
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L6
+..L7:
+	call	._rt_flush
+	popq	%rbp
+	xorq	%rax, %rax
+	ret
+._rt_flush:
+	movq	.__._rt_len(%rip), %rdx
+	leaq	.__._rt_buf(%rip), %rsi
+._rt_flush.1:
+	testq	%rdx, %rdx
+	jz	._rt_flush.2
+	movq	$1, %rax
+	movq	$1, %rdi
+	syscall
+	cmpq	$-4, %rax
+	je	._rt_flush.1
+	testq	%rax, %rax
+	jle	._rt_flush.2
+	addq	%rax, %rsi
+	subq	%rax, %rdx
+	jmp	._rt_flush.1
+._rt_flush.2:
+	movq	$0, .__._rt_len(%rip)
+	ret
+._rt_reserve:
+	movq	.__._rt_len(%rip), %rax
+	cmpq	$65504, %rax
+	jbe	._rt_reserve.1
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	xorq	%rax, %rax
+._rt_reserve.1:
+	leaq	.__._rt_buf(%rip), %rsi
+	addq	%rax, %rsi
+	ret
+._rt_commit:
+	leaq	.__._rt_buf(%rip), %rax
+	subq	%rax, %rsi
+	movq	%rsi, .__._rt_len(%rip)
+	ret
+._rt_utoa:
+	movq	%rsp, %rdi
+	movabsq	$-3689348814741910323, %r8
+	movq	%rax, %rcx
+._rt_utoa.1:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	decq	%rdi
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	testq	%rcx, %rcx
+	jnz	._rt_utoa.1
+._rt_utoa.2:
+	movb	(%rdi), %al
+	movb	%al, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	cmpq	%rsp, %rdi
+	jb	._rt_utoa.2
+	ret
+._rt_write_char:
+	call	._rt_reserve
+	movb	%dil, (%rsi)
+	incq	%rsi
+	jmp	._rt_commit
+._rt_write_str:
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+._rt_write_str.1:
+	movb	(%rdi), %cl
+	testb	%cl, %cl
+	jz	._rt_commit
+	cmpq	%rdx, %rsi
+	jb	._rt_write_str.2
+	call	._rt_commit
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+	movb	(%rdi), %cl
+._rt_write_str.2:
+	movb	%cl, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	jmp	._rt_write_str.1
+._rt_write_int:
+	call	._rt_reserve
+	movq	%rdi, %rax
+	testq	%rax, %rax
+	jns	._rt_write_int.1
+	movb	$45, (%rsi)
+	incq	%rsi
+	negq	%rax
+._rt_write_int.1:
+	call	._rt_utoa
+	jmp	._rt_commit
+._rt_write_float:
+	call	._rt_reserve
+	movq	%rdi, %r11
+	shrq	$52, %r11
+	andq	$2047, %r11
+	cmpq	$1086, %r11
+	jae	._rt_write_float.slow
+	testq	%rdi, %rdi
+	jns	._rt_write_float.1
+	movb	$45, (%rsi)
+	incq	%rsi
+._rt_write_float.1:
+	movabsq	$4503599627370495, %r8
+	andq	%rdi, %r8
+	movq	$1075, %rcx
+	testq	%r11, %r11
+	jz	._rt_write_float.2
+	btsq	$52, %r8
+	subq	%r11, %rcx
+	jmp	._rt_write_float.3
+._rt_write_float.2:
+	decq	%rcx
+._rt_write_float.3:
+	xorq	%r9, %r9
+	testq	%rcx, %rcx
+	jg	._rt_write_float.4
+	negq	%rcx
+	shlq	%cl, %r8
+	movq	%r8, %r10
+	jmp	._rt_write_float.out
+._rt_write_float.4:
+	xorq	%r10, %r10
+	cmpq	$64, %rcx
+	jae	._rt_write_float.5
+	movq	%r8, %r10
+	shrq	%cl, %r10
+	movq	$1, %rax
+	shlq	%cl, %rax
+	decq	%rax
+	andq	%rax, %r8
+._rt_write_float.5:
+	cmpq	$74, %rcx
+	jae	._rt_write_float.out
+	movq	%r8, %rax
+	movq	$1000000, %rdx
+	mulq	%rdx
+	decq	%rcx
+	cmpq	$64, %rcx
+	jae	._rt_write_float.6
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rax, %r11
+	shrdq	%cl, %rdx, %rax
+	jmp	._rt_write_float.7
+._rt_write_float.6:
+	subq	$64, %rcx
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rdx, %r11
+	orq	%rax, %r11
+	movq	%rdx, %rax
+	shrq	%cl, %rax
+._rt_write_float.7:
+	movq	%rax, %r9
+	shrq	$1, %r9
+	testq	$1, %rax
+	jz	._rt_write_float.out
+	testq	%r11, %r11
+	jnz	._rt_write_float.8
+	testq	$1, %r9
+	jz	._rt_write_float.out
+._rt_write_float.8:
+	incq	%r9
+	cmpq	$1000000, %r9
+	jb	._rt_write_float.out
+	xorq	%r9, %r9
+	incq	%r10
+._rt_write_float.out:
+	movq	%r10, %rax
+	pushq	%r9
+	call	._rt_utoa
+	popq	%rcx
+	movb	$46, (%rsi)
+	leaq	6(%rsi), %rdi
+	movabsq	$-3689348814741910323, %r8
+._rt_write_float.9:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	decq	%rdi
+	cmpq	%rsi, %rdi
+	jnz	._rt_write_float.9
+	addq	$7, %rsi
+	jmp	._rt_commit
+._rt_write_float.slow:
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	pushq	%rbp
+	movq	%rsp, %rbp
+	andq	$-16, %rsp
+	movq	%rdi, %xmm0
+	leaq	.__._rt_buf(%rip), %rdi
+	movq	$65536, %rsi
+	leaq	.__._rt_fmt_float(%rip), %rdx
+	movq	$1, %rax
+	call	snprintf
+	movq	%rax, .__._rt_len(%rip)
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+
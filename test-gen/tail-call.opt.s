@@ -0,0 +1,711 @@
+	.globl main
+.data
+	.__I: .quad 0
+.data
+	.__S: .quad 0
+.data
+	.__A: .fill 40,1,0
+.__.str1:
+	.string " "
+.__.str2:
+	.string " "
+.__.str0:
+	.string "done "
+	.lcomm .__._rt_buf, 65536
+.data
+	.__._rt_len: .quad 0
+.__._rt_fmt_float:
+	.string "%lf"
+.text
+main:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$48, %rsp
+	movq	$100000, -8(%rbp)
+	movq	$0, -16(%rbp)
+	xorq	%r11, %r11
+	movq	-8(%rbp), %rdx
+	xorq	%rax, %rax
+	cmpq	%r11, %rdx
+	sete	%al
+	testq	%rax, %rax
+	jz	..L33
+	movq	-16(%rbp), %rax
+	jmp	..L32
+	jmp	..L34
+..L33:
+..L34:
+	movq	-8(%rbp), %r10
+	movq	-16(%rbp), %rax
+	addq	%r10, %rax
+	movq	$1, %r10
+	pushq	%rax
+	movq	-8(%rbp), %rax
+	popq	%rsi
+	subq	%r10, %rax
+	movq	%rax, %rdi
+	call	.__SUM_TO
+	jmp	..L32
+..L32:
+	movq	%rax, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	$462, -16(%rbp)
+	xorq	%r11, %r11
+	xorq	%rax, %rax
+	movq	$1071, -8(%rbp)
+	movq	-16(%rbp), %rdx
+	cmpq	%r11, %rdx
+	sete	%al
+	testq	%rax, %rax
+	jz	..L36
+	movq	-8(%rbp), %rax
+	jmp	..L35
+	jmp	..L37
+..L36:
+..L37:
+	movq	-16(%rbp), %rbx
+	movq	-8(%rbp), %rax
+	cqo
+	idivq	%rbx
+	movq	%rdx, %rax
+	movq	%rbx, %rdi
+	movq	%rax, %rsi
+	call	.__GCD
+	jmp	..L35
+..L35:
+	movq	%rax, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	$10001, -8(%rbp)
+	xorq	%r11, %r11
+	movq	-8(%rbp), %rdx
+	xorq	%rax, %rax
+	cmpq	%r11, %rdx
+	sete	%al
+	testq	%rax, %rax
+	jz	..L41
+	movq	$1, %rax
+	jmp	..L40
+	jmp	..L42
+..L41:
+..L42:
+	movq	-8(%rbp), %rax
+	subq	$1, %rax
+	movq	%rax, %rdi
+	call	.__IS_ODD
+	jmp	..L40
+..L40:
+	movq	%rax, %rdi
+	call	._rt_write_int
+	leaq	.__.str1, %rdi
+	call	._rt_write_str
+	movq	$10001, %rdi
+	call	.__IS_ODD
+	movq	%rax, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	$1, -8(%rbp)
+	movq	$2, -16(%rbp)
+	movq	$3, -24(%rbp)
+	movq	-16(%rbp), %r10
+	movq	-8(%rbp), %rax
+	addq	%r10, %rax
+	addq	-24(%rbp), %rax
+	movq	%rax, -40(%rbp)
+	xorq	%r11, %r11
+	movq	%rax, %rdx
+	xorq	%rax, %rax
+	cmpq	%r11, %rdx
+	sete	%al
+	testq	%rax, %rax
+	jz	..L45
+	movq	$1, %rax
+	jmp	..L44
+	jmp	..L46
+..L45:
+..L46:
+	movq	-40(%rbp), %rax
+	subq	$1, %rax
+	movq	%rax, %rdi
+	call	.__IS_ODD
+	jmp	..L44
+..L44:
+	jmp	..L43
+..L43:
+	movq	%rax, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	$1000, -8(%rbp)
+	xorq	%r11, %r11
+	xorq	%rax, %rax
+	movq	$0, .__S
+	movq	-8(%rbp), %rdx
+	cmpq	%r11, %rdx
+	setg	%al
+	testq	%rax, %rax
+	jz	..L48
+	movq	%rdx, %r10
+	leaq	.__S, %rax
+	addq	%r10, .__S
+	pushq	%rax
+	movq	$1, %r10
+	movq	%rdx, %rax
+	popq	%rsi
+	subq	%r10, %rax
+	movq	%rax, %rdi
+	call	.__COUNT_DOWN
+	jmp	..L47
+	jmp	..L49
+..L48:
+..L49:
+	leaq	.__.str0, %rdi
+	call	._rt_write_str
+	movq	.__S, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+..L47:
+	movq	.__S, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	$1, -16(%rbp)
+	movq	-16(%rbp), %rdx
+	xorq	%rax, %rax
+	cmpq	$5, %rdx
+	setle	%al
+	testq	%rax, %rax
+	jz	..L51
+	movq	%rdx, %r10
+	movq	%rdx, %rax
+	imulq	%r10, %rax
+	pushq	%rax
+	leaq	.__A, %rax
+	pushq	%rax
+	movq	%rdx, %rax
+	subq	$1, %rax
+	movq	%rax, %rcx
+	popq	%rax
+	imulq	$8, %rcx
+	popq	(%rax,%rcx,1)
+	movq	-16(%rbp), %rax
+	addq	$1, %rax
+	pushq	%rax
+	leaq	.__A, %rax
+	popq	%rsi
+	movq	%rax, %rdi
+	call	.__FILL
+	jmp	..L52
+..L51:
+..L52:
+..L50:
+	leaq	.__I, %rax
+	movq	%rax, %r14
+	movq	$1, (%r14)
+	movq	$5, %r13
+	cmpq	(%r14), %r13
+	jl	..L54
+..L53:
+	leaq	.__A, %rax
+	pushq	%rax
+	movq	.__I, %rax
+	popq	%r10
+	subq	$1, %rax
+	movq	%rax, %r12
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %rdi
+	call	._rt_write_int
+	leaq	.__.str2, %rdi
+	call	._rt_write_str
+..L55:
+	movq	.__I, %r13
+	movq	$5, %r14
+	cmpq	%r13, %r14
+	jle	..L54
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L53
+..L54:
+	movq	$10, %rdi
+	call	._rt_write_char
+	call	._rt_flush
+	movq	%rbp, %rsp
+	popq	%rbp
+	xorq	%rax, %rax
+	ret
+.__SUM_TO:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+..L2:
+	xorq	%r11, %r11
+	movq	-8(%rbp), %rdx
+	xorq	%rax, %rax
+	cmpq	%r11, %rdx
+	sete	%al
+	testq	%rax, %rax
+	jz	..L3
+	movq	-16(%rbp), %rax
+	jmp	..L1
+	jmp	..L4
+..L3:
+..L4:
+	movq	-8(%rbp), %r10
+	movq	-16(%rbp), %rax
+	addq	%r10, %rax
+	movq	$1, %r10
+	pushq	%rax
+	movq	-8(%rbp), %rax
+	popq	-16(%rbp)
+	subq	%r10, %rax
+	movq	%rax, -8(%rbp)
+	jmp	..L2
+..L1:
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+.__GCD:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+..L6:
+	xorq	%r11, %r11
+	movq	-16(%rbp), %rdx
+	xorq	%rax, %rax
+	cmpq	%r11, %rdx
+	sete	%al
+	testq	%rax, %rax
+	jz	..L7
+	movq	-8(%rbp), %rax
+	jmp	..L5
+	jmp	..L8
+..L7:
+..L8:
+	movq	-16(%rbp), %rbx
+	movq	-8(%rbp), %rax
+	cqo
+	idivq	%rbx
+	movq	%rdx, %rax
+	pushq	%rax
+	pushq	%rbx
+	popq	-8(%rbp)
+	popq	-16(%rbp)
+	jmp	..L6
+..L5:
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+.__IS_EVEN:
+	pushq	%rbp
+	xorq	%r11, %r11
+	movq	%rdi, %rdx
+	xorq	%rax, %rax
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	cmpq	%r11, %rdx
+	sete	%al
+	movq	%rdi, -8(%rbp)
+	testq	%rax, %rax
+	jz	..L12
+	movq	$1, %rax
+	jmp	..L11
+	jmp	..L13
+..L12:
+..L13:
+	movq	-8(%rbp), %rax
+	movq	%rbp, %rsp
+	popq	%rbp
+	subq	$1, %rax
+	movq	%rax, %rdi
+	jmp	.__IS_ODD
+..L11:
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+.__IS_ODD:
+	pushq	%rbp
+	xorq	%r11, %r11
+	movq	%rdi, %rdx
+	xorq	%rax, %rax
+	movq	%rsp, %rbp
+	subq	$32, %rsp
+	cmpq	%r11, %rdx
+	sete	%al
+	movq	%rdi, -8(%rbp)
+	testq	%rax, %rax
+	jz	..L15
+	xorq	%rax, %rax
+	jmp	..L14
+	jmp	..L16
+..L15:
+..L16:
+	movq	-8(%rbp), %rax
+	subq	$1, %rax
+	movq	%rax, -24(%rbp)
+	xorq	%r11, %r11
+	movq	%rax, %rdx
+	xorq	%rax, %rax
+	cmpq	%r11, %rdx
+	sete	%al
+	testq	%rax, %rax
+	jz	..L18
+	movq	$1, %rax
+	jmp	..L17
+	jmp	..L19
+..L18:
+..L19:
+	movq	-24(%rbp), %rax
+	subq	$1, %rax
+	movq	%rax, %rdi
+	call	.__IS_ODD
+	jmp	..L17
+..L17:
+	jmp	..L14
+..L14:
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+.__PICK:
+	movq	%rsi, %r10
+	movq	%rdi, %rax
+	pushq	%rbp
+	xorq	%r11, %r11
+	addq	%r10, %rax
+	movq	%rsp, %rbp
+	subq	$48, %rsp
+	addq	%rdx, %rax
+	movq	%rdx, -24(%rbp)
+	movq	%rax, %rdx
+	movq	%rax, -40(%rbp)
+	xorq	%rax, %rax
+	cmpq	%r11, %rdx
+	movq	%rdi, -8(%rbp)
+	sete	%al
+	movq	%rsi, -16(%rbp)
+	testq	%rax, %rax
+	jz	..L22
+	movq	$1, %rax
+	jmp	..L21
+	jmp	..L23
+..L22:
+..L23:
+	movq	-40(%rbp), %rax
+	subq	$1, %rax
+	movq	%rax, %rdi
+	call	.__IS_ODD
+	jmp	..L21
+..L21:
+	jmp	..L20
+..L20:
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+.__COUNT_DOWN:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+..L25:
+	xorq	%r11, %r11
+	movq	-8(%rbp), %rdx
+	xorq	%rax, %rax
+	cmpq	%r11, %rdx
+	setg	%al
+	testq	%rax, %rax
+	jz	..L26
+	movq	-16(%rbp), %rax
+	movq	%rdx, %r10
+	movq	(%rax), %rax
+	addq	%r10, %rax
+	pushq	%rax
+	movq	-16(%rbp), %rax
+	popq	(%rax)
+	movq	-8(%rbp), %rax
+	pushq	-16(%rbp)
+	popq	-16(%rbp)
+	subq	$1, %rax
+	movq	%rax, -8(%rbp)
+	jmp	..L25
+	jmp	..L24
+	jmp	..L27
+..L26:
+..L27:
+	leaq	.__.str0, %rdi
+	call	._rt_write_str
+	movq	-16(%rbp), %rax
+	movq	(%rax), %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+..L24:
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+.__FILL:
+	pushq	%rbp
+	movq	%rsp, %rbp
+	subq	$16, %rsp
+	movq	%rdi, -8(%rbp)
+	movq	%rsi, -16(%rbp)
+..L29:
+	movq	-16(%rbp), %rdx
+	xorq	%rax, %rax
+	cmpq	$5, %rdx
+	setle	%al
+	testq	%rax, %rax
+	jz	..L30
+	movq	%rdx, %r10
+	movq	%rdx, %rax
+	imulq	%r10, %rax
+	pushq	%rax
+	movq	%rdx, %rax
+	subq	$1, %rax
+	movq	%rax, %rcx
+	movq	-8(%rbp), %rax
+	imulq	$8, %rcx
+	popq	(%rax,%rcx,1)
+	movq	-16(%rbp), %rax
+	addq	$1, %rax
+	pushq	%rax
+	pushq	-8(%rbp)
+	popq	-8(%rbp)
+	popq	-16(%rbp)
+	jmp	..L29
+	jmp	..L31
+..L30:
+..L31:
+..L28:
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+._rt_flush:
+	movq	.__._rt_len(%rip), %rdx
+	leaq	.__._rt_buf(%rip), %rsi
+._rt_flush.1:
+	testq	%rdx, %rdx
+	jz	._rt_flush.2
+	movq	$1, %rax
+	movq	$1, %rdi
+	syscall
+	cmpq	$-4, %rax
+	je	._rt_flush.1
+	testq	%rax, %rax
+	jle	._rt_flush.2
+	addq	%rax, %rsi
+	subq	%rax, %rdx
+	jmp	._rt_flush.1
+._rt_flush.2:
+	movq	$0, .__._rt_len(%rip)
+	ret
+._rt_reserve:
+	movq	.__._rt_len(%rip), %rax
+	cmpq	$65504, %rax
+	jbe	._rt_reserve.1
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	xorq	%rax, %rax
+._rt_reserve.1:
+	leaq	.__._rt_buf(%rip), %rsi
+	addq	%rax, %rsi
+	ret
+._rt_commit:
+	leaq	.__._rt_buf(%rip), %rax
+	subq	%rax, %rsi
+	movq	%rsi, .__._rt_len(%rip)
+	ret
+._rt_utoa:
+	movq	%rsp, %rdi
+	movabsq	$-3689348814741910323, %r8
+	movq	%rax, %rcx
+._rt_utoa.1:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	decq	%rdi
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	testq	%rcx, %rcx
+	jnz	._rt_utoa.1
+._rt_utoa.2:
+	movb	(%rdi), %al
+	movb	%al, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	cmpq	%rsp, %rdi
+	jb	._rt_utoa.2
+	ret
+._rt_write_char:
+	call	._rt_reserve
+	movb	%dil, (%rsi)
+	incq	%rsi
+	jmp	._rt_commit
+._rt_write_str:
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+._rt_write_str.1:
+	movb	(%rdi), %cl
+	testb	%cl, %cl
+	jz	._rt_commit
+	cmpq	%rdx, %rsi
+	jb	._rt_write_str.2
+	call	._rt_commit
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+	movb	(%rdi), %cl
+._rt_write_str.2:
+	movb	%cl, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	jmp	._rt_write_str.1
+._rt_write_int:
+	call	._rt_reserve
+	movq	%rdi, %rax
+	testq	%rax, %rax
+	jns	._rt_write_int.1
+	movb	$45, (%rsi)
+	incq	%rsi
+	negq	%rax
+._rt_write_int.1:
+	call	._rt_utoa
+	jmp	._rt_commit
+._rt_write_float:
+	call	._rt_reserve
+	movq	%rdi, %r11
+	shrq	$52, %r11
+	andq	$2047, %r11
+	cmpq	$1086, %r11
+	jae	._rt_write_float.slow
+	testq	%rdi, %rdi
+	jns	._rt_write_float.1
+	movb	$45, (%rsi)
+	incq	%rsi
+._rt_write_float.1:
+	movabsq	$4503599627370495, %r8
+	andq	%rdi, %r8
+	movq	$1075, %rcx
+	testq	%r11, %r11
+	jz	._rt_write_float.2
+	btsq	$52, %r8
+	subq	%r11, %rcx
+	jmp	._rt_write_float.3
+._rt_write_float.2:
+	decq	%rcx
+._rt_write_float.3:
+	xorq	%r9, %r9
+	testq	%rcx, %rcx
+	jg	._rt_write_float.4
+	negq	%rcx
+	shlq	%cl, %r8
+	movq	%r8, %r10
+	jmp	._rt_write_float.out
+._rt_write_float.4:
+	xorq	%r10, %r10
+	cmpq	$64, %rcx
+	jae	._rt_write_float.5
+	movq	%r8, %r10
+	shrq	%cl, %r10
+	movq	$1, %rax
+	shlq	%cl, %rax
+	decq	%rax
+	andq	%rax, %r8
+._rt_write_float.5:
+	cmpq	$74, %rcx
+	jae	._rt_write_float.out
+	movq	%r8, %rax
+	movq	$1000000, %rdx
+	mulq	%rdx
+	decq	%rcx
+	cmpq	$64, %rcx
+	jae	._rt_write_float.6
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rax, %r11
+	shrdq	%cl, %rdx, %rax
+	jmp	._rt_write_float.7
+._rt_write_float.6:
+	subq	$64, %rcx
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rdx, %r11
+	orq	%rax, %r11
+	movq	%rdx, %rax
+	shrq	%cl, %rax
+._rt_write_float.7:
+	movq	%rax, %r9
+	shrq	$1, %r9
+	testq	$1, %rax
+	jz	._rt_write_float.out
+	testq	%r11, %r11
+	jnz	._rt_write_float.8
+	testq	$1, %r9
+	jz	._rt_write_float.out
+._rt_write_float.8:
+	incq	%r9
+	cmpq	$1000000, %r9
+	jb	._rt_write_float.out
+	xorq	%r9, %r9
+	incq	%r10
+._rt_write_float.out:
+	movq	%r10, %rax
+	pushq	%r9
+	call	._rt_utoa
+	popq	%rcx
+	movb	$46, (%rsi)
+	leaq	6(%rsi), %rdi
+	movabsq	$-3689348814741910323, %r8
+._rt_write_float.9:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	decq	%rdi
+	cmpq	%rsi, %rdi
+	jnz	._rt_write_float.9
+	addq	$7, %rsi
+	jmp	._rt_commit
+._rt_write_float.slow:
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	pushq	%rbp
+	movq	%rsp, %rbp
+	andq	$-16, %rsp
+	movq	%rdi, %xmm0
+	leaq	.__._rt_buf(%rip), %rdi
+	movq	$65536, %rsi
+	leaq	.__._rt_fmt_float(%rip), %rdx
+	movq	$1, %rax
+	call	snprintf
+	movq	%rax, .__._rt_len(%rip)
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+
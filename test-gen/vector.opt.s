@@ -0,0 +1,982 @@
+	.globl main
+.data
+	.__I: .quad 0
+.data
+	.__K: .quad 0
+.data
+	.__N: .quad 0
+.data
+	.__X: .double 0
+.data
+	.__Y: .double 0
+.data
+	.__A: .fill 88,1,0
+.data
+	.__B: .fill 88,1,0
+.data
+	.__C: .fill 88,1,0
+.data
+	.__D: .fill 88,1,0
+.data
+	.__PA: .quad 0
+.data
+	.__PB: .quad 0
+.__.str0:
+	.string " "
+.__.str1:
+	.string " "
+	.lcomm .__._rt_buf, 65536
+.data
+	.__._rt_len: .quad 0
+.__._rt_fmt_float:
+	.string "%lf"
+.text
+main:
+	leaq	.__A, %rax
+	pushq	%rbp
+	movq	%rax, .__PA
+	leaq	.__B, %rax
+	movq	%rsp, %rbp
+	movq	%rax, .__PB
+	movq	$1, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	$11, .__N
+	movq	$3, .__K
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	$4, %rax
+	movq	.__N, %r13
+	cvtsi2sd	%rax, %xmm0
+	popq	%rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	divsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	movq	%rax, .__X
+	leaq	.__I, %rax
+	movq	%rax, %r14
+	movq	$1, (%r14)
+	cmpq	(%r14), %r13
+	jl	..L2
+..L1:
+	movq	.__I, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	leaq	.__B, %rax
+	pushq	%rax
+	movq	.__I, %rax
+	subq	$1, %rax
+	movq	%rax, %rcx
+	popq	%rax
+	imulq	$8, %rcx
+	popq	(%rax,%rcx,1)
+..L3:
+	movq	.__I, %r13
+	movq	.__N, %r14
+	cmpq	%r13, %r14
+	jle	..L2
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L1
+..L2:
+	movq	.__K, %rax
+	pushq	$1
+	pushq	.__N
+	pushq	.__X
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	$2, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	leaq	.__A, %rax
+	pushq	%rax
+	leaq	.__B, %rax
+	popq	%r9
+	movq	%rax, %r10
+	popq	%rax
+	movq	%rax, %xmm2
+	popq	%rax
+	unpcklpd	%xmm2, %xmm2
+	movq	%rax, %xmm1
+	popq	%rax
+	unpcklpd	%xmm1, %xmm1
+	popq	%rdx
+	movq	%rax, %xmm0
+	unpcklpd	%xmm0, %xmm0
+	popq	%rcx
+..L7:
+	cmpq	%rdx, %rcx
+	jg	..L10
+..L8:
+	leaq	1(%rcx), %rax
+	cmpq	%rdx, %rax
+	jg	..L9
+	movupd	-8(%r10,%rcx,8), %xmm3
+	mulpd	%xmm0, %xmm3
+	addpd	%xmm1, %xmm3
+	divpd	%xmm2, %xmm3
+	movupd	-8(%r10,%rcx,8), %xmm4
+	subpd	%xmm4, %xmm3
+	movupd	%xmm3, -8(%r9,%rcx,8)
+	addq	$2, %rcx
+	jmp	..L8
+..L9:
+	cmpq	%rdx, %rcx
+	jle	..L11
+	movq	%rdx, %rcx
+..L10:
+	movq	%rcx, .__I
+	jmp	..L5
+..L11:
+	movq	%rcx, .__I
+..L4:
+	leaq	.__B, %rax
+	pushq	%rax
+	movq	.__I, %rax
+	popq	%r10
+	subq	$1, %rax
+	movq	%rax, %r12
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	pushq	%r10
+	movq	.__X, %r10
+	popq	%rax
+	movq	%r10, %xmm1
+	movq	%rax, %xmm0
+	mulsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	.__K, %rax
+	cvtsi2sd	%rax, %xmm0
+	popq	%rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	$2, %rax
+	cvtsi2sd	%rax, %xmm0
+	popq	%rax
+	movq	%xmm0, %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	divsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	leaq	.__B, %rax
+	pushq	%rax
+	movq	.__I, %rax
+	popq	%r10
+	subq	$1, %rax
+	movq	%rax, %r12
+	popq	%rax
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	movq	%rax, %xmm0
+	movq	%r10, %xmm1
+	subsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	leaq	.__A, %rax
+	pushq	%rax
+	movq	.__I, %rax
+	subq	$1, %rax
+	movq	%rax, %rcx
+	popq	%rax
+	imulq	$8, %rcx
+	popq	(%rax,%rcx,1)
+..L6:
+	movq	.__I, %r13
+	movq	.__N, %r14
+	cmpq	%r13, %r14
+	jle	..L5
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L4
+..L5:
+	leaq	.__I, %rax
+	movq	.__N, %r13
+	movq	%rax, %r14
+	movq	$1, (%r14)
+	cmpq	(%r14), %r13
+	jl	..L13
+..L12:
+	leaq	.__A, %rax
+	pushq	%rax
+	movq	.__I, %rax
+	popq	%r10
+	subq	$1, %rax
+	movq	%rax, %r12
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %rdi
+	call	._rt_write_float
+	movq	$10, %rdi
+	call	._rt_write_char
+..L14:
+	movq	.__I, %r13
+	movq	.__N, %r14
+	cmpq	%r13, %r14
+	jle	..L13
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L12
+..L13:
+	leaq	.__I, %rax
+	movq	%rax, %r14
+	movq	$0, (%r14)
+	movq	$10, %r13
+	cmpq	(%r14), %r13
+	jl	..L16
+..L15:
+	movq	.__I, %r10
+	xorq	%r9, %r9
+	movq	%r10, %rax
+	imulq	%r10, %rax
+	pushq	%rax
+	leaq	.__C, %rax
+	pushq	%rax
+	movq	%r10, %rax
+	subq	%r9, %rax
+	movq	%rax, %rcx
+	popq	%rax
+	imulq	$8, %rcx
+	popq	(%rax,%rcx,1)
+..L17:
+	movq	.__I, %r13
+	movq	$10, %r14
+	cmpq	%r13, %r14
+	jle	..L16
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L15
+..L16:
+	pushq	$1
+	leaq	.__D, %rax
+	pushq	$9
+	pushq	.__K
+	pushq	%rax
+	leaq	.__C, %rax
+	popq	%r9
+	movq	%rax, %r10
+	popq	%rax
+	popq	%rdx
+	movq	%rax, %xmm0
+	punpcklqdq	%xmm0, %xmm0
+	popq	%rcx
+..L21:
+	cmpq	%rdx, %rcx
+	jg	..L24
+..L22:
+	leaq	1(%rcx), %rax
+	cmpq	%rdx, %rax
+	jg	..L23
+	pxor	%xmm1, %xmm1
+	movdqu	8(%r10,%rcx,8), %xmm2
+	movdqu	-8(%r10,%rcx,8), %xmm3
+	psubq	%xmm3, %xmm2
+	psubq	%xmm2, %xmm1
+	paddq	%xmm0, %xmm1
+	movdqu	%xmm1, -8(%r9,%rcx,8)
+	addq	$2, %rcx
+	jmp	..L22
+..L23:
+	cmpq	%rdx, %rcx
+	jle	..L25
+	movq	%rdx, %rcx
+..L24:
+	movq	%rcx, .__I
+	jmp	..L19
+..L25:
+	movq	%rcx, .__I
+..L18:
+	leaq	.__C, %rax
+	pushq	%rax
+	movq	.__I, %rax
+	popq	%r10
+	addq	$1, %rax
+	movq	%rax, %r12
+	leaq	.__C, %rax
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	pushq	%r10
+	pushq	%rax
+	movq	.__I, %rax
+	popq	%r10
+	subq	$1, %rax
+	movq	%rax, %r12
+	popq	%rax
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	subq	%r10, %rax
+	negq	%rax
+	addq	.__K, %rax
+	pushq	%rax
+	leaq	.__D, %rax
+	pushq	%rax
+	movq	.__I, %rax
+	subq	$1, %rax
+	movq	%rax, %rcx
+	popq	%rax
+	imulq	$8, %rcx
+	popq	(%rax,%rcx,1)
+..L20:
+	movq	.__I, %r13
+	movq	$9, %r14
+	cmpq	%r13, %r14
+	jle	..L19
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L18
+..L19:
+	leaq	.__I, %rax
+	movq	%rax, %r14
+	movq	$0, (%r14)
+	movq	$10, %r13
+	cmpq	(%r14), %r13
+	jl	..L27
+..L26:
+	leaq	.__D, %rax
+	xorq	%r9, %r9
+	pushq	%rax
+	movq	.__I, %rax
+	popq	%r10
+	subq	%r9, %rax
+	movq	%rax, %r12
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+..L28:
+	movq	.__I, %r13
+	movq	$10, %r14
+	cmpq	%r13, %r14
+	jle	..L27
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L26
+..L27:
+	leaq	.__D, %rax
+	pushq	$0
+	pushq	$9
+	pushq	%rax
+	leaq	.__C, %rax
+	movq	%rax, %r10
+	popq	%r9
+	popq	%rdx
+	popq	%rcx
+..L32:
+	cmpq	%rdx, %rcx
+	jg	..L35
+..L33:
+	leaq	1(%rcx), %rax
+	cmpq	%rdx, %rax
+	jg	..L34
+	movdqu	(%r9,%rcx,8), %xmm0
+	movdqu	8(%r10,%rcx,8), %xmm1
+	paddq	%xmm1, %xmm0
+	movdqu	%xmm0, (%r9,%rcx,8)
+	addq	$2, %rcx
+	jmp	..L33
+..L34:
+	cmpq	%rdx, %rcx
+	jle	..L36
+	movq	%rdx, %rcx
+..L35:
+	movq	%rcx, .__I
+	jmp	..L30
+..L36:
+	movq	%rcx, .__I
+..L29:
+	leaq	.__D, %rax
+	xorq	%r9, %r9
+	pushq	%rax
+	movq	.__I, %rax
+	popq	%r10
+	subq	%r9, %rax
+	xorq	%r9, %r9
+	movq	%rax, %r12
+	leaq	.__C, %rax
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	pushq	%r10
+	pushq	%rax
+	movq	.__I, %rax
+	popq	%r10
+	addq	$1, %rax
+	movq	%rax, %r12
+	popq	%rax
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	addq	%r10, %rax
+	pushq	%rax
+	leaq	.__D, %rax
+	pushq	%rax
+	movq	.__I, %rax
+	subq	%r9, %rax
+	movq	%rax, %rcx
+	popq	%rax
+	imulq	$8, %rcx
+	popq	(%rax,%rcx,1)
+..L31:
+	movq	.__I, %r13
+	movq	$9, %r14
+	cmpq	%r13, %r14
+	jle	..L30
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L29
+..L30:
+	leaq	.__D, %rax
+	xorq	%r9, %r9
+	pushq	%rax
+	xorq	%rax, %rax
+	subq	%r9, %rax
+	popq	%r10
+	movq	%rax, %r12
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %rdi
+	call	._rt_write_int
+	leaq	.__.str0, %rdi
+	call	._rt_write_str
+	leaq	.__D, %rax
+	xorq	%r9, %r9
+	pushq	%rax
+	movq	$8, %rax
+	subq	%r9, %rax
+	popq	%r10
+	movq	%rax, %r12
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %rdi
+	call	._rt_write_int
+	leaq	.__.str1, %rdi
+	call	._rt_write_str
+	leaq	.__D, %rax
+	xorq	%r9, %r9
+	pushq	%rax
+	movq	$9, %rax
+	subq	%r9, %rax
+	popq	%r10
+	movq	%rax, %r12
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	leaq	.__D, %rax
+	movq	%rax, %r9
+	xorq	%rax, %rax
+	movq	%rax, %xmm0
+	punpcklqdq	%xmm0, %xmm0
+	movq	$5, %rcx
+	movq	$4, %rdx
+..L40:
+	cmpq	%rdx, %rcx
+	jg	..L43
+..L41:
+	leaq	1(%rcx), %rax
+	cmpq	%rdx, %rax
+	jg	..L42
+	movdqu	%xmm0, (%r9,%rcx,8)
+	addq	$2, %rcx
+	jmp	..L41
+..L42:
+	cmpq	%rdx, %rcx
+	jle	..L44
+	movq	%rdx, %rcx
+..L43:
+	movq	%rcx, .__I
+	jmp	..L38
+..L44:
+	movq	%rcx, .__I
+..L37:
+	leaq	.__D, %rax
+	pushq	$0
+	xorq	%r9, %r9
+	pushq	%rax
+	movq	.__I, %rax
+	subq	%r9, %rax
+	movq	%rax, %rcx
+	popq	%rax
+	imulq	$8, %rcx
+	popq	(%rax,%rcx,1)
+..L39:
+	movq	.__I, %r13
+	movq	$4, %r14
+	cmpq	%r13, %r14
+	jle	..L38
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L37
+..L38:
+	movq	.__I, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	leaq	.__I, %rax
+	movq	%rax, %r14
+	movq	$2, (%r14)
+	movq	$10, %r13
+	cmpq	(%r14), %r13
+	jl	..L46
+..L45:
+	leaq	.__C, %rax
+	xorq	%r9, %r9
+	pushq	%rax
+	movq	.__I, %rax
+	popq	%r10
+	subq	$1, %rax
+	movq	%rax, %r12
+	leaq	.__C, %rax
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	pushq	%r10
+	pushq	%rax
+	movq	.__I, %rax
+	popq	%r10
+	subq	$2, %rax
+	movq	%rax, %r12
+	popq	%rax
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %r10
+	addq	%r10, %rax
+	pushq	%rax
+	leaq	.__C, %rax
+	pushq	%rax
+	movq	.__I, %rax
+	subq	%r9, %rax
+	movq	%rax, %rcx
+	popq	%rax
+	imulq	$8, %rcx
+	popq	(%rax,%rcx,1)
+..L47:
+	movq	.__I, %r13
+	movq	$10, %r14
+	cmpq	%r13, %r14
+	jle	..L46
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L45
+..L46:
+	leaq	.__C, %rax
+	xorq	%r9, %r9
+	pushq	%rax
+	movq	$10, %rax
+	subq	%r9, %rax
+	popq	%r10
+	movq	%rax, %r12
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	movq	$1, %rax
+	movq	.__PB, %r10
+	movq	.__PA, %r9
+	movq	$2, %rcx
+	cvtsi2sd	%rax, %xmm0
+	movq	.__N, %rdx
+	movq	%xmm0, %rax
+	movq	%rax, %xmm0
+	unpcklpd	%xmm0, %xmm0
+..L51:
+	cmpq	%rdx, %rcx
+	jg	..L54
+	movq	%r9, %rax
+	subq	%r10, %rax
+	addq	$7, %rax
+	cmpq	$15, %rax
+	jb	..L55
+..L52:
+	leaq	1(%rcx), %rax
+	cmpq	%rdx, %rax
+	jg	..L53
+	movupd	-16(%r10,%rcx,8), %xmm1
+	addpd	%xmm0, %xmm1
+	movupd	%xmm1, -8(%r9,%rcx,8)
+	addq	$2, %rcx
+	jmp	..L52
+..L53:
+	cmpq	%rdx, %rcx
+	jle	..L55
+	movq	%rdx, %rcx
+..L54:
+	movq	%rcx, .__I
+	jmp	..L49
+..L55:
+	movq	%rcx, .__I
+..L48:
+	movq	.__I, %rax
+	movq	.__PB, %r10
+	subq	$1, %rax
+	subq	$1, %rax
+	movq	%rax, %r12
+	movq	$1, %rax
+	imulq	$8, %r12
+	cvtsi2sd	%rax, %xmm0
+	movq	(%r10,%r12,1), %r10
+	pushq	%r10
+	movq	%xmm0, %r10
+	popq	%rax
+	movq	%r10, %xmm1
+	movq	%rax, %xmm0
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	.__I, %rax
+	subq	$1, %rax
+	movq	%rax, %rcx
+	movq	.__PA, %rax
+	imulq	$8, %rcx
+	popq	(%rax,%rcx,1)
+..L50:
+	movq	.__I, %r13
+	movq	.__N, %r14
+	cmpq	%r13, %r14
+	jle	..L49
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L48
+..L49:
+	leaq	.__A, %rax
+	movq	.__PA, %r9
+	movq	.__N, %rdx
+	movq	$2, %rcx
+	movq	%rax, .__PB
+	movq	$1, %rax
+	cvtsi2sd	%rax, %xmm0
+	movq	.__PB, %r10
+	movq	%xmm0, %rax
+	movq	%rax, %xmm0
+	unpcklpd	%xmm0, %xmm0
+..L59:
+	cmpq	%rdx, %rcx
+	jg	..L62
+	movq	%r9, %rax
+	subq	%r10, %rax
+	addq	$7, %rax
+	cmpq	$15, %rax
+	jb	..L63
+..L60:
+	leaq	1(%rcx), %rax
+	cmpq	%rdx, %rax
+	jg	..L61
+	movupd	-16(%r10,%rcx,8), %xmm1
+	addpd	%xmm0, %xmm1
+	movupd	%xmm1, -8(%r9,%rcx,8)
+	addq	$2, %rcx
+	jmp	..L60
+..L61:
+	cmpq	%rdx, %rcx
+	jle	..L63
+	movq	%rdx, %rcx
+..L62:
+	movq	%rcx, .__I
+	jmp	..L57
+..L63:
+	movq	%rcx, .__I
+..L56:
+	movq	.__I, %rax
+	movq	.__PB, %r10
+	subq	$1, %rax
+	subq	$1, %rax
+	movq	%rax, %r12
+	movq	$1, %rax
+	imulq	$8, %r12
+	cvtsi2sd	%rax, %xmm0
+	movq	(%r10,%r12,1), %r10
+	pushq	%r10
+	movq	%xmm0, %r10
+	popq	%rax
+	movq	%r10, %xmm1
+	movq	%rax, %xmm0
+	addsd	%xmm1, %xmm0
+	movq	%xmm0, %rax
+	pushq	%rax
+	movq	.__I, %rax
+	subq	$1, %rax
+	movq	%rax, %rcx
+	movq	.__PA, %rax
+	imulq	$8, %rcx
+	popq	(%rax,%rcx,1)
+..L58:
+	movq	.__I, %r13
+	movq	.__N, %r14
+	cmpq	%r13, %r14
+	jle	..L57
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L56
+..L57:
+	leaq	.__I, %rax
+	movq	.__N, %r13
+	movq	%rax, %r14
+	movq	$1, (%r14)
+	cmpq	(%r14), %r13
+	jl	..L65
+..L64:
+	leaq	.__A, %rax
+	pushq	%rax
+	movq	.__I, %rax
+	popq	%r10
+	subq	$1, %rax
+	movq	%rax, %r12
+	imulq	$8, %r12
+	movq	(%r10,%r12,1), %rdi
+	call	._rt_write_float
+	movq	$10, %rdi
+	call	._rt_write_char
+..L66:
+	movq	.__I, %r13
+	movq	.__N, %r14
+	cmpq	%r13, %r14
+	jle	..L65
+	leaq	.__I, %rax
+	movq	%rax, %r12
+	addq	$1, (%r12)
+	jmp	..L64
+..L65:
+	movq	.__I, %rdi
+	call	._rt_write_int
+	movq	$10, %rdi
+	call	._rt_write_char
+	call	._rt_flush
+	popq	%rbp
+	xorq	%rax, %rax
+	ret
+._rt_flush:
+	movq	.__._rt_len(%rip), %rdx
+	leaq	.__._rt_buf(%rip), %rsi
+._rt_flush.1:
+	testq	%rdx, %rdx
+	jz	._rt_flush.2
+	movq	$1, %rax
+	movq	$1, %rdi
+	syscall
+	cmpq	$-4, %rax
+	je	._rt_flush.1
+	testq	%rax, %rax
+	jle	._rt_flush.2
+	addq	%rax, %rsi
+	subq	%rax, %rdx
+	jmp	._rt_flush.1
+._rt_flush.2:
+	movq	$0, .__._rt_len(%rip)
+	ret
+._rt_reserve:
+	movq	.__._rt_len(%rip), %rax
+	cmpq	$65504, %rax
+	jbe	._rt_reserve.1
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	xorq	%rax, %rax
+._rt_reserve.1:
+	leaq	.__._rt_buf(%rip), %rsi
+	addq	%rax, %rsi
+	ret
+._rt_commit:
+	leaq	.__._rt_buf(%rip), %rax
+	subq	%rax, %rsi
+	movq	%rsi, .__._rt_len(%rip)
+	ret
+._rt_utoa:
+	movq	%rsp, %rdi
+	movabsq	$-3689348814741910323, %r8
+	movq	%rax, %rcx
+._rt_utoa.1:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	decq	%rdi
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	testq	%rcx, %rcx
+	jnz	._rt_utoa.1
+._rt_utoa.2:
+	movb	(%rdi), %al
+	movb	%al, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	cmpq	%rsp, %rdi
+	jb	._rt_utoa.2
+	ret
+._rt_write_char:
+	call	._rt_reserve
+	movb	%dil, (%rsi)
+	incq	%rsi
+	jmp	._rt_commit
+._rt_write_str:
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+._rt_write_str.1:
+	movb	(%rdi), %cl
+	testb	%cl, %cl
+	jz	._rt_commit
+	cmpq	%rdx, %rsi
+	jb	._rt_write_str.2
+	call	._rt_commit
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	call	._rt_reserve
+	leaq	.__._rt_buf(%rip), %rdx
+	addq	$65536, %rdx
+	movb	(%rdi), %cl
+._rt_write_str.2:
+	movb	%cl, (%rsi)
+	incq	%rsi
+	incq	%rdi
+	jmp	._rt_write_str.1
+._rt_write_int:
+	call	._rt_reserve
+	movq	%rdi, %rax
+	testq	%rax, %rax
+	jns	._rt_write_int.1
+	movb	$45, (%rsi)
+	incq	%rsi
+	negq	%rax
+._rt_write_int.1:
+	call	._rt_utoa
+	jmp	._rt_commit
+._rt_write_float:
+	call	._rt_reserve
+	movq	%rdi, %r11
+	shrq	$52, %r11
+	andq	$2047, %r11
+	cmpq	$1086, %r11
+	jae	._rt_write_float.slow
+	testq	%rdi, %rdi
+	jns	._rt_write_float.1
+	movb	$45, (%rsi)
+	incq	%rsi
+._rt_write_float.1:
+	movabsq	$4503599627370495, %r8
+	andq	%rdi, %r8
+	movq	$1075, %rcx
+	testq	%r11, %r11
+	jz	._rt_write_float.2
+	btsq	$52, %r8
+	subq	%r11, %rcx
+	jmp	._rt_write_float.3
+._rt_write_float.2:
+	decq	%rcx
+._rt_write_float.3:
+	xorq	%r9, %r9
+	testq	%rcx, %rcx
+	jg	._rt_write_float.4
+	negq	%rcx
+	shlq	%cl, %r8
+	movq	%r8, %r10
+	jmp	._rt_write_float.out
+._rt_write_float.4:
+	xorq	%r10, %r10
+	cmpq	$64, %rcx
+	jae	._rt_write_float.5
+	movq	%r8, %r10
+	shrq	%cl, %r10
+	movq	$1, %rax
+	shlq	%cl, %rax
+	decq	%rax
+	andq	%rax, %r8
+._rt_write_float.5:
+	cmpq	$74, %rcx
+	jae	._rt_write_float.out
+	movq	%r8, %rax
+	movq	$1000000, %rdx
+	mulq	%rdx
+	decq	%rcx
+	cmpq	$64, %rcx
+	jae	._rt_write_float.6
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rax, %r11
+	shrdq	%cl, %rdx, %rax
+	jmp	._rt_write_float.7
+._rt_write_float.6:
+	subq	$64, %rcx
+	movq	$1, %r11
+	shlq	%cl, %r11
+	decq	%r11
+	andq	%rdx, %r11
+	orq	%rax, %r11
+	movq	%rdx, %rax
+	shrq	%cl, %rax
+._rt_write_float.7:
+	movq	%rax, %r9
+	shrq	$1, %r9
+	testq	$1, %rax
+	jz	._rt_write_float.out
+	testq	%r11, %r11
+	jnz	._rt_write_float.8
+	testq	$1, %r9
+	jz	._rt_write_float.out
+._rt_write_float.8:
+	incq	%r9
+	cmpq	$1000000, %r9
+	jb	._rt_write_float.out
+	xorq	%r9, %r9
+	incq	%r10
+._rt_write_float.out:
+	movq	%r10, %rax
+	pushq	%r9
+	call	._rt_utoa
+	popq	%rcx
+	movb	$46, (%rsi)
+	leaq	6(%rsi), %rdi
+	movabsq	$-3689348814741910323, %r8
+._rt_write_float.9:
+	movq	%rcx, %rax
+	mulq	%r8
+	shrq	$3, %rdx
+	leaq	(%rdx,%rdx,4), %rax
+	addq	%rax, %rax
+	subq	%rax, %rcx
+	addb	$48, %cl
+	movb	%cl, (%rdi)
+	movq	%rdx, %rcx
+	decq	%rdi
+	cmpq	%rsi, %rdi
+	jnz	._rt_write_float.9
+	addq	$7, %rsi
+	jmp	._rt_commit
+._rt_write_float.slow:
+	pushq	%rdi
+	call	._rt_flush
+	popq	%rdi
+	pushq	%rbp
+	movq	%rsp, %rbp
+	andq	$-16, %rsp
+	movq	%rdi, %xmm0
+	leaq	.__._rt_buf(%rip), %rdi
+	movq	$65536, %rsi
+	leaq	.__._rt_fmt_float(%rip), %rdx
+	movq	$1, %rax
+	call	snprintf
+	movq	%rax, .__._rt_len(%rip)
+	movq	%rbp, %rsp
+	popq	%rbp
+	ret
+
@@ -0,0 +1,32 @@
+#!/bin/bash
+# The test-gen programs run in process with --run, with and without -O, by a compiler built with
+# optimization: it keeps values in rbx and r12-r15 across the call of the program's main, so they
+# are lost if the call does not save them. The exit code must be 0 and the output as with -S -O.
+script_dir=$(dirname $0)
+test_dir=$script_dir/test-gen
+build=$(mktemp -d)
+trap "rm -rf $build" EXIT
+dots=.........................
+
+cmake -S $script_dir -B $build -DCMAKE_BUILD_TYPE=Release >/dev/null &&
+cmake --build $build -j"$(nproc)" >/dev/null || { echo "compiler build failed"; exit 1; }
+
+total=0
+passed=0
+for filename in $test_dir/*.in; do
+	opt_output=$test_dir/$(basename "$filename" .in).opt.out
+	for opt in "" -O; do
+		echo ..................................................$filename $opt
+		total=$((total + 1))
+		output=$($build/compiler --run $opt $filename)
+		status=$?
+		if [ $status -ne 0 ]; then
+			echo "$dots exit code $status"
+		elif [ "$output" != "$(cat $opt_output)" ]; then
+			echo "$dots run outputs are different"
+		else
+			passed=$((passed + 1))
+		fi
+	done
+done
+echo $passed of $total tests passed
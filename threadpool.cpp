@@ -0,0 +1,90 @@
+#include "threadpool.h"
+#include <algorithm>
+
+using namespace std;
+
+ThreadPool::ThreadPool(size_t workers) :
+    m_next(0)
+{
+	if (workers == 0) {
+		workers = max(1u, thread::hardware_concurrency());
+	}
+	for (size_t worker = 1; worker < workers; worker++) {
+		m_threads.emplace_back(&ThreadPool::m_work, this, worker);
+	}
+}
+
+ThreadPool::~ThreadPool() {
+	{
+		lock_guard<mutex> lock(m_mutex);
+		m_stop = true;
+	}
+	m_wake.notify_all();
+	for (thread& t: m_threads) {
+		t.join();
+	}
+}
+
+size_t ThreadPool::size() const {
+	return m_threads.size() + 1;
+}
+
+void ThreadPool::run(size_t count, const std::function<void(size_t, size_t)>& task) {
+	/// nothing for the others, they are not woken
+	if (count <= 1 || m_threads.empty()) {
+		for (size_t i = 0; i < count; i++) {
+			task(i, 0);
+		}
+		return;
+	}
+	{
+		lock_guard<mutex> lock(m_mutex);
+		m_task = &task;
+		m_count = count;
+		m_next = 0;
+		m_running = m_threads.size();
+		m_error = nullptr;
+		m_generation++;
+	}
+	m_wake.notify_all();
+	m_drain(0);
+	unique_lock<mutex> lock(m_mutex);
+	m_done.wait(lock, [this]() { return m_running == 0; });
+	m_task = nullptr;
+	if (m_error) {
+		rethrow_exception(m_error);
+	}
+}
+
+void ThreadPool::m_work(size_t worker) {
+	uint64_t seen = 0;
+	while (true) {
+		{
+			unique_lock<mutex> lock(m_mutex);
+			m_wake.wait(lock, [&]() { return m_stop || m_generation != seen; });
+			if (m_stop) {
+				return;
+			}
+			seen = m_generation;
+		}
+		m_drain(worker);
+		lock_guard<mutex> lock(m_mutex);
+		if (--m_running == 0) {
+			m_done.notify_one();
+		}
+	}
+}
+
+/// indices go to whichever worker asks first
+void ThreadPool::m_drain(size_t worker) {
+	for (size_t i = m_next++; i < m_count; i = m_next++) {
+		try {
+			(*m_task)(i, worker);
+		} catch (...) {
+			lock_guard<mutex> lock(m_mutex);
+			if (!m_error) {
+				m_error = current_exception();
+			}
+		}
+	}
+}
@@ -0,0 +1,40 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// Workers waiting for the tasks of run(), the thread calling run() is worker 0.
+class ThreadPool {
+public:
+	/// as many workers as the hardware has threads for 0
+	explicit ThreadPool(size_t workers = 0);
+	~ThreadPool();
+	size_t size() const;
+	/// task(index, worker) for each index below count, the first exception is thrown again;
+	/// a single task runs on the calling thread
+	void run(size_t count, const std::function<void(size_t, size_t)>& task);
+private:
+	std::vector<std::thread> m_threads;
+	std::mutex m_mutex;
+	std::condition_variable m_wake;
+	std::condition_variable m_done;
+	/// of the run going on
+	const std::function<void(size_t, size_t)>* m_task = nullptr;
+	size_t m_count = 0;
+	std::atomic<size_t> m_next;
+	size_t m_running = 0;
+	uint64_t m_generation = 0;
+	std::exception_ptr m_error;
+	bool m_stop = false;
+
+	void m_work(size_t worker);
+	void m_drain(size_t worker);
+};
+
+#endif // THREADPOOL_H
@@ -133,41 +133,27 @@ typedef std::shared_ptr<NodeConstantFloat> PNodeConstantFloat;
 
 typedef std::shared_ptr<NodeExprStmtFunctionCall> PNodeExprStmtFunctionCall;
 
-class AsmOperand;
-class AsmOperandReg;
-class AsmOperandImm;
-class AsmImmInt;
-class AsmImmFloat;
-class AsmOperandOffset;
-class AsmOperandIndirect;
+struct AsmOp;
+struct AsmInstr;
 class AsmCode;
-class AsmCmd;
-class AsmCmd0;
-class AsmCmd1;
-class AsmCmd2;
-class AsmComment;
 class AsmVar;
 class AsmVarString;
+class AsmVarInt;
+class AsmVarFloat;
+class AsmVarArray;
+class AsmVarRecord;
+class AsmVarBss;
 class AsmLabel;
-class AsmRawInt;
 
-typedef std::shared_ptr<AsmOperand> PAsmOperand; 
-typedef std::shared_ptr<AsmOperandReg> PAsmOperandReg; 
-typedef std::shared_ptr<AsmOperandImm> PAsmOperandImm; 
-typedef std::shared_ptr<AsmImmInt> PAsmImmInt;
-typedef std::shared_ptr<AsmImmFloat> PAsmImmFloat;
-typedef std::shared_ptr<AsmOperandOffset> PAsmOperandOffset;
-typedef std::shared_ptr<AsmOperandIndirect> PAsmOperandIndirect; 
 typedef std::shared_ptr<AsmCode> PAsmCode; 
-typedef std::shared_ptr<AsmCmd> PAsmCmd; 
-typedef std::shared_ptr<AsmCmd0> PAsmCmd0; 
-typedef std::shared_ptr<AsmCmd1> PAsmCmd1; 
-typedef std::shared_ptr<AsmCmd2> PAsmCmd2; 
-typedef std::shared_ptr<AsmComment> PAsmComment; 
 typedef std::shared_ptr<AsmVar> PAsmVar;
 typedef std::shared_ptr<AsmVarString> PAsmVarString;
+typedef std::shared_ptr<AsmVarInt> PAsmVarInt;
+typedef std::shared_ptr<AsmVarFloat> PAsmVarFloat;
+typedef std::shared_ptr<AsmVarArray> PAsmVarArray;
+typedef std::shared_ptr<AsmVarRecord> PAsmVarRecord;
+typedef std::shared_ptr<AsmVarBss> PAsmVarBss;
 typedef std::shared_ptr<AsmLabel> PAsmLabel;
-typedef std::shared_ptr<AsmRawInt> PAsmRawInt;
 
 struct Pos {
 	bool operator==(const Pos& other) const {
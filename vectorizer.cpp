@@ -0,0 +1,378 @@
+#include "vectorizer.h"
+#include "symbol.h"
+#include "rangecheck.h"
+
+using namespace std;
+
+Vectorizer::Mode Vectorizer::mode = Vectorizer::OFF;
+
+/// registers holding array start addresses during the vector loop
+static const vector<Register> base_regs = {R9, R10, R11, R12, R13, R14, R15, RBX, RSI, RDI};
+static const vector<Register> xmm_regs = {XMM0, XMM1, XMM2, XMM3, XMM4, XMM5, XMM6, XMM7,
+                                          XMM8, XMM9, XMM10, XMM11, XMM12, XMM13, XMM14, XMM15};
+static const int vreg_count = 16;
+
+Vectorizer::Vectorizer(NodeStmtFor& loop) :
+	m_loop(loop) {}
+
+bool Vectorizer::generate(AsmCode& ac, AsmLabel end) {
+	if (!m_analyze()) {
+		return false;
+	}
+	AsmLabel _vinit, _vloop, _vdone, _store_end, _store_scalar;
+	/// init: low, high, invariants and array addresses are computed once
+	m_loop.low->generate(ac);
+	m_loop.high->generate(ac);
+	for (PNodeExpression inv: m_invariant_order) {
+		inv->generate(ac);
+		inv->exprtype()->gen_typecast(ac, m_elem_type);
+	}
+	for (const Stream& b: m_bases) {
+		b.base->generate_lvalue(ac);
+	}
+	for (int i = m_bases.size() - 1; i >= 0; i--) {
+		ac << AsmCmd1{POPQ, base_regs[i]};
+	}
+	for (int i = m_invariant_order.size() - 1; i >= 0; i--) {
+		ac << AsmCmd1{POPQ, RAX}
+		   << AsmCmd2{MOVQ, RAX, xmm_regs[i]};
+		if (mode == AVX2) {
+			ac << AsmCmd2{(m_is_float ? VBROADCASTSD : VPBROADCASTQ), xmm_regs[i], m_vreg(i)};
+		} else {
+			ac << AsmCmd2{(m_is_float ? UNPCKLPD : PUNPCKLQDQ), xmm_regs[i], xmm_regs[i]};
+		}
+	}
+	/// registers stay live through the loop,
+	/// the label keeps the optimizer from folding their loads into the first use
+	ac << AsmCmd1{POPQ, RDX}
+	   << AsmCmd1{POPQ, RCX}
+	   << _vinit
+	/// pre-check
+	   << AsmCmd2{CMPQ, RDX, RCX}
+	   << AsmCmd1{JG, _store_end};
+	int64_t test_low, test_high;
+	if (RangeChecks::enabled && RangeChecks::loop_test(m_loop, test_low, test_high)) {
+		RangeChecks::gen_test(ac, RCX, test_low, test_high, R8);
+		RangeChecks::gen_test(ac, RDX, test_low, test_high, R8);
+	}
+	/// run-time alias checks: 0 < dst - src < vector size means
+	/// a store would overwrite an element that has not been loaded yet
+	for (const pair<NodeExpression* const, Stream>& p: m_streams) {
+		const Stream& s = p.second;
+		if (s.base_id == m_dest.base_id || (!m_may_alias(s) && !m_may_alias(m_dest))) {
+			continue;
+		}
+		ac << AsmCmd2{MOVQ, base_regs[m_dest.base_id], RAX}
+		   << AsmCmd2{SUBQ, base_regs[s.base_id], RAX}
+		   << AsmCmd2{ADDQ, m_dest.disp - s.disp - 1, RAX}
+		   << AsmCmd2{CMPQ, (int64_t)(m_width*m_elem_type->size() - 1), RAX}
+		   << AsmCmd1{JB, _store_scalar};
+	}
+	/// vector loop
+	ac << _vloop
+	   << AsmCmd2{LEAQ, AsmOffs{(int64_t)(m_width - 1), RCX}, RAX}
+	   << AsmCmd2{CMPQ, RDX, RAX}
+	   << AsmCmd1{JG, _vdone};
+	int r = m_gen(ac, m_assign->right);
+	ac << AsmCmd2{(mode == AVX2 ? (m_is_float ? VMOVUPD : VMOVDQU) : (m_is_float ? MOVUPD : MOVDQU)),
+	              m_vreg(r), AsmOffs{m_dest.disp, base_regs[m_dest.base_id], RCX, 8}};
+	m_free(r);
+	ac << AsmCmd2{ADDQ, (int64_t)m_width, RCX}
+	   << AsmCmd1{JMP, _vloop}
+	/// remainder goes to the scalar loop
+	   << _vdone
+	   << AsmCmd2{CMPQ, RDX, RCX}
+	   << AsmCmd1{JLE, _store_scalar}
+	   << AsmCmd2{MOVQ, RDX, RCX}
+	   << _store_end;
+	m_store_iter(ac);
+	ac << AsmCmd1{JMP, end}
+	   << _store_scalar;
+	m_store_iter(ac);
+	return true;
+}
+
+bool Vectorizer::m_analyze() {
+	if (mode == OFF || !m_loop.is_inc) {
+		return false;
+	}
+	PNodeStmt body = m_loop.stmt;
+	PNodeStmtBlock block = dynamic_pointer_cast<NodeStmtBlock>(body);
+	if (block) {
+		if (block->stmts.size() != 1) {
+			return false;
+		}
+		body = block->stmts[0];
+	}
+	m_assign = dynamic_pointer_cast<NodeStmtAssign>(body);
+	if (!m_assign || m_assign->operation != Token::OP_ASSIGN) {
+		return false;
+	}
+	PNodeArrayAccess dest = dynamic_pointer_cast<NodeArrayAccess>(m_assign->left);
+	if (!dest) {
+		return false;
+	}
+	m_elem_type = dest->exprtype();
+	m_is_float = (bool)dynamic_pointer_cast<SymbolTypeFloat>(m_elem_type);
+	if (!m_is_float && !dynamic_pointer_cast<SymbolTypeInt>(m_elem_type)) {
+		return false;
+	}
+	if (!m_stream(dest, m_dest) || !m_is_invariant(m_loop.high) || !m_is_vectorizable(m_assign->right)) {
+		return false;
+	}
+	/// a[i] := a[i - 1] reads what the previous iteration stored
+	for (const pair<NodeExpression* const, Stream>& p: m_streams) {
+		if (p.second.base_id == m_dest.base_id && p.second.offset < m_dest.offset) {
+			return false;
+		}
+	}
+	m_first_temp = m_next_vreg = m_invariant_order.size();
+	if (m_bases.size() > base_regs.size() || m_first_temp + m_need(m_assign->right) > vreg_count) {
+		return false;
+	}
+	m_width = (mode == AVX2 ? 4 : 2);
+	return true;
+}
+
+/// pointers and VAR parameters may refer to any array
+bool Vectorizer::m_may_alias(const Stream& s) const {
+	return s.is_deref || s.symbol->is_var;
+}
+
+bool Vectorizer::m_is_iter(PNodeExpression e) {
+	PNodeVariable var = dynamic_pointer_cast<NodeVariable>(e);
+	return var && var->symbol == m_loop.iter_var->symbol;
+}
+
+bool Vectorizer::m_is_invariant(PNodeExpression e) {
+	if (dynamic_pointer_cast<NodeInteger>(e) || dynamic_pointer_cast<NodeFloat>(e)) {
+		return true;
+	}
+	PNodeVariable var = dynamic_pointer_cast<NodeVariable>(e);
+	if (var) {
+		return !m_is_iter(var) && (dynamic_pointer_cast<SymbolTypeInt>(var->exprtype())
+		                           || dynamic_pointer_cast<SymbolTypeFloat>(var->exprtype()));
+	}
+	PNodeUnaryOperator un = dynamic_pointer_cast<NodeUnaryOperator>(e);
+	if (un) {
+		return un->operation == Token::OP_MINUS && m_is_invariant(un->node);
+	}
+	PNodeBinaryOperator bin = dynamic_pointer_cast<NodeBinaryOperator>(e);
+	if (bin && !dynamic_pointer_cast<NodeStmtAssign>(e)) {
+		switch (bin->operation) {
+			case Token::OP_PLUS:
+			case Token::OP_MINUS:
+			case Token::OP_MULT:
+			case Token::OP_DIV_SLASH:
+				return m_is_invariant(bin->left) && m_is_invariant(bin->right);
+			default:
+				return false;
+		}
+	}
+	return false;
+}
+
+bool Vectorizer::m_stream(PNodeExpression e, Stream& s) {
+	PNodeArrayAccess acc = dynamic_pointer_cast<NodeArrayAccess>(e);
+	if (!acc || acc->index->arglist.size() != 1) {
+		return false;
+	}
+	PSymbolTypeArray arr = dynamic_pointer_cast<SymbolTypeArray>(acc->array->exprtype());
+	if (!arr || arr->bounds.size() != 1 || !(arr->type == m_elem_type)) {
+		return false;
+	}
+	/// array start address: a variable or a dereferenced pointer variable
+	PNodeVariable var = dynamic_pointer_cast<NodeVariable>(acc->array);
+	PNodeUnaryOperator un = dynamic_pointer_cast<NodeUnaryOperator>(acc->array);
+	if (var) {
+		s.is_deref = false;
+	} else if (un && un->operation == Token::OP_DEREFERENCE && (var = dynamic_pointer_cast<NodeVariable>(un->node))) {
+		s.is_deref = true;
+	} else {
+		return false;
+	}
+	s.base = acc->array;
+	s.symbol = var->symbol;
+	/// i, i + c, c + i, i - c
+	PNodeExpression idx = acc->index->arglist[0];
+	PNodeBinaryOperator bin = dynamic_pointer_cast<NodeBinaryOperator>(idx);
+	if (m_is_iter(idx)) {
+		s.offset = 0;
+	} else if (bin && (bin->operation == Token::OP_PLUS || bin->operation == Token::OP_MINUS)) {
+		PNodeInteger left = dynamic_pointer_cast<NodeInteger>(bin->left);
+		PNodeInteger right = dynamic_pointer_cast<NodeInteger>(bin->right);
+		if (m_is_iter(bin->left) && right) {
+			s.offset = bin->operation == Token::OP_PLUS ? right->value : -right->value;
+		} else if (m_is_iter(bin->right) && left && bin->operation == Token::OP_PLUS) {
+			s.offset = left->value;
+		} else {
+			return false;
+		}
+	} else {
+		return false;
+	}
+	s.disp = (s.offset - arr->bounds[0].first)*m_elem_type->size();
+	for (s.base_id = 0; s.base_id < m_bases.size(); s.base_id++) {
+		const Stream& b = m_bases[s.base_id];
+		if (b.symbol == s.symbol && b.is_deref == s.is_deref) {
+			return true;
+		}
+	}
+	m_bases.push_back(s);
+	return true;
+}
+
+bool Vectorizer::m_is_vectorizable(PNodeExpression e) {
+	if (m_is_invariant(e)) {
+		if (!m_invariants.count(e.get())) {
+			m_invariants[e.get()] = m_invariant_order.size();
+			m_invariant_order.push_back(e);
+		}
+		return true;
+	}
+	Stream s;
+	if (m_stream(e, s)) {
+		m_streams[e.get()] = s;
+		return true;
+	}
+	if (!(e->exprtype() == m_elem_type)) {
+		return false;
+	}
+	PNodeUnaryOperator un = dynamic_pointer_cast<NodeUnaryOperator>(e);
+	if (un) {
+		return un->operation == Token::OP_MINUS && m_is_vectorizable(un->node);
+	}
+	PNodeBinaryOperator bin = dynamic_pointer_cast<NodeBinaryOperator>(e);
+	if (!bin || dynamic_pointer_cast<NodeStmtAssign>(e)) {
+		return false;
+	}
+	switch (bin->operation) {
+		case Token::OP_PLUS:
+		case Token::OP_MINUS:
+			break;
+		/// there is no packed 64-bit integer multiplication in SSE2/AVX2
+		case Token::OP_MULT:
+		case Token::OP_DIV_SLASH:
+			if (!m_is_float) {
+				return false;
+			}
+			break;
+		default:
+			return false;
+	}
+	return m_is_vectorizable(bin->left) && m_is_vectorizable(bin->right);
+}
+
+int Vectorizer::m_need(PNodeExpression e) {
+	if (m_invariants.count(e.get()) || m_streams.count(e.get())) {
+		return 1;
+	}
+	PNodeUnaryOperator un = dynamic_pointer_cast<NodeUnaryOperator>(e);
+	if (un) {
+		return 1 + m_need(un->node);
+	}
+	PNodeBinaryOperator bin = dynamic_pointer_cast<NodeBinaryOperator>(e);
+	int right = m_invariants.count(bin->right.get()) ? 0 : 1 + m_need(bin->right);
+	return max(m_need(bin->left), right);
+}
+
+/// returns the vector register holding the value;
+/// registers below m_first_temp are broadcast invariants and must not be changed
+int Vectorizer::m_gen(AsmCode& ac, PNodeExpression e) {
+	auto inv = m_invariants.find(e.get());
+	if (inv != m_invariants.end()) {
+		return inv->second;
+	}
+	auto st = m_streams.find(e.get());
+	if (st != m_streams.end()) {
+		int t = m_alloc();
+		ac << AsmCmd2{(mode == AVX2 ? (m_is_float ? VMOVUPD : VMOVDQU) : (m_is_float ? MOVUPD : MOVDQU)),
+		              AsmOffs{st->second.disp, base_regs[st->second.base_id], RCX, 8}, m_vreg(t)};
+		return t;
+	}
+	PNodeUnaryOperator un = dynamic_pointer_cast<NodeUnaryOperator>(e);
+	if (un) {
+		int t = m_alloc();
+		if (mode == AVX2) {
+			ac << AsmCmd3{m_zero(), m_vreg(t), m_vreg(t), m_vreg(t)};
+		} else {
+			ac << AsmCmd2{m_zero(), m_vreg(t), m_vreg(t)};
+		}
+		int x = m_gen(ac, un->node);
+		if (mode == AVX2) {
+			ac << AsmCmd3{m_op(Token::OP_MINUS), m_vreg(x), m_vreg(t), m_vreg(t)};
+		} else {
+			ac << AsmCmd2{m_op(Token::OP_MINUS), m_vreg(x), m_vreg(t)};
+		}
+		m_free(x);
+		return t;
+	}
+	PNodeBinaryOperator bin = dynamic_pointer_cast<NodeBinaryOperator>(e);
+	int l = m_gen(ac, bin->left);
+	if (l < m_first_temp) {
+		int t = m_alloc();
+		ac << AsmCmd2{m_move(), m_vreg(l), m_vreg(t)};
+		l = t;
+	}
+	int r = m_gen(ac, bin->right);
+	if (mode == AVX2) {
+		ac << AsmCmd3{m_op(bin->operation), m_vreg(r), m_vreg(l), m_vreg(l)};
+	} else {
+		ac << AsmCmd2{m_op(bin->operation), m_vreg(r), m_vreg(l)};
+	}
+	m_free(r);
+	return l;
+}
+
+int Vectorizer::m_alloc() {
+	return m_next_vreg++;
+}
+
+void Vectorizer::m_free(int r) {
+	if (r >= m_first_temp) {
+		m_next_vreg--;
+	}
+}
+
+void Vectorizer::m_store_iter(AsmCode& ac) {
+	if (mode == AVX2) {
+		ac << AsmCmd0{VZEROUPPER};
+	}
+	ac << AsmCmd1{PUSHQ, RCX};
+	m_loop.iter_var->generate_lvalue(ac);
+	m_loop.iter_var->generate_assign(ac);
+}
+
+Register Vectorizer::m_vreg(int n) const {
+	return mode == AVX2 ? (Register)(YMM0 + n) : xmm_regs.at(n);
+}
+
+Opcode Vectorizer::m_op(Token::Operator op) const {
+	bool avx = mode == AVX2;
+	switch (op) {
+		case Token::OP_PLUS:
+			return m_is_float ? (avx ? VADDPD : ADDPD) : (avx ? VPADDQ : PADDQ);
+		case Token::OP_MINUS:
+			return m_is_float ? (avx ? VSUBPD : SUBPD) : (avx ? VPSUBQ : PSUBQ);
+		case Token::OP_MULT:
+			return avx ? VMULPD : MULPD;
+		case Token::OP_DIV_SLASH:
+			return avx ? VDIVPD : DIVPD;
+		default:
+			return NONE;
+	}
+}
+
+Opcode Vectorizer::m_move() const {
+	if (mode == AVX2) {
+		return m_is_float ? VMOVAPD : VMOVDQA;
+	}
+	return m_is_float ? MOVAPD : MOVDQA;
+}
+
+Opcode Vectorizer::m_zero() const {
+	if (mode == AVX2) {
+		return m_is_float ? VXORPD : VPXOR;
+	}
+	return m_is_float ? XORPD : PXOR;
+}
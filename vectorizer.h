@@ -0,0 +1,67 @@
+#ifndef VECTORIZER_H
+#define VECTORIZER_H
+
+#include <vector>
+#include <map>
+#include "node.h"
+#include "asmcode.h"
+
+/// Packed code for innermost loops of the form
+///     for i := low to high do a[i + c] := <expr over b[i + d] and invariants>
+/// over one-dimensional INTEGER or FLOAT arrays.
+/// The vector loop runs while a whole vector fits, the remainder is left to the scalar loop.
+class Vectorizer {
+public:
+	enum Mode {
+		OFF,
+		SSE2,
+		AVX2
+	};
+	static Mode mode;
+
+	Vectorizer(NodeStmtFor&);
+	/// false if the loop does not fit; nothing is emitted then.
+	/// Otherwise either jumps to end or falls through to the scalar body
+	/// with the iteration variable stored and not greater than high.
+	bool generate(AsmCode&, AsmLabel end);
+private:
+	struct Stream {
+		PNodeExpression base;
+		PSymbolVariable symbol; /// array variable or pointer variable
+		bool is_deref;
+		int64_t offset;   /// index offset from the iteration variable
+		int64_t disp;     /// (offset - low bound) * element size
+		size_t base_id;
+	};
+	bool m_analyze();
+	bool m_is_invariant(PNodeExpression);
+	bool m_is_vectorizable(PNodeExpression);
+	bool m_stream(PNodeExpression, Stream&);
+	bool m_is_iter(PNodeExpression);
+	bool m_may_alias(const Stream&) const;
+	int  m_need(PNodeExpression);
+
+	int  m_gen(AsmCode&, PNodeExpression);
+	int  m_alloc();
+	void m_free(int);
+	void m_store_iter(AsmCode&);
+	Register m_vreg(int) const;
+	Opcode m_op(Token::Operator) const;
+	Opcode m_move() const;
+	Opcode m_zero() const;
+
+	NodeStmtFor& m_loop;
+	PNodeStmtAssign m_assign;
+	PSymbolType m_elem_type;
+	bool m_is_float = false;
+	int m_width = 0;
+	Stream m_dest;
+	std::vector<Stream> m_bases;
+	std::map<NodeExpression*, Stream> m_streams;
+	std::map<NodeExpression*, int> m_invariants;
+	std::vector<PNodeExpression> m_invariant_order;
+	int m_next_vreg = 0;
+	int m_first_temp = 0;
+};
+
+#endif // VECTORIZER_H